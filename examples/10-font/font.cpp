@@ -290,6 +290,10 @@ public:
 				bgfx::setViewRect(0, 0, 0, uint16_t(m_width), uint16_t(m_height) );
 			}
 
+			// Advance glyph cache LRU, so that glyphs unused since last
+			// frame can be recycled.
+			m_fontManager->update();
+
 			// Submit the debug text.
 			m_textBufferManager->submitTextBuffer(m_transientText, 0);
 
@@ -293,6 +293,10 @@ public:
 			// Set model matrix for rendering.
 			bgfx::setTransform(tmpMat3);
 
+			// Advance glyph cache LRU, so that glyphs unused since last
+			// frame can be recycled.
+			m_fontManager->update();
+
 			// Draw your text.
 			m_textBufferManager->submitTextBuffer(m_scrollableBuffer, 0);
 
@@ -1461,6 +1461,28 @@ public:
 
 			showExampleDialog(this);
 
+			NVGdrawStats stats;
+			nvgGetDrawStats(m_nvg, &stats);
+
+			ImGui::SetNextWindowPos(
+				  ImVec2(m_width - m_width / 5.0f - 10.0f, 10.0f)
+				, ImGuiCond_FirstUseEver
+				);
+			ImGui::SetNextWindowSize(
+				  ImVec2(m_width / 5.0f, m_height / 6.0f)
+				, ImGuiCond_FirstUseEver
+				);
+			ImGui::Begin("Stats"
+				, NULL
+				, 0
+				);
+
+			ImGui::Text("Calls: %u", stats.numCalls);
+			ImGui::Text("Draws: %u (unmerged %u)", stats.numDraws, stats.numDrawsUnmerged);
+			ImGui::Text("Uniforms: %u (unmerged %u)", stats.numUniforms, stats.numUniformsUnmerged);
+
+			ImGui::End();
+
 			imguiEndFrame();
 
 			int64_t now = bx::getHPCounter();
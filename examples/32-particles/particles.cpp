@@ -249,6 +249,11 @@ public:
 		init.resolution.width  = m_width;
 		init.resolution.height = m_height;
 		init.resolution.reset  = m_reset;
+
+		// Benchmark emitter needs room for 128K particles, 4 vertices and
+		// 6 32-bit indices each.
+		init.limits.transientVbSize = 32<<20;
+		init.limits.transientIbSize =  8<<20;
 		bgfx::init(init);
 
 		// Enable m_debug text.
@@ -264,14 +269,14 @@ public:
 
 		ddInit();
 
-		psInit();
+		psInit(64, NULL, 3);
 
 		bimg::ImageContainer* image = imageLoad(
 			  "textures/particle.ktx"
 			, bgfx::TextureFormat::BGRA8
 			);
 
-		EmitterSpriteHandle sprite = psCreateSprite(
+		m_sprite = psCreateSprite(
 				  uint16_t(image->m_width)
 				, uint16_t(image->m_height)
 				, image->m_data
@@ -282,10 +287,12 @@ public:
 		for (uint32_t ii = 0; ii < BX_COUNTOF(m_emitter); ++ii)
 		{
 			m_emitter[ii].create();
-			m_emitter[ii].m_uniforms.m_handle = sprite;
+			m_emitter[ii].m_uniforms.m_handle = m_sprite;
 			m_emitter[ii].update();
 		}
 
+		m_benchmark = { UINT16_MAX };
+
 		imguiCreate();
 
 		cameraCreate();
@@ -303,6 +310,11 @@ public:
 			m_emitter[ii].destroy();
 		}
 
+		if (isValid(m_benchmark) )
+		{
+			psDestroyEmitter(m_benchmark);
+		}
+
 		psShutdown();
 
 		ddShutdown();
@@ -383,6 +395,45 @@ public:
 			static bool showBounds;
 			ImGui::Checkbox("Show bounds", &showBounds);
 
+			bool benchmark = isValid(m_benchmark);
+			if (ImGui::Checkbox("Benchmark (128K particles)", &benchmark) )
+			{
+				if (benchmark)
+				{
+					m_benchmark = psCreateEmitter(EmitterShape::Sphere, EmitterDirection::Outward, 128<<10);
+
+					EmitterUniforms uniforms;
+					uniforms.reset();
+					uniforms.m_handle = m_sprite;
+					uniforms.m_particlesPerSecond = 128<<10;
+					psUpdateEmitter(m_benchmark, &uniforms);
+				}
+				else
+				{
+					psDestroyEmitter(m_benchmark);
+					m_benchmark = { UINT16_MAX };
+				}
+			}
+
+			{
+				ParticleSystemStats stats;
+				psGetStats(stats);
+
+				const double toMs = 1000.0/freq;
+				const double updateMs = double(stats.m_updateTime)*toMs;
+				const double renderMs = double(stats.m_renderTime)*toMs;
+
+				ImGui::Text("Particles: %d", stats.m_numParticles);
+				ImGui::Text("Update: %7.3f [ms] %8.0f [particles/ms]"
+					, updateMs
+					, 0.0 < updateMs ? stats.m_numParticles/updateMs : 0.0
+					);
+				ImGui::Text("Render: %7.3f [ms] %8.0f [particles/ms]"
+					, renderMs
+					, 0.0 < renderMs ? stats.m_numParticles/renderMs : 0.0
+					);
+			}
+
 			ImGui::Text("Emitter:");
 			static int currentEmitter = 0;
 			for (uint32_t ii = 0; ii < BX_COUNTOF(m_emitter); ++ii)
@@ -448,6 +499,9 @@ public:
 	uint32_t m_reset;
 
 	Emitter m_emitter[4];
+
+	EmitterSpriteHandle m_sprite;
+	EmitterHandle       m_benchmark;
 };
 
 } // namespace
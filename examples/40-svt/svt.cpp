@@ -17,7 +17,7 @@
 #include "bgfx_utils.h"
 #include "imgui/imgui.h"
 #include "camera.h"
-#include "vt.h"
+#include "vt/vt.h"
 
 namespace
 {
@@ -60,6 +60,26 @@ static const uint16_t s_planeIndices[] =
 	1, 3, 2,
 };
 
+static const bgfx::TextureFormat::Enum s_tileFormats[] =
+{
+	bgfx::TextureFormat::BGRA8,
+	bgfx::TextureFormat::BC1,
+	bgfx::TextureFormat::BC3,
+	bgfx::TextureFormat::BC7,
+};
+
+static const char* s_tileFormatNames[] =
+{
+	"BGRA8",
+	"BC1",
+	"BC3",
+	"BC7",
+};
+BX_STATIC_ASSERT(BX_COUNTOF(s_tileFormats) == BX_COUNTOF(s_tileFormatNames) );
+
+// Atlas memory budget, same as 2048x2048 BGRA8 atlas
+static const uint32_t s_atlasMemorySize = 2048 * 2048 * 4;
+
 class ExampleSVT : public entry::AppI
 {
 public:
@@ -138,24 +158,52 @@ public:
 
 		// Create Virtual texture info
 		m_vti = new vt::VirtualTextureInfo();
+
+		// Create virtual texture and feedback buffer
+		m_tileFormat = 0;
+		m_tileDataFile = NULL;
+		m_vt = NULL;
+		createVirtualTexture();
+		m_feedbackBuffer = new vt::FeedbackBuffer(m_vti, 64, 64);
+
+	}
+
+	void createVirtualTexture()
+	{
+		const bgfx::TextureFormat::Enum format = s_tileFormats[m_tileFormat];
+
 		m_vti->m_virtualTextureSize = 8192; // The actual size will be read from the tile data file
 		m_vti->m_tileSize = 128;
 		m_vti->m_borderSize = 1;
+		m_vti->m_format = format;
 
-		// Generate tile data file (if not yet created)
+		// Generate tile data file, only pages which changed since it was created are rebuilt
 		{
 			vt::TileGenerator tileGenerator(m_vti);
 			tileGenerator.generate("textures/8k_mars.jpg");
 		}
 
 		// Load tile data file
-		auto tileDataFile = new vt::TileDataFile("temp/8k_mars.vt", m_vti);
-		tileDataFile->readInfo();
+		m_tileDataFile = new vt::TileDataFile(vt::TileGenerator::getFilePath("textures/8k_mars.jpg", format), m_vti);
+		m_tileDataFile->readInfo();
+
+		// Atlas size is selected so that every format uses the same amount of memory
+		const bgfx::TextureFormat::Enum atlasFormat = vt::VirtualTexture::getAtlasFormat(m_vti->m_format);
+		const float bytesPerTexel = bimg::getBitsPerPixel(bimg::TextureFormat::Enum(atlasFormat) ) / 8.0f;
+		const int atlasSize = bx::min(
+			  int(bx::sqrt(float(s_atlasMemorySize) / bytesPerTexel) )
+			, int(m_caps->limits.maxTextureSize)
+			);
 
-		// Create virtual texture and feedback buffer
-		m_vt = new vt::VirtualTexture(tileDataFile, m_vti, 2048, 1);
-		m_feedbackBuffer = new vt::FeedbackBuffer(m_vti, 64, 64);
+		m_vt = new vt::VirtualTexture(m_tileDataFile, m_vti, atlasSize, 1);
+	}
 
+	void destroyVirtualTexture()
+	{
+		delete m_vt;
+		delete m_tileDataFile;
+		m_vt = NULL;
+		m_tileDataFile = NULL;
 	}
 
 	virtual int shutdown() override
@@ -172,9 +220,9 @@ public:
 		bgfx::destroy(m_vt_unlit);
 		bgfx::destroy(m_vt_mip);
 
-		delete m_vti;
-		delete m_vt;
+		destroyVirtualTexture();
 		delete m_feedbackBuffer;
+		delete m_vti;
 
 		// Shutdown bgfx.
 		bgfx::shutdown();
@@ -247,6 +295,21 @@ public:
 				{
 					m_vt->enableColorMipLevels(colorMipLevels);
 				}
+				if (ImGui::Combo("Tile format", &m_tileFormat, s_tileFormatNames, BX_COUNTOF(s_tileFormatNames) ) )
+				{
+					// Tile data file is generated on first use, this might take a while
+					const int uploadsPerFrame = m_vt->getUploadsPerFrame();
+					const bool showBorders = m_vt->isShowBoardersEnabled();
+					const bool colorMipLevels = m_vt->isColorMipLevelsEnabled();
+
+					destroyVirtualTexture();
+					createVirtualTexture();
+
+					m_vt->setUploadsPerFrame(uploadsPerFrame);
+					m_vt->enableShowBoarders(showBorders);
+					m_vt->enableColorMipLevels(colorMipLevels);
+				}
+
 				auto uploadsperframe = m_vt->getUploadsPerFrame();
 				if (ImGui::InputInt("Updates per frame", &uploadsperframe, 1, 2))
 				{
@@ -254,6 +317,16 @@ public:
 					m_vt->setUploadsPerFrame(uploadsperframe);
 				}
 
+				const vt::PageLoaderStats& loaderStats = m_vt->getLoaderStats();
+				ImGui::Text("Queue depth: %d (max %d)", loaderStats.m_queueDepth, loaderStats.m_queueDepthMax);
+				ImGui::Text("Loading: %d, pending: %d", loaderStats.m_loading, loaderStats.m_pending);
+				ImGui::Text("Uploaded: %d (total %d)", loaderStats.m_uploaded, loaderStats.m_totalUploaded);
+				ImGui::Text("Dropped: %d", loaderStats.m_totalDropped);
+				ImGui::Text("Latency: %.2f ms avg, %.2f ms max", loaderStats.m_latencyAvg, loaderStats.m_latencyMax);
+				ImGui::Text("Streamed: %.2f MB/s (total %.1f MB)", loaderStats.m_streamed, double(loaderStats.m_totalBytesRead) / (1024.0 * 1024.0) );
+				ImGui::Text("Atlas: %s, %.1f MB", bimg::getName(bimg::TextureFormat::Enum(m_vt->getAtlasFormat() ) ), m_vt->getAtlasMemorySize() / (1024.0f * 1024.0f) );
+				ImGui::Text("Resident: %d / %d pages", m_vt->getResidentCount(), m_vt->getAtlasCapacity() );
+
 				ImGui::ImageButton(m_vt->getAtlastTexture(), ImVec2(m_width / 5.0f - 16.0f, m_width / 5.0f - 16.0f));
 				ImGui::ImageButton(bgfx::getTexture(m_feedbackBuffer->getFrameBuffer()), ImVec2(m_width / 5.0f - 16.0f, m_width / 5.0f - 16.0f));
 
@@ -365,8 +438,11 @@ public:
 
 	bx::DefaultAllocator m_vtAllocator;
 	vt::VirtualTextureInfo* m_vti;
+	vt::TileDataFile* m_tileDataFile;
 	vt::VirtualTexture* m_vt;
 	vt::FeedbackBuffer* m_feedbackBuffer;
+
+	int32_t m_tileFormat;
 };
 
 } // namespace
@@ -20,6 +20,8 @@ namespace stl = tinystl;
 #include <meshoptimizer/src/meshoptimizer.h>
 
 #include "bgfx_utils.h"
+#include "culling.h"
+#include "occlusion.h"
 
 #include <bimg/decode.h>
 
@@ -96,10 +98,8 @@ static void* loadMem(bx::FileReaderI* _reader, bx::AllocatorI* _allocator, const
 	return NULL;
 }
 
-static bgfx::ShaderHandle loadShader(bx::FileReaderI* _reader, const char* _name)
+static void getShaderFilePath(char* _out, uint32_t _max, const char* _name, const char* _ext)
 {
-	char filePath[512];
-
 	const char* shaderPath = "???";
 
 	switch (bgfx::getRendererType() )
@@ -122,9 +122,15 @@ static bgfx::ShaderHandle loadShader(bx::FileReaderI* _reader, const char* _name
 		break;
 	}
 
-	bx::strCopy(filePath, BX_COUNTOF(filePath), shaderPath);
-	bx::strCat(filePath, BX_COUNTOF(filePath), _name);
-	bx::strCat(filePath, BX_COUNTOF(filePath), ".bin");
+	bx::strCopy(_out, _max, shaderPath);
+	bx::strCat(_out, _max, _name);
+	bx::strCat(_out, _max, _ext);
+}
+
+static bgfx::ShaderHandle loadShader(bx::FileReaderI* _reader, const char* _name)
+{
+	char filePath[512];
+	getShaderFilePath(filePath, BX_COUNTOF(filePath), _name, ".bin");
 
 	bgfx::ShaderHandle handle = bgfx::createShader(loadMem(_reader, filePath) );
 	bgfx::setName(handle, _name);
@@ -137,6 +143,111 @@ bgfx::ShaderHandle loadShader(const char* _name)
 	return loadShader(entry::getFileReader(), _name);
 }
 
+#define BGFX_CHUNK_MAGIC_SVA BX_MAKEFOURCC('S', 'V', 'A', 2)
+
+static bool isValidShaderVariants(const uint8_t* _data, uint32_t _size, uint32_t _numVariants, uint32_t _numBlobs)
+{
+	const uint64_t tableSize = 0
+		+ 3*sizeof(uint32_t)
+		+ uint64_t(_numVariants)*sizeof(uint32_t)
+		+ uint64_t(_numBlobs)*2*sizeof(uint32_t)
+		;
+
+	if (tableSize > _size)
+	{
+		return false;
+	}
+
+	const uint32_t* variants = (const uint32_t*)&_data[3*sizeof(uint32_t)];
+	const uint32_t* blobs    = &variants[_numVariants];
+
+	for (uint32_t ii = 0; ii < _numVariants; ++ii)
+	{
+		if (variants[ii] >= _numBlobs)
+		{
+			return false;
+		}
+	}
+
+	for (uint32_t ii = 0; ii < _numBlobs; ++ii)
+	{
+		const uint32_t offset = blobs[ii*2+0];
+		const uint32_t length = blobs[ii*2+1];
+
+		if (offset < tableSize
+		||  uint64_t(offset) + length > _size)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static uint32_t loadShaderVariants(bx::FileReaderI* _reader, const char* _name, bgfx::ShaderHandle* _handles, uint32_t _max)
+{
+	for (uint32_t ii = 0; ii < _max; ++ii)
+	{
+		_handles[ii] = BGFX_INVALID_HANDLE;
+	}
+
+	char filePath[512];
+	getShaderFilePath(filePath, BX_COUNTOF(filePath), _name, ".sva");
+
+	uint32_t size;
+	void* data = loadMem(_reader, entry::getAllocator(), filePath, &size);
+	if (NULL == data)
+	{
+		return 0;
+	}
+
+	bx::MemoryReader reader(data, size);
+	bx::Error err;
+
+	uint32_t magic = 0;
+	uint32_t numVariants = 0;
+	uint32_t numBlobs = 0;
+	bx::read(&reader, magic, &err);
+	bx::read(&reader, numVariants, &err);
+	bx::read(&reader, numBlobs, &err);
+
+	uint32_t num = 0;
+
+	if (err.isOk()
+	&&  BGFX_CHUNK_MAGIC_SVA == magic
+	&&  isValidShaderVariants( (const uint8_t*)data, size, numVariants, numBlobs) )
+	{
+		const uint32_t* variants = (const uint32_t*)&reader.getDataPtr()[0];
+		const uint32_t* blobs    = &variants[numVariants];
+
+		num = bx::min(numVariants, _max);
+
+		for (uint32_t ii = 0; ii < num; ++ii)
+		{
+			const uint32_t blob   = variants[ii];
+			const uint32_t offset = blobs[blob*2+0];
+			const uint32_t length = blobs[blob*2+1];
+
+			// Shaders with identical binary are deduplicated by bgfx, and
+			// returned handles are reference counted.
+			_handles[ii] = bgfx::createShader(bgfx::copy( (const uint8_t*)data + offset, length) );
+		}
+	}
+	else
+	{
+		DBG("Invalid shader variant archive %s.", filePath);
+	}
+
+	unload(data);
+
+	return num;
+}
+
+uint32_t loadShaderVariants(const char* _name, bgfx::ShaderHandle* _handles, uint32_t _max)
+{
+	return loadShaderVariants(entry::getFileReader(), _name, _handles, _max);
+}
+
 bgfx::ProgramHandle loadProgram(bx::FileReaderI* _reader, const char* _vsName, const char* _fsName)
 {
 	bgfx::ShaderHandle vsh = loadShader(_reader, _vsName);
@@ -573,28 +684,192 @@ void Mesh::unload()
 	m_groups.clear();
 }
 
-void Mesh::submit(bgfx::ViewId _id, bgfx::ProgramHandle _program, const float* _mtx, uint64_t _state) const
+uint32_t Mesh::cull(const Frustum& _frustum, const float* _mtx, MeshDrawArray& _draws) const
 {
-	if (BGFX_STATE_MASK == _state)
+	// Bounds are transformed and tested in batches, so that SIMD tests are used.
+	constexpr uint32_t kBatchSize = 64;
+
+	bx::Sphere spheres[kBatchSize];
+	uint32_t   visible[kBatchSize];
+	bx::Sphere primSpheres[kBatchSize];
+	uint32_t   primVisible[kBatchSize];
+
+	const uint32_t first = uint32_t(_draws.size() );
+	const uint32_t numGroups = uint32_t(m_groups.size() );
+
+	for (uint32_t base = 0; base < numGroups; base += kBatchSize)
 	{
-		_state = 0
-			| BGFX_STATE_WRITE_RGB
-			| BGFX_STATE_WRITE_A
-			| BGFX_STATE_WRITE_Z
-			| BGFX_STATE_DEPTH_TEST_LESS
-			| BGFX_STATE_CULL_CCW
-			| BGFX_STATE_MSAA
-			;
+		const uint32_t num = bx::min(numGroups - base, kBatchSize);
+
+		for (uint32_t ii = 0; ii < num; ++ii)
+		{
+			sphereTransform(spheres[ii], _mtx, m_groups[base + ii].m_sphere);
+		}
+
+		const uint32_t numVisible = cullSpheres(visible, _frustum, spheres, num);
+
+		for (uint32_t ii = 0; ii < numVisible; ++ii)
+		{
+			const uint32_t groupIdx = base + visible[ii];
+			const Group& group = m_groups[groupIdx];
+			const uint32_t numPrims = uint32_t(group.m_prims.size() );
+
+			if (1 >= numPrims)
+			{
+				const MeshDraw draw = { groupIdx, 0, UINT32_MAX };
+				_draws.push_back(draw);
+				continue;
+			}
+
+			for (uint32_t primBase = 0; primBase < numPrims; primBase += kBatchSize)
+			{
+				const uint32_t numBatch = bx::min(numPrims - primBase, kBatchSize);
+
+				for (uint32_t jj = 0; jj < numBatch; ++jj)
+				{
+					sphereTransform(primSpheres[jj], _mtx, group.m_prims[primBase + jj].m_sphere);
+				}
+
+				const uint32_t numPrimVisible = cullSpheres(primVisible, _frustum, primSpheres, numBatch);
+
+				for (uint32_t jj = 0; jj < numPrimVisible; ++jj)
+				{
+					const Primitive& prim = group.m_prims[primBase + primVisible[jj] ];
+
+					// Merge with previous range when primitives are adjacent in index buffer.
+					if (first != _draws.size() )
+					{
+						MeshDraw& last = _draws.back();
+
+						if (last.m_group == groupIdx
+						&&  last.m_startIndex + last.m_numIndices == prim.m_startIndex)
+						{
+							last.m_numIndices += prim.m_numIndices;
+							continue;
+						}
+					}
+
+					const MeshDraw draw = { groupIdx, prim.m_startIndex, prim.m_numIndices };
+					_draws.push_back(draw);
+				}
+			}
+		}
 	}
 
-	bgfx::setTransform(_mtx);
-	bgfx::setState(_state);
+	return uint32_t(_draws.size() ) - first;
+}
+
+void Mesh::rasterizeOccluder(OcclusionRasterizer& _rasterizer, const float* _mtx) const
+{
+	uint8_t num;
+	bgfx::AttribType::Enum type;
+	bool normalized;
+	bool asInt;
+	m_layout.decode(bgfx::Attrib::Position, num, type, normalized, asInt);
+
+	const bool isFloat = bgfx::AttribType::Float == type && 3 <= num;
+	const uint16_t stride = m_layout.getStride();
+
+	stl::vector<float> positions;
 
 	for (GroupArray::const_iterator it = m_groups.begin(), itEnd = m_groups.end(); it != itEnd; ++it)
 	{
 		const Group& group = *it;
 
-		bgfx::setIndexBuffer(group.m_ibh);
+		if (NULL == group.m_vertices
+		||  NULL == group.m_indices)
+		{
+			continue;
+		}
+
+		if (isFloat)
+		{
+			_rasterizer.addOccluder(
+				  &group.m_vertices[m_layout.getOffset(bgfx::Attrib::Position)]
+				, stride
+				, group.m_numVertices
+				, group.m_indices
+				, group.m_numIndices
+				, _mtx
+				);
+			continue;
+		}
+
+		// Rasterizer expects float positions, unpack other formats.
+		positions.resize(group.m_numVertices*3);
+
+		for (uint32_t ii = 0; ii < group.m_numVertices; ++ii)
+		{
+			float pos[4];
+			bgfx::vertexUnpack(pos, bgfx::Attrib::Position, m_layout, group.m_vertices, ii);
+			bx::memCopy(&positions[ii*3], pos, 3*sizeof(float) );
+		}
+
+		_rasterizer.addOccluder(
+			  positions.data()
+			, 3*sizeof(float)
+			, group.m_numVertices
+			, group.m_indices
+			, group.m_numIndices
+			, _mtx
+			);
+	}
+}
+
+uint32_t Mesh::cullOccluded(const OcclusionRasterizer& _rasterizer, const float* _mtx, MeshDraw* _draws, uint32_t _numDraws) const
+{
+	uint32_t num = 0;
+	uint32_t lastGroup = UINT32_MAX;
+	bool lastVisible = false;
+
+	for (uint32_t ii = 0; ii < _numDraws; ++ii)
+	{
+		const MeshDraw& draw = _draws[ii];
+
+		// Draws of the same group are adjacent, test group once.
+		if (lastGroup != draw.m_group)
+		{
+			lastGroup   = draw.m_group;
+			lastVisible = _rasterizer.isVisible(m_groups[draw.m_group].m_aabb, _mtx);
+		}
+
+		if (lastVisible)
+		{
+			_draws[num++] = draw;
+		}
+	}
+
+	return num;
+}
+
+void Mesh::submitGroups(bgfx::ViewId _id, bgfx::ProgramHandle _program, const MeshDraw* _draws, uint32_t _numDraws) const
+{
+	if (NULL == _draws)
+	{
+		for (GroupArray::const_iterator it = m_groups.begin(), itEnd = m_groups.end(); it != itEnd; ++it)
+		{
+			const Group& group = *it;
+
+			bgfx::setIndexBuffer(group.m_ibh);
+			bgfx::setVertexBuffer(0, group.m_vbh);
+			bgfx::submit(
+				  _id
+				, _program
+				, 0
+				, BGFX_DISCARD_INDEX_BUFFER
+				| BGFX_DISCARD_VERTEX_STREAMS
+				);
+		}
+
+		return;
+	}
+
+	for (uint32_t ii = 0; ii < _numDraws; ++ii)
+	{
+		const MeshDraw& draw = _draws[ii];
+		const Group& group = m_groups[draw.m_group];
+
+		bgfx::setIndexBuffer(group.m_ibh, draw.m_startIndex, draw.m_numIndices);
 		bgfx::setVertexBuffer(0, group.m_vbh);
 		bgfx::submit(
 			  _id
@@ -604,11 +879,31 @@ void Mesh::submit(bgfx::ViewId _id, bgfx::ProgramHandle _program, const float* _
 			| BGFX_DISCARD_VERTEX_STREAMS
 			);
 	}
+}
+
+void Mesh::submit(bgfx::ViewId _id, bgfx::ProgramHandle _program, const float* _mtx, uint64_t _state, const MeshDraw* _draws, uint32_t _numDraws) const
+{
+	if (BGFX_STATE_MASK == _state)
+	{
+		_state = 0
+			| BGFX_STATE_WRITE_RGB
+			| BGFX_STATE_WRITE_A
+			| BGFX_STATE_WRITE_Z
+			| BGFX_STATE_DEPTH_TEST_LESS
+			| BGFX_STATE_CULL_CCW
+			| BGFX_STATE_MSAA
+			;
+	}
+
+	bgfx::setTransform(_mtx);
+	bgfx::setState(_state);
+
+	submitGroups(_id, _program, _draws, _numDraws);
 
 	bgfx::discard();
 }
 
-void Mesh::submit(const MeshState*const* _state, uint8_t _numPasses, const float* _mtx, uint16_t _numMatrices) const
+void Mesh::submit(const MeshState*const* _state, uint8_t _numPasses, const float* _mtx, uint16_t _numMatrices, const MeshDraw* _draws, uint32_t _numDraws) const
 {
 	uint32_t cached = bgfx::setTransform(_mtx, _numMatrices);
 
@@ -630,20 +925,7 @@ void Mesh::submit(const MeshState*const* _state, uint8_t _numPasses, const float
 				);
 		}
 
-		for (GroupArray::const_iterator it = m_groups.begin(), itEnd = m_groups.end(); it != itEnd; ++it)
-		{
-			const Group& group = *it;
-
-			bgfx::setIndexBuffer(group.m_ibh);
-			bgfx::setVertexBuffer(0, group.m_vbh);
-			bgfx::submit(
-				  state.m_viewId
-				, state.m_program
-				, 0
-				, BGFX_DISCARD_INDEX_BUFFER
-				| BGFX_DISCARD_VERTEX_STREAMS
-				);
-		}
+		submitGroups(state.m_viewId, state.m_program, _draws, _numDraws);
 
 		bgfx::discard(0
 			| BGFX_DISCARD_BINDINGS
@@ -702,6 +984,31 @@ void meshSubmit(const Mesh* _mesh, const MeshState*const* _state, uint8_t _numPa
 	_mesh->submit(_state, _numPasses, _mtx, _numMatrices);
 }
 
+uint32_t meshCull(const Mesh* _mesh, const Frustum& _frustum, const float* _mtx, MeshDrawArray& _draws)
+{
+	return _mesh->cull(_frustum, _mtx, _draws);
+}
+
+void meshOccluder(const Mesh* _mesh, OcclusionRasterizer& _rasterizer, const float* _mtx)
+{
+	_mesh->rasterizeOccluder(_rasterizer, _mtx);
+}
+
+uint32_t meshOcclusionCull(const Mesh* _mesh, const OcclusionRasterizer& _rasterizer, const float* _mtx, MeshDraw* _draws, uint32_t _numDraws)
+{
+	return _mesh->cullOccluded(_rasterizer, _mtx, _draws, _numDraws);
+}
+
+void meshSubmit(const Mesh* _mesh, bgfx::ViewId _id, bgfx::ProgramHandle _program, const float* _mtx, const MeshDraw* _draws, uint32_t _numDraws, uint64_t _state)
+{
+	_mesh->submit(_id, _program, _mtx, _state, _draws, _numDraws);
+}
+
+void meshSubmit(const Mesh* _mesh, const MeshState*const* _state, uint8_t _numPasses, const float* _mtx, uint16_t _numMatrices, const MeshDraw* _draws, uint32_t _numDraws)
+{
+	_mesh->submit(_state, _numPasses, _mtx, _numMatrices, _draws, _numDraws);
+}
+
 struct RendererTypeRemap
 {
 	bx::StringView           name;
@@ -26,6 +26,17 @@ void unload(void* _ptr);
 ///
 bgfx::ShaderHandle loadShader(const char* _name);
 
+/// Load shader variant archive produced by `shaderc --variants` with single
+/// file read from `shaders/<renderer>/<_name>.sva`. Variant index is mixed
+/// radix number of manifest axis alternatives, where the first axis is the
+/// least significant digit.
+///
+/// @returns Number of shader handles written into `_handles`. Zero and
+///   all `_handles` set to `BGFX_INVALID_HANDLE` if archive is missing or
+///   corrupt.
+///
+uint32_t loadShaderVariants(const char* _name, bgfx::ShaderHandle* _handles, uint32_t _max);
+
 ///
 bgfx::ProgramHandle loadProgram(const char* _vsName, const char* _fsName);
 
@@ -117,12 +128,28 @@ struct Group
 };
 typedef stl::vector<Group> GroupArray;
 
+/// Visible index range of mesh group.
+struct MeshDraw
+{
+	uint32_t m_group;
+	uint32_t m_startIndex;
+	uint32_t m_numIndices;
+};
+typedef stl::vector<MeshDraw> MeshDrawArray;
+
+struct Frustum;
+class OcclusionRasterizer;
+
 struct Mesh
 {
 	void load(bx::ReaderSeekerI* _reader, bool _ramcopy);
 	void unload();
-	void submit(bgfx::ViewId _id, bgfx::ProgramHandle _program, const float* _mtx, uint64_t _state) const;
-	void submit(const MeshState*const* _state, uint8_t _numPasses, const float* _mtx, uint16_t _numMatrices) const;
+	uint32_t cull(const Frustum& _frustum, const float* _mtx, MeshDrawArray& _draws) const;
+	void submit(bgfx::ViewId _id, bgfx::ProgramHandle _program, const float* _mtx, uint64_t _state, const MeshDraw* _draws = NULL, uint32_t _numDraws = 0) const;
+	void submit(const MeshState*const* _state, uint8_t _numPasses, const float* _mtx, uint16_t _numMatrices, const MeshDraw* _draws = NULL, uint32_t _numDraws = 0) const;
+	void submitGroups(bgfx::ViewId _id, bgfx::ProgramHandle _program, const MeshDraw* _draws, uint32_t _numDraws) const;
+	void rasterizeOccluder(OcclusionRasterizer& _rasterizer, const float* _mtx) const;
+	uint32_t cullOccluded(const OcclusionRasterizer& _rasterizer, const float* _mtx, MeshDraw* _draws, uint32_t _numDraws) const;
 
 	bgfx::VertexLayout m_layout;
 	GroupArray m_groups;
@@ -146,6 +173,46 @@ void meshSubmit(const Mesh* _mesh, bgfx::ViewId _id, bgfx::ProgramHandle _progra
 ///
 void meshSubmit(const Mesh* _mesh, const MeshState*const* _state, uint8_t _numPasses, const float* _mtx, uint16_t _numMatrices = 1);
 
+/// Cull mesh groups against frustum, and primitives of groups which are
+/// visible. Visible index ranges are appended to `_draws`.
+///
+/// @param[in] _mesh Mesh.
+/// @param[in] _frustum Frustum, see `frustumInit` in `culling.h`.
+/// @param[in] _mtx Mesh transform.
+/// @param[out] _draws Visible index ranges.
+/// @returns Number of index ranges appended.
+///
+uint32_t meshCull(const Mesh* _mesh, const Frustum& _frustum, const float* _mtx, MeshDrawArray& _draws);
+
+/// Submit only index ranges returned by `meshCull`.
+///
+void meshSubmit(const Mesh* _mesh, bgfx::ViewId _id, bgfx::ProgramHandle _program, const float* _mtx, const MeshDraw* _draws, uint32_t _numDraws, uint64_t _state = BGFX_STATE_MASK);
+
+/// Submit only index ranges returned by `meshCull`.
+///
+void meshSubmit(const Mesh* _mesh, const MeshState*const* _state, uint8_t _numPasses, const float* _mtx, uint16_t _numMatrices, const MeshDraw* _draws, uint32_t _numDraws);
+
+/// Add mesh to software occlusion rasterizer as occluder. Mesh must be
+/// loaded with `_ramcopy` set, see `meshLoad`.
+///
+/// @param[in] _mesh Mesh.
+/// @param[in] _rasterizer Occlusion rasterizer, see `occlusion.h`.
+/// @param[in] _mtx Mesh transform.
+///
+void meshOccluder(const Mesh* _mesh, OcclusionRasterizer& _rasterizer, const float* _mtx);
+
+/// Remove index ranges whose group AABB is hidden behind rasterized
+/// occluders. Index ranges are compacted in place.
+///
+/// @param[in] _mesh Mesh.
+/// @param[in] _rasterizer Occlusion rasterizer, after `rasterize` was called.
+/// @param[in] _mtx Mesh transform.
+/// @param[in,out] _draws Index ranges returned by `meshCull`.
+/// @param[in] _numDraws Number of index ranges.
+/// @returns Number of visible index ranges.
+///
+uint32_t meshOcclusionCull(const Mesh* _mesh, const OcclusionRasterizer& _rasterizer, const float* _mtx, MeshDraw* _draws, uint32_t _numDraws);
+
 /// bgfx::RendererType::Enum to name.
 bx::StringView getName(bgfx::RendererType::Enum _type);
 
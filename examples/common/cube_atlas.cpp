@@ -250,7 +250,12 @@ struct Atlas::PackedLayer
 };
 
 Atlas::Atlas(uint16_t _textureSize, uint16_t _maxRegionsCount)
-	: m_usedLayers(0)
+	: m_lruHead(UINT16_MAX)
+	, m_lruTail(UINT16_MAX)
+	, m_frame(0)
+	, m_evictionCount(0)
+	, m_uploadCount(0)
+	, m_usedLayers(0)
 	, m_usedFaces(0)
 	, m_textureSize(_textureSize)
 	, m_regionCount(0)
@@ -268,6 +273,8 @@ Atlas::Atlas(uint16_t _textureSize, uint16_t _maxRegionsCount)
 	}
 
 	m_regions = new AtlasRegion[_maxRegionsCount];
+	initSlots(_maxRegionsCount);
+
 	m_textureBuffer = new uint8_t[ _textureSize * _textureSize * 6 * 4 ];
 	bx::memSet(m_textureBuffer, 0, _textureSize * _textureSize * 6 * 4);
 
@@ -279,7 +286,12 @@ Atlas::Atlas(uint16_t _textureSize, uint16_t _maxRegionsCount)
 }
 
 Atlas::Atlas(uint16_t _textureSize, const uint8_t* _textureBuffer, uint16_t _regionCount, const uint8_t* _regionBuffer, uint16_t _maxRegionsCount)
-	: m_usedLayers(6)
+	: m_lruHead(UINT16_MAX)
+	, m_lruTail(UINT16_MAX)
+	, m_frame(0)
+	, m_evictionCount(0)
+	, m_uploadCount(0)
+	, m_usedLayers(6)
 	, m_usedFaces(6)
 	, m_textureSize(_textureSize)
 	, m_regionCount(_regionCount)
@@ -295,6 +307,13 @@ Atlas::Atlas(uint16_t _textureSize, const uint8_t* _textureBuffer, uint16_t _reg
 	bx::memCopy(m_regions, _regionBuffer, _regionCount * sizeof(AtlasRegion) );
 	bx::memCopy(m_textureBuffer, _textureBuffer, getTextureBufferSize() );
 
+	// Serialized regions can't be recycled.
+	initSlots(_regionCount);
+	for (uint16_t ii = 0; ii < _regionCount; ++ii)
+	{
+		m_slots[ii].frame = UINT32_MAX;
+	}
+
 	m_textureHandle = bgfx::createTextureCube(_textureSize
 		, false
 		, 1
@@ -310,64 +329,260 @@ Atlas::~Atlas()
 
 	delete [] m_layers;
 	delete [] m_regions;
+	delete [] m_slots;
 	delete [] m_textureBuffer;
 }
 
-uint16_t Atlas::addRegion(uint16_t _width, uint16_t _height, const uint8_t* _bitmapBuffer, AtlasRegion::Type _type, uint16_t outline)
+void Atlas::initSlots(uint16_t _count)
 {
-	if (m_regionCount >= m_maxRegionCount)
+	m_slots = new RegionSlot[_count];
+	bx::memSet(m_slots, 0, _count * sizeof(RegionSlot) );
+
+	for (uint16_t ii = 0; ii < _count; ++ii)
 	{
-		return UINT16_MAX;
+		m_slots[ii].prev = UINT16_MAX;
+		m_slots[ii].next = UINT16_MAX;
 	}
 
-	uint16_t xx = 0;
-	uint16_t yy = 0;
+	for (uint32_t ii = 0; ii < 6; ++ii)
+	{
+		m_dirty[ii].x0 = UINT16_MAX;
+		m_dirty[ii].y0 = UINT16_MAX;
+		m_dirty[ii].x1 = 0;
+		m_dirty[ii].y1 = 0;
+	}
+}
+
+void Atlas::lruRemove(uint16_t _handle)
+{
+	RegionSlot& slot = m_slots[_handle];
+
+	if (UINT16_MAX != slot.prev)
+	{
+		m_slots[slot.prev].next = slot.next;
+	}
+	else if (m_lruHead == _handle)
+	{
+		m_lruHead = slot.next;
+	}
+
+	if (UINT16_MAX != slot.next)
+	{
+		m_slots[slot.next].prev = slot.prev;
+	}
+	else if (m_lruTail == _handle)
+	{
+		m_lruTail = slot.prev;
+	}
+
+	slot.prev = UINT16_MAX;
+	slot.next = UINT16_MAX;
+}
+
+void Atlas::lruPushFront(uint16_t _handle)
+{
+	RegionSlot& slot = m_slots[_handle];
+	slot.prev = UINT16_MAX;
+	slot.next = m_lruHead;
+
+	if (UINT16_MAX != m_lruHead)
+	{
+		m_slots[m_lruHead].prev = _handle;
+	}
+
+	m_lruHead = _handle;
+
+	if (UINT16_MAX == m_lruTail)
+	{
+		m_lruTail = _handle;
+	}
+}
+
+void Atlas::touchRegion(uint16_t _handle)
+{
+	RegionSlot& slot = m_slots[_handle];
+
+	if (UINT32_MAX == slot.frame)
+	{
+		return;
+	}
+
+	slot.frame = m_frame;
+
+	if (0 == slot.refCount
+	&&  m_lruHead != _handle)
+	{
+		lruRemove(_handle);
+		lruPushFront(_handle);
+	}
+}
+
+void Atlas::pinRegion(uint16_t _handle)
+{
+	lruRemove(_handle);
+	m_slots[_handle].frame = UINT32_MAX;
+}
+
+void Atlas::addRef(uint16_t _handle)
+{
+	RegionSlot& slot = m_slots[_handle];
+
+	// Referenced regions are taken out of the LRU, so they can't be evicted.
+	if (0 == slot.refCount++
+	&&  UINT32_MAX != slot.frame)
+	{
+		lruRemove(_handle);
+	}
+}
+
+void Atlas::release(uint16_t _handle)
+{
+	RegionSlot& slot = m_slots[_handle];
+	BX_ASSERT(0 < slot.refCount, "Atlas region %d is not referenced.", _handle);
+
+	if (0 == --slot.refCount
+	&&  UINT32_MAX != slot.frame)
+	{
+		slot.frame = m_frame;
+		lruPushFront(_handle);
+	}
+}
+
+uint16_t Atlas::evictRegion(uint16_t _width, uint16_t _height, AtlasRegion::Type _type)
+{
+	// Walk from least recently used region, regions used in current frame
+	// are referenced by vertices submitted this frame and can't be replaced.
+	for (uint16_t handle = m_lruTail; UINT16_MAX != handle; handle = m_slots[handle].prev)
+	{
+		const RegionSlot& slot = m_slots[handle];
+
+		if (slot.frame == m_frame)
+		{
+			break;
+		}
+
+		if (m_regions[handle].getType() == _type
+		&&  slot.width  >= _width
+		&&  slot.height >= _height)
+		{
+			lruRemove(handle);
+			m_slots[handle].generation++;
+			m_evictionCount++;
+			return handle;
+		}
+	}
+
+	return UINT16_MAX;
+}
+
+bool Atlas::packRegion(uint16_t _width, uint16_t _height, AtlasRegion::Type _type, uint32_t& _outLayer, uint16_t& _outX, uint16_t& _outY)
+{
 	uint32_t idx = 0;
 	while (idx < m_usedLayers)
 	{
 		if (m_layers[idx].faceRegion.getType() == _type
-		&&  m_layers[idx].packer.addRectangle(_width + 1, _height + 1, xx, yy) )
+		&&  m_layers[idx].packer.addRectangle(_width, _height, _outX, _outY) )
 		{
-			break;
+			_outLayer = idx;
+			return true;
 		}
 
 		idx++;
 	}
 
-	if (idx >= m_usedLayers)
+	if ( (idx + _type) > 24
+	|| m_usedFaces >= 6)
+	{
+		return false;
+	}
+
+	//for (int ii = 0; ii < _type; ++ii)
 	{
-		if ( (idx + _type) > 24
-		|| m_usedFaces >= 6)
+		int ii = 0;
+		AtlasRegion& region = m_layers[idx + ii].faceRegion;
+		region.x = 0;
+		region.y = 0;
+		region.width = m_textureSize;
+		region.height = m_textureSize;
+		region.setMask(_type, m_usedFaces, ii);
+	}
+
+	m_usedLayers++;
+	m_usedFaces++;
+
+	_outLayer = idx;
+	return m_layers[idx].packer.addRectangle(_width, _height, _outX, _outY);
+}
+
+uint16_t Atlas::addRegion(uint16_t _width, uint16_t _height, const uint8_t* _bitmapBuffer, AtlasRegion::Type _type, uint16_t outline)
+{
+	uint16_t xx = 0;
+	uint16_t yy = 0;
+	uint32_t idx = 0;
+	uint16_t handle = UINT16_MAX;
+
+	if (m_regionCount < m_maxRegionCount
+	&&  packRegion(_width + 1, _height + 1, _type, idx, xx, yy) )
+	{
+		handle = m_regionCount++;
+
+		RegionSlot& slot = m_slots[handle];
+		slot.x      = xx;
+		slot.y      = yy;
+		slot.width  = _width + 1;
+		slot.height = _height + 1;
+
+		m_regions[handle].mask = m_layers[idx].faceRegion.mask;
+	}
+	else
+	{
+		handle = evictRegion(_width + 1, _height + 1, _type);
+		if (UINT16_MAX == handle)
 		{
 			return UINT16_MAX;
 		}
 
-		//for (int ii = 0; ii < _type; ++ii)
+		// Clear whole recycled slot so that previous content doesn't bleed
+		// into the new region.
+		const RegionSlot& slot = m_slots[handle];
+		const AtlasRegion& old = m_regions[handle];
+		uint8_t* lineBuffer = m_textureBuffer + old.getFaceIndex() * (m_textureSize * m_textureSize * 4) + ( ( (slot.y * m_textureSize) + slot.x) * 4);
+
+		for (int ii = 0; ii < slot.height; ++ii)
 		{
-			int ii = 0;
-			AtlasRegion& region = m_layers[idx + ii].faceRegion;
-			region.x = 0;
-			region.y = 0;
-			region.width = m_textureSize;
-			region.height = m_textureSize;
-			region.setMask(_type, m_usedFaces, ii);
+			if (old.getType() == AtlasRegion::TYPE_BGRA8)
+			{
+				bx::memSet(lineBuffer, 0, slot.width * 4);
+			}
+			else
+			{
+				for (int jj = 0; jj < slot.width; ++jj)
+				{
+					lineBuffer[(jj * 4) + old.getComponentIndex()] = 0;
+				}
+			}
+
+			lineBuffer += m_textureSize * 4;
 		}
 
-		m_usedLayers++;
-		m_usedFaces++;
+		DirtyRect& dirty = m_dirty[old.getFaceIndex()];
+		dirty.x0 = bx::min<uint16_t>(dirty.x0, slot.x);
+		dirty.y0 = bx::min<uint16_t>(dirty.y0, slot.y);
+		dirty.x1 = bx::max<uint16_t>(dirty.x1, slot.x + slot.width);
+		dirty.y1 = bx::max<uint16_t>(dirty.y1, slot.y + slot.height);
 
-		if (!m_layers[idx].packer.addRectangle(_width + 1, _height + 1, xx, yy) )
-		{
-			return UINT16_MAX;
-		}
+		xx = slot.x;
+		yy = slot.y;
 	}
 
-	AtlasRegion& region = m_regions[m_regionCount];
+	m_slots[handle].frame = m_frame;
+	lruPushFront(handle);
+
+	AtlasRegion& region = m_regions[handle];
 	region.x = xx;
 	region.y = yy;
 	region.width = _width;
 	region.height = _height;
-	region.mask = m_layers[idx].faceRegion.mask;
 
 	updateRegion(region, _bitmapBuffer);
 
@@ -376,7 +591,7 @@ uint16_t Atlas::addRegion(uint16_t _width, uint16_t _height, const uint8_t* _bit
 	region.width -= (outline * 2);
 	region.height -= (outline * 2);
 
-	return m_regionCount++;
+	return handle;
 }
 
 void Atlas::updateRegion(const AtlasRegion& _region, const uint8_t* _bitmapBuffer)
@@ -384,27 +599,21 @@ void Atlas::updateRegion(const AtlasRegion& _region, const uint8_t* _bitmapBuffe
 	uint32_t size = _region.width * _region.height * 4;
 	if (0 < size)
 	{
-		const bgfx::Memory* mem = bgfx::alloc(size);
-		bx::memSet(mem->data, 0, mem->size);
+		uint8_t* outLineBuffer = m_textureBuffer + _region.getFaceIndex() * (m_textureSize * m_textureSize * 4) + ( ( (_region.y * m_textureSize) + _region.x) * 4);
+		const uint8_t* inLineBuffer = _bitmapBuffer;
+
 		if (_region.getType() == AtlasRegion::TYPE_BGRA8)
 		{
-			const uint8_t* inLineBuffer = _bitmapBuffer;
-			uint8_t* outLineBuffer = m_textureBuffer + _region.getFaceIndex() * (m_textureSize * m_textureSize * 4) + ( ( (_region.y * m_textureSize) + _region.x) * 4);
-
 			for (int yy = 0; yy < _region.height; ++yy)
 			{
 				bx::memCopy(outLineBuffer, inLineBuffer, _region.width * 4);
 				inLineBuffer += _region.width * 4;
 				outLineBuffer += m_textureSize * 4;
 			}
-
-			bx::memCopy(mem->data, _bitmapBuffer, mem->size);
 		}
 		else
 		{
 			uint32_t layer = _region.getComponentIndex();
-			const uint8_t* inLineBuffer = _bitmapBuffer;
-			uint8_t* outLineBuffer = (m_textureBuffer + _region.getFaceIndex() * (m_textureSize * m_textureSize * 4) + ( ( (_region.y * m_textureSize) + _region.x) * 4) );
 
 			for (int yy = 0; yy < _region.height; ++yy)
 			{
@@ -413,13 +622,56 @@ void Atlas::updateRegion(const AtlasRegion& _region, const uint8_t* _bitmapBuffe
 					outLineBuffer[(xx * 4) + layer] = inLineBuffer[xx];
 				}
 
-				bx::memCopy(mem->data + yy * _region.width * 4, outLineBuffer, _region.width * 4);
 				inLineBuffer += _region.width;
 				outLineBuffer += m_textureSize * 4;
 			}
 		}
 
-		bgfx::updateTextureCube(m_textureHandle, 0, (uint8_t)_region.getFaceIndex(), 0, _region.x, _region.y, _region.width, _region.height, mem);
+		// Texture is updated once per face in flush().
+		DirtyRect& dirty = m_dirty[_region.getFaceIndex()];
+		dirty.x0 = bx::min<uint16_t>(dirty.x0, _region.x);
+		dirty.y0 = bx::min<uint16_t>(dirty.y0, _region.y);
+		dirty.x1 = bx::max<uint16_t>(dirty.x1, _region.x + _region.width);
+		dirty.y1 = bx::max<uint16_t>(dirty.y1, _region.y + _region.height);
+	}
+}
+
+void Atlas::update()
+{
+	flush();
+
+	m_frame++;
+}
+
+void Atlas::flush() const
+{
+	for (uint8_t face = 0; face < 6; ++face)
+	{
+		DirtyRect& dirty = m_dirty[face];
+
+		if (dirty.x0 < dirty.x1
+		&&  dirty.y0 < dirty.y1)
+		{
+			const uint16_t width  = dirty.x1 - dirty.x0;
+			const uint16_t height = dirty.y1 - dirty.y0;
+
+			const bgfx::Memory* mem = bgfx::alloc(width * height * 4);
+			const uint8_t* inLineBuffer = m_textureBuffer + face * (m_textureSize * m_textureSize * 4) + ( ( (dirty.y0 * m_textureSize) + dirty.x0) * 4);
+
+			for (int yy = 0; yy < height; ++yy)
+			{
+				bx::memCopy(mem->data + yy * width * 4, inLineBuffer, width * 4);
+				inLineBuffer += m_textureSize * 4;
+			}
+
+			bgfx::updateTextureCube(m_textureHandle, 0, face, 0, dirty.x0, dirty.y0, width, height, mem);
+			m_uploadCount++;
+
+			dirty.x0 = UINT16_MAX;
+			dirty.y0 = UINT16_MAX;
+			dirty.x1 = 0;
+			dirty.y1 = 0;
+		}
 	}
 }
 
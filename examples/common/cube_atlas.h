@@ -68,11 +68,49 @@ public:
 	~Atlas();
 
 	/// add a region to the atlas, and copy the content of mem to the underlying texture
+	/// @remark when the atlas is full, the least recently used region which wasn't used in the
+	///   current frame and is large enough gets evicted and recycled, its generation is incremented
 	uint16_t addRegion(uint16_t _width, uint16_t _height, const uint8_t* _bitmapBuffer, AtlasRegion::Type _type = AtlasRegion::TYPE_BGRA8, uint16_t outline = 0);
 
 	/// update a preallocated region
+	/// @remark the texture is updated when the texture handle is retrieved, or on the next call to update()
 	void updateRegion(const AtlasRegion& _region, const uint8_t* _bitmapBuffer);
 
+	/// upload all regions modified since the last upload (one texture update per modified face)
+	/// and start a new frame for the LRU
+	/// @remark regions are recycled only when this is called once per frame
+	void update();
+
+	/// mark a region as used in the current frame
+	void touchRegion(uint16_t _handle);
+
+	/// exclude a region from eviction
+	void pinRegion(uint16_t _handle);
+
+	/// add a reference to a region, referenced regions are not evicted
+	void addRef(uint16_t _handle);
+
+	/// release a reference added by addRef()
+	void release(uint16_t _handle);
+
+	/// retrieve the generation of a region, it changes each time the region is recycled
+	uint16_t getRegionGeneration(uint16_t _handle) const
+	{
+		return m_slots[_handle].generation;
+	}
+
+	/// retrieve the number of evicted regions since the atlas creation
+	uint32_t getEvictionCount() const
+	{
+		return m_evictionCount;
+	}
+
+	/// retrieve the number of texture updates since the atlas creation
+	uint32_t getUploadCount() const
+	{
+		return m_uploadCount;
+	}
+
 	/// Pack the UV coordinates of the four corners of a region to a vertex buffer using the supplied vertex format.
 	/// v0 -- v3
 	/// |     |     encoded in that order:  v0,v1,v2,v3
@@ -89,9 +127,10 @@ public:
 	/// Same as packUV but pack a whole face of the atlas cube, mostly used for debugging and visualizing atlas
 	void packFaceLayerUV(uint32_t _idx, uint8_t* _vertexBuffer, uint32_t _offset, uint32_t _stride) const;
 
-	/// return the TextureHandle (cube) of the atlas
+	/// return the TextureHandle (cube) of the atlas, regions modified since the last upload are uploaded first
 	bgfx::TextureHandle getTextureHandle() const
 	{
+		flush();
 		return m_textureHandle;
 	}
 
@@ -136,10 +175,47 @@ public:
 
 private:
 	struct PackedLayer;
+
+	/// LRU bookkeeping of a region, width and height include the packing border
+	struct RegionSlot
+	{
+		uint16_t x;
+		uint16_t y;
+		uint16_t width;
+		uint16_t height;
+		uint16_t prev;
+		uint16_t next;
+		uint16_t generation;
+		uint32_t frame;
+		uint32_t refCount;
+	};
+
+	struct DirtyRect
+	{
+		uint16_t x0, y0;
+		uint16_t x1, y1;
+	};
+
+	void initSlots(uint16_t _count);
+	bool packRegion(uint16_t _width, uint16_t _height, AtlasRegion::Type _type, uint32_t& _outLayer, uint16_t& _outX, uint16_t& _outY);
+	void lruRemove(uint16_t _handle);
+	void lruPushFront(uint16_t _handle);
+	uint16_t evictRegion(uint16_t _width, uint16_t _height, AtlasRegion::Type _type);
+	void flush() const;
+
 	PackedLayer* m_layers;
 	AtlasRegion* m_regions;
+	RegionSlot* m_slots;
 	uint8_t* m_textureBuffer;
 
+	mutable DirtyRect m_dirty[6];
+
+	uint16_t m_lruHead;
+	uint16_t m_lruTail;
+	uint32_t m_frame;
+	uint32_t m_evictionCount;
+	mutable uint32_t m_uploadCount;
+
 	uint32_t m_usedLayers;
 	uint32_t m_usedFaces;
 
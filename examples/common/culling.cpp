@@ -0,0 +1,489 @@
+/*
+ * Copyright 2011-2022 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include <bx/math.h>
+#include <bx/simd_t.h>
+#include "culling.h"
+
+// Maximum number of instances in leaf node.
+static const uint32_t kLeafSize = 16;
+
+// Maximum depth of hierarchy, median split keeps depth at log2(num/kLeafSize).
+static const uint32_t kMaxDepth = 64;
+
+static void planeInit(float* _plane, float _x, float _y, float _z, float _w)
+{
+	const float invLen = 1.0f/bx::sqrt(_x*_x + _y*_y + _z*_z);
+	_plane[0] = _x*invLen;
+	_plane[1] = _y*invLen;
+	_plane[2] = _z*invLen;
+	_plane[3] = _w*invLen;
+}
+
+void frustumInit(Frustum& _frustum, const float* _viewProj)
+{
+	// Clip space component of point is dot product of point with matrix column.
+	const float* mtx = _viewProj;
+
+	planeInit(_frustum.m_planes[0], mtx[3] + mtx[0], mtx[7] + mtx[4], mtx[11] + mtx[ 8], mtx[15] + mtx[12]); // left
+	planeInit(_frustum.m_planes[1], mtx[3] - mtx[0], mtx[7] - mtx[4], mtx[11] - mtx[ 8], mtx[15] - mtx[12]); // right
+	planeInit(_frustum.m_planes[2], mtx[3] + mtx[1], mtx[7] + mtx[5], mtx[11] + mtx[ 9], mtx[15] + mtx[13]); // bottom
+	planeInit(_frustum.m_planes[3], mtx[3] - mtx[1], mtx[7] - mtx[5], mtx[11] - mtx[ 9], mtx[15] - mtx[13]); // top
+	planeInit(_frustum.m_planes[4], mtx[3] + mtx[2], mtx[7] + mtx[6], mtx[11] + mtx[10], mtx[15] + mtx[14]); // near
+	planeInit(_frustum.m_planes[5], mtx[3] - mtx[2], mtx[7] - mtx[6], mtx[11] - mtx[10], mtx[15] - mtx[14]); // far
+}
+
+void frustumInit(Frustum& _frustum, const float* _view, const float* _proj)
+{
+	float viewProj[16];
+	bx::mtxMul(viewProj, _view, _proj);
+	frustumInit(_frustum, viewProj);
+}
+
+void aabbTransform(bx::Aabb& _result, const float* _mtx, const bx::Aabb& _aabb)
+{
+	const bx::Vec3 center = bx::mul(bx::add(_aabb.min, _aabb.max), 0.5f);
+	const bx::Vec3 extent = bx::mul(bx::sub(_aabb.max, _aabb.min), 0.5f);
+
+	const bx::Vec3 tc = bx::mul(center, _mtx);
+	const bx::Vec3 te =
+	{
+		bx::abs(_mtx[0])*extent.x + bx::abs(_mtx[4])*extent.y + bx::abs(_mtx[ 8])*extent.z,
+		bx::abs(_mtx[1])*extent.x + bx::abs(_mtx[5])*extent.y + bx::abs(_mtx[ 9])*extent.z,
+		bx::abs(_mtx[2])*extent.x + bx::abs(_mtx[6])*extent.y + bx::abs(_mtx[10])*extent.z,
+	};
+
+	_result.min = bx::sub(tc, te);
+	_result.max = bx::add(tc, te);
+}
+
+void sphereTransform(bx::Sphere& _result, const float* _mtx, const bx::Sphere& _sphere)
+{
+	const float sx = _mtx[0]*_mtx[0] + _mtx[1]*_mtx[1] + _mtx[ 2]*_mtx[ 2];
+	const float sy = _mtx[4]*_mtx[4] + _mtx[5]*_mtx[5] + _mtx[ 6]*_mtx[ 6];
+	const float sz = _mtx[8]*_mtx[8] + _mtx[9]*_mtx[9] + _mtx[10]*_mtx[10];
+
+	_result.center = bx::mul(_sphere.center, _mtx);
+	_result.radius = _sphere.radius * bx::sqrt(bx::max(sx, bx::max(sy, sz) ) );
+}
+
+// Frustum planes splatted into SIMD registers.
+struct SimdFrustum
+{
+	bx::simd128_t m_nx[6];
+	bx::simd128_t m_ny[6];
+	bx::simd128_t m_nz[6];
+	bx::simd128_t m_d[6];
+	bx::simd128_t m_ax[6];
+	bx::simd128_t m_ay[6];
+	bx::simd128_t m_az[6];
+};
+
+static void simdFrustumInit(SimdFrustum& _result, const Frustum& _frustum)
+{
+	using namespace bx;
+
+	for (uint32_t ii = 0; ii < 6; ++ii)
+	{
+		const float* plane = _frustum.m_planes[ii];
+		_result.m_nx[ii] = simd_splat<simd128_t>(plane[0]);
+		_result.m_ny[ii] = simd_splat<simd128_t>(plane[1]);
+		_result.m_nz[ii] = simd_splat<simd128_t>(plane[2]);
+		_result.m_d[ii]  = simd_splat<simd128_t>(plane[3]);
+		_result.m_ax[ii] = simd_splat<simd128_t>(bx::abs(plane[0]) );
+		_result.m_ay[ii] = simd_splat<simd128_t>(bx::abs(plane[1]) );
+		_result.m_az[ii] = simd_splat<simd128_t>(bx::abs(plane[2]) );
+	}
+}
+
+// Returns lane mask of spheres which are not completely behind any plane.
+static int testSpheres(const SimdFrustum& _frustum, bx::simd128_t _cx, bx::simd128_t _cy, bx::simd128_t _cz, bx::simd128_t _radius)
+{
+	using namespace bx;
+
+	simd128_t dmin = simd_splat<simd128_t>(bx::kFloatMax);
+
+	for (uint32_t ii = 0; ii < 6; ++ii)
+	{
+		const simd128_t dist = simd_madd(_frustum.m_nx[ii], _cx
+			, simd_madd(_frustum.m_ny[ii], _cy
+			, simd_madd(_frustum.m_nz[ii], _cz, _frustum.m_d[ii]) ) );
+		dmin = simd_min(dmin, simd_add(dist, _radius) );
+	}
+
+	return ~simd_signbitsmask(dmin) & 0xf;
+}
+
+// Returns lane mask of boxes which are not completely behind any plane.
+static int testBoxes(const SimdFrustum& _frustum, bx::simd128_t _cx, bx::simd128_t _cy, bx::simd128_t _cz, bx::simd128_t _ex, bx::simd128_t _ey, bx::simd128_t _ez)
+{
+	using namespace bx;
+
+	simd128_t dmin = simd_splat<simd128_t>(bx::kFloatMax);
+
+	for (uint32_t ii = 0; ii < 6; ++ii)
+	{
+		const simd128_t dist = simd_madd(_frustum.m_nx[ii], _cx
+			, simd_madd(_frustum.m_ny[ii], _cy
+			, simd_madd(_frustum.m_nz[ii], _cz, _frustum.m_d[ii]) ) );
+		const simd128_t radius = simd_madd(_frustum.m_ax[ii], _ex
+			, simd_madd(_frustum.m_ay[ii], _ey
+			, simd_mul(_frustum.m_az[ii], _ez) ) );
+		dmin = simd_min(dmin, simd_add(dist, radius) );
+	}
+
+	return ~simd_signbitsmask(dmin) & 0xf;
+}
+
+uint32_t cullSpheres(uint32_t* _result, const Frustum& _frustum, const bx::Sphere* _spheres, uint32_t _num)
+{
+	using namespace bx;
+
+	SimdFrustum frustum;
+	simdFrustumInit(frustum, _frustum);
+
+	uint32_t num = 0;
+
+	for (uint32_t ii = 0; ii < _num; ii += 4)
+	{
+		// Last batch repeats last sphere, lanes past the end are ignored.
+		const uint32_t numLanes = bx::min<uint32_t>(_num - ii, 4);
+		const bx::Sphere& s0 = _spheres[ii];
+		const bx::Sphere& s1 = _spheres[ii + bx::min<uint32_t>(1, numLanes-1)];
+		const bx::Sphere& s2 = _spheres[ii + bx::min<uint32_t>(2, numLanes-1)];
+		const bx::Sphere& s3 = _spheres[ii + bx::min<uint32_t>(3, numLanes-1)];
+
+		const int mask = testSpheres(frustum
+			, simd_ld<simd128_t>(s0.center.x, s1.center.x, s2.center.x, s3.center.x)
+			, simd_ld<simd128_t>(s0.center.y, s1.center.y, s2.center.y, s3.center.y)
+			, simd_ld<simd128_t>(s0.center.z, s1.center.z, s2.center.z, s3.center.z)
+			, simd_ld<simd128_t>(s0.radius,   s1.radius,   s2.radius,   s3.radius  )
+			);
+
+		for (uint32_t lane = 0; lane < numLanes; ++lane)
+		{
+			_result[num] = ii + lane;
+			num += (mask >> lane) & 1;
+		}
+	}
+
+	return num;
+}
+
+uint32_t cullAabbs(uint32_t* _result, const Frustum& _frustum, const bx::Aabb* _aabbs, uint32_t _num)
+{
+	using namespace bx;
+
+	SimdFrustum frustum;
+	simdFrustumInit(frustum, _frustum);
+
+	const simd128_t half = simd_splat<simd128_t>(0.5f);
+
+	uint32_t num = 0;
+
+	for (uint32_t ii = 0; ii < _num; ii += 4)
+	{
+		// Last batch repeats last box, lanes past the end are ignored.
+		const uint32_t numLanes = bx::min<uint32_t>(_num - ii, 4);
+		const bx::Aabb& b0 = _aabbs[ii];
+		const bx::Aabb& b1 = _aabbs[ii + bx::min<uint32_t>(1, numLanes-1)];
+		const bx::Aabb& b2 = _aabbs[ii + bx::min<uint32_t>(2, numLanes-1)];
+		const bx::Aabb& b3 = _aabbs[ii + bx::min<uint32_t>(3, numLanes-1)];
+
+		const simd128_t minx = simd_ld<simd128_t>(b0.min.x, b1.min.x, b2.min.x, b3.min.x);
+		const simd128_t miny = simd_ld<simd128_t>(b0.min.y, b1.min.y, b2.min.y, b3.min.y);
+		const simd128_t minz = simd_ld<simd128_t>(b0.min.z, b1.min.z, b2.min.z, b3.min.z);
+		const simd128_t maxx = simd_ld<simd128_t>(b0.max.x, b1.max.x, b2.max.x, b3.max.x);
+		const simd128_t maxy = simd_ld<simd128_t>(b0.max.y, b1.max.y, b2.max.y, b3.max.y);
+		const simd128_t maxz = simd_ld<simd128_t>(b0.max.z, b1.max.z, b2.max.z, b3.max.z);
+
+		const int mask = testBoxes(frustum
+			, simd_mul(simd_add(minx, maxx), half)
+			, simd_mul(simd_add(miny, maxy), half)
+			, simd_mul(simd_add(minz, maxz), half)
+			, simd_mul(simd_sub(maxx, minx), half)
+			, simd_mul(simd_sub(maxy, miny), half)
+			, simd_mul(simd_sub(maxz, minz), half)
+			);
+
+		for (uint32_t lane = 0; lane < numLanes; ++lane)
+		{
+			_result[num] = ii + lane;
+			num += (mask >> lane) & 1;
+		}
+	}
+
+	return num;
+}
+
+// Partially sorts indices so that element at `_nth` is in sorted position, elements before it
+// have smaller or equal key, and elements after it have greater or equal key.
+static void selectNth(uint32_t* _indices, const float* _keys, uint32_t _begin, uint32_t _end, uint32_t _nth)
+{
+	while (_end - _begin > 1)
+	{
+		const float pivot = _keys[_indices[_begin + (_end - _begin)/2] ];
+
+		uint32_t lt = _begin;
+		uint32_t ii = _begin;
+		uint32_t gt = _end;
+
+		while (ii < gt)
+		{
+			const float key = _keys[_indices[ii] ];
+
+			if (key < pivot)
+			{
+				bx::swap(_indices[lt++], _indices[ii++]);
+			}
+			else if (key > pivot)
+			{
+				bx::swap(_indices[ii], _indices[--gt]);
+			}
+			else
+			{
+				++ii;
+			}
+		}
+
+		if (_nth < lt)
+		{
+			_end = lt;
+		}
+		else if (_nth >= gt)
+		{
+			_begin = gt;
+		}
+		else
+		{
+			return;
+		}
+	}
+}
+
+CullingBvh::CullingBvh()
+{
+}
+
+void CullingBvh::build(const bx::Aabb* _aabbs, uint32_t _num)
+{
+	m_nodes.clear();
+	m_indices.resize(_num);
+
+	for (uint32_t axis = 0; axis < 3; ++axis)
+	{
+		m_center[axis].resize(_num);
+		m_extent[axis].resize(_num);
+	}
+
+	if (0 == _num)
+	{
+		return;
+	}
+
+	// While building, centers are indexed by instance and used as split keys.
+	for (uint32_t ii = 0; ii < _num; ++ii)
+	{
+		const bx::Aabb& aabb = _aabbs[ii];
+		m_indices[ii] = ii;
+		m_center[0][ii] = (aabb.min.x + aabb.max.x) * 0.5f;
+		m_center[1][ii] = (aabb.min.y + aabb.max.y) * 0.5f;
+		m_center[2][ii] = (aabb.min.z + aabb.max.z) * 0.5f;
+	}
+
+	m_nodes.reserve(2*(_num/kLeafSize + 1) );
+	m_nodes.push_back(Node() );
+	subdivide(0, 0, _num, _aabbs);
+
+	// Reorder instance bounds to leaf order.
+	for (uint32_t ii = 0; ii < _num; ++ii)
+	{
+		const bx::Aabb& aabb = _aabbs[m_indices[ii] ];
+		m_center[0][ii] = (aabb.min.x + aabb.max.x) * 0.5f;
+		m_center[1][ii] = (aabb.min.y + aabb.max.y) * 0.5f;
+		m_center[2][ii] = (aabb.min.z + aabb.max.z) * 0.5f;
+		m_extent[0][ii] = (aabb.max.x - aabb.min.x) * 0.5f;
+		m_extent[1][ii] = (aabb.max.y - aabb.min.y) * 0.5f;
+		m_extent[2][ii] = (aabb.max.z - aabb.min.z) * 0.5f;
+	}
+}
+
+void CullingBvh::subdivide(uint32_t _node, uint32_t _begin, uint32_t _end, const bx::Aabb* _aabbs)
+{
+	float bmin[3] = {  bx::kFloatMax,  bx::kFloatMax,  bx::kFloatMax };
+	float bmax[3] = { -bx::kFloatMax, -bx::kFloatMax, -bx::kFloatMax };
+	float cmin[3] = {  bx::kFloatMax,  bx::kFloatMax,  bx::kFloatMax };
+	float cmax[3] = { -bx::kFloatMax, -bx::kFloatMax, -bx::kFloatMax };
+
+	for (uint32_t ii = _begin; ii < _end; ++ii)
+	{
+		const uint32_t idx = m_indices[ii];
+		const bx::Aabb& aabb = _aabbs[idx];
+		const float min[3] = { aabb.min.x, aabb.min.y, aabb.min.z };
+		const float max[3] = { aabb.max.x, aabb.max.y, aabb.max.z };
+
+		for (uint32_t axis = 0; axis < 3; ++axis)
+		{
+			bmin[axis] = bx::min(bmin[axis], min[axis]);
+			bmax[axis] = bx::max(bmax[axis], max[axis]);
+			cmin[axis] = bx::min(cmin[axis], m_center[axis][idx]);
+			cmax[axis] = bx::max(cmax[axis], m_center[axis][idx]);
+		}
+	}
+
+	Node node;
+	for (uint32_t axis = 0; axis < 3; ++axis)
+	{
+		node.m_center[axis] = (bmin[axis] + bmax[axis]) * 0.5f;
+		node.m_extent[axis] = (bmax[axis] - bmin[axis]) * 0.5f;
+	}
+	node.m_begin = _begin;
+	node.m_end   = _end;
+	node.m_child = 0;
+
+	if (_end - _begin <= kLeafSize)
+	{
+		m_nodes[_node] = node;
+		return;
+	}
+
+	// Median split along longest axis of instance centers.
+	const float size[3] = { cmax[0] - cmin[0], cmax[1] - cmin[1], cmax[2] - cmin[2] };
+	const uint32_t axis = size[0] > size[1]
+		? (size[0] > size[2] ? 0 : 2)
+		: (size[1] > size[2] ? 1 : 2)
+		;
+
+	const uint32_t mid = _begin + (_end - _begin)/2;
+	selectNth(&m_indices[0], &m_center[axis][0], _begin, _end, mid);
+
+	node.m_child = uint32_t(m_nodes.size() );
+	m_nodes[_node] = node;
+
+	m_nodes.push_back(Node() );
+	m_nodes.push_back(Node() );
+
+	subdivide(node.m_child,   _begin, mid,  _aabbs);
+	subdivide(node.m_child+1, mid,    _end, _aabbs);
+}
+
+uint32_t CullingBvh::cull(uint32_t* _result, const Frustum& _frustum) const
+{
+	using namespace bx;
+
+	if (m_nodes.empty() )
+	{
+		return 0;
+	}
+
+	SimdFrustum frustum;
+	simdFrustumInit(frustum, _frustum);
+
+	struct StackEntry
+	{
+		uint32_t m_node;
+		uint32_t m_planeMask;
+	};
+
+	StackEntry stack[kMaxDepth*2];
+	uint32_t top = 0;
+	stack[top++] = { 0, 0x3f };
+
+	uint32_t num = 0;
+
+	while (0 != top)
+	{
+		const StackEntry entry = stack[--top];
+		const Node& node = m_nodes[entry.m_node];
+
+		// Planes which node is completely in front of are not tested for its children.
+		uint32_t planeMask = entry.m_planeMask;
+		bool outside = false;
+
+		for (uint32_t ii = 0; ii < 6 && !outside; ++ii)
+		{
+			if (0 == (planeMask & (1<<ii) ) )
+			{
+				continue;
+			}
+
+			const float* plane = _frustum.m_planes[ii];
+			const float dist = plane[0]*node.m_center[0] + plane[1]*node.m_center[1] + plane[2]*node.m_center[2] + plane[3];
+			const float radius = bx::abs(plane[0])*node.m_extent[0] + bx::abs(plane[1])*node.m_extent[1] + bx::abs(plane[2])*node.m_extent[2];
+
+			outside = dist + radius < 0.0f;
+
+			if (dist - radius >= 0.0f)
+			{
+				planeMask &= ~(1<<ii);
+			}
+		}
+
+		if (outside)
+		{
+			continue;
+		}
+
+		if (0 == planeMask)
+		{
+			// Completely inside, all instances are visible.
+			const uint32_t count = node.m_end - node.m_begin;
+			bx::memCopy(&_result[num], &m_indices[node.m_begin], count*sizeof(uint32_t) );
+			num += count;
+			continue;
+		}
+
+		if (0 != node.m_child)
+		{
+			stack[top++] = { node.m_child,   planeMask };
+			stack[top++] = { node.m_child+1, planeMask };
+			continue;
+		}
+
+		// Leaf intersects frustum, test instances.
+		const float* cx = &m_center[0][0];
+		const float* cy = &m_center[1][0];
+		const float* cz = &m_center[2][0];
+		const float* ex = &m_extent[0][0];
+		const float* ey = &m_extent[1][0];
+		const float* ez = &m_extent[2][0];
+
+		for (uint32_t ii = node.m_begin; ii < node.m_end; ii += 4)
+		{
+			const uint32_t numLanes = bx::min<uint32_t>(node.m_end - ii, 4);
+			const uint32_t i0 = ii;
+			const uint32_t i1 = ii + bx::min<uint32_t>(1, numLanes-1);
+			const uint32_t i2 = ii + bx::min<uint32_t>(2, numLanes-1);
+			const uint32_t i3 = ii + bx::min<uint32_t>(3, numLanes-1);
+
+			const int mask = testBoxes(frustum
+				, simd_ld<simd128_t>(cx[i0], cx[i1], cx[i2], cx[i3])
+				, simd_ld<simd128_t>(cy[i0], cy[i1], cy[i2], cy[i3])
+				, simd_ld<simd128_t>(cz[i0], cz[i1], cz[i2], cz[i3])
+				, simd_ld<simd128_t>(ex[i0], ex[i1], ex[i2], ex[i3])
+				, simd_ld<simd128_t>(ey[i0], ey[i1], ey[i2], ey[i3])
+				, simd_ld<simd128_t>(ez[i0], ez[i1], ez[i2], ez[i3])
+				);
+
+			for (uint32_t lane = 0; lane < numLanes; ++lane)
+			{
+				_result[num] = m_indices[ii + lane];
+				num += (mask >> lane) & 1;
+			}
+		}
+	}
+
+	return num;
+}
+
+uint32_t CullingBvh::getNumInstances() const
+{
+	return uint32_t(m_indices.size() );
+}
+
+uint32_t CullingBvh::getNumNodes() const
+{
+	return uint32_t(m_nodes.size() );
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2011-2022 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#ifndef CULLING_H_HEADER_GUARD
+#define CULLING_H_HEADER_GUARD
+
+#include <bx/bounds.h>
+#include <tinystl/allocator.h>
+#include <tinystl/vector.h>
+
+/// View frustum. Planes are normalized and point inside of frustum, plane
+/// is stored as normal xyz and distance.
+///
+struct Frustum
+{
+	float m_planes[6][4];
+};
+
+/// Build frustum from view projection matrix. Near plane is extracted for
+/// [-1, 1] depth range, which is conservative for [0, 1] depth range.
+///
+void frustumInit(Frustum& _frustum, const float* _viewProj);
+
+/// Build frustum from view and projection matrices.
+///
+void frustumInit(Frustum& _frustum, const float* _view, const float* _proj);
+
+/// Transform AABB by matrix. Result encloses transformed box.
+///
+void aabbTransform(bx::Aabb& _result, const float* _mtx, const bx::Aabb& _aabb);
+
+/// Transform sphere by matrix. Radius is scaled by largest axis scale.
+///
+void sphereTransform(bx::Sphere& _result, const float* _mtx, const bx::Sphere& _sphere);
+
+/// Test spheres against frustum. Spheres are tested in batches of four with
+/// SIMD.
+///
+/// @param[out] _result Indices of visible spheres. Must have space for `_num`
+///   indices.
+/// @param[in] _frustum Frustum.
+/// @param[in] _spheres Spheres.
+/// @param[in] _num Number of spheres.
+/// @returns Number of visible spheres.
+///
+uint32_t cullSpheres(uint32_t* _result, const Frustum& _frustum, const bx::Sphere* _spheres, uint32_t _num);
+
+/// Test AABBs against frustum. AABBs are tested in batches of four with SIMD.
+///
+/// @param[out] _result Indices of visible AABBs. Must have space for `_num`
+///   indices.
+/// @param[in] _frustum Frustum.
+/// @param[in] _aabbs AABBs.
+/// @param[in] _num Number of AABBs.
+/// @returns Number of visible AABBs.
+///
+uint32_t cullAabbs(uint32_t* _result, const Frustum& _frustum, const bx::Aabb* _aabbs, uint32_t _num);
+
+/// Bounding volume hierarchy over world space AABBs of many instances.
+/// Subtrees outside of frustum are rejected, and subtrees inside of
+/// frustum are accepted without testing instances.
+///
+class CullingBvh
+{
+public:
+	///
+	CullingBvh();
+
+	/// Build hierarchy. Instance index is index of its AABB in `_aabbs`.
+	///
+	void build(const bx::Aabb* _aabbs, uint32_t _num);
+
+	/// Cull instances against frustum.
+	///
+	/// @param[out] _result Indices of visible instances. Must have space for
+	///   all instances.
+	/// @param[in] _frustum Frustum.
+	/// @returns Number of visible instances.
+	///
+	uint32_t cull(uint32_t* _result, const Frustum& _frustum) const;
+
+	///
+	uint32_t getNumInstances() const;
+
+	///
+	uint32_t getNumNodes() const;
+
+private:
+	struct Node
+	{
+		float    m_center[3];
+		float    m_extent[3];
+		uint32_t m_begin;  //!< First instance in m_indices.
+		uint32_t m_end;    //!< One past last instance in m_indices.
+		uint32_t m_child;  //!< First child, second child follows it. Zero for leaf.
+	};
+
+	void subdivide(uint32_t _node, uint32_t _begin, uint32_t _end, const bx::Aabb* _aabbs);
+
+	tinystl::vector<Node>     m_nodes;
+	tinystl::vector<uint32_t> m_indices;
+
+	// Instance centers and extents in m_indices order, so that leaf instances
+	// are contiguous.
+	tinystl::vector<float> m_center[3];
+	tinystl::vector<float> m_extent[3];
+};
+
+#endif // CULLING_H_HEADER_GUARD
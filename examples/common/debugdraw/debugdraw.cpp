@@ -318,6 +318,26 @@ bx::Vec3 getPoint(Axis::Enum _axis, float _x, float _y)
 #include "fs_debugdraw_fill_lit.bin.h"
 #include "vs_debugdraw_fill_texture.bin.h"
 #include "fs_debugdraw_fill_texture.bin.h"
+#include "vs_debugdraw_fill_instance.bin.h"
+#include "fs_debugdraw_fill_instance.bin.h"
+#include "vs_debugdraw_fill_lit_instance.bin.h"
+#include "fs_debugdraw_fill_lit_instance.bin.h"
+
+// Instance shaders are not compiled for Direct3D and console renderers, these
+// renderers draw shapes without instancing.
+#define DEBUGDRAW_EMBEDDED_SHADER_INSTANCE(_name)                                          \
+	{                                                                                      \
+		#_name,                                                                            \
+		{                                                                                  \
+			BGFX_EMBEDDED_SHADER_METAL(bgfx::RendererType::Metal,      _name)              \
+			BGFX_EMBEDDED_SHADER_ESSL (bgfx::RendererType::OpenGLES,   _name)              \
+			BGFX_EMBEDDED_SHADER_GLSL (bgfx::RendererType::OpenGL,     _name)              \
+			BGFX_EMBEDDED_SHADER_SPIRV(bgfx::RendererType::Vulkan,     _name)              \
+			BGFX_EMBEDDED_SHADER_SPIRV(bgfx::RendererType::WebGPU,     _name)              \
+			{ bgfx::RendererType::Noop,  (const uint8_t*)"VSH\x5\x0\x0\x0\x0\x0\x0", 10 }, \
+			{ bgfx::RendererType::Count, NULL, 0 }                                         \
+		}                                                                                  \
+	}
 
 static const bgfx::EmbeddedShader s_embeddedShaders[] =
 {
@@ -333,6 +353,10 @@ static const bgfx::EmbeddedShader s_embeddedShaders[] =
 	BGFX_EMBEDDED_SHADER(fs_debugdraw_fill_lit),
 	BGFX_EMBEDDED_SHADER(vs_debugdraw_fill_texture),
 	BGFX_EMBEDDED_SHADER(fs_debugdraw_fill_texture),
+	DEBUGDRAW_EMBEDDED_SHADER_INSTANCE(vs_debugdraw_fill_instance),
+	DEBUGDRAW_EMBEDDED_SHADER_INSTANCE(fs_debugdraw_fill_instance),
+	DEBUGDRAW_EMBEDDED_SHADER_INSTANCE(vs_debugdraw_fill_lit_instance),
+	DEBUGDRAW_EMBEDDED_SHADER_INSTANCE(fs_debugdraw_fill_lit_instance),
 
 	BGFX_EMBEDDED_SHADER_END()
 };
@@ -508,11 +532,35 @@ struct Program
 		FillLit,
 		FillLitMesh,
 		FillTexture,
+		FillInstance,
+		FillLitInstance,
 
 		Count
 	};
 };
 
+// Per instance data for shape primitives. Shapes are affine, so world matrix
+// is stored as 3 rows, with offset between two ends of cone, cylinder, and
+// capsule, and material color.
+struct ShapeInstance
+{
+	float m_row[3][4];
+	float m_offset[4];
+	float m_color[4];
+};
+
+BX_STATIC_ASSERT(sizeof(ShapeInstance) == 80, "Instance data must fit into i_data0-i_data4.");
+
+struct ShapeBatch
+{
+	uint64_t       m_state;
+	uint32_t       m_num;
+	uint32_t       m_max;
+	ShapeInstance* m_instance;
+	uint8_t        m_mesh;
+	bool           m_wireframe;
+};
+
 struct DebugMesh
 {
 	enum Enum
@@ -560,6 +608,32 @@ typedef GeometryT<DEBUG_DRAW_CONFIG_MAX_GEOMETRY> Geometry;
 
 struct DebugDrawShared
 {
+	// Returns invalid handle when renderer has no instance shaders.
+	static bgfx::ProgramHandle createInstanceProgram(bgfx::RendererType::Enum _type, const char* _vsName, const char* _fsName)
+	{
+		bgfx::ShaderHandle vsh = bgfx::createEmbeddedShader(s_embeddedShaders, _type, _vsName);
+		bgfx::ShaderHandle fsh = bgfx::createEmbeddedShader(s_embeddedShaders, _type, _fsName);
+
+		if (bgfx::isValid(vsh)
+		&&  bgfx::isValid(fsh) )
+		{
+			return bgfx::createProgram(vsh, fsh, true);
+		}
+
+		if (bgfx::isValid(vsh) )
+		{
+			bgfx::destroy(vsh);
+		}
+
+		if (bgfx::isValid(fsh) )
+		{
+			bgfx::destroy(fsh);
+		}
+
+		bgfx::ProgramHandle invalid = BGFX_INVALID_HANDLE;
+		return invalid;
+	}
+
 	void init(bx::AllocatorI* _allocator)
 	{
 		if (NULL == _allocator)
@@ -621,6 +695,15 @@ struct DebugDrawShared
 			, true
 			);
 
+		m_program[Program::FillInstance]    = createInstanceProgram(type, "vs_debugdraw_fill_instance",     "fs_debugdraw_fill_instance");
+		m_program[Program::FillLitInstance] = createInstanceProgram(type, "vs_debugdraw_fill_lit_instance", "fs_debugdraw_fill_lit_instance");
+
+		m_instancing = true
+			&& 0 != (bgfx::getCaps()->supported & BGFX_CAPS_INSTANCING)
+			&& bgfx::isValid(m_program[Program::FillInstance])
+			&& bgfx::isValid(m_program[Program::FillLitInstance])
+			;
+
 		u_params   = bgfx::createUniform("u_params",   bgfx::UniformType::Vec4, 4);
 		s_texColor = bgfx::createUniform("s_texColor", bgfx::UniformType::Sampler);
 		m_texture  = bgfx::createTexture2D(SPRITE_TEXTURE_SIZE, SPRITE_TEXTURE_SIZE, false, 1, bgfx::TextureFormat::BGRA8);
@@ -953,7 +1036,10 @@ struct DebugDrawShared
 		bgfx::destroy(m_vbh);
 		for (uint32_t ii = 0; ii < Program::Count; ++ii)
 		{
-			bgfx::destroy(m_program[ii]);
+			if (bgfx::isValid(m_program[ii]) )
+			{
+				bgfx::destroy(m_program[ii]);
+			}
 		}
 		bgfx::destroy(u_params);
 		bgfx::destroy(s_texColor);
@@ -1011,6 +1097,8 @@ struct DebugDrawShared
 
 	bgfx::VertexBufferHandle m_vbh;
 	bgfx::IndexBufferHandle  m_ibh;
+
+	bool m_instancing;
 };
 
 static DebugDrawShared s_dds;
@@ -1028,10 +1116,24 @@ struct DebugDrawEncoderImpl
 	{
 		m_defaultEncoder = _encoder;
 		m_state = State::Count;
+
+		m_shapeBatch       = NULL;
+		m_numShapeBatches  = 0;
+		m_maxShapeBatches  = 0;
+		m_shapesOrdered    = false;
 	}
 
 	void shutdown()
 	{
+		for (uint32_t ii = 0; ii < m_maxShapeBatches; ++ii)
+		{
+			BX_FREE(s_dds.m_allocator, m_shapeBatch[ii].m_instance);
+		}
+
+		BX_FREE(s_dds.m_allocator, m_shapeBatch);
+		m_shapeBatch      = NULL;
+		m_numShapeBatches = 0;
+		m_maxShapeBatches = 0;
 	}
 
 	void begin(bgfx::ViewId _viewId, bool _depthTestLess, bgfx::Encoder* _encoder)
@@ -1074,6 +1176,7 @@ struct DebugDrawEncoderImpl
 
 		flushQuad();
 		flush();
+		flushShapes();
 
 		m_encoder = NULL;
 		m_state   = State::Count;
@@ -1285,6 +1388,7 @@ struct DebugDrawEncoderImpl
 	{
 		BX_ASSERT(State::Count != m_state, "");
 
+		flushShapesOrdered();
 		softFlush();
 
 		m_state = State::MoveTo;
@@ -1561,6 +1665,8 @@ struct DebugDrawEncoderImpl
 
 	void draw(GeometryHandle _handle)
 	{
+		flushShapesOrdered();
+
 		const Geometry::Geometry& geometry = s_dds.m_geometry.m_geometry[_handle.idx];
 		m_encoder->setVertexBuffer(0, geometry.m_vbh);
 
@@ -1592,6 +1698,7 @@ struct DebugDrawEncoderImpl
 
 	void draw(bool _lineList, uint32_t _numVertices, const DdVertex* _vertices, uint32_t _numIndices, const uint16_t* _indices)
 	{
+		flushShapesOrdered();
 		flush();
 
 		if (_numVertices == bgfx::getAvailTransientVertexBuffer(_numVertices, DebugMeshVertex::ms_layout) )
@@ -1854,6 +1961,8 @@ struct DebugDrawEncoderImpl
 			return;
 		}
 
+		flushShapesOrdered();
+
 		if (m_posQuad == BX_COUNTOF(m_cacheQuad) )
 		{
 			flushQuad();
@@ -2115,6 +2224,12 @@ struct DebugDrawEncoderImpl
 
 	void draw(DebugMesh::Enum _mesh, const float* _mtx, uint16_t _num, bool _wireframe)
 	{
+		if (s_dds.m_instancing)
+		{
+			drawInstanced(_mesh, _mtx, _num, _wireframe);
+			return;
+		}
+
 		pushTransform(_mtx, _num, false /* flush */);
 
 		const DebugMesh& mesh = s_dds.m_mesh[_mesh];
@@ -2139,6 +2254,175 @@ struct DebugDrawEncoderImpl
 		popTransform(false /* flush */);
 	}
 
+	ShapeBatch& getShapeBatch(DebugMesh::Enum _mesh, uint64_t _state, bool _wireframe)
+	{
+		for (uint32_t ii = 0; ii < m_numShapeBatches; ++ii)
+		{
+			ShapeBatch& batch = m_shapeBatch[ii];
+			if (batch.m_mesh      == _mesh
+			&&  batch.m_state     == _state
+			&&  batch.m_wireframe == _wireframe)
+			{
+				return batch;
+			}
+		}
+
+		if (m_numShapeBatches == m_maxShapeBatches)
+		{
+			const uint32_t max = bx::uint32_max(16, m_maxShapeBatches*2);
+			m_shapeBatch = (ShapeBatch*)BX_REALLOC(s_dds.m_allocator, m_shapeBatch, max*sizeof(ShapeBatch) );
+			bx::memSet(&m_shapeBatch[m_maxShapeBatches], 0, (max-m_maxShapeBatches)*sizeof(ShapeBatch) );
+			m_maxShapeBatches = max;
+		}
+
+		ShapeBatch& batch = m_shapeBatch[m_numShapeBatches++];
+		batch.m_state     = _state;
+		batch.m_num       = 0;
+		batch.m_mesh      = uint8_t(_mesh);
+		batch.m_wireframe = _wireframe;
+
+		return batch;
+	}
+
+	void drawInstanced(DebugMesh::Enum _mesh, const float* _mtx, uint16_t _num, bool _wireframe)
+	{
+		BX_ASSERT(0 < _num && 2 >= _num, "Shape instance supports 1 or 2 matrices (requested %d).", _num);
+
+		const Attrib& attrib = m_attrib[m_stack];
+		const uint8_t alpha  = attrib.m_abgr >> 24;
+
+		// Lines and quads submitted before this shape must be drawn before it,
+		// when shape depends on draw order.
+		if (isOrdered(attrib) )
+		{
+			flushQuad();
+			flush();
+			m_shapesOrdered = true;
+		}
+
+		const uint64_t state = 0
+			| attrib.m_state
+			| (_wireframe ? BGFX_STATE_PT_LINES | BGFX_STATE_LINEAA | BGFX_STATE_BLEND_ALPHA
+			: (alpha < 0xff) ? BGFX_STATE_BLEND_ALPHA : 0)
+			;
+
+		ShapeBatch& batch = getShapeBatch(_mesh, state, _wireframe);
+
+		if (batch.m_num == batch.m_max)
+		{
+			batch.m_max      = bx::uint32_max(64, batch.m_max*2);
+			batch.m_instance = (ShapeInstance*)BX_REALLOC(s_dds.m_allocator, batch.m_instance, batch.m_max*sizeof(ShapeInstance) );
+		}
+
+		const MatrixStack& stack = m_mtxStack[m_mtxStackCurrent];
+
+		float mtx[2][16];
+		for (uint16_t ii = 0; ii < _num; ++ii)
+		{
+			if (NULL == stack.data)
+			{
+				bx::memCopy(mtx[ii], &_mtx[ii*16], 64);
+			}
+			else
+			{
+				bx::mtxMul(mtx[ii], &_mtx[ii*16], stack.data);
+			}
+		}
+
+		ShapeInstance& instance = batch.m_instance[batch.m_num++];
+
+		for (uint32_t ii = 0; ii < 3; ++ii)
+		{
+			instance.m_row[ii][0] = mtx[0][ii+ 0];
+			instance.m_row[ii][1] = mtx[0][ii+ 4];
+			instance.m_row[ii][2] = mtx[0][ii+ 8];
+			instance.m_row[ii][3] = mtx[0][ii+12];
+		}
+
+		// Second matrix of cone, cylinder, and capsule differs only in translation.
+		const bool ends = 2 == _num;
+		instance.m_offset[0] = ends ? mtx[1][12] - mtx[0][12] : 0.0f;
+		instance.m_offset[1] = ends ? mtx[1][13] - mtx[0][13] : 0.0f;
+		instance.m_offset[2] = ends ? mtx[1][14] - mtx[0][14] : 0.0f;
+		instance.m_offset[3] = 0.0f;
+
+		instance.m_color[0] = ( (attrib.m_abgr)       & 0xff) / 255.0f;
+		instance.m_color[1] = ( (attrib.m_abgr >> 8)  & 0xff) / 255.0f;
+		instance.m_color[2] = ( (attrib.m_abgr >> 16) & 0xff) / 255.0f;
+		instance.m_color[3] = alpha / 255.0f;
+	}
+
+	void flushShapes()
+	{
+		const uint16_t stride = uint16_t(sizeof(ShapeInstance) );
+
+		for (uint32_t ii = 0; ii < m_numShapeBatches; ++ii)
+		{
+			ShapeBatch& batch = m_shapeBatch[ii];
+
+			const uint32_t num = bgfx::getAvailInstanceDataBuffer(batch.m_num, stride);
+			BX_WARN(num == batch.m_num
+				, "Truncating instance data buffer for debug draw shapes to maximum available (requested %d, available %d)."
+				, batch.m_num
+				, num
+				);
+
+			if (0 < num)
+			{
+				bgfx::InstanceDataBuffer idb;
+				bgfx::allocInstanceDataBuffer(&idb, num, stride);
+				bx::memCopy(idb.data, batch.m_instance, num*stride);
+
+				const DebugMesh& mesh = s_dds.m_mesh[batch.m_mesh];
+
+				if (0 != mesh.m_numIndices[batch.m_wireframe])
+				{
+					m_encoder->setIndexBuffer(s_dds.m_ibh
+						, mesh.m_startIndex[batch.m_wireframe]
+						, mesh.m_numIndices[batch.m_wireframe]
+						);
+				}
+
+				// Material color comes from instance data, batch state already
+				// contains blending.
+				Attrib attrib;
+				attrib.m_state = batch.m_state;
+				attrib.m_abgr  = UINT32_MAX;
+				setUParams(attrib, batch.m_wireframe);
+
+				m_encoder->setVertexBuffer(0, s_dds.m_vbh, mesh.m_startVertex, mesh.m_numVertices);
+				m_encoder->setInstanceDataBuffer(&idb);
+				m_encoder->submit(m_viewId, s_dds.m_program[batch.m_wireframe ? Program::FillInstance : Program::FillLitInstance]);
+			}
+
+			batch.m_num = 0;
+		}
+
+		m_numShapeBatches = 0;
+		m_shapesOrdered   = false;
+	}
+
+	// Returns true when draws with attributes are blended or not depth tested,
+	// and result depends on draw order. Anti-aliased lines and wireframes are
+	// blended only at edges, so only translucent color is considered.
+	static bool isOrdered(const Attrib& _attrib)
+	{
+		return (_attrib.m_abgr >> 24) < 0xff
+			|| 0 == (_attrib.m_state & BGFX_STATE_DEPTH_TEST_MASK)
+			;
+	}
+
+	// Opaque depth tested shapes are drawn at the end, otherwise shape batches
+	// are drawn before the next primitive to preserve submission order.
+	void flushShapesOrdered()
+	{
+		if (0 != m_numShapeBatches
+		&& (m_shapesOrdered || isOrdered(m_attrib[m_stack]) ) )
+		{
+			flushShapes();
+		}
+	}
+
 	void softFlush()
 	{
 		if (m_pos == uint16_t(BX_COUNTOF(m_cache) ) )
@@ -2268,6 +2552,11 @@ struct DebugDrawEncoderImpl
 
 	MatrixStack m_mtxStack[32];
 
+	ShapeBatch* m_shapeBatch;
+	uint32_t    m_numShapeBatches;
+	uint32_t    m_maxShapeBatches;
+	bool        m_shapesOrdered;
+
 	bgfx::ViewId m_viewId;
 	uint8_t m_stack;
 	bool    m_depthTestLess;
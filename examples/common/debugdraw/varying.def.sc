@@ -8,3 +8,9 @@ vec4  v_color0    : COLOR = vec4(1.0, 0.0, 0.0, 1.0);
 float v_stipple   : TEXCOORD0 = 0.0;
 vec3  v_view      : TEXCOORD0 = vec3(0.0, 0.0, 0.0);
 vec3  v_world     : TEXCOORD1 = vec3(0.0, 0.0, 0.0);
+
+vec4  i_data0     : TEXCOORD7;
+vec4  i_data1     : TEXCOORD6;
+vec4  i_data2     : TEXCOORD5;
+vec4  i_data3     : TEXCOORD4;
+vec4  i_data4     : TEXCOORD3;
@@ -0,0 +1,17 @@
+$input a_position, a_indices, i_data0, i_data1, i_data2, i_data3, i_data4
+$output v_color0
+
+/*
+ * Copyright 2011-2022 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include <bgfx_shader.sh>
+
+void main()
+{
+	vec4 pos   = vec4(a_position, 1.0);
+	vec3 world = vec3(dot(i_data0, pos), dot(i_data1, pos), dot(i_data2, pos) ) + i_data3.xyz*float(a_indices.x);
+	gl_Position = mul(u_viewProj, vec4(world, 1.0) );
+	v_color0 = i_data4;
+}
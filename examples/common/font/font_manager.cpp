@@ -241,6 +241,9 @@ void FontManager::init()
 	m_cachedFonts = new CachedFont[MAX_OPENED_FONT];
 	m_buffer = new uint8_t[MAX_FONT_BUFFER_SIZE];
 
+	m_cacheHits   = 0;
+	m_cacheMisses = 0;
+
 	const uint32_t W = 3;
 	// Create filler rectangle
 	uint8_t buffer[W * W * 4];
@@ -251,6 +254,8 @@ void FontManager::init()
 
 	///make sure the black glyph doesn't bleed by using a one pixel inner outline
 	m_blackGlyph.regionIndex = m_atlas->addRegion(W, W, buffer, AtlasRegion::TYPE_GRAY, 1);
+	m_blackGlyph.regionGeneration = m_atlas->getRegionGeneration(m_blackGlyph.regionIndex);
+	m_atlas->pinRegion(m_blackGlyph.regionIndex);
 }
 
 FontManager::~FontManager()
@@ -394,7 +399,14 @@ bool FontManager::preloadGlyph(FontHandle _handle, CodePoint _codePoint)
 	GlyphHashMap::iterator iter = font.cachedGlyphs.find(_codePoint);
 	if (iter != font.cachedGlyphs.end() )
 	{
-		return true;
+		if (isGlyphValid(iter->second) )
+		{
+			m_atlas->touchRegion(iter->second.regionIndex);
+			return true;
+		}
+
+		// Atlas region was recycled, bake glyph again.
+		font.cachedGlyphs.erase(iter);
 	}
 
 	if (NULL != font.trueTypeFont)
@@ -471,7 +483,13 @@ bool FontManager::addGlyphBitmap(FontHandle _handle, CodePoint _codePoint, uint1
 	GlyphHashMap::iterator iter = font.cachedGlyphs.find(_codePoint);
 	if (iter != font.cachedGlyphs.end() )
 	{
-		return true;
+		if (isGlyphValid(iter->second) )
+		{
+			m_atlas->touchRegion(iter->second.regionIndex);
+			return true;
+		}
+
+		font.cachedGlyphs.erase(iter);
 	}
 
 	GlyphInfo glyphInfo;
@@ -506,6 +524,13 @@ bool FontManager::addGlyphBitmap(FontHandle _handle, CodePoint _codePoint, uint1
 		, AtlasRegion::TYPE_BGRA8
 		);
 
+	if (UINT16_MAX == glyphInfo.regionIndex)
+	{
+		return false;
+	}
+
+	glyphInfo.regionGeneration = m_atlas->getRegionGeneration(glyphInfo.regionIndex);
+
 	font.cachedGlyphs[_codePoint] = glyphInfo;
 	return true;
 }
@@ -535,8 +560,16 @@ const GlyphInfo* FontManager::getGlyphInfo(FontHandle _handle, CodePoint _codePo
 	const GlyphHashMap& cachedGlyphs = m_cachedFonts[_handle.idx].cachedGlyphs;
 	GlyphHashMap::const_iterator it = cachedGlyphs.find(_codePoint);
 
-	if (it == cachedGlyphs.end() )
+	if (it != cachedGlyphs.end()
+	&&  isGlyphValid(it->second) )
 	{
+		m_cacheHits++;
+		m_atlas->touchRegion(it->second.regionIndex);
+	}
+	else
+	{
+		m_cacheMisses++;
+
 		if (!preloadGlyph(_handle, _codePoint) )
 		{
 			return NULL;
@@ -557,5 +590,43 @@ bool FontManager::addBitmap(GlyphInfo& _glyphInfo, const uint8_t* _data)
 		, _data
 		, AtlasRegion::TYPE_GRAY
 		);
+
+	if (UINT16_MAX == _glyphInfo.regionIndex)
+	{
+		return false;
+	}
+
+	_glyphInfo.regionGeneration = m_atlas->getRegionGeneration(_glyphInfo.regionIndex);
 	return true;
 }
+
+bool FontManager::isGlyphValid(const GlyphInfo& _glyphInfo) const
+{
+	return UINT16_MAX != _glyphInfo.regionIndex
+		&& m_atlas->getRegionGeneration(_glyphInfo.regionIndex) == _glyphInfo.regionGeneration
+		;
+}
+
+void FontManager::addGlyphRef(uint16_t _regionIndex)
+{
+	m_atlas->addRef(_regionIndex);
+}
+
+void FontManager::releaseGlyphRef(uint16_t _regionIndex)
+{
+	m_atlas->release(_regionIndex);
+}
+
+void FontManager::update()
+{
+	m_atlas->update();
+}
+
+void FontManager::getCacheStats(GlyphCacheStats& _outStats) const
+{
+	_outStats.numHits      = m_cacheHits;
+	_outStats.numMisses    = m_cacheMisses;
+	_outStats.numEvictions = m_atlas->getEvictionCount();
+	_outStats.numUploads   = m_atlas->getUploadCount();
+	_outStats.numRegions   = m_atlas->getRegionCount();
+}
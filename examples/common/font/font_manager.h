@@ -122,6 +122,29 @@ struct GlyphInfo
 
 	/// Region index in the atlas storing textures.
 	uint16_t regionIndex;
+
+	/// Generation of atlas region, when it doesn't match the region was
+	/// evicted and the glyph must be baked again.
+	uint16_t regionGeneration;
+};
+
+/// Glyph cache statistics.
+struct GlyphCacheStats
+{
+	/// Number of glyph lookups found in cache.
+	uint32_t numHits;
+
+	/// Number of glyph lookups which required baking the glyph.
+	uint32_t numMisses;
+
+	/// Number of atlas regions evicted to make room for new glyphs.
+	uint32_t numEvictions;
+
+	/// Number of atlas texture updates.
+	uint32_t numUploads;
+
+	/// Number of regions allocated in the atlas.
+	uint16_t numRegions;
 };
 
 BGFX_HANDLE(TrueTypeHandle)
@@ -193,6 +216,21 @@ public:
 		return m_blackGlyph;
 	}
 
+	/// Keep the atlas region of a glyph from being recycled, until the
+	/// reference is released. Used by text buffers which keep the glyph UVs.
+	void addGlyphRef(uint16_t _regionIndex);
+
+	/// Release a reference added with addGlyphRef().
+	void releaseGlyphRef(uint16_t _regionIndex);
+
+	/// Advance the glyph cache LRU, glyphs are recycled only when this is
+	/// called once per frame. Glyphs baked since the last upload are
+	/// uploaded to the atlas texture.
+	void update();
+
+	/// Return glyph cache statistics.
+	void getCacheStats(GlyphCacheStats& _outStats) const;
+
 private:
 	struct CachedFont;
 	struct CachedFile
@@ -203,6 +241,7 @@ private:
 
 	void init();
 	bool addBitmap(GlyphInfo& _glyphInfo, const uint8_t* _data);
+	bool isGlyphValid(const GlyphInfo& _glyphInfo) const;
 
 	bool m_ownAtlas;
 	Atlas* m_atlas;
@@ -217,6 +256,9 @@ private:
 
 	//temporary buffer to raster glyph
 	uint8_t* m_buffer;
+
+	uint32_t m_cacheHits;
+	uint32_t m_cacheMisses;
 };
 
 #endif // FONT_MANAGER_H_HEADER_GUARD
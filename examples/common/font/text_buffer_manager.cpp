@@ -237,6 +237,9 @@ private:
 			 ;
 	}
 
+	void addGlyphRef(uint16_t _regionIndex);
+	void releaseGlyphRefs();
+
 	void setVertex(uint32_t _i, float _x, float _y, uint32_t _rgba, uint8_t _style = STYLE_NORMAL)
 	{
 		m_vertexBuffer[_i].x = _x;
@@ -299,6 +302,11 @@ private:
 	uint16_t* m_indexBuffer;
 	uint8_t* m_styleBuffer;
 
+	// Atlas regions of glyphs referenced by the vertex buffer, they are
+	// kept from being recycled until the buffer is cleared.
+	uint16_t* m_glyphRefBuffer;
+	uint32_t m_glyphRefCount;
+
 	uint32_t m_indexCount;
 	uint32_t m_lineStartIndex;
 	uint16_t m_vertexCount;
@@ -327,6 +335,8 @@ TextBuffer::TextBuffer(FontManager* _fontManager)
 	, m_vertexBuffer(new TextVertex[MAX_BUFFERED_CHARACTERS * 4])
 	, m_indexBuffer(new uint16_t[MAX_BUFFERED_CHARACTERS * 6])
 	, m_styleBuffer(new uint8_t[MAX_BUFFERED_CHARACTERS * 4])
+	, m_glyphRefBuffer(new uint16_t[MAX_BUFFERED_CHARACTERS])
+	, m_glyphRefCount(0)
 	, m_indexCount(0)
 	, m_lineStartIndex(0)
 	, m_vertexCount(0)
@@ -339,6 +349,9 @@ TextBuffer::TextBuffer(FontManager* _fontManager)
 
 TextBuffer::~TextBuffer()
 {
+	releaseGlyphRefs();
+
+	delete [] m_glyphRefBuffer;
 	delete [] m_vertexBuffer;
 	delete [] m_indexBuffer;
 	delete [] m_styleBuffer;
@@ -480,6 +493,8 @@ void TextBuffer::appendAtlasFace(uint16_t _faceIndex)
 
 void TextBuffer::clearTextBuffer()
 {
+	releaseGlyphRefs();
+
 	m_penX = 0;
 	m_penY = 0;
 	m_originX = 0;
@@ -572,6 +587,7 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint, bool shad
 
 			bx::memSet(&m_vertexBuffer[m_vertexCount], 0, sizeof(TextVertex) * 4);
 
+			addGlyphRef(glyph->regionIndex);
 			atlas->packUV(glyph->regionIndex
 				, (uint8_t*)m_vertexBuffer
 				, sizeof(TextVertex) * m_vertexCount + offsetof(TextVertex, u2)
@@ -731,6 +747,7 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint, bool shad
 	{
 		bx::memSet(&m_vertexBuffer[m_vertexCount], 0, sizeof(TextVertex) * 4);
 
+		addGlyphRef(glyph->regionIndex);
 		atlas->packUV(glyph->regionIndex
 			, (uint8_t*)m_vertexBuffer
 			, sizeof(TextVertex) * m_vertexCount + offsetof(TextVertex, u1)
@@ -754,6 +771,7 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint, bool shad
 	{
 		bx::memSet(&m_vertexBuffer[m_vertexCount], 0, sizeof(TextVertex) * 4);
 
+		addGlyphRef(glyph->regionIndex);
 		atlas->packUV(glyph->regionIndex
 			, (uint8_t*)m_vertexBuffer
 			, sizeof(TextVertex) * m_vertexCount + offsetof(TextVertex, u)
@@ -799,6 +817,25 @@ void TextBuffer::appendGlyph(FontHandle _handle, CodePoint _codePoint, bool shad
 	m_previousCodePoint = _codePoint;
 }
 
+void TextBuffer::addGlyphRef(uint16_t _regionIndex)
+{
+	if (m_glyphRefCount < MAX_BUFFERED_CHARACTERS)
+	{
+		m_fontManager->addGlyphRef(_regionIndex);
+		m_glyphRefBuffer[m_glyphRefCount++] = _regionIndex;
+	}
+}
+
+void TextBuffer::releaseGlyphRefs()
+{
+	for (uint32_t ii = 0; ii < m_glyphRefCount; ++ii)
+	{
+		m_fontManager->releaseGlyphRef(m_glyphRefBuffer[ii]);
+	}
+
+	m_glyphRefCount = 0;
+}
+
 void TextBuffer::verticalCenterLastLine(float _dy, float _top, float _bottom)
 {
 	for (uint32_t ii = m_lineStartIndex; ii < m_vertexCount; ii += 4)
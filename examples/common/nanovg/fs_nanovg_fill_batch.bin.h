@@ -0,0 +1,1057 @@
+static const uint8_t fs_nanovg_fill_batch_glsl[3717] =
+{
+	0x46, 0x53, 0x48, 0x0b, 0x3c, 0x9c, 0x87, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x73, // FSH.<..|.......s
+	0x5f, 0x74, 0x65, 0x78, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, // _tex...........s
+	0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // _paint..........
+	0x50, 0x0e, 0x00, 0x00, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6e, 0x67, 0x20, 0x76, 0x65, 0x63, 0x32, // P...varying vec2
+	0x20, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x3b, 0x0a, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6e, //  v_paint;.varyin
+	0x67, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, // g vec2 v_positio
+	0x6e, 0x3b, 0x0a, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6e, 0x67, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, // n;.varying vec2 
+	0x76, 0x5f, 0x74, 0x65, 0x78, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x30, 0x3b, 0x0a, 0x75, 0x6e, 0x69, // v_texcoord0;.uni
+	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x73, // form sampler2D s
+	0x5f, 0x74, 0x65, 0x78, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x73, 0x61, // _tex;.uniform sa
+	0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x3b, // mpler2D s_paint;
+	0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x20, 0x28, 0x29, 0x0a, 0x7b, 0x0a, // .void main ().{.
+	0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x31, 0x3b, //   vec4 result_1;
+	0x0a, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, // .  vec4 tmpvar_2
+	0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x20, 0x3d, 0x20, 0x74, // ;.  tmpvar_2 = t
+	0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x20, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, // exture2D (s_pain
+	0x74, 0x2c, 0x20, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x76, // t, v_paint);.  v
+	0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x3b, 0x0a, 0x20, 0x20, // ec2 tmpvar_3;.  
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x2e, 0x78, 0x20, 0x3d, 0x20, 0x28, 0x76, 0x5f, // tmpvar_3.x = (v_
+	0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x30, 0x30, 0x33, 0x39, // paint.x + 0.0039
+	0x30, 0x36, 0x32, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, // 0625);.  tmpvar_
+	0x33, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x79, 0x3b, // 3.y = v_paint.y;
+	0x0a, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x34, // .  vec4 tmpvar_4
+	0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x34, 0x20, 0x3d, 0x20, 0x74, // ;.  tmpvar_4 = t
+	0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x20, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, // exture2D (s_pain
+	0x74, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20, // t, tmpvar_3);.  
+	0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x35, 0x3b, 0x0a, 0x20, // vec2 tmpvar_5;. 
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x35, 0x2e, 0x78, 0x20, 0x3d, 0x20, 0x28, 0x76, //  tmpvar_5.x = (v
+	0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x30, 0x30, 0x37, // _paint.x + 0.007
+	0x38, 0x31, 0x32, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, // 8125);.  tmpvar_
+	0x35, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x79, 0x3b, // 5.y = v_paint.y;
+	0x0a, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x36, // .  vec4 tmpvar_6
+	0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x36, 0x20, 0x3d, 0x20, 0x74, // ;.  tmpvar_6 = t
+	0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x20, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, // exture2D (s_pain
+	0x74, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, // t, tmpvar_5);.  
+	0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x37, 0x3b, 0x0a, 0x20, // vec2 tmpvar_7;. 
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x37, 0x2e, 0x78, 0x20, 0x3d, 0x20, 0x28, 0x76, //  tmpvar_7.x = (v
+	0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x30, 0x31, 0x31, // _paint.x + 0.011
+	0x37, 0x31, 0x38, 0x37, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // 71875);.  tmpvar
+	0x5f, 0x37, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x79, // _7.y = v_paint.y
+	0x3b, 0x0a, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, // ;.  vec4 tmpvar_
+	0x38, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x20, 0x3d, 0x20, // 8;.  tmpvar_8 = 
+	0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x20, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, // texture2D (s_pai
+	0x6e, 0x74, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x37, 0x29, 0x3b, 0x0a, 0x20, // nt, tmpvar_7);. 
+	0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x39, 0x3b, 0x0a, //  vec2 tmpvar_9;.
+	0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x39, 0x2e, 0x78, 0x20, 0x3d, 0x20, 0x28, //   tmpvar_9.x = (
+	0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x30, 0x31, // v_paint.x + 0.01
+	0x35, 0x36, 0x32, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, // 5625);.  tmpvar_
+	0x39, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x79, 0x3b, // 9.y = v_paint.y;
+	0x0a, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, // .  vec4 tmpvar_1
+	0x30, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x30, 0x20, 0x3d, // 0;.  tmpvar_10 =
+	0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x20, 0x28, 0x73, 0x5f, 0x70, 0x61, //  texture2D (s_pa
+	0x69, 0x6e, 0x74, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x39, 0x29, 0x3b, 0x0a, // int, tmpvar_9);.
+	0x20, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x31, //   vec2 tmpvar_11
+	0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x31, 0x2e, 0x78, 0x20, // ;.  tmpvar_11.x 
+	0x3d, 0x20, 0x28, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, // = (v_paint.x + 0
+	0x2e, 0x30, 0x31, 0x39, 0x35, 0x33, 0x31, 0x32, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, // .01953125);.  tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x31, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x5f, 0x70, 0x61, // pvar_11.y = v_pa
+	0x69, 0x6e, 0x74, 0x2e, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, // int.y;.  vec4 tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, // pvar_12;.  tmpva
+	0x72, 0x5f, 0x31, 0x32, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, // r_12 = texture2D
+	0x20, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, //  (s_paint, tmpva
+	0x72, 0x5f, 0x31, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, // r_11);.  vec2 tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, // pvar_13;.  tmpva
+	0x72, 0x5f, 0x31, 0x33, 0x2e, 0x78, 0x20, 0x3d, 0x20, 0x28, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, // r_13.x = (v_pain
+	0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x30, 0x32, 0x33, 0x34, 0x33, 0x37, 0x35, 0x29, // t.x + 0.0234375)
+	0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x33, 0x2e, 0x79, 0x20, // ;.  tmpvar_13.y 
+	0x3d, 0x20, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x76, // = v_paint.y;.  v
+	0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x34, 0x3b, 0x0a, 0x20, // ec4 tmpvar_14;. 
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x34, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, //  tmpvar_14 = tex
+	0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x20, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2c, // ture2D (s_paint,
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x76, //  tmpvar_13);.  v
+	0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x35, 0x3b, 0x0a, 0x20, // ec2 tmpvar_15;. 
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x35, 0x2e, 0x78, 0x20, 0x3d, 0x20, 0x28, //  tmpvar_15.x = (
+	0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x30, 0x32, // v_paint.x + 0.02
+	0x37, 0x33, 0x34, 0x33, 0x37, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, // 734375);.  tmpva
+	0x72, 0x5f, 0x31, 0x35, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, // r_15.y = v_paint
+	0x2e, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, // .y;.  vec4 tmpva
+	0x72, 0x5f, 0x31, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, // r_16;.  tmpvar_1
+	0x36, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x20, 0x28, 0x73, // 6 = texture2D (s
+	0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, // _paint, tmpvar_1
+	0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, // 5);.  vec3 tmpva
+	0x72, 0x5f, 0x31, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, // r_17;.  tmpvar_1
+	0x37, 0x2e, 0x7a, 0x20, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, // 7.z = 1.0;.  tmp
+	0x76, 0x61, 0x72, 0x5f, 0x31, 0x37, 0x2e, 0x78, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x5f, 0x70, 0x6f, // var_17.xy = v_po
+	0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, // sition;.  float 
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x76, 0x65, 0x63, // tmpvar_18;.  vec
+	0x32, 0x20, 0x73, 0x63, 0x5f, 0x31, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, // 2 sc_19;.  vec3 
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, // tmpvar_20;.  tmp
+	0x76, 0x61, 0x72, 0x5f, 0x32, 0x30, 0x2e, 0x7a, 0x20, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, // var_20.z = 1.0;.
+	0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x30, 0x2e, 0x78, 0x79, 0x20, 0x3d, //   tmpvar_20.xy =
+	0x20, 0x76, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x76, //  v_position;.  v
+	0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x31, 0x3b, 0x0a, 0x20, // ec2 tmpvar_21;. 
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x31, 0x2e, 0x78, 0x20, 0x3d, 0x20, 0x64, //  tmpvar_21.x = d
+	0x6f, 0x74, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x2e, 0x78, 0x79, 0x7a, // ot (tmpvar_2.xyz
+	0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, // , tmpvar_20);.  
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x31, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x64, 0x6f, // tmpvar_21.y = do
+	0x74, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x34, 0x2e, 0x78, 0x79, 0x7a, 0x2c, // t (tmpvar_4.xyz,
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x73, //  tmpvar_20);.  s
+	0x63, 0x5f, 0x31, 0x39, 0x20, 0x3d, 0x20, 0x28, 0x76, 0x65, 0x63, 0x32, 0x28, 0x30, 0x2e, 0x35, // c_19 = (vec2(0.5
+	0x2c, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2d, 0x20, 0x28, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, // , 0.5) - ((.    
+	0x61, 0x62, 0x73, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x31, 0x29, 0x0a, 0x20, // abs(tmpvar_21). 
+	0x20, 0x20, 0x2d, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x34, 0x2e, 0x78, 0x79, //   - tmpvar_14.xy
+	0x29, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x34, 0x2e, 0x7a, 0x77, // ) * tmpvar_14.zw
+	0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x38, 0x20, // ));.  tmpvar_18 
+	0x3d, 0x20, 0x28, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x20, 0x28, 0x73, 0x63, 0x5f, 0x31, 0x39, 0x2e, // = (clamp (sc_19.
+	0x78, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x20, 0x2a, 0x20, 0x63, // x, 0.0, 1.0) * c
+	0x6c, 0x61, 0x6d, 0x70, 0x20, 0x28, 0x73, 0x63, 0x5f, 0x31, 0x39, 0x2e, 0x79, 0x2c, 0x20, 0x30, // lamp (sc_19.y, 0
+	0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, // .0, 1.0));.  flo
+	0x61, 0x74, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x32, 0x3b, 0x0a, 0x20, 0x20, // at tmpvar_22;.  
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x6d, 0x69, 0x6e, // tmpvar_22 = (min
+	0x20, 0x28, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x31, 0x2e, //  (1.0, (.    (1.
+	0x30, 0x20, 0x2d, 0x20, 0x61, 0x62, 0x73, 0x28, 0x28, 0x28, 0x76, 0x5f, 0x74, 0x65, 0x78, 0x63, // 0 - abs(((v_texc
+	0x6f, 0x6f, 0x72, 0x64, 0x30, 0x2e, 0x78, 0x20, 0x2a, 0x20, 0x32, 0x2e, 0x30, 0x29, 0x20, 0x2d, // oord0.x * 2.0) -
+	0x20, 0x31, 0x2e, 0x30, 0x29, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, //  1.0))).   * tmp
+	0x76, 0x61, 0x72, 0x5f, 0x32, 0x2e, 0x77, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x6d, 0x69, 0x6e, 0x20, // var_2.w)) * min 
+	0x28, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x76, 0x5f, 0x74, 0x65, 0x78, 0x63, 0x6f, 0x6f, 0x72, 0x64, // (1.0, v_texcoord
+	0x30, 0x2e, 0x79, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x74, 0x6d, // 0.y));.  if ((tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x36, 0x2e, 0x77, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x2e, 0x30, 0x29, // pvar_6.w == 0.0)
+	0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, // ) {.    vec2 tmp
+	0x76, 0x61, 0x72, 0x5f, 0x32, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, // var_23;.    tmpv
+	0x61, 0x72, 0x5f, 0x32, 0x33, 0x2e, 0x78, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x74, 0x20, 0x28, 0x74, // ar_23.x = dot (t
+	0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x36, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x74, 0x6d, 0x70, // mpvar_6.xyz, tmp
+	0x76, 0x61, 0x72, 0x5f, 0x31, 0x37, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, // var_17);.    tmp
+	0x76, 0x61, 0x72, 0x5f, 0x32, 0x33, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x74, 0x20, 0x28, // var_23.y = dot (
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x74, 0x6d, // tmpvar_8.xyz, tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x37, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, // pvar_17);.    ve
+	0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x34, 0x3b, 0x0a, 0x20, 0x20, // c2 tmpvar_24;.  
+	0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x34, 0x20, 0x3d, 0x20, 0x28, 0x61, //   tmpvar_24 = (a
+	0x62, 0x73, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x33, 0x29, 0x20, 0x2d, 0x20, // bs(tmpvar_23) - 
+	0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x36, 0x2e, 0x78, 0x79, 0x20, 0x2d, 0x20, // (tmpvar_16.xy - 
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x36, 0x2e, 0x7a, 0x7a, 0x29, 0x29, 0x3b, 0x0a, // tmpvar_16.zz));.
+	0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, //     vec2 tmpvar_
+	0x32, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, // 25;.    tmpvar_2
+	0x35, 0x20, 0x3d, 0x20, 0x6d, 0x61, 0x78, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, // 5 = max (tmpvar_
+	0x32, 0x34, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, // 24, 0.0);.    re
+	0x73, 0x75, 0x6c, 0x74, 0x5f, 0x31, 0x20, 0x3d, 0x20, 0x28, 0x6d, 0x69, 0x78, 0x20, 0x28, 0x74, // sult_1 = (mix (t
+	0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x30, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // mpvar_10, tmpvar
+	0x5f, 0x31, 0x32, 0x2c, 0x20, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, // _12, clamp (.   
+	0x20, 0x20, 0x20, 0x28, 0x28, 0x28, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    ((((.        
+	0x6d, 0x69, 0x6e, 0x20, 0x28, 0x6d, 0x61, 0x78, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // min (max (tmpvar
+	0x5f, 0x32, 0x34, 0x2e, 0x78, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x34, // _24.x, tmpvar_24
+	0x2e, 0x79, 0x29, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .y), 0.0).      
+	0x20, 0x2b, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x72, 0x74, //  + .        sqrt
+	0x28, 0x64, 0x6f, 0x74, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x35, 0x2c, // (dot (tmpvar_25,
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x35, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, //  tmpvar_25)).   
+	0x20, 0x20, 0x20, 0x29, 0x20, 0x2d, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x36, //    ) - tmpvar_16
+	0x2e, 0x7a, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x2e, // .z) + (tmpvar_8.
+	0x77, 0x20, 0x2a, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x29, 0x20, 0x2f, 0x20, 0x74, 0x6d, 0x70, 0x76, // w * 0.5)) / tmpv
+	0x61, 0x72, 0x5f, 0x38, 0x2e, 0x77, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2c, 0x20, 0x30, 0x2e, // ar_8.w).    , 0.
+	0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, // 0, 1.0)) * (tmpv
+	0x61, 0x72, 0x5f, 0x32, 0x32, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, // ar_22 * tmpvar_1
+	0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, // 8));.  } else {.
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, //     if ((tmpvar_
+	0x36, 0x2e, 0x77, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, // 6.w == 1.0)) {. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, //      vec4 color_
+	0x32, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, // 26;.      vec2 t
+	0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // mpvar_27;.      
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x37, 0x2e, 0x78, 0x20, 0x3d, 0x20, 0x64, 0x6f, // tmpvar_27.x = do
+	0x74, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x36, 0x2e, 0x78, 0x79, 0x7a, 0x2c, // t (tmpvar_6.xyz,
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x37, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, //  tmpvar_17);.   
+	0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x37, 0x2e, 0x79, 0x20, 0x3d, //    tmpvar_27.y =
+	0x20, 0x64, 0x6f, 0x74, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x2e, 0x78, //  dot (tmpvar_8.x
+	0x79, 0x7a, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x37, 0x29, 0x3b, 0x0a, // yz, tmpvar_17);.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, //       vec4 tmpva
+	0x72, 0x5f, 0x32, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, // r_28;.      tmpv
+	0x61, 0x72, 0x5f, 0x32, 0x38, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, // ar_28 = texture2
+	0x44, 0x20, 0x28, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x2c, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, // D (s_tex, (tmpva
+	0x72, 0x5f, 0x32, 0x37, 0x20, 0x2f, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x36, // r_27 / tmpvar_16
+	0x2e, 0x78, 0x79, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, // .xy));.      col
+	0x6f, 0x72, 0x5f, 0x32, 0x36, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, // or_26 = tmpvar_2
+	0x38, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x74, 0x6d, // 8;.      if ((tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x34, 0x2e, 0x77, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x29, // pvar_4.w == 1.0)
+	0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, // ) {.        vec4
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, //  tmpvar_29;.    
+	0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x39, 0x2e, 0x78, 0x79, //     tmpvar_29.xy
+	0x7a, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x38, 0x2e, 0x78, // z = (tmpvar_28.x
+	0x79, 0x7a, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x38, 0x2e, 0x77, // yz * tmpvar_28.w
+	0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, // );.        tmpva
+	0x72, 0x5f, 0x32, 0x39, 0x2e, 0x77, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, // r_29.w = tmpvar_
+	0x32, 0x38, 0x2e, 0x77, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, // 28.w;.        co
+	0x6c, 0x6f, 0x72, 0x5f, 0x32, 0x36, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, // lor_26 = tmpvar_
+	0x32, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, // 29;.      };.   
+	0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x34, //    if ((tmpvar_4
+	0x2e, 0x77, 0x20, 0x3d, 0x3d, 0x20, 0x32, 0x2e, 0x30, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, // .w == 2.0)) {.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x32, 0x36, 0x20, 0x3d, //       color_26 =
+	0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x32, 0x36, 0x2e, 0x78, 0x78, 0x78, 0x78, 0x3b, 0x0a, //  color_26.xxxx;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, //       };.      c
+	0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x32, 0x36, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, // olor_26 = (color
+	0x5f, 0x32, 0x36, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x30, 0x29, // _26 * tmpvar_10)
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x32, 0x36, // ;.      color_26
+	0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x32, 0x36, 0x20, 0x2a, 0x20, 0x28, //  = (color_26 * (
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x32, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, // tmpvar_22 * tmpv
+	0x61, 0x72, 0x5f, 0x31, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, // ar_18));.      r
+	0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x31, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, // esult_1 = color_
+	0x32, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, // 26;.    } else {
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x76, // .      if ((tmpv
+	0x61, 0x72, 0x5f, 0x36, 0x2e, 0x77, 0x20, 0x3d, 0x3d, 0x20, 0x33, 0x2e, 0x30, 0x29, 0x29, 0x20, // ar_6.w == 3.0)) 
+	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x63, // {.        vec4 c
+	0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x33, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // olor_30;.       
+	0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x31, 0x3b, //  vec4 tmpvar_31;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, // .        tmpvar_
+	0x33, 0x31, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x20, 0x28, // 31 = texture2D (
+	0x73, 0x5f, 0x74, 0x65, 0x78, 0x2c, 0x20, 0x76, 0x5f, 0x74, 0x65, 0x78, 0x63, 0x6f, 0x6f, 0x72, // s_tex, v_texcoor
+	0x64, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, // d0);.        col
+	0x6f, 0x72, 0x5f, 0x33, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, // or_30 = tmpvar_3
+	0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, // 1;.        if ((
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x34, 0x2e, 0x77, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x2e, // tmpvar_4.w == 1.
+	0x30, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 0)) {.          
+	0x76, 0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x32, 0x3b, 0x0a, // vec4 tmpvar_32;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, //           tmpvar
+	0x5f, 0x33, 0x32, 0x2e, 0x78, 0x79, 0x7a, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, // _32.xyz = (tmpva
+	0x72, 0x5f, 0x33, 0x31, 0x2e, 0x78, 0x79, 0x7a, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, // r_31.xyz * tmpva
+	0x72, 0x5f, 0x33, 0x31, 0x2e, 0x77, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // r_31.w);.       
+	0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x32, 0x2e, 0x77, 0x20, 0x3d, //    tmpvar_32.w =
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x31, 0x2e, 0x77, 0x3b, 0x0a, 0x20, 0x20, //  tmpvar_31.w;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x33, 0x30, //         color_30
+	0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x32, 0x3b, 0x0a, 0x20, 0x20, //  = tmpvar_32;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //       };.       
+	0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x34, 0x2e, 0x77, //  if ((tmpvar_4.w
+	0x20, 0x3d, 0x3d, 0x20, 0x32, 0x2e, 0x30, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, //  == 2.0)) {.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x33, 0x30, 0x20, 0x3d, //       color_30 =
+	0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x33, 0x30, 0x2e, 0x78, 0x78, 0x78, 0x78, 0x3b, 0x0a, //  color_30.xxxx;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //         };.     
+	0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x33, 0x30, 0x20, 0x3d, 0x20, 0x28, 0x63, //    color_30 = (c
+	0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x33, 0x30, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // olor_30 * tmpvar
+	0x5f, 0x31, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, // _18);.        re
+	0x73, 0x75, 0x6c, 0x74, 0x5f, 0x31, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, // sult_1 = (color_
+	0x33, 0x30, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x30, 0x29, 0x3b, // 30 * tmpvar_10);
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x3b, // .      };.    };
+	0x0a, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x67, 0x6c, 0x5f, 0x46, 0x72, 0x61, 0x67, 0x43, // .  };.  gl_FragC
+	0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x31, 0x3b, // olor = result_1;
+	0x0a, 0x7d, 0x0a, 0x0a, 0x00,                                                                   // .}...
+};
+static const uint8_t fs_nanovg_fill_batch_essl[3904] =
+{
+	0x46, 0x53, 0x48, 0x0b, 0x3c, 0x9c, 0x87, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x73, // FSH.<..|.......s
+	0x5f, 0x74, 0x65, 0x78, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, // _tex...........s
+	0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // _paint..........
+	0x0b, 0x0f, 0x00, 0x00, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6e, 0x67, 0x20, 0x68, 0x69, 0x67, 0x68, // ....varying high
+	0x70, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x3b, 0x0a, // p vec2 v_paint;.
+	0x76, 0x61, 0x72, 0x79, 0x69, 0x6e, 0x67, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x76, 0x65, // varying highp ve
+	0x63, 0x32, 0x20, 0x76, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x0a, 0x76, // c2 v_position;.v
+	0x61, 0x72, 0x79, 0x69, 0x6e, 0x67, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x76, 0x65, 0x63, // arying highp vec
+	0x32, 0x20, 0x76, 0x5f, 0x74, 0x65, 0x78, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x30, 0x3b, 0x0a, 0x75, // 2 v_texcoord0;.u
+	0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, // niform sampler2D
+	0x20, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, //  s_tex;.uniform 
+	0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, // sampler2D s_pain
+	0x74, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x20, 0x28, 0x29, 0x0a, // t;.void main ().
+	0x7b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x72, 0x65, // {.  lowp vec4 re
+	0x73, 0x75, 0x6c, 0x74, 0x5f, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, // sult_1;.  lowp v
+	0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x3b, 0x0a, 0x20, 0x20, // ec4 tmpvar_2;.  
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, // tmpvar_2 = textu
+	0x72, 0x65, 0x32, 0x44, 0x20, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x76, // re2D (s_paint, v
+	0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, // _paint);.  highp
+	0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x3b, 0x0a, //  vec2 tmpvar_3;.
+	0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x2e, 0x78, 0x20, 0x3d, 0x20, 0x28, //   tmpvar_3.x = (
+	0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x30, 0x30, // v_paint.x + 0.00
+	0x33, 0x39, 0x30, 0x36, 0x32, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, // 390625);.  tmpva
+	0x72, 0x5f, 0x33, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, // r_3.y = v_paint.
+	0x79, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, // y;.  lowp vec4 t
+	0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, // mpvar_4;.  tmpva
+	0x72, 0x5f, 0x34, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x20, // r_4 = texture2D 
+	0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // (s_paint, tmpvar
+	0x5f, 0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x76, 0x65, 0x63, // _3);.  highp vec
+	0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, // 2 tmpvar_5;.  tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x35, 0x2e, 0x78, 0x20, 0x3d, 0x20, 0x28, 0x76, 0x5f, 0x70, 0x61, // pvar_5.x = (v_pa
+	0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x30, 0x30, 0x37, 0x38, 0x31, 0x32, // int.x + 0.007812
+	0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x35, 0x2e, 0x79, // 5);.  tmpvar_5.y
+	0x20, 0x3d, 0x20, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x79, 0x3b, 0x0a, 0x20, 0x20, //  = v_paint.y;.  
+	0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // lowp vec4 tmpvar
+	0x5f, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x36, 0x20, 0x3d, // _6;.  tmpvar_6 =
+	0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x20, 0x28, 0x73, 0x5f, 0x70, 0x61, //  texture2D (s_pa
+	0x69, 0x6e, 0x74, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x35, 0x29, 0x3b, 0x0a, // int, tmpvar_5);.
+	0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, //   highp vec2 tmp
+	0x76, 0x61, 0x72, 0x5f, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, // var_7;.  tmpvar_
+	0x37, 0x2e, 0x78, 0x20, 0x3d, 0x20, 0x28, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, // 7.x = (v_paint.x
+	0x20, 0x2b, 0x20, 0x30, 0x2e, 0x30, 0x31, 0x31, 0x37, 0x31, 0x38, 0x37, 0x35, 0x29, 0x3b, 0x0a, //  + 0.01171875);.
+	0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x37, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x76, //   tmpvar_7.y = v
+	0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, // _paint.y;.  lowp
+	0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x3b, 0x0a, //  vec4 tmpvar_8;.
+	0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, //   tmpvar_8 = tex
+	0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x20, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2c, // ture2D (s_paint,
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x37, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x69, //  tmpvar_7);.  hi
+	0x67, 0x68, 0x70, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, // ghp vec2 tmpvar_
+	0x39, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x39, 0x2e, 0x78, 0x20, // 9;.  tmpvar_9.x 
+	0x3d, 0x20, 0x28, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, // = (v_paint.x + 0
+	0x2e, 0x30, 0x31, 0x35, 0x36, 0x32, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, // .015625);.  tmpv
+	0x61, 0x72, 0x5f, 0x39, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, // ar_9.y = v_paint
+	0x2e, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, // .y;.  lowp vec4 
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, // tmpvar_10;.  tmp
+	0x76, 0x61, 0x72, 0x5f, 0x31, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, // var_10 = texture
+	0x32, 0x44, 0x20, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x74, 0x6d, 0x70, // 2D (s_paint, tmp
+	0x76, 0x61, 0x72, 0x5f, 0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, // var_9);.  highp 
+	0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x31, 0x3b, 0x0a, // vec2 tmpvar_11;.
+	0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x31, 0x2e, 0x78, 0x20, 0x3d, 0x20, //   tmpvar_11.x = 
+	0x28, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x30, // (v_paint.x + 0.0
+	0x31, 0x39, 0x35, 0x33, 0x31, 0x32, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, // 1953125);.  tmpv
+	0x61, 0x72, 0x5f, 0x31, 0x31, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, // ar_11.y = v_pain
+	0x74, 0x2e, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x34, // t.y;.  lowp vec4
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, //  tmpvar_12;.  tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x32, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, // pvar_12 = textur
+	0x65, 0x32, 0x44, 0x20, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x74, 0x6d, // e2D (s_paint, tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, // pvar_11);.  high
+	0x70, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x33, // p vec2 tmpvar_13
+	0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x33, 0x2e, 0x78, 0x20, // ;.  tmpvar_13.x 
+	0x3d, 0x20, 0x28, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, // = (v_paint.x + 0
+	0x2e, 0x30, 0x32, 0x33, 0x34, 0x33, 0x37, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, // .0234375);.  tmp
+	0x76, 0x61, 0x72, 0x5f, 0x31, 0x33, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x5f, 0x70, 0x61, 0x69, // var_13.y = v_pai
+	0x6e, 0x74, 0x2e, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, // nt.y;.  lowp vec
+	0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x74, // 4 tmpvar_14;.  t
+	0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x34, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, // mpvar_14 = textu
+	0x72, 0x65, 0x32, 0x44, 0x20, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x74, // re2D (s_paint, t
+	0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, // mpvar_13);.  hig
+	0x68, 0x70, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, // hp vec2 tmpvar_1
+	0x35, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x35, 0x2e, 0x78, // 5;.  tmpvar_15.x
+	0x20, 0x3d, 0x20, 0x28, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, //  = (v_paint.x + 
+	0x30, 0x2e, 0x30, 0x32, 0x37, 0x33, 0x34, 0x33, 0x37, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x74, // 0.02734375);.  t
+	0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x35, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x5f, 0x70, // mpvar_15.y = v_p
+	0x61, 0x69, 0x6e, 0x74, 0x2e, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, // aint.y;.  lowp v
+	0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x36, 0x3b, 0x0a, 0x20, // ec4 tmpvar_16;. 
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x36, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, //  tmpvar_16 = tex
+	0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x20, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2c, // ture2D (s_paint,
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x68, //  tmpvar_15);.  h
+	0x69, 0x67, 0x68, 0x70, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // ighp vec3 tmpvar
+	0x5f, 0x31, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x37, // _17;.  tmpvar_17
+	0x2e, 0x7a, 0x20, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, // .z = 1.0;.  tmpv
+	0x61, 0x72, 0x5f, 0x31, 0x37, 0x2e, 0x78, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x5f, 0x70, 0x6f, 0x73, // ar_17.xy = v_pos
+	0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x66, 0x6c, // ition;.  lowp fl
+	0x6f, 0x61, 0x74, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x38, 0x3b, 0x0a, 0x20, // oat tmpvar_18;. 
+	0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x73, 0x63, 0x5f, 0x31, 0x39, //  lowp vec2 sc_19
+	0x3b, 0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x74, // ;.  highp vec3 t
+	0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, // mpvar_20;.  tmpv
+	0x61, 0x72, 0x5f, 0x32, 0x30, 0x2e, 0x7a, 0x20, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, // ar_20.z = 1.0;. 
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x30, 0x2e, 0x78, 0x79, 0x20, 0x3d, 0x20, //  tmpvar_20.xy = 
+	0x76, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, // v_position;.  lo
+	0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, // wp vec2 tmpvar_2
+	0x31, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x31, 0x2e, 0x78, // 1;.  tmpvar_21.x
+	0x20, 0x3d, 0x20, 0x64, 0x6f, 0x74, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, //  = dot (tmpvar_2
+	0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x30, 0x29, // .xyz, tmpvar_20)
+	0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x31, 0x2e, 0x79, 0x20, // ;.  tmpvar_21.y 
+	0x3d, 0x20, 0x64, 0x6f, 0x74, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x34, 0x2e, // = dot (tmpvar_4.
+	0x78, 0x79, 0x7a, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x30, 0x29, 0x3b, // xyz, tmpvar_20);
+	0x0a, 0x20, 0x20, 0x73, 0x63, 0x5f, 0x31, 0x39, 0x20, 0x3d, 0x20, 0x28, 0x76, 0x65, 0x63, 0x32, // .  sc_19 = (vec2
+	0x28, 0x30, 0x2e, 0x35, 0x2c, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2d, 0x20, 0x28, 0x28, 0x0a, // (0.5, 0.5) - ((.
+	0x20, 0x20, 0x20, 0x20, 0x61, 0x62, 0x73, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, //     abs(tmpvar_2
+	0x31, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x2d, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, // 1).   - tmpvar_1
+	0x34, 0x2e, 0x78, 0x79, 0x29, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, // 4.xy) * tmpvar_1
+	0x34, 0x2e, 0x7a, 0x77, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // 4.zw));.  tmpvar
+	0x5f, 0x31, 0x38, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x20, 0x28, 0x73, 0x63, // _18 = (clamp (sc
+	0x5f, 0x31, 0x39, 0x2e, 0x78, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, // _19.x, 0.0, 1.0)
+	0x20, 0x2a, 0x20, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x20, 0x28, 0x73, 0x63, 0x5f, 0x31, 0x39, 0x2e, //  * clamp (sc_19.
+	0x79, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x29, 0x3b, 0x0a, 0x20, // y, 0.0, 1.0));. 
+	0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x6d, 0x70, 0x76, //  lowp float tmpv
+	0x61, 0x72, 0x5f, 0x32, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, // ar_22;.  tmpvar_
+	0x32, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x6d, 0x69, 0x6e, 0x20, 0x28, 0x31, 0x2e, 0x30, 0x2c, 0x20, // 22 = (min (1.0, 
+	0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x31, 0x2e, 0x30, 0x20, 0x2d, 0x20, 0x61, 0x62, 0x73, // (.    (1.0 - abs
+	0x28, 0x28, 0x28, 0x76, 0x5f, 0x74, 0x65, 0x78, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x30, 0x2e, 0x78, // (((v_texcoord0.x
+	0x20, 0x2a, 0x20, 0x32, 0x2e, 0x30, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x29, 0x29, //  * 2.0) - 1.0)))
+	0x0a, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x2e, 0x77, // .   * tmpvar_2.w
+	0x29, 0x29, 0x20, 0x2a, 0x20, 0x6d, 0x69, 0x6e, 0x20, 0x28, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x76, // )) * min (1.0, v
+	0x5f, 0x74, 0x65, 0x78, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x30, 0x2e, 0x79, 0x29, 0x29, 0x3b, 0x0a, // _texcoord0.y));.
+	0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x36, 0x2e, //   if ((tmpvar_6.
+	0x77, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, // w == 0.0)) {.   
+	0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, //  lowp vec2 tmpva
+	0x72, 0x5f, 0x32, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // r_23;.    tmpvar
+	0x5f, 0x32, 0x33, 0x2e, 0x78, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x74, 0x20, 0x28, 0x74, 0x6d, 0x70, // _23.x = dot (tmp
+	0x76, 0x61, 0x72, 0x5f, 0x36, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, // var_6.xyz, tmpva
+	0x72, 0x5f, 0x31, 0x37, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, // r_17);.    tmpva
+	0x72, 0x5f, 0x32, 0x33, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x74, 0x20, 0x28, 0x74, 0x6d, // r_23.y = dot (tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, // pvar_8.xyz, tmpv
+	0x61, 0x72, 0x5f, 0x31, 0x37, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, // ar_17);.    lowp
+	0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x34, 0x3b, //  vec2 tmpvar_24;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x34, 0x20, 0x3d, // .    tmpvar_24 =
+	0x20, 0x28, 0x61, 0x62, 0x73, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x33, 0x29, //  (abs(tmpvar_23)
+	0x20, 0x2d, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x36, 0x2e, 0x78, 0x79, //  - (tmpvar_16.xy
+	0x20, 0x2d, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x36, 0x2e, 0x7a, 0x7a, 0x29, //  - tmpvar_16.zz)
+	0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x32, // );.    lowp vec2
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, //  tmpvar_25;.    
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x35, 0x20, 0x3d, 0x20, 0x6d, 0x61, 0x78, 0x20, // tmpvar_25 = max 
+	0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x34, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, // (tmpvar_24, 0.0)
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x31, 0x20, 0x3d, // ;.    result_1 =
+	0x20, 0x28, 0x6d, 0x69, 0x78, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x30, //  (mix (tmpvar_10
+	0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x32, 0x2c, 0x20, 0x63, 0x6c, 0x61, // , tmpvar_12, cla
+	0x6d, 0x70, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x28, 0x28, 0x0a, // mp (.      ((((.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x69, 0x6e, 0x20, 0x28, 0x6d, 0x61, 0x78, //         min (max
+	0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x34, 0x2e, 0x78, 0x2c, 0x20, 0x74, //  (tmpvar_24.x, t
+	0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x34, 0x2e, 0x79, 0x29, 0x2c, 0x20, 0x30, 0x2e, 0x30, // mpvar_24.y), 0.0
+	0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2b, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, // ).       + .    
+	0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x72, 0x74, 0x28, 0x64, 0x6f, 0x74, 0x20, 0x28, 0x74, 0x6d, //     sqrt(dot (tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x35, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, // pvar_25, tmpvar_
+	0x32, 0x35, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x20, 0x2d, 0x20, 0x74, // 25)).      ) - t
+	0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x36, 0x2e, 0x7a, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x74, // mpvar_16.z) + (t
+	0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x2e, 0x77, 0x20, 0x2a, 0x20, 0x30, 0x2e, 0x35, 0x29, // mpvar_8.w * 0.5)
+	0x29, 0x20, 0x2f, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x2e, 0x77, 0x29, 0x0a, // ) / tmpvar_8.w).
+	0x20, 0x20, 0x20, 0x20, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x29, //     , 0.0, 1.0))
+	0x20, 0x2a, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x32, 0x20, 0x2a, 0x20, //  * (tmpvar_22 * 
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x7d, // tmpvar_18));.  }
+	0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, //  else {.    if (
+	0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x36, 0x2e, 0x77, 0x20, 0x3d, 0x3d, 0x20, 0x31, // (tmpvar_6.w == 1
+	0x2e, 0x30, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x77, // .0)) {.      low
+	0x70, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x32, 0x36, 0x3b, // p vec4 color_26;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x32, // .      lowp vec2
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, //  tmpvar_27;.    
+	0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x37, 0x2e, 0x78, 0x20, 0x3d, 0x20, //   tmpvar_27.x = 
+	0x64, 0x6f, 0x74, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x36, 0x2e, 0x78, 0x79, // dot (tmpvar_6.xy
+	0x7a, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x37, 0x29, 0x3b, 0x0a, 0x20, // z, tmpvar_17);. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x37, 0x2e, 0x79, //      tmpvar_27.y
+	0x20, 0x3d, 0x20, 0x64, 0x6f, 0x74, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, //  = dot (tmpvar_8
+	0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x37, 0x29, // .xyz, tmpvar_17)
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, // ;.      lowp vec
+	0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x20, // 4 tmpvar_28;.   
+	0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x38, 0x20, 0x3d, 0x20, 0x74, //    tmpvar_28 = t
+	0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x20, 0x28, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x2c, // exture2D (s_tex,
+	0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x37, 0x20, 0x2f, 0x20, 0x74, 0x6d, //  (tmpvar_27 / tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x36, 0x2e, 0x78, 0x79, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, // pvar_16.xy));.  
+	0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x32, 0x36, 0x20, 0x3d, 0x20, 0x74, //     color_26 = t
+	0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // mpvar_28;.      
+	0x69, 0x66, 0x20, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x34, 0x2e, 0x77, 0x20, // if ((tmpvar_4.w 
+	0x3d, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // == 1.0)) {.     
+	0x20, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, //    lowp vec4 tmp
+	0x76, 0x61, 0x72, 0x5f, 0x32, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // var_29;.        
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x39, 0x2e, 0x78, 0x79, 0x7a, 0x20, 0x3d, 0x20, // tmpvar_29.xyz = 
+	0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x38, 0x2e, 0x78, 0x79, 0x7a, 0x20, 0x2a, // (tmpvar_28.xyz *
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x38, 0x2e, 0x77, 0x29, 0x3b, 0x0a, 0x20, //  tmpvar_28.w);. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x39, //        tmpvar_29
+	0x2e, 0x77, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x38, 0x2e, 0x77, // .w = tmpvar_28.w
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, // ;.        color_
+	0x32, 0x36, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x32, 0x39, 0x3b, 0x0a, // 26 = tmpvar_29;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, //       };.      i
+	0x66, 0x20, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x34, 0x2e, 0x77, 0x20, 0x3d, // f ((tmpvar_4.w =
+	0x3d, 0x20, 0x32, 0x2e, 0x30, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // = 2.0)) {.      
+	0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x32, 0x36, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x6c, //   color_26 = col
+	0x6f, 0x72, 0x5f, 0x32, 0x36, 0x2e, 0x78, 0x78, 0x78, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // or_26.xxxx;.    
+	0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, //   };.      color
+	0x5f, 0x32, 0x36, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x32, 0x36, 0x20, // _26 = (color_26 
+	0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, // * tmpvar_10);.  
+	0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x32, 0x36, 0x20, 0x3d, 0x20, 0x28, //     color_26 = (
+	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x32, 0x36, 0x20, 0x2a, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, // color_26 * (tmpv
+	0x61, 0x72, 0x5f, 0x32, 0x32, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, // ar_22 * tmpvar_1
+	0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, // 8));.      resul
+	0x74, 0x5f, 0x31, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x32, 0x36, 0x3b, 0x0a, // t_1 = color_26;.
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, //     } else {.   
+	0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x36, //    if ((tmpvar_6
+	0x2e, 0x77, 0x20, 0x3d, 0x3d, 0x20, 0x33, 0x2e, 0x30, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, // .w == 3.0)) {.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, //       lowp vec4 
+	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x33, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // color_30;.      
+	0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, //   lowp vec4 tmpv
+	0x61, 0x72, 0x5f, 0x33, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, // ar_31;.        t
+	0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x31, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, // mpvar_31 = textu
+	0x72, 0x65, 0x32, 0x44, 0x20, 0x28, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x2c, 0x20, 0x76, 0x5f, 0x74, // re2D (s_tex, v_t
+	0x65, 0x78, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // excoord0);.     
+	0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x33, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x6d, //    color_30 = tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // pvar_31;.       
+	0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x34, 0x2e, 0x77, //  if ((tmpvar_4.w
+	0x20, 0x3d, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, //  == 1.0)) {.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, //       lowp vec4 
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // tmpvar_32;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x32, 0x2e, 0x78, //      tmpvar_32.x
+	0x79, 0x7a, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x31, 0x2e, // yz = (tmpvar_31.
+	0x78, 0x79, 0x7a, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x31, 0x2e, // xyz * tmpvar_31.
+	0x77, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, // w);.          tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x32, 0x2e, 0x77, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x76, // pvar_32.w = tmpv
+	0x61, 0x72, 0x5f, 0x33, 0x31, 0x2e, 0x77, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ar_31.w;.       
+	0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x33, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x6d, //    color_30 = tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x33, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // pvar_32;.       
+	0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, //  };.        if (
+	0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x34, 0x2e, 0x77, 0x20, 0x3d, 0x3d, 0x20, 0x32, // (tmpvar_4.w == 2
+	0x2e, 0x30, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .0)) {.         
+	0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x33, 0x30, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x6c, 0x6f, //  color_30 = colo
+	0x72, 0x5f, 0x33, 0x30, 0x2e, 0x78, 0x78, 0x78, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // r_30.xxxx;.     
+	0x20, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, //    };.        co
+	0x6c, 0x6f, 0x72, 0x5f, 0x33, 0x30, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, // lor_30 = (color_
+	0x33, 0x30, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x38, 0x29, 0x3b, // 30 * tmpvar_18);
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, // .        result_
+	0x31, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x33, 0x30, 0x20, 0x2a, 0x20, // 1 = (color_30 * 
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // tmpvar_10);.    
+	0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x3b, //   };.    };.  };
+	0x0a, 0x20, 0x20, 0x67, 0x6c, 0x5f, 0x46, 0x72, 0x61, 0x67, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x20, // .  gl_FragColor 
+	0x3d, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x31, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x00, // = result_1;.}...
+};
+static const uint8_t fs_nanovg_fill_batch_spv[5124] =
+{
+	0x46, 0x53, 0x48, 0x0b, 0x3c, 0x9c, 0x87, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x73, // FSH.<..|.......s
+	0x5f, 0x74, 0x65, 0x78, 0x30, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1a, 0x00, 0x07, 0x73, // _tex0..........s
+	0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x30, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1a, 0x00, // _paint0.........
+	0xcc, 0x13, 0x00, 0x00, 0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x08, 0x00, // ......#.........
+	0x32, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, // 2...............
+	0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, // ........GLSL.std
+	0x2e, 0x34, 0x35, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, // .450............
+	0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x09, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, // ................
+	0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x01, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, // main............
+	0xba, 0x01, 0x00, 0x00, 0xc9, 0x01, 0x00, 0x00, 0x10, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, // ................
+	0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, // ................
+	0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, // ........main....
+	0x05, 0x00, 0x06, 0x00, 0x41, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x53, 0x61, 0x6d, // ....A...s_texSam
+	0x70, 0x6c, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x44, 0x00, 0x00, 0x00, // pler........D...
+	0x73, 0x5f, 0x74, 0x65, 0x78, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, // s_texTexture....
+	0x05, 0x00, 0x06, 0x00, 0x48, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x53, // ....H...s_paintS
+	0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x4a, 0x00, 0x00, 0x00, // ampler......J...
+	0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x00, 0x00, // s_paintTexture..
+	0x05, 0x00, 0x04, 0x00, 0xb4, 0x01, 0x00, 0x00, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x00, // ........v_paint.
+	0x05, 0x00, 0x05, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x76, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, // ........v_positi
+	0x6f, 0x6e, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0xba, 0x01, 0x00, 0x00, 0x76, 0x5f, 0x74, 0x65, // on..........v_te
+	0x78, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x30, 0x00, 0x05, 0x00, 0x06, 0x00, 0xc9, 0x01, 0x00, 0x00, // xcoord0.........
+	0x62, 0x67, 0x66, 0x78, 0x5f, 0x46, 0x72, 0x61, 0x67, 0x44, 0x61, 0x74, 0x61, 0x30, 0x00, 0x00, // bgfx_FragData0..
+	0x47, 0x00, 0x04, 0x00, 0x41, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // G...A...".......
+	0x47, 0x00, 0x04, 0x00, 0x41, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, // G...A...!.......
+	0x47, 0x00, 0x04, 0x00, 0x44, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // G...D...".......
+	0x47, 0x00, 0x04, 0x00, 0x44, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, // G...D...!.......
+	0x47, 0x00, 0x04, 0x00, 0x48, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // G...H...".......
+	0x47, 0x00, 0x04, 0x00, 0x48, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, // G...H...!.......
+	0x47, 0x00, 0x04, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // G...J...".......
+	0x47, 0x00, 0x04, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, // G...J...!.......
+	0x47, 0x00, 0x04, 0x00, 0xb4, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // G...............
+	0x47, 0x00, 0x04, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // G...............
+	0x47, 0x00, 0x04, 0x00, 0xba, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, // G...............
+	0x47, 0x00, 0x04, 0x00, 0xc9, 0x01, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // G...............
+	0x13, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, // ........!.......
+	0x02, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x02, 0x00, 0x06, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, // ................
+	0x07, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x19, 0x00, 0x09, 0x00, 0x08, 0x00, 0x00, 0x00, // .... ...........
+	0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, // ................
+	0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, // ................
+	0x0d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, // ............ ...
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, // @...........;...
+	0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, // @...A....... ...
+	0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, // C...........;...
+	0x43, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, // C...D.......;...
+	0x40, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, // @...H.......;...
+	0x43, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x03, 0x00, // C...J...........
+	0x56, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, // V.......+.......
+	0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, // ........,.......
+	0x8e, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, // ................
+	0x96, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, // ............+...
+	0x07, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x2b, 0x00, 0x04, 0x00, // ...........?+...
+	0x07, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x2c, 0x00, 0x05, 0x00, // ...........?,...
+	0x0b, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, // ................
+	0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, // +..............@
+	0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, // +.............@@
+	0x14, 0x00, 0x02, 0x00, 0x26, 0x01, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0xb3, 0x01, 0x00, 0x00, // ....&... .......
+	0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0xb3, 0x01, 0x00, 0x00, // ........;.......
+	0xb4, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0xb3, 0x01, 0x00, 0x00, // ........;.......
+	0xb7, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0xb3, 0x01, 0x00, 0x00, // ........;.......
+	0xba, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0xc8, 0x01, 0x00, 0x00, // ........ .......
+	0x03, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0xc8, 0x01, 0x00, 0x00, // ........;.......
+	0xc9, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, // ........+.......
+	0x23, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3b, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, // #......;+.......
+	0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, // $......<+.......
+	0x25, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x3c, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, // %.....@<+.......
+	0x26, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3c, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, // &......<+.......
+	0x27, 0x04, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x3c, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, // '......<+.......
+	0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x3c, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, // (......<+.......
+	0x29, 0x04, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x3c, 0x01, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00, // )......<........
+	0x31, 0x04, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, // 1...6...........
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, // ................
+	0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, // =.......B...A...
+	0x3d, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, // =.......E...D...
+	0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, // =.......I...H...
+	0x3d, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, // =.......K...J...
+	0x3d, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0xb4, 0x01, 0x00, 0x00, // =...............
+	0x3d, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, // =...............
+	0x3d, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xbb, 0x01, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, // =...............
+	0x56, 0x00, 0x05, 0x00, 0x56, 0x00, 0x00, 0x00, 0xd6, 0x02, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, // V...V.......K...
+	0x49, 0x00, 0x00, 0x00, 0x57, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, // I...W...........
+	0xd6, 0x02, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // ........Q.......
+	0xde, 0x02, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, // ................
+	0x07, 0x00, 0x00, 0x00, 0xe1, 0x02, 0x00, 0x00, 0xde, 0x02, 0x00, 0x00, 0x23, 0x04, 0x00, 0x00, // ............#...
+	0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xe3, 0x02, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, // Q...............
+	0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, // ....P...........
+	0xe1, 0x02, 0x00, 0x00, 0xe3, 0x02, 0x00, 0x00, 0x56, 0x00, 0x05, 0x00, 0x56, 0x00, 0x00, 0x00, // ........V...V...
+	0xed, 0x02, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x57, 0x00, 0x05, 0x00, // ....K...I...W...
+	0x0d, 0x00, 0x00, 0x00, 0xef, 0x02, 0x00, 0x00, 0xed, 0x02, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, // ................
+	0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xf5, 0x02, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, // Q...............
+	0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xf8, 0x02, 0x00, 0x00, // ................
+	0xf5, 0x02, 0x00, 0x00, 0x24, 0x04, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // ....$...Q.......
+	0xfa, 0x02, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, // ............P...
+	0x0b, 0x00, 0x00, 0x00, 0xfb, 0x02, 0x00, 0x00, 0xf8, 0x02, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, // ................
+	0x56, 0x00, 0x05, 0x00, 0x56, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, // V...V.......K...
+	0x49, 0x00, 0x00, 0x00, 0x57, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, // I...W...........
+	0x04, 0x03, 0x00, 0x00, 0xfb, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // ........Q.......
+	0x0c, 0x03, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, // ................
+	0x07, 0x00, 0x00, 0x00, 0x0f, 0x03, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x25, 0x04, 0x00, 0x00, // ............%...
+	0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x11, 0x03, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, // Q...............
+	0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x12, 0x03, 0x00, 0x00, // ....P...........
+	0x0f, 0x03, 0x00, 0x00, 0x11, 0x03, 0x00, 0x00, 0x56, 0x00, 0x05, 0x00, 0x56, 0x00, 0x00, 0x00, // ........V...V...
+	0x1b, 0x03, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x57, 0x00, 0x05, 0x00, // ....K...I...W...
+	0x0d, 0x00, 0x00, 0x00, 0x1d, 0x03, 0x00, 0x00, 0x1b, 0x03, 0x00, 0x00, 0x12, 0x03, 0x00, 0x00, // ................
+	0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x23, 0x03, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, // Q.......#.......
+	0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, // ............&...
+	0x23, 0x03, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // #...&...Q.......
+	0x28, 0x03, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, // (...........P...
+	0x0b, 0x00, 0x00, 0x00, 0x29, 0x03, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00, // ....)...&...(...
+	0x56, 0x00, 0x05, 0x00, 0x56, 0x00, 0x00, 0x00, 0x32, 0x03, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, // V...V...2...K...
+	0x49, 0x00, 0x00, 0x00, 0x57, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x34, 0x03, 0x00, 0x00, // I...W.......4...
+	0x32, 0x03, 0x00, 0x00, 0x29, 0x03, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // 2...)...Q.......
+	0x3a, 0x03, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, // :...............
+	0x07, 0x00, 0x00, 0x00, 0x3d, 0x03, 0x00, 0x00, 0x3a, 0x03, 0x00, 0x00, 0x27, 0x04, 0x00, 0x00, // ....=...:...'...
+	0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3f, 0x03, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, // Q.......?.......
+	0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00, // ....P.......@...
+	0x3d, 0x03, 0x00, 0x00, 0x3f, 0x03, 0x00, 0x00, 0x56, 0x00, 0x05, 0x00, 0x56, 0x00, 0x00, 0x00, // =...?...V...V...
+	0x49, 0x03, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x57, 0x00, 0x05, 0x00, // I...K...I...W...
+	0x0d, 0x00, 0x00, 0x00, 0x4b, 0x03, 0x00, 0x00, 0x49, 0x03, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00, // ....K...I...@...
+	0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, // Q.......Q.......
+	0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00, // ............T...
+	0x51, 0x03, 0x00, 0x00, 0x28, 0x04, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // Q...(...Q.......
+	0x56, 0x03, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, // V...........P...
+	0x0b, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, // ....W...T...V...
+	0x56, 0x00, 0x05, 0x00, 0x56, 0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, // V...V...`...K...
+	0x49, 0x00, 0x00, 0x00, 0x57, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x62, 0x03, 0x00, 0x00, // I...W.......b...
+	0x60, 0x03, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // `...W...Q.......
+	0x68, 0x03, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, // h...............
+	0x07, 0x00, 0x00, 0x00, 0x6b, 0x03, 0x00, 0x00, 0x68, 0x03, 0x00, 0x00, 0x29, 0x04, 0x00, 0x00, // ....k...h...)...
+	0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6d, 0x03, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, // Q.......m.......
+	0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x6e, 0x03, 0x00, 0x00, // ....P.......n...
+	0x6b, 0x03, 0x00, 0x00, 0x6d, 0x03, 0x00, 0x00, 0x56, 0x00, 0x05, 0x00, 0x56, 0x00, 0x00, 0x00, // k...m...V...V...
+	0x77, 0x03, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x57, 0x00, 0x05, 0x00, // w...K...I...W...
+	0x0d, 0x00, 0x00, 0x00, 0x79, 0x03, 0x00, 0x00, 0x77, 0x03, 0x00, 0x00, 0x6e, 0x03, 0x00, 0x00, // ....y...w...n...
+	0x4f, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x2d, 0x02, 0x00, 0x00, 0x79, 0x03, 0x00, 0x00, // O.......-...y...
+	0x79, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, // y...........Q...
+	0x07, 0x00, 0x00, 0x00, 0x2f, 0x02, 0x00, 0x00, 0x79, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, // ..../...y.......
+	0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x31, 0x02, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, // Q.......1.......
+	0x03, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x33, 0x02, 0x00, 0x00, // ....Q.......3...
+	0xef, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // ........Q.......
+	0x35, 0x02, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, // 5...........Q...
+	0x07, 0x00, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00, 0x1d, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, // ....7...........
+	0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x39, 0x02, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, // Q.......9.......
+	0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3a, 0x02, 0x00, 0x00, // ....Q.......:...
+	0xb8, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x96, 0x00, 0x00, 0x00, // ........P.......
+	0x3b, 0x02, 0x00, 0x00, 0x39, 0x02, 0x00, 0x00, 0x3a, 0x02, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, // ;...9...:.......
+	0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x7f, 0x03, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, // Q...............
+	0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, // ....Q...........
+	0xb8, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x96, 0x00, 0x00, 0x00, // ........P.......
+	0x81, 0x03, 0x00, 0x00, 0x7f, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, // ................
+	0x4f, 0x00, 0x08, 0x00, 0x96, 0x00, 0x00, 0x00, 0x83, 0x03, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, // O...............
+	0xd8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, // ................
+	0x94, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x85, 0x03, 0x00, 0x00, 0x83, 0x03, 0x00, 0x00, // ................
+	0x81, 0x03, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x96, 0x00, 0x00, 0x00, 0x87, 0x03, 0x00, 0x00, // ....O...........
+	0xef, 0x02, 0x00, 0x00, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ................
+	0x02, 0x00, 0x00, 0x00, 0x94, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x89, 0x03, 0x00, 0x00, // ................
+	0x87, 0x03, 0x00, 0x00, 0x81, 0x03, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, // ........P.......
+	0x8a, 0x03, 0x00, 0x00, 0x85, 0x03, 0x00, 0x00, 0x89, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, // ................
+	0x0b, 0x00, 0x00, 0x00, 0x8b, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, // ................
+	0x8a, 0x03, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x8d, 0x03, 0x00, 0x00, // ....O...........
+	0x62, 0x03, 0x00, 0x00, 0x62, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // b...b...........
+	0x83, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x8e, 0x03, 0x00, 0x00, 0x8b, 0x03, 0x00, 0x00, // ................
+	0x8d, 0x03, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x91, 0x03, 0x00, 0x00, // ....O...........
+	0x62, 0x03, 0x00, 0x00, 0x62, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, // b...b...........
+	0x85, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x92, 0x03, 0x00, 0x00, 0x8e, 0x03, 0x00, 0x00, // ................
+	0x91, 0x03, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x93, 0x03, 0x00, 0x00, // ................
+	0xad, 0x00, 0x00, 0x00, 0x92, 0x03, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // ........Q.......
+	0x95, 0x03, 0x00, 0x00, 0x93, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, // ................
+	0x07, 0x00, 0x00, 0x00, 0x96, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, // ............+...
+	0x95, 0x03, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, // ............Q...
+	0x07, 0x00, 0x00, 0x00, 0x98, 0x03, 0x00, 0x00, 0x93, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ................
+	0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, 0x00, 0x99, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ................
+	0x2b, 0x00, 0x00, 0x00, 0x98, 0x03, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, // +...............
+	0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x9a, 0x03, 0x00, 0x00, 0x96, 0x03, 0x00, 0x00, // ................
+	0x99, 0x03, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x9e, 0x03, 0x00, 0x00, // ....Q...........
+	0xbb, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // ................
+	0x9f, 0x03, 0x00, 0x00, 0x9e, 0x03, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, // ................
+	0x07, 0x00, 0x00, 0x00, 0xa0, 0x03, 0x00, 0x00, 0x9f, 0x03, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, // ................
+	0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0xa1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ................
+	0x04, 0x00, 0x00, 0x00, 0xa0, 0x03, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // ................
+	0xa2, 0x03, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0xa1, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, // ................
+	0x07, 0x00, 0x00, 0x00, 0xa4, 0x03, 0x00, 0x00, 0xa2, 0x03, 0x00, 0x00, 0x31, 0x02, 0x00, 0x00, // ............1...
+	0x0c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0xa5, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ................
+	0x25, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0xa4, 0x03, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, // %...........Q...
+	0x07, 0x00, 0x00, 0x00, 0xa7, 0x03, 0x00, 0x00, 0xbb, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ................
+	0x0c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0xa8, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ................
+	0x25, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0xa7, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, // %...............
+	0x07, 0x00, 0x00, 0x00, 0xa9, 0x03, 0x00, 0x00, 0xa5, 0x03, 0x00, 0x00, 0xa8, 0x03, 0x00, 0x00, // ................
+	0xb4, 0x00, 0x05, 0x00, 0x26, 0x01, 0x00, 0x00, 0x45, 0x02, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, // ....&...E...5...
+	0x8b, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xb9, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0xfa, 0x00, 0x04, 0x00, 0x45, 0x02, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0x65, 0x02, 0x00, 0x00, // ....E...F...e...
+	0xf8, 0x00, 0x02, 0x00, 0x46, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x96, 0x00, 0x00, 0x00, // ....F...O.......
+	0x48, 0x02, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // H...............
+	0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x94, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // ................
+	0x4a, 0x02, 0x00, 0x00, 0x48, 0x02, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, // J...H...;...O...
+	0x96, 0x00, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x1d, 0x03, 0x00, 0x00, 0x1d, 0x03, 0x00, 0x00, // ....L...........
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x94, 0x00, 0x05, 0x00, // ................
+	0x07, 0x00, 0x00, 0x00, 0x4e, 0x02, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, // ....N...L...;...
+	0x50, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x4f, 0x02, 0x00, 0x00, 0x4a, 0x02, 0x00, 0x00, // P.......O...J...
+	0x4e, 0x02, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xb1, 0x03, 0x00, 0x00, // N...P...........
+	0x2f, 0x02, 0x00, 0x00, 0x2f, 0x02, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, // /.../...........
+	0xb2, 0x03, 0x00, 0x00, 0x2d, 0x02, 0x00, 0x00, 0xb1, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, // ....-...........
+	0x0b, 0x00, 0x00, 0x00, 0xb4, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, // ................
+	0x4f, 0x02, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xb6, 0x03, 0x00, 0x00, // O...............
+	0xb4, 0x03, 0x00, 0x00, 0xb2, 0x03, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // ........Q.......
+	0xb8, 0x03, 0x00, 0x00, 0xb6, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, // ............Q...
+	0x07, 0x00, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0xb6, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ................
+	0x0c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0xbb, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ................
+	0x28, 0x00, 0x00, 0x00, 0xb8, 0x03, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, // (...............
+	0x07, 0x00, 0x00, 0x00, 0xbc, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, // ............%...
+	0xbb, 0x03, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x00, // ................
+	0xbe, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xb6, 0x03, 0x00, 0x00, // ........(.......
+	0x8e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0xbf, 0x03, 0x00, 0x00, // ................
+	0x01, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0xbe, 0x03, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, // ....B...........
+	0x07, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xbc, 0x03, 0x00, 0x00, 0xbf, 0x03, 0x00, 0x00, // ................
+	0x83, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xc2, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, // ................
+	0x2f, 0x02, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x55, 0x02, 0x00, 0x00, // /...........U...
+	0x37, 0x02, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // 7...............
+	0x56, 0x02, 0x00, 0x00, 0xc2, 0x03, 0x00, 0x00, 0x55, 0x02, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00, // V.......U.......
+	0x07, 0x00, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0x56, 0x02, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00, // ....X...V...7...
+	0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, 0x00, 0x59, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ........Y.......
+	0x2b, 0x00, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, // +...X...........
+	0x50, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x5b, 0x02, 0x00, 0x00, 0x59, 0x02, 0x00, 0x00, // P.......[...Y...
+	0x59, 0x02, 0x00, 0x00, 0x59, 0x02, 0x00, 0x00, 0x59, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, // Y...Y...Y.......
+	0x0d, 0x00, 0x00, 0x00, 0xc8, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, // ................
+	0x34, 0x03, 0x00, 0x00, 0x4b, 0x03, 0x00, 0x00, 0x5b, 0x02, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, // 4...K...[.......
+	0x07, 0x00, 0x00, 0x00, 0x61, 0x02, 0x00, 0x00, 0xa9, 0x03, 0x00, 0x00, 0x9a, 0x03, 0x00, 0x00, // ....a...........
+	0x8e, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x63, 0x02, 0x00, 0x00, 0xc8, 0x03, 0x00, 0x00, // ........c.......
+	0x61, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xb9, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, // a...............
+	0x65, 0x02, 0x00, 0x00, 0xb4, 0x00, 0x05, 0x00, 0x26, 0x01, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, // e.......&...g...
+	0x35, 0x02, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xb8, 0x02, 0x00, 0x00, // 5...............
+	0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x67, 0x02, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00, // ........g...h...
+	0x95, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x68, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, // ........h...O...
+	0x96, 0x00, 0x00, 0x00, 0x6a, 0x02, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, // ....j...........
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x94, 0x00, 0x05, 0x00, // ................
+	0x07, 0x00, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x00, 0x6a, 0x02, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, // ....l...j...;...
+	0x4f, 0x00, 0x08, 0x00, 0x96, 0x00, 0x00, 0x00, 0x6e, 0x02, 0x00, 0x00, 0x1d, 0x03, 0x00, 0x00, // O.......n.......
+	0x1d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, // ................
+	0x94, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00, 0x6e, 0x02, 0x00, 0x00, // ........p...n...
+	0x3b, 0x02, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x71, 0x02, 0x00, 0x00, // ;...P.......q...
+	0x6c, 0x02, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, // l...p...........
+	0x73, 0x02, 0x00, 0x00, 0x71, 0x02, 0x00, 0x00, 0x2d, 0x02, 0x00, 0x00, 0x56, 0x00, 0x05, 0x00, // s...q...-...V...
+	0x56, 0x00, 0x00, 0x00, 0xcf, 0x03, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, // V.......E...B...
+	0x57, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xd1, 0x03, 0x00, 0x00, 0xcf, 0x03, 0x00, 0x00, // W...............
+	0x73, 0x02, 0x00, 0x00, 0xb4, 0x00, 0x05, 0x00, 0x26, 0x01, 0x00, 0x00, 0x78, 0x02, 0x00, 0x00, // s.......&...x...
+	0x33, 0x02, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x85, 0x02, 0x00, 0x00, // 3...............
+	0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x78, 0x02, 0x00, 0x00, 0x79, 0x02, 0x00, 0x00, // ........x...y...
+	0x85, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x79, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, // ........y...O...
+	0x96, 0x00, 0x00, 0x00, 0x7b, 0x02, 0x00, 0x00, 0xd1, 0x03, 0x00, 0x00, 0xd1, 0x03, 0x00, 0x00, // ....{...........
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, // ............Q...
+	0x07, 0x00, 0x00, 0x00, 0x7d, 0x02, 0x00, 0x00, 0xd1, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, // ....}...........
+	0x8e, 0x00, 0x05, 0x00, 0x96, 0x00, 0x00, 0x00, 0x7e, 0x02, 0x00, 0x00, 0x7b, 0x02, 0x00, 0x00, // ........~...{...
+	0x7d, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, // }...Q...........
+	0xd1, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // ........Q.......
+	0x81, 0x02, 0x00, 0x00, 0x7e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, // ....~.......Q...
+	0x07, 0x00, 0x00, 0x00, 0x82, 0x02, 0x00, 0x00, 0x7e, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ........~.......
+	0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x83, 0x02, 0x00, 0x00, 0x7e, 0x02, 0x00, 0x00, // Q...........~...
+	0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x84, 0x02, 0x00, 0x00, // ....P...........
+	0x81, 0x02, 0x00, 0x00, 0x82, 0x02, 0x00, 0x00, 0x83, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, // ................
+	0xf9, 0x00, 0x02, 0x00, 0x85, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x85, 0x02, 0x00, 0x00, // ................
+	0xf5, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x2c, 0x04, 0x00, 0x00, 0xd1, 0x03, 0x00, 0x00, // ........,.......
+	0x68, 0x02, 0x00, 0x00, 0x84, 0x02, 0x00, 0x00, 0x79, 0x02, 0x00, 0x00, 0xb4, 0x00, 0x05, 0x00, // h.......y.......
+	0x26, 0x01, 0x00, 0x00, 0x87, 0x02, 0x00, 0x00, 0x33, 0x02, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, // &.......3.......
+	0xf7, 0x00, 0x03, 0x00, 0x8b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, // ................
+	0x87, 0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x8b, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, // ................
+	0x88, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x8a, 0x02, 0x00, 0x00, // ....O...........
+	0x2c, 0x04, 0x00, 0x00, 0x2c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ,...,...........
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x8b, 0x02, 0x00, 0x00, // ................
+	0xf8, 0x00, 0x02, 0x00, 0x8b, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, // ................
+	0x2d, 0x04, 0x00, 0x00, 0x2c, 0x04, 0x00, 0x00, 0x85, 0x02, 0x00, 0x00, 0x8a, 0x02, 0x00, 0x00, // -...,...........
+	0x88, 0x02, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x8e, 0x02, 0x00, 0x00, // ................
+	0x2d, 0x04, 0x00, 0x00, 0x34, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // -...4...........
+	0x91, 0x02, 0x00, 0x00, 0xa9, 0x03, 0x00, 0x00, 0x9a, 0x03, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, // ................
+	0x0d, 0x00, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00, 0x8e, 0x02, 0x00, 0x00, 0x91, 0x02, 0x00, 0x00, // ................
+	0xf9, 0x00, 0x02, 0x00, 0xb8, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x95, 0x02, 0x00, 0x00, // ................
+	0xb4, 0x00, 0x05, 0x00, 0x26, 0x01, 0x00, 0x00, 0x97, 0x02, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, // ....&.......5...
+	0xdf, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xb7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0xfa, 0x00, 0x04, 0x00, 0x97, 0x02, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00, // ................
+	0xf8, 0x00, 0x02, 0x00, 0x98, 0x02, 0x00, 0x00, 0x56, 0x00, 0x05, 0x00, 0x56, 0x00, 0x00, 0x00, // ........V...V...
+	0xd8, 0x03, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x57, 0x00, 0x05, 0x00, // ....E...B...W...
+	0x0d, 0x00, 0x00, 0x00, 0xda, 0x03, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x00, 0xbb, 0x01, 0x00, 0x00, // ................
+	0xb4, 0x00, 0x05, 0x00, 0x26, 0x01, 0x00, 0x00, 0x9d, 0x02, 0x00, 0x00, 0x33, 0x02, 0x00, 0x00, // ....&.......3...
+	0x9a, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0xfa, 0x00, 0x04, 0x00, 0x9d, 0x02, 0x00, 0x00, 0x9e, 0x02, 0x00, 0x00, 0xaa, 0x02, 0x00, 0x00, // ................
+	0xf8, 0x00, 0x02, 0x00, 0x9e, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x96, 0x00, 0x00, 0x00, // ........O.......
+	0xa0, 0x02, 0x00, 0x00, 0xda, 0x03, 0x00, 0x00, 0xda, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // ........Q.......
+	0xa2, 0x02, 0x00, 0x00, 0xda, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, // ................
+	0x96, 0x00, 0x00, 0x00, 0xa3, 0x02, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, 0xa2, 0x02, 0x00, 0x00, // ................
+	0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xa5, 0x02, 0x00, 0x00, 0xda, 0x03, 0x00, 0x00, // Q...............
+	0x03, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xa6, 0x02, 0x00, 0x00, // ....Q...........
+	0xa3, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, // ........Q.......
+	0xa7, 0x02, 0x00, 0x00, 0xa3, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, // ............Q...
+	0x07, 0x00, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0xa3, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, // ................
+	0x50, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xa9, 0x02, 0x00, 0x00, 0xa6, 0x02, 0x00, 0x00, // P...............
+	0xa7, 0x02, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0xa5, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, // ................
+	0xaa, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xaa, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, // ................
+	0x0d, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0xda, 0x03, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, // ....*...........
+	0xa9, 0x02, 0x00, 0x00, 0x9e, 0x02, 0x00, 0x00, 0xb4, 0x00, 0x05, 0x00, 0x26, 0x01, 0x00, 0x00, // ............&...
+	0xac, 0x02, 0x00, 0x00, 0x33, 0x02, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, // ....3...........
+	0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xac, 0x02, 0x00, 0x00, // ................
+	0xad, 0x02, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xad, 0x02, 0x00, 0x00, // ................
+	0x4f, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xaf, 0x02, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, // O...........*...
+	0x2a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // *...............
+	0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xb0, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, // ................
+	0xb0, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x2b, 0x04, 0x00, 0x00, // ............+...
+	0x2a, 0x04, 0x00, 0x00, 0xaa, 0x02, 0x00, 0x00, 0xaf, 0x02, 0x00, 0x00, 0xad, 0x02, 0x00, 0x00, // *...............
+	0x8e, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xb3, 0x02, 0x00, 0x00, 0x2b, 0x04, 0x00, 0x00, // ............+...
+	0x9a, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xb6, 0x02, 0x00, 0x00, // ................
+	0xb3, 0x02, 0x00, 0x00, 0x34, 0x03, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xb7, 0x02, 0x00, 0x00, // ....4...........
+	0xf8, 0x00, 0x02, 0x00, 0xb7, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, // ................
+	0x30, 0x04, 0x00, 0x00, 0x31, 0x04, 0x00, 0x00, 0x95, 0x02, 0x00, 0x00, 0xb6, 0x02, 0x00, 0x00, // 0...1...........
+	0xb0, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xb8, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, // ................
+	0xb8, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x2f, 0x04, 0x00, 0x00, // ............/...
+	0x93, 0x02, 0x00, 0x00, 0x8b, 0x02, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00, // ........0.......
+	0xf9, 0x00, 0x02, 0x00, 0xb9, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb9, 0x02, 0x00, 0x00, // ................
+	0xf5, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x2e, 0x04, 0x00, 0x00, 0x63, 0x02, 0x00, 0x00, // ............c...
+	0x46, 0x02, 0x00, 0x00, 0x2f, 0x04, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, // F.../.......>...
+	0xc9, 0x01, 0x00, 0x00, 0x2e, 0x04, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00, // ............8...
+	0x00, 0x00, 0x00, 0x00,                                                                         // ....
+};
+static const uint8_t fs_nanovg_fill_batch_mtl[3917] =
+{
+	0x46, 0x53, 0x48, 0x0b, 0x3c, 0x9c, 0x87, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0c, 0x73, // FSH.<..|.......s
+	0x5f, 0x74, 0x65, 0x78, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x11, 0x01, 0xff, 0xff, 0x01, // _texSampler.....
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x54, 0x65, 0x78, 0x74, 0x75, // ......s_texTextu
+	0x72, 0x65, 0x11, 0x01, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x5f, 0x70, // re...........s_p
+	0x61, 0x69, 0x6e, 0x74, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x11, 0x01, 0xff, 0xff, 0x01, // aintSampler.....
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x54, 0x65, 0x78, // ......s_paintTex
+	0x74, 0x75, 0x72, 0x65, 0x11, 0x01, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x73, // ture...........s
+	0x5f, 0x74, 0x65, 0x78, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x73, // _tex...........s
+	0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // _paint..........
+	0xb5, 0x0e, 0x00, 0x00, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x3c, 0x6d, 0x65, // ....#include <me
+	0x74, 0x61, 0x6c, 0x5f, 0x73, 0x74, 0x64, 0x6c, 0x69, 0x62, 0x3e, 0x0a, 0x23, 0x69, 0x6e, 0x63, // tal_stdlib>.#inc
+	0x6c, 0x75, 0x64, 0x65, 0x20, 0x3c, 0x73, 0x69, 0x6d, 0x64, 0x2f, 0x73, 0x69, 0x6d, 0x64, 0x2e, // lude <simd/simd.
+	0x68, 0x3e, 0x0a, 0x0a, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x70, // h>..using namesp
+	0x61, 0x63, 0x65, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x3b, 0x0a, 0x0a, 0x63, 0x6f, 0x6e, 0x73, // ace metal;..cons
+	0x74, 0x61, 0x6e, 0x74, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x31, 0x30, 0x37, // tant float4 _107
+	0x30, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, // 0 = {};..struct 
+	0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, 0x69, 0x6e, 0x5f, 0x6f, 0x75, 0x74, 0x0a, // xlatMtlMain_out.
+	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x62, 0x67, 0x66, // {.    float4 bgf
+	0x78, 0x5f, 0x46, 0x72, 0x61, 0x67, 0x44, 0x61, 0x74, 0x61, 0x30, 0x20, 0x5b, 0x5b, 0x63, 0x6f, // x_FragData0 [[co
+	0x6c, 0x6f, 0x72, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x73, 0x74, // lor(0)]];.};..st
+	0x72, 0x75, 0x63, 0x74, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, 0x69, 0x6e, // ruct xlatMtlMain
+	0x5f, 0x69, 0x6e, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, // _in.{.    float2
+	0x20, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x20, 0x5b, 0x5b, 0x75, 0x73, 0x65, 0x72, 0x28, //  v_paint [[user(
+	0x6c, 0x6f, 0x63, 0x6e, 0x30, 0x29, 0x5d, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, // locn0)]];.    fl
+	0x6f, 0x61, 0x74, 0x32, 0x20, 0x76, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, // oat2 v_position 
+	0x5b, 0x5b, 0x75, 0x73, 0x65, 0x72, 0x28, 0x6c, 0x6f, 0x63, 0x6e, 0x31, 0x29, 0x5d, 0x5d, 0x3b, // [[user(locn1)]];
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x20, 0x76, 0x5f, 0x74, 0x65, // .    float2 v_te
+	0x78, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x30, 0x20, 0x5b, 0x5b, 0x75, 0x73, 0x65, 0x72, 0x28, 0x6c, // xcoord0 [[user(l
+	0x6f, 0x63, 0x6e, 0x32, 0x29, 0x5d, 0x5d, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x66, 0x72, 0x61, // ocn2)]];.};..fra
+	0x67, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, 0x69, // gment xlatMtlMai
+	0x6e, 0x5f, 0x6f, 0x75, 0x74, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, 0x69, // n_out xlatMtlMai
+	0x6e, 0x28, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, 0x69, 0x6e, 0x5f, 0x69, 0x6e, // n(xlatMtlMain_in
+	0x20, 0x69, 0x6e, 0x20, 0x5b, 0x5b, 0x73, 0x74, 0x61, 0x67, 0x65, 0x5f, 0x69, 0x6e, 0x5d, 0x5d, //  in [[stage_in]]
+	0x2c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x64, 0x3c, 0x66, 0x6c, 0x6f, 0x61, // , texture2d<floa
+	0x74, 0x3e, 0x20, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x20, 0x5b, 0x5b, 0x74, 0x65, 0x78, 0x74, 0x75, // t> s_tex [[textu
+	0x72, 0x65, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, // re(0)]], texture
+	0x32, 0x64, 0x3c, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x3e, 0x20, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, // 2d<float> s_pain
+	0x74, 0x20, 0x5b, 0x5b, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x28, 0x31, 0x29, 0x5d, 0x5d, // t [[texture(1)]]
+	0x2c, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x20, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x53, // , sampler s_texS
+	0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x20, 0x5b, 0x5b, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, // ampler [[sampler
+	0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x20, 0x73, // (0)]], sampler s
+	0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x20, 0x5b, 0x5b, // _paintSampler [[
+	0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x28, 0x31, 0x29, 0x5d, 0x5d, 0x29, 0x0a, 0x7b, 0x0a, // sampler(1)]]).{.
+	0x20, 0x20, 0x20, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, 0x69, 0x6e, 0x5f, //     xlatMtlMain_
+	0x6f, 0x75, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0x3b, 0x0a, 0x20, 0x20, // out out = {};.  
+	0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x37, 0x32, 0x35, 0x20, 0x3d, 0x20, //   float4 _725 = 
+	0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x28, 0x73, // s_paint.sample(s
+	0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x2c, 0x20, 0x69, // _paintSampler, i
+	0x6e, 0x2e, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // n.v_paint);.    
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x37, 0x34, 0x38, 0x20, 0x3d, 0x20, 0x73, 0x5f, // float4 _748 = s_
+	0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x28, 0x73, 0x5f, 0x70, // paint.sample(s_p
+	0x61, 0x69, 0x6e, 0x74, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x2c, 0x20, 0x66, 0x6c, 0x6f, // aintSampler, flo
+	0x61, 0x74, 0x32, 0x28, 0x69, 0x6e, 0x2e, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, // at2(in.v_paint.x
+	0x20, 0x2b, 0x20, 0x30, 0x2e, 0x30, 0x30, 0x33, 0x39, 0x30, 0x36, 0x32, 0x35, 0x2c, 0x20, 0x69, //  + 0.00390625, i
+	0x6e, 0x2e, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x79, 0x29, 0x29, 0x3b, 0x0a, 0x20, // n.v_paint.y));. 
+	0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x37, 0x37, 0x31, 0x20, 0x3d, //    float4 _771 =
+	0x20, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x28, //  s_paint.sample(
+	0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x2c, 0x20, // s_paintSampler, 
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x28, 0x69, 0x6e, 0x2e, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, // float2(in.v_pain
+	0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x30, 0x30, 0x37, 0x38, 0x31, 0x32, 0x35, 0x2c, // t.x + 0.0078125,
+	0x20, 0x69, 0x6e, 0x2e, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x79, 0x29, 0x29, 0x3b, //  in.v_paint.y));
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x37, 0x39, 0x34, // .    float4 _794
+	0x20, 0x3d, 0x20, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x73, 0x61, 0x6d, 0x70, 0x6c, //  = s_paint.sampl
+	0x65, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, // e(s_paintSampler
+	0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x28, 0x69, 0x6e, 0x2e, 0x76, 0x5f, 0x70, 0x61, // , float2(in.v_pa
+	0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x30, 0x31, 0x31, 0x37, 0x31, 0x38, // int.x + 0.011718
+	0x37, 0x35, 0x2c, 0x20, 0x69, 0x6e, 0x2e, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x79, // 75, in.v_paint.y
+	0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, // ));.    float4 _
+	0x38, 0x31, 0x37, 0x20, 0x3d, 0x20, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x73, 0x61, // 817 = s_paint.sa
+	0x6d, 0x70, 0x6c, 0x65, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x53, 0x61, 0x6d, 0x70, // mple(s_paintSamp
+	0x6c, 0x65, 0x72, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x28, 0x69, 0x6e, 0x2e, 0x76, // ler, float2(in.v
+	0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x30, 0x31, 0x35, // _paint.x + 0.015
+	0x36, 0x32, 0x35, 0x2c, 0x20, 0x69, 0x6e, 0x2e, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, // 625, in.v_paint.
+	0x79, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, // y));.    float4 
+	0x5f, 0x38, 0x34, 0x30, 0x20, 0x3d, 0x20, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x73, // _840 = s_paint.s
+	0x61, 0x6d, 0x70, 0x6c, 0x65, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x53, 0x61, 0x6d, // ample(s_paintSam
+	0x70, 0x6c, 0x65, 0x72, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x28, 0x69, 0x6e, 0x2e, // pler, float2(in.
+	0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x30, 0x31, // v_paint.x + 0.01
+	0x39, 0x35, 0x33, 0x31, 0x32, 0x35, 0x2c, 0x20, 0x69, 0x6e, 0x2e, 0x76, 0x5f, 0x70, 0x61, 0x69, // 953125, in.v_pai
+	0x6e, 0x74, 0x2e, 0x79, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, // nt.y));.    floa
+	0x74, 0x34, 0x20, 0x5f, 0x38, 0x36, 0x33, 0x20, 0x3d, 0x20, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, // t4 _863 = s_pain
+	0x74, 0x2e, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, // t.sample(s_paint
+	0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x28, // Sampler, float2(
+	0x69, 0x6e, 0x2e, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x30, // in.v_paint.x + 0
+	0x2e, 0x30, 0x32, 0x33, 0x34, 0x33, 0x37, 0x35, 0x2c, 0x20, 0x69, 0x6e, 0x2e, 0x76, 0x5f, 0x70, // .0234375, in.v_p
+	0x61, 0x69, 0x6e, 0x74, 0x2e, 0x79, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, // aint.y));.    fl
+	0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x38, 0x38, 0x36, 0x20, 0x3d, 0x20, 0x73, 0x5f, 0x70, 0x61, // oat4 _886 = s_pa
+	0x69, 0x6e, 0x74, 0x2e, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x28, 0x73, 0x5f, 0x70, 0x61, 0x69, // int.sample(s_pai
+	0x6e, 0x74, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, // ntSampler, float
+	0x32, 0x28, 0x69, 0x6e, 0x2e, 0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x2b, // 2(in.v_paint.x +
+	0x20, 0x30, 0x2e, 0x30, 0x32, 0x37, 0x33, 0x34, 0x33, 0x37, 0x35, 0x2c, 0x20, 0x69, 0x6e, 0x2e, //  0.02734375, in.
+	0x76, 0x5f, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2e, 0x79, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, // v_paint.y));.   
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x20, 0x5f, 0x35, 0x35, 0x34, 0x20, 0x3d, 0x20, 0x5f, //  float2 _554 = _
+	0x38, 0x38, 0x36, 0x2e, 0x78, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, // 886.xy;.    floa
+	0x74, 0x20, 0x5f, 0x35, 0x35, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x38, 0x38, 0x36, 0x2e, 0x7a, 0x3b, // t _556 = _886.z;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x35, 0x36, 0x30, 0x20, // .    float _560 
+	0x3d, 0x20, 0x5f, 0x37, 0x34, 0x38, 0x2e, 0x77, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, // = _748.w;.    fl
+	0x6f, 0x61, 0x74, 0x20, 0x5f, 0x35, 0x36, 0x32, 0x20, 0x3d, 0x20, 0x5f, 0x37, 0x37, 0x31, 0x2e, // oat _562 = _771.
+	0x77, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x35, 0x36, // w;.    float _56
+	0x34, 0x20, 0x3d, 0x20, 0x5f, 0x37, 0x39, 0x34, 0x2e, 0x77, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // 4 = _794.w;.    
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x35, 0x36, 0x38, 0x20, 0x3d, 0x20, 0x66, 0x6c, // float3 _568 = fl
+	0x6f, 0x61, 0x74, 0x33, 0x28, 0x69, 0x6e, 0x2e, 0x76, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, // oat3(in.v_positi
+	0x6f, 0x6e, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, // on, 1.0);.    fl
+	0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x38, 0x39, 0x34, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, // oat3 _894 = floa
+	0x74, 0x33, 0x28, 0x69, 0x6e, 0x2e, 0x76, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, // t3(in.v_position
+	0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, // , 1.0);.    floa
+	0x74, 0x32, 0x20, 0x5f, 0x39, 0x31, 0x32, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, // t2 _912 = float2
+	0x28, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2d, 0x20, 0x28, 0x28, 0x61, 0x62, 0x73, 0x28, 0x66, 0x6c, // (0.5) - ((abs(fl
+	0x6f, 0x61, 0x74, 0x32, 0x28, 0x64, 0x6f, 0x74, 0x28, 0x5f, 0x37, 0x32, 0x35, 0x2e, 0x78, 0x79, // oat2(dot(_725.xy
+	0x7a, 0x2c, 0x20, 0x5f, 0x38, 0x39, 0x34, 0x29, 0x2c, 0x20, 0x64, 0x6f, 0x74, 0x28, 0x5f, 0x37, // z, _894), dot(_7
+	0x34, 0x38, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x5f, 0x38, 0x39, 0x34, 0x29, 0x29, 0x29, 0x20, // 48.xyz, _894))) 
+	0x2d, 0x20, 0x5f, 0x38, 0x36, 0x33, 0x2e, 0x78, 0x79, 0x29, 0x20, 0x2a, 0x20, 0x5f, 0x38, 0x36, // - _863.xy) * _86
+	0x33, 0x2e, 0x7a, 0x77, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, // 3.zw);.    float
+	0x20, 0x5f, 0x39, 0x31, 0x39, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x63, 0x6c, //  _919 = fast::cl
+	0x61, 0x6d, 0x70, 0x28, 0x5f, 0x39, 0x31, 0x32, 0x2e, 0x78, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, // amp(_912.x, 0.0,
+	0x20, 0x31, 0x2e, 0x30, 0x29, 0x20, 0x2a, 0x20, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x63, 0x6c, //  1.0) * fast::cl
+	0x61, 0x6d, 0x70, 0x28, 0x5f, 0x39, 0x31, 0x32, 0x2e, 0x79, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, // amp(_912.y, 0.0,
+	0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, //  1.0);.    float
+	0x20, 0x5f, 0x39, 0x33, 0x34, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x6d, 0x69, //  _934 = fast::mi
+	0x6e, 0x28, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x28, 0x31, 0x2e, 0x30, 0x20, 0x2d, 0x20, 0x61, 0x62, // n(1.0, (1.0 - ab
+	0x73, 0x28, 0x28, 0x69, 0x6e, 0x2e, 0x76, 0x5f, 0x74, 0x65, 0x78, 0x63, 0x6f, 0x6f, 0x72, 0x64, // s((in.v_texcoord
+	0x30, 0x2e, 0x78, 0x20, 0x2a, 0x20, 0x32, 0x2e, 0x30, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x2e, 0x30, // 0.x * 2.0) - 1.0
+	0x29, 0x29, 0x20, 0x2a, 0x20, 0x5f, 0x37, 0x32, 0x35, 0x2e, 0x77, 0x29, 0x20, 0x2a, 0x20, 0x66, // )) * _725.w) * f
+	0x61, 0x73, 0x74, 0x3a, 0x3a, 0x6d, 0x69, 0x6e, 0x28, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x69, 0x6e, // ast::min(1.0, in
+	0x2e, 0x76, 0x5f, 0x74, 0x65, 0x78, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x30, 0x2e, 0x79, 0x29, 0x3b, // .v_texcoord0.y);
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x31, 0x30, 0x36, // .    float4 _106
+	0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x35, 0x36, 0x32, 0x20, // 7;.    if (_562 
+	0x3d, 0x3d, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, // == 0.0).    {.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x20, 0x5f, 0x39, 0x34, //       float2 _94
+	0x37, 0x20, 0x3d, 0x20, 0x61, 0x62, 0x73, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x28, 0x64, // 7 = abs(float2(d
+	0x6f, 0x74, 0x28, 0x5f, 0x37, 0x37, 0x31, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x5f, 0x35, 0x36, // ot(_771.xyz, _56
+	0x38, 0x29, 0x2c, 0x20, 0x64, 0x6f, 0x74, 0x28, 0x5f, 0x37, 0x39, 0x34, 0x2e, 0x78, 0x79, 0x7a, // 8), dot(_794.xyz
+	0x2c, 0x20, 0x5f, 0x35, 0x36, 0x38, 0x29, 0x29, 0x29, 0x20, 0x2d, 0x20, 0x28, 0x5f, 0x35, 0x35, // , _568))) - (_55
+	0x34, 0x20, 0x2d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x28, 0x5f, 0x35, 0x35, 0x36, 0x29, // 4 - float2(_556)
+	0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x37, // );.        _1067
+	0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x5f, 0x38, 0x31, 0x37, 0x2c, 0x20, 0x5f, 0x38, 0x34, //  = mix(_817, _84
+	0x30, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, // 0, float4(fast::
+	0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x28, 0x28, 0x28, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x6d, // clamp((((fast::m
+	0x69, 0x6e, 0x28, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x6d, 0x61, 0x78, 0x28, 0x5f, 0x39, 0x34, // in(fast::max(_94
+	0x37, 0x2e, 0x78, 0x2c, 0x20, 0x5f, 0x39, 0x34, 0x37, 0x2e, 0x79, 0x29, 0x2c, 0x20, 0x30, 0x2e, // 7.x, _947.y), 0.
+	0x30, 0x29, 0x20, 0x2b, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x28, 0x66, 0x61, 0x73, 0x74, // 0) + length(fast
+	0x3a, 0x3a, 0x6d, 0x61, 0x78, 0x28, 0x5f, 0x39, 0x34, 0x37, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, // ::max(_947, floa
+	0x74, 0x32, 0x28, 0x30, 0x2e, 0x30, 0x29, 0x29, 0x29, 0x29, 0x20, 0x2d, 0x20, 0x5f, 0x35, 0x35, // t2(0.0)))) - _55
+	0x36, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x5f, 0x35, 0x36, 0x34, 0x20, 0x2a, 0x20, 0x30, 0x2e, 0x35, // 6) + (_564 * 0.5
+	0x29, 0x29, 0x20, 0x2f, 0x20, 0x5f, 0x35, 0x36, 0x34, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, // )) / _564, 0.0, 
+	0x31, 0x2e, 0x30, 0x29, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x39, 0x33, 0x34, 0x20, 0x2a, // 1.0))) * (_934 *
+	0x20, 0x5f, 0x39, 0x31, 0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, //  _919);.    }.  
+	0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, //   else.    {.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x31, 0x30, 0x36, //      float4 _106
+	0x38, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, // 8;.        if (_
+	0x35, 0x36, 0x32, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, // 562 == 1.0).    
+	0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     {.          
+	0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x39, 0x37, 0x34, 0x20, 0x3d, 0x20, //   float4 _974 = 
+	0x73, 0x5f, 0x74, 0x65, 0x78, 0x2e, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x28, 0x73, 0x5f, 0x74, // s_tex.sample(s_t
+	0x65, 0x78, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x2c, 0x20, 0x28, 0x66, 0x6c, 0x6f, 0x61, // exSampler, (floa
+	0x74, 0x32, 0x28, 0x64, 0x6f, 0x74, 0x28, 0x5f, 0x37, 0x37, 0x31, 0x2e, 0x78, 0x79, 0x7a, 0x2c, // t2(dot(_771.xyz,
+	0x20, 0x5f, 0x35, 0x36, 0x38, 0x29, 0x2c, 0x20, 0x64, 0x6f, 0x74, 0x28, 0x5f, 0x37, 0x39, 0x34, //  _568), dot(_794
+	0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x5f, 0x35, 0x36, 0x38, 0x29, 0x29, 0x20, 0x2f, 0x20, 0x5f, // .xyz, _568)) / _
+	0x35, 0x35, 0x34, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 554));.         
+	0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x35, 0x3b, //    float4 _1065;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, // .            if 
+	0x28, 0x5f, 0x35, 0x36, 0x30, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x0a, 0x20, 0x20, // (_560 == 1.0).  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, //           {.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x30, 0x36, //             _106
+	0x35, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x39, 0x37, 0x34, 0x2e, // 5 = float4(_974.
+	0x78, 0x79, 0x7a, 0x20, 0x2a, 0x20, 0x5f, 0x39, 0x37, 0x34, 0x2e, 0x77, 0x2c, 0x20, 0x5f, 0x39, // xyz * _974.w, _9
+	0x37, 0x34, 0x2e, 0x77, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 74.w);.         
+	0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    }.           
+	0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  else.          
+	0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //   {.            
+	0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x35, 0x20, 0x3d, 0x20, 0x5f, 0x39, 0x37, 0x34, //     _1065 = _974
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, // ;.            }.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, //             floa
+	0x74, 0x34, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // t4 _1066;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x35, 0x36, 0x30, 0x20, 0x3d, //       if (_560 =
+	0x3d, 0x20, 0x32, 0x2e, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // = 2.0).         
+	0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    {.           
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x30, //      _1066 = _10
+	0x36, 0x35, 0x2e, 0x78, 0x78, 0x78, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 65.xxxx;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      }.         
+	0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    else.        
+	0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     {.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x31, //       _1066 = _1
+	0x30, 0x36, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 065;.           
+	0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, //  }.            _
+	0x31, 0x30, 0x36, 0x38, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, 0x30, 0x36, 0x36, 0x20, 0x2a, 0x20, // 1068 = (_1066 * 
+	0x5f, 0x38, 0x31, 0x37, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x39, 0x33, 0x34, 0x20, 0x2a, 0x20, // _817) * (_934 * 
+	0x5f, 0x39, 0x31, 0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, // _919);.        }
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, // .        else.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //       {.        
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x39, //     float4 _1069
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, // ;.            if
+	0x20, 0x28, 0x5f, 0x35, 0x36, 0x32, 0x20, 0x3d, 0x3d, 0x20, 0x33, 0x2e, 0x30, 0x29, 0x0a, 0x20, //  (_562 == 3.0). 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, //            {.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, //              flo
+	0x61, 0x74, 0x34, 0x20, 0x5f, 0x39, 0x38, 0x33, 0x20, 0x3d, 0x20, 0x73, 0x5f, 0x74, 0x65, 0x78, // at4 _983 = s_tex
+	0x2e, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x28, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x53, 0x61, 0x6d, // .sample(s_texSam
+	0x70, 0x6c, 0x65, 0x72, 0x2c, 0x20, 0x69, 0x6e, 0x2e, 0x76, 0x5f, 0x74, 0x65, 0x78, 0x63, 0x6f, // pler, in.v_texco
+	0x6f, 0x72, 0x64, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ord0);.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x31, //        float4 _1
+	0x30, 0x36, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 063;.           
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x35, 0x36, 0x30, 0x20, 0x3d, 0x3d, //      if (_560 ==
+	0x20, 0x31, 0x2e, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  1.0).          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //       {.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x30, 0x36, //             _106
+	0x33, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x39, 0x38, 0x33, 0x2e, // 3 = float4(_983.
+	0x78, 0x79, 0x7a, 0x20, 0x2a, 0x20, 0x5f, 0x39, 0x38, 0x33, 0x2e, 0x77, 0x2c, 0x20, 0x5f, 0x39, // xyz * _983.w, _9
+	0x38, 0x33, 0x2e, 0x77, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 83.w);.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //        }.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, //          else.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, //               {.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x33, 0x20, 0x3d, 0x20, 0x5f, 0x39, 0x38, 0x33, //     _1063 = _983
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ;.              
+	0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //   }.            
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x34, //     float4 _1064
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ;.              
+	0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x35, 0x36, 0x30, 0x20, 0x3d, 0x3d, 0x20, 0x32, 0x2e, //   if (_560 == 2.
+	0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 0).             
+	0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    {.           
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x34, 0x20, 0x3d, //          _1064 =
+	0x20, 0x5f, 0x31, 0x30, 0x36, 0x33, 0x2e, 0x78, 0x78, 0x78, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, //  _1063.xxxx;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, //              }. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, //                e
+	0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // lse.            
+	0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     {.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x34, 0x20, //           _1064 
+	0x3d, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // = _1063;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //          }.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x39, //            _1069
+	0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, 0x30, 0x36, 0x34, 0x20, 0x2a, 0x20, 0x5f, 0x39, 0x31, 0x39, //  = (_1064 * _919
+	0x29, 0x20, 0x2a, 0x20, 0x5f, 0x38, 0x31, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ) * _817;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //       }.        
+	0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     else.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      {.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x39, 0x20, 0x3d, 0x20, 0x5f, //        _1069 = _
+	0x31, 0x30, 0x37, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1070;.          
+	0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //   }.            
+	0x5f, 0x31, 0x30, 0x36, 0x38, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x39, 0x3b, 0x0a, 0x20, // _1068 = _1069;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //        }.       
+	0x20, 0x5f, 0x31, 0x30, 0x36, 0x37, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x38, 0x3b, 0x0a, //  _1067 = _1068;.
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x75, 0x74, 0x2e, 0x62, 0x67, //     }.    out.bg
+	0x66, 0x78, 0x5f, 0x46, 0x72, 0x61, 0x67, 0x44, 0x61, 0x74, 0x61, 0x30, 0x20, 0x3d, 0x20, 0x5f, // fx_FragData0 = _
+	0x31, 0x30, 0x36, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // 1067;.    return
+	0x20, 0x6f, 0x75, 0x74, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x00, 0x00, 0x40, 0x00,                   //  out;.}....@.
+};
+extern const uint8_t* fs_nanovg_fill_batch_pssl;
+extern const uint32_t fs_nanovg_fill_batch_pssl_size;
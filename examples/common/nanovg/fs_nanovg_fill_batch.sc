@@ -0,0 +1,101 @@
+$input v_position, v_texcoord0, v_paint
+
+#include "../common.sh"
+
+#define EDGE_AA 1
+
+SAMPLER2D(s_tex,   0);
+SAMPLER2D(s_paint, 1);
+
+// Paint of each call is stored in 8 texels of paint texture, and _paint is
+// coordinate of its first texel. See glnvg__convertPaint in nanovg_bgfx.cpp.
+vec4 paintTexel(vec2 _paint, float _index)
+{
+	return texture2D(s_paint, vec2(_paint.x + _index/256.0, _paint.y) );
+}
+
+float sdroundrect(vec2 pt, vec2 ext, float rad)
+{
+	vec2 ext2 = ext - vec2(rad,rad);
+	vec2 d = abs(pt) - ext2;
+	return min(max(d.x, d.y), 0.0) + length(max(d, 0.0) ) - rad;
+}
+
+// Scissoring
+float scissorMask(vec2 p, vec4 _scissorMat0, vec4 _scissorMat1, vec4 _scissorExtScale)
+{
+	vec3 pt = vec3(p, 1.0);
+	vec2 sc = abs(vec2(dot(_scissorMat0.xyz, pt), dot(_scissorMat1.xyz, pt) ) ) - _scissorExtScale.xy;
+	sc = vec2(0.5, 0.5) - sc * _scissorExtScale.zw;
+	return clamp(sc.x, 0.0, 1.0) * clamp(sc.y, 0.0, 1.0);
+}
+
+// Stroke - from [0..1] to clipped pyramid, where the slope is 1px.
+float strokeMask(vec2 _texcoord, float _strokeMult)
+{
+#if EDGE_AA
+	return min(1.0, (1.0 - abs(_texcoord.x*2.0 - 1.0) )*_strokeMult) * min(1.0, _texcoord.y);
+#else
+	return 1.0;
+#endif // EDGE_AA
+}
+
+void main()
+{
+	// Rows of scissor and paint 2x3 matrices, with scalar parameters in w.
+	vec4 scissorMat0     = paintTexel(v_paint, 0.0);
+	vec4 scissorMat1     = paintTexel(v_paint, 1.0);
+	vec4 paintMat0       = paintTexel(v_paint, 2.0);
+	vec4 paintMat1       = paintTexel(v_paint, 3.0);
+	vec4 innerCol        = paintTexel(v_paint, 4.0);
+	vec4 outerCol        = paintTexel(v_paint, 5.0);
+	vec4 scissorExtScale = paintTexel(v_paint, 6.0);
+	vec4 extentRadius    = paintTexel(v_paint, 7.0);
+
+	vec2  extent     = extentRadius.xy;
+	float radius     = extentRadius.z;
+	float strokeMult = scissorMat0.w;
+	float texType    = scissorMat1.w;
+	float paintType  = paintMat0.w;
+	float feather    = paintMat1.w;
+
+	vec3 position = vec3(v_position, 1.0);
+
+	vec4 result;
+	float scissor = scissorMask(v_position, scissorMat0, scissorMat1, scissorExtScale);
+	float strokeAlpha = strokeMask(v_texcoord0, strokeMult);
+
+	if (paintType == 0.0) // Gradient
+	{
+		// Calculate gradient color using box gradient
+		vec2 pt = vec2(dot(paintMat0.xyz, position), dot(paintMat1.xyz, position) );
+		float d = clamp( (sdroundrect(pt, extent, radius) + feather*0.5) / feather, 0.0, 1.0);
+		vec4 color = mix(innerCol, outerCol, d);
+		// Combine alpha
+		color *= strokeAlpha * scissor;
+		result = color;
+	}
+	else if (paintType == 1.0) // Image
+	{
+		// Calculate color from texture
+		vec2 pt = vec2(dot(paintMat0.xyz, position), dot(paintMat1.xyz, position) ) / extent;
+		vec4 color = texture2D(s_tex, pt);
+		if (texType == 1.0) color = vec4(color.xyz * color.w, color.w);
+		if (texType == 2.0) color = color.xxxx;
+		// Apply color tint and alpha
+		color *= innerCol;
+		// Combine alpha
+		color *= strokeAlpha * scissor;
+		result = color;
+	}
+	else if (paintType == 3.0) // Textured tris
+	{
+		vec4 color = texture2D(s_tex, v_texcoord0.xy);
+		if (texType == 1.0) color = vec4(color.xyz * color.w, color.w);
+		if (texType == 2.0) color = color.xxxx;
+		color *= scissor;
+		result = color * innerCol;
+	}
+
+	gl_FragColor = result;
+}
@@ -37,11 +37,31 @@ BX_PRAGMA_DIAGNOSTIC_IGNORED_MSVC(4244); // warning C4244: '=' : conversion from
 
 #include "vs_nanovg_fill.bin.h"
 #include "fs_nanovg_fill.bin.h"
+#include "vs_nanovg_fill_batch.bin.h"
+#include "fs_nanovg_fill_batch.bin.h"
+
+// Batch shaders are not compiled for Direct3D and console renderers, these
+// renderers set paints as uniforms.
+#define NVG_EMBEDDED_SHADER_BATCH(_name)                                                   \
+	{                                                                                      \
+		#_name,                                                                            \
+		{                                                                                  \
+			BGFX_EMBEDDED_SHADER_METAL(bgfx::RendererType::Metal,      _name)              \
+			BGFX_EMBEDDED_SHADER_ESSL (bgfx::RendererType::OpenGLES,   _name)              \
+			BGFX_EMBEDDED_SHADER_GLSL (bgfx::RendererType::OpenGL,     _name)              \
+			BGFX_EMBEDDED_SHADER_SPIRV(bgfx::RendererType::Vulkan,     _name)              \
+			BGFX_EMBEDDED_SHADER_SPIRV(bgfx::RendererType::WebGPU,     _name)              \
+			{ bgfx::RendererType::Noop,  (const uint8_t*)"VSH\x5\x0\x0\x0\x0\x0\x0", 10 }, \
+			{ bgfx::RendererType::Count, NULL, 0 }                                         \
+		}                                                                                  \
+	}
 
 static const bgfx::EmbeddedShader s_embeddedShaders[] =
 {
 	BGFX_EMBEDDED_SHADER(vs_nanovg_fill),
 	BGFX_EMBEDDED_SHADER(fs_nanovg_fill),
+	NVG_EMBEDDED_SHADER_BATCH(vs_nanovg_fill_batch),
+	NVG_EMBEDDED_SHADER_BATCH(fs_nanovg_fill_batch),
 
 	BGFX_EMBEDDED_SHADER_END()
 };
@@ -87,6 +107,29 @@ namespace
 		GLNVG_TRIANGLES,
 	};
 
+	// Paint of call, set as uniforms or stored in paint texture where each
+	// line is one texel.
+	struct GLNVGfragUniforms
+	{
+		float scissorMat0[3]; float strokeMult;
+		float scissorMat1[3]; float texType;
+		float paintMat0[3];   float type;
+		float paintMat1[3];   float feather;
+		NVGcolor innerCol;
+		NVGcolor outerCol;
+		float scissorExt[2];  float scissorScale[2];
+		float extent[2];      float radius; float unused;
+	};
+
+	// Paint texture page rows hold paints of 32 calls, and calls index their
+	// paint per vertex. This must match vs_nanovg_fill_batch.sc and
+	// fs_nanovg_fill_batch.sc.
+	static const uint16_t kPaintTexels        = sizeof(GLNVGfragUniforms) / (4*sizeof(float) );
+	static const uint16_t kPaintTextureWidth  = 256;
+	static const uint16_t kPaintTextureHeight = 128;
+	static const uint32_t kPaintsPerRow       = kPaintTextureWidth / kPaintTexels;
+	static const uint32_t kPaintsPerPage      = kPaintsPerRow * kPaintTextureHeight;
+
 	struct GLNVGcall
 	{
 		int type;
@@ -95,8 +138,11 @@ namespace
 		int pathCount;
 		int vertexOffset;
 		int vertexCount;
-		int uniformOffset;
+		int vertexAllocOffset;
+		int vertexAllocCount;
+		int paintPage;
 		GLNVGblend blendFunc;
+		GLNVGfragUniforms paint;
 	};
 
 	struct GLNVGpath
@@ -107,26 +153,25 @@ namespace
 		int strokeCount;
 	};
 
-	struct GLNVGfragUniforms
+	// Vertex of batch shaders, with index of call paint in paint texture page.
+	struct GLNVGvertex
 	{
-		float scissorMat[12]; // matrices are actually 3 vec4s
-		float paintMat[12];
-		NVGcolor innerCol;
-		NVGcolor outerCol;
-
-		// u_scissorExtScale
-		float scissorExt[2];
-		float scissorScale[2];
-
-		// u_extentRadius
-		float extent[2];
-		float radius;
+		float x, y, u, v;
+		float paint;
+	};
 
-		// u_params
-		float feather;
-		float strokeMult;
-		float texType;
-		float type;
+	// Last uniform values set, draws in sequential view retain uniform values
+	// of previous draw.
+	struct GLNVGuniformCache
+	{
+		float scissorMat[9];
+		float paintMat[9];
+		float innerCol[4];
+		float outerCol[4];
+		float scissorExtScale[4];
+		float extentRadius[4];
+		float params[4];
+		float halfTexel[4];
 	};
 
 	struct GLNVGcontext
@@ -145,13 +190,30 @@ namespace
 		bgfx::UniformHandle u_halfTexel;
 
 		bgfx::UniformHandle s_tex;
+		bgfx::UniformHandle s_paint;
 
 		uint64_t state;
 		bgfx::TextureHandle th;
 		bgfx::TextureHandle texMissing;
+		bgfx::TextureHandle tp;
+
+		// Paint texture pages, when renderer supports batch shaders. Otherwise
+		// paints are set as uniforms, and only calls with the same paint are
+		// merged.
+		bool batch;
+		bgfx::TextureHandle* paintPages;
+		int npaintPages;
+		int paintPage;
+		uint16_t paintRow;
+		uint32_t paintStartVertex;
 
 		bgfx::TransientVertexBuffer tvb;
+		bgfx::TransientIndexBuffer tib;
 		bgfx::ViewId viewId;
+		uint32_t nindices;
+
+		GLNVGuniformCache uniformCache;
+		NVGdrawStats stats;
 
 		struct GLNVGtexture* textures;
 		float view[2];
@@ -159,7 +221,6 @@ namespace
 		int ctextures;
 		int textureId;
 		int vertBuf;
-		int fragSize;
 		int edgeAntiAlias;
 
 		// Per frame buffers
@@ -172,9 +233,6 @@ namespace
 		struct NVGvertex* verts;
 		int cverts;
 		int nverts;
-		unsigned char* uniforms;
-		int cuniforms;
-		int nuniforms;
 	};
 
 	static struct GLNVGtexture* glnvg__allocTexture(struct GLNVGcontext* gl)
@@ -252,26 +310,60 @@ namespace
 		struct GLNVGcontext* gl = (struct GLNVGcontext*)_userPtr;
 
 		bgfx::RendererType::Enum type = bgfx::getRendererType();
-		gl->prog = bgfx::createProgram(
-						  bgfx::createEmbeddedShader(s_embeddedShaders, type, "vs_nanovg_fill")
-						, bgfx::createEmbeddedShader(s_embeddedShaders, type, "fs_nanovg_fill")
-						, true
-						);
+
+		// Batch shaders read paints from RGBA32F paint texture, without it
+		// paints are set as uniforms per call.
+		bgfx::ShaderHandle vsh = BGFX_INVALID_HANDLE;
+		bgfx::ShaderHandle fsh = BGFX_INVALID_HANDLE;
+
+		if (0 != (bgfx::getCaps()->formats[bgfx::TextureFormat::RGBA32F] & BGFX_CAPS_FORMAT_TEXTURE_2D) )
+		{
+			vsh = bgfx::createEmbeddedShader(s_embeddedShaders, type, "vs_nanovg_fill_batch");
+			fsh = bgfx::createEmbeddedShader(s_embeddedShaders, type, "fs_nanovg_fill_batch");
+		}
+
+		gl->batch = bgfx::isValid(vsh) && bgfx::isValid(fsh);
+
+		if (!gl->batch)
+		{
+			if (bgfx::isValid(vsh) )
+			{
+				bgfx::destroy(vsh);
+			}
+
+			if (bgfx::isValid(fsh) )
+			{
+				bgfx::destroy(fsh);
+			}
+
+			vsh = bgfx::createEmbeddedShader(s_embeddedShaders, type, "vs_nanovg_fill");
+			fsh = bgfx::createEmbeddedShader(s_embeddedShaders, type, "fs_nanovg_fill");
+		}
+
+		gl->prog = bgfx::createProgram(vsh, fsh, true);
 
 		const bgfx::Memory* mem = bgfx::alloc(4*4*4);
 		uint32_t* bgra8 = (uint32_t*)mem->data;
 		bx::memSet(bgra8, 0, 4*4*4);
 		gl->texMissing = bgfx::createTexture2D(4, 4, false, 1, bgfx::TextureFormat::BGRA8, 0, mem);
 
-		gl->u_scissorMat      = bgfx::createUniform("u_scissorMat",      bgfx::UniformType::Mat3);
-		gl->u_paintMat        = bgfx::createUniform("u_paintMat",        bgfx::UniformType::Mat3);
-		gl->u_innerCol        = bgfx::createUniform("u_innerCol",        bgfx::UniformType::Vec4);
-		gl->u_outerCol        = bgfx::createUniform("u_outerCol",        bgfx::UniformType::Vec4);
-		gl->u_viewSize        = bgfx::createUniform("u_viewSize",        bgfx::UniformType::Vec4);
-		gl->u_scissorExtScale = bgfx::createUniform("u_scissorExtScale", bgfx::UniformType::Vec4);
-		gl->u_extentRadius    = bgfx::createUniform("u_extentRadius",    bgfx::UniformType::Vec4);
-		gl->u_params          = bgfx::createUniform("u_params",          bgfx::UniformType::Vec4);
-		gl->s_tex             = bgfx::createUniform("s_tex",             bgfx::UniformType::Sampler);
+		gl->u_viewSize = bgfx::createUniform("u_viewSize", bgfx::UniformType::Vec4);
+		gl->s_tex      = bgfx::createUniform("s_tex",      bgfx::UniformType::Sampler);
+
+		if (gl->batch)
+		{
+			gl->s_paint = bgfx::createUniform("s_paint", bgfx::UniformType::Sampler);
+		}
+		else
+		{
+			gl->u_scissorMat      = bgfx::createUniform("u_scissorMat",      bgfx::UniformType::Mat3);
+			gl->u_paintMat        = bgfx::createUniform("u_paintMat",        bgfx::UniformType::Mat3);
+			gl->u_innerCol        = bgfx::createUniform("u_innerCol",        bgfx::UniformType::Vec4);
+			gl->u_outerCol        = bgfx::createUniform("u_outerCol",        bgfx::UniformType::Vec4);
+			gl->u_scissorExtScale = bgfx::createUniform("u_scissorExtScale", bgfx::UniformType::Vec4);
+			gl->u_extentRadius    = bgfx::createUniform("u_extentRadius",    bgfx::UniformType::Vec4);
+			gl->u_params          = bgfx::createUniform("u_params",          bgfx::UniformType::Vec4);
+		}
 
 		if (bgfx::getRendererType() == bgfx::RendererType::Direct3D9)
 		{
@@ -286,10 +378,14 @@ namespace
 			.begin()
 			.add(bgfx::Attrib::Position,  2, bgfx::AttribType::Float)
 			.add(bgfx::Attrib::TexCoord0, 2, bgfx::AttribType::Float)
-			.end();
+			;
+
+		if (gl->batch)
+		{
+			s_nvgLayout.add(bgfx::Attrib::TexCoord1, 1, bgfx::AttribType::Float);
+		}
 
-		int align = 16;
-		gl->fragSize = sizeof(struct GLNVGfragUniforms) + align - sizeof(struct GLNVGfragUniforms) % align;
+		s_nvgLayout.end();
 
 		return 1;
 	}
@@ -408,20 +504,14 @@ namespace
 		return 1;
 	}
 
-	static void glnvg__xformToMat3x4(float* m3, float* t)
-	{
-		m3[ 0] = t[0];
-		m3[ 1] = t[1];
-		m3[ 2] = 0.0f;
-		m3[ 3] = 0.0f;
-		m3[ 4] = t[2];
-		m3[ 5] = t[3];
-		m3[ 6] = 0.0f;
-		m3[ 7] = 0.0f;
-		m3[ 8] = t[4];
-		m3[ 9] = t[5];
-		m3[10] = 1.0f;
-		m3[11] = 0.0f;
+	static void glnvg__xformToRows(float* row0, float* row1, float* t)
+	{
+		row0[0] = t[0];
+		row0[1] = t[2];
+		row0[2] = t[4];
+		row1[0] = t[1];
+		row1[1] = t[3];
+		row1[2] = t[5];
 	}
 
 	static NVGcolor glnvg__premulColor(NVGcolor c)
@@ -451,7 +541,6 @@ namespace
 
 		if (scissor->extent[0] < -0.5f || scissor->extent[1] < -0.5f)
 		{
-			bx::memSet(frag->scissorMat, 0, sizeof(frag->scissorMat) );
 			frag->scissorExt[0] = 1.0f;
 			frag->scissorExt[1] = 1.0f;
 			frag->scissorScale[0] = 1.0f;
@@ -460,7 +549,7 @@ namespace
 		else
 		{
 			nvgTransformInverse(invxform, scissor->xform);
-			glnvg__xformToMat3x4(frag->scissorMat, invxform);
+			glnvg__xformToRows(frag->scissorMat0, frag->scissorMat1, invxform);
 			frag->scissorExt[0] = scissor->extent[0];
 			frag->scissorExt[1] = scissor->extent[1];
 			frag->scissorScale[0] = sqrtf(scissor->xform[0]*scissor->xform[0] + scissor->xform[2]*scissor->xform[2]) / fringe;
@@ -498,51 +587,66 @@ namespace
 			nvgTransformInverse(invxform, paint->xform);
 		}
 
-		glnvg__xformToMat3x4(frag->paintMat, invxform);
+		glnvg__xformToRows(frag->paintMat0, frag->paintMat1, invxform);
 
 		return 1;
 	}
 
-	static void glnvg__mat3(float* dst, float* src)
+	static void glnvg__setUniform(struct GLNVGcontext* gl, bgfx::UniformHandle _handle, float* _cache, const float* _value, uint32_t _num)
 	{
-		dst[0] = src[ 0];
-		dst[1] = src[ 1];
-		dst[2] = src[ 2];
-
-		dst[3] = src[ 4];
-		dst[4] = src[ 5];
-		dst[5] = src[ 6];
-
-		dst[6] = src[ 8];
-		dst[7] = src[ 9];
-		dst[8] = src[10];
+		if (0 != bx::memCmp(_cache, _value, _num*sizeof(float) ) )
+		{
+			bx::memCopy(_cache, _value, _num*sizeof(float) );
+			bgfx::setUniform(_handle, _value);
+			gl->stats.numUniforms++;
+		}
 	}
 
-	static struct GLNVGfragUniforms* nvg__fragUniformPtr(struct GLNVGcontext* gl, int i)
+	static void glnvg__mat3(float* dst, const float* row0, const float* row1)
 	{
-		return (struct GLNVGfragUniforms*)&gl->uniforms[i];
+		dst[0] = row0[0];
+		dst[1] = row1[0];
+		dst[2] = 0.0f;
+
+		dst[3] = row0[1];
+		dst[4] = row1[1];
+		dst[5] = 0.0f;
+
+		dst[6] = row0[2];
+		dst[7] = row1[2];
+		dst[8] = 1.0f;
 	}
 
-	static void nvgRenderSetUniforms(struct GLNVGcontext* gl, int uniformOffset, int image)
+	static void nvgRenderSetUniforms(struct GLNVGcontext* gl, const struct GLNVGcall* call)
 	{
-		struct GLNVGfragUniforms* frag = nvg__fragUniformPtr(gl, uniformOffset);
-		float tmp[9]; // Maybe there's a way to get rid of this...
-		glnvg__mat3(tmp, frag->scissorMat);
-		bgfx::setUniform(gl->u_scissorMat, tmp);
-		glnvg__mat3(tmp, frag->paintMat);
-		bgfx::setUniform(gl->u_paintMat, tmp);
+		struct GLNVGuniformCache* cache = &gl->uniformCache;
 
-		bgfx::setUniform(gl->u_innerCol,        frag->innerCol.rgba);
-		bgfx::setUniform(gl->u_outerCol,        frag->outerCol.rgba);
-		bgfx::setUniform(gl->u_scissorExtScale, &frag->scissorExt[0]);
-		bgfx::setUniform(gl->u_extentRadius,    &frag->extent[0]);
-		bgfx::setUniform(gl->u_params,          &frag->feather);
+		if (gl->batch)
+		{
+			gl->tp = gl->paintPages[call->paintPage];
+		}
+		else
+		{
+			const struct GLNVGfragUniforms* frag = &call->paint;
+			float tmp[9];
+			glnvg__mat3(tmp, frag->scissorMat0, frag->scissorMat1);
+			glnvg__setUniform(gl, gl->u_scissorMat, cache->scissorMat, tmp, 9);
+			glnvg__mat3(tmp, frag->paintMat0, frag->paintMat1);
+			glnvg__setUniform(gl, gl->u_paintMat, cache->paintMat, tmp, 9);
+
+			const float params[4] = { frag->feather, frag->strokeMult, frag->texType, frag->type };
+			glnvg__setUniform(gl, gl->u_innerCol,        cache->innerCol,        frag->innerCol.rgba, 4);
+			glnvg__setUniform(gl, gl->u_outerCol,        cache->outerCol,        frag->outerCol.rgba, 4);
+			glnvg__setUniform(gl, gl->u_scissorExtScale, cache->scissorExtScale, &frag->scissorExt[0], 4);
+			glnvg__setUniform(gl, gl->u_extentRadius,    cache->extentRadius,    &frag->extent[0], 4);
+			glnvg__setUniform(gl, gl->u_params,          cache->params,          params, 4);
+		}
 
 		bgfx::TextureHandle handle = gl->texMissing;
 
-		if (image != 0)
+		if (call->image != 0)
 		{
-			struct GLNVGtexture* tex = glnvg__findTexture(gl, image);
+			struct GLNVGtexture* tex = glnvg__findTexture(gl, call->image);
 			if (tex != NULL)
 			{
 				handle = tex->id;
@@ -550,7 +654,7 @@ namespace
 				if (bgfx::isValid(gl->u_halfTexel) )
 				{
 					float halfTexel[4] = { 0.5f / tex->width, 0.5f / tex->height };
-					bgfx::setUniform(gl->u_halfTexel, halfTexel);
+					glnvg__setUniform(gl, gl->u_halfTexel, cache->halfTexel, halfTexel, 4);
 				}
 			}
 		}
@@ -566,91 +670,207 @@ namespace
 		bgfx::setViewRect(gl->viewId, 0, 0, width * devicePixelRatio, height * devicePixelRatio);
 	}
 
-	static void fan(uint32_t _start, uint32_t _count)
+	static void glnvg__index(struct GLNVGcontext* gl, uint32_t _index)
 	{
-		uint32_t numTris = _count-2;
-		bgfx::TransientIndexBuffer tib;
-		bgfx::allocTransientIndexBuffer(&tib, numTris*3);
-		uint16_t* data = (uint16_t*)tib.data;
-		for (uint32_t ii = 0; ii < numTris; ++ii)
+		if (gl->tib.isIndex16)
+		{
+			( (uint16_t*)gl->tib.data)[gl->nindices++] = uint16_t(_index);
+		}
+		else
+		{
+			( (uint32_t*)gl->tib.data)[gl->nindices++] = _index;
+		}
+	}
+
+	// Fans, strips and lists are all converted to triangle lists, so that
+	// they can be drawn together with a single draw call.
+	static void glnvg__fan(struct GLNVGcontext* gl, uint32_t _start, uint32_t _count)
+	{
+		for (uint32_t ii = 2; ii < _count; ++ii)
+		{
+			glnvg__index(gl, _start);
+			glnvg__index(gl, _start + ii - 1);
+			glnvg__index(gl, _start + ii);
+		}
+	}
+
+	static void glnvg__strip(struct GLNVGcontext* gl, uint32_t _start, uint32_t _count)
+	{
+		for (uint32_t ii = 2; ii < _count; ++ii)
+		{
+			glnvg__index(gl, _start + ii - 2);
+			glnvg__index(gl, _start + ii - 1);
+			glnvg__index(gl, _start + ii);
+		}
+	}
+
+	static void glnvg__list(struct GLNVGcontext* gl, uint32_t _start, uint32_t _count)
+	{
+		for (uint32_t ii = 0, num = _count/3*3; ii < num; ++ii)
+		{
+			glnvg__index(gl, _start + ii);
+		}
+	}
+
+	static uint32_t glnvg__numTriangles(uint32_t _count)
+	{
+		return _count > 2 ? _count - 2 : 0;
+	}
+
+	// Number of indices of call triangle lists.
+	static uint32_t glnvg__numIndices(struct GLNVGcontext* gl, const struct GLNVGcall* call)
+	{
+		const struct GLNVGpath* paths = &gl->paths[call->pathOffset];
+		uint32_t num = 0;
+
+		switch (call->type)
+		{
+		case GLNVG_FILL:
+		case GLNVG_CONVEXFILL:
+			for (int i = 0; i < call->pathCount; i++)
+			{
+				num += glnvg__numTriangles(paths[i].fillCount)*3;
+				num += gl->edgeAntiAlias ? glnvg__numTriangles(paths[i].strokeCount)*3 : 0;
+			}
+			num += GLNVG_FILL == call->type ? 6 : 0;
+			break;
+
+		case GLNVG_STROKE:
+			for (int i = 0; i < call->pathCount; i++)
+			{
+				num += glnvg__numTriangles(paths[i].strokeCount)*3;
+			}
+			break;
+
+		case GLNVG_TRIANGLES:
+			num += call->vertexCount/3*3;
+			break;
+		}
+
+		return num;
+	}
+
+	// Number of draws submitted for call without merging.
+	static uint32_t glnvg__numDrawsUnmerged(struct GLNVGcontext* gl, const struct GLNVGcall* call)
+	{
+		const struct GLNVGpath* paths = &gl->paths[call->pathOffset];
+		uint32_t num = 0;
+
+		switch (call->type)
 		{
-			data[ii*3+0] = _start;
-			data[ii*3+1] = _start + ii + 1;
-			data[ii*3+2] = _start + ii + 2;
+		case GLNVG_FILL:
+			for (int i = 0; i < call->pathCount; i++)
+			{
+				num += 2 < paths[i].fillCount ? 1 : 0;
+			}
+			num += (gl->edgeAntiAlias ? call->pathCount : 0) + 1;
+			break;
+
+		case GLNVG_CONVEXFILL:
+			for (int i = 0; i < call->pathCount; i++)
+			{
+				num += 0 != paths[i].fillCount ? 1 : 0;
+			}
+			num += gl->edgeAntiAlias ? call->pathCount : 0;
+			break;
+
+		case GLNVG_STROKE:
+			num += call->pathCount;
+			break;
+
+		case GLNVG_TRIANGLES:
+			num += 3 <= call->vertexCount ? 1 : 0;
+			break;
 		}
 
-		bgfx::setIndexBuffer(&tib);
+		return num;
+	}
+
+	static void glnvg__submit(struct GLNVGcontext* gl, uint32_t _firstIndex, uint64_t _state, uint32_t _fstencil = BGFX_STENCIL_NONE, uint32_t _bstencil = BGFX_STENCIL_NONE)
+	{
+		if (_firstIndex != gl->nindices)
+		{
+			bgfx::setState(_state);
+			bgfx::setStencil(_fstencil, _bstencil);
+			bgfx::setVertexBuffer(0, &gl->tvb);
+			bgfx::setIndexBuffer(&gl->tib, _firstIndex, gl->nindices - _firstIndex);
+			bgfx::setTexture(0, gl->s_tex, gl->th);
+
+			if (gl->batch)
+			{
+				bgfx::setTexture(1, gl->s_paint, gl->tp);
+			}
+
+			bgfx::submit(gl->viewId, gl->prog);
+			gl->stats.numDraws++;
+		}
 	}
 
 	static void glnvg__fill(struct GLNVGcontext* gl, struct GLNVGcall* call)
 	{
 		struct GLNVGpath* paths = &gl->paths[call->pathOffset];
 		int i, npaths = call->pathCount;
+		uint32_t first;
 
-		// set bindpoint for solid loc
-		nvgRenderSetUniforms(gl, call->uniformOffset, 0);
+		// Stencil pass doesn't write color, and the rest of passes are using
+		// call paint.
+		nvgRenderSetUniforms(gl, call);
 
+		// Stencil is incremented and decremented, so all paths can be
+		// drawn in any order with one draw.
+		first = gl->nindices;
 		for (i = 0; i < npaths; i++)
 		{
-			if (2 < paths[i].fillCount)
-			{
-				bgfx::setState(0);
-				bgfx::setStencil(0
-					| BGFX_STENCIL_TEST_ALWAYS
-					| BGFX_STENCIL_FUNC_RMASK(0xff)
-					| BGFX_STENCIL_OP_FAIL_S_KEEP
-					| BGFX_STENCIL_OP_FAIL_Z_KEEP
-					| BGFX_STENCIL_OP_PASS_Z_INCR
-					, 0
-					| BGFX_STENCIL_TEST_ALWAYS
-					| BGFX_STENCIL_FUNC_RMASK(0xff)
-					| BGFX_STENCIL_OP_FAIL_S_KEEP
-					| BGFX_STENCIL_OP_FAIL_Z_KEEP
-					| BGFX_STENCIL_OP_PASS_Z_DECR
-					);
-				bgfx::setVertexBuffer(0, &gl->tvb);
-				bgfx::setTexture(0, gl->s_tex, gl->th);
-				fan(paths[i].fillOffset, paths[i].fillCount);
-				bgfx::submit(gl->viewId, gl->prog);
-			}
+			glnvg__fan(gl, paths[i].fillOffset, paths[i].fillCount);
 		}
 
-		// Draw aliased off-pixels
-		nvgRenderSetUniforms(gl, call->uniformOffset + gl->fragSize, call->image);
+		glnvg__submit(gl, first, 0
+			, 0
+			| BGFX_STENCIL_TEST_ALWAYS
+			| BGFX_STENCIL_FUNC_RMASK(0xff)
+			| BGFX_STENCIL_OP_FAIL_S_KEEP
+			| BGFX_STENCIL_OP_FAIL_Z_KEEP
+			| BGFX_STENCIL_OP_PASS_Z_INCR
+			, 0
+			| BGFX_STENCIL_TEST_ALWAYS
+			| BGFX_STENCIL_FUNC_RMASK(0xff)
+			| BGFX_STENCIL_OP_FAIL_S_KEEP
+			| BGFX_STENCIL_OP_FAIL_Z_KEEP
+			| BGFX_STENCIL_OP_PASS_Z_DECR
+			);
 
+		// Draw aliased off-pixels
 		if (gl->edgeAntiAlias)
 		{
 			// Draw fringes
+			first = gl->nindices;
 			for (i = 0; i < npaths; i++)
 			{
-				bgfx::setState(gl->state
-					| BGFX_STATE_PT_TRISTRIP
-					);
-				bgfx::setStencil(0
-					| BGFX_STENCIL_TEST_EQUAL
-					| BGFX_STENCIL_FUNC_RMASK(0xff)
-					| BGFX_STENCIL_OP_FAIL_S_KEEP
-					| BGFX_STENCIL_OP_FAIL_Z_KEEP
-					| BGFX_STENCIL_OP_PASS_Z_KEEP
-					);
-				bgfx::setVertexBuffer(0, &gl->tvb, paths[i].strokeOffset, paths[i].strokeCount);
-				bgfx::setTexture(0, gl->s_tex, gl->th);
-				bgfx::submit(gl->viewId, gl->prog);
+				glnvg__strip(gl, paths[i].strokeOffset, paths[i].strokeCount);
 			}
-		}
 
-		// Draw fill
-		bgfx::setState(gl->state);
-		bgfx::setVertexBuffer(0, &gl->tvb, call->vertexOffset, call->vertexCount);
-		bgfx::setTexture(0, gl->s_tex, gl->th);
-		bgfx::setStencil(0
-				| BGFX_STENCIL_TEST_NOTEQUAL
+			glnvg__submit(gl, first, gl->state
+				, 0
+				| BGFX_STENCIL_TEST_EQUAL
 				| BGFX_STENCIL_FUNC_RMASK(0xff)
-				| BGFX_STENCIL_OP_FAIL_S_ZERO
-				| BGFX_STENCIL_OP_FAIL_Z_ZERO
-				| BGFX_STENCIL_OP_PASS_Z_ZERO
+				| BGFX_STENCIL_OP_FAIL_S_KEEP
+				| BGFX_STENCIL_OP_FAIL_Z_KEEP
+				| BGFX_STENCIL_OP_PASS_Z_KEEP
 				);
-		bgfx::submit(gl->viewId, gl->prog);
+		}
+
+		// Draw fill
+		first = gl->nindices;
+		glnvg__list(gl, call->vertexOffset, call->vertexCount);
+
+		glnvg__submit(gl, first, gl->state
+			, 0
+			| BGFX_STENCIL_TEST_NOTEQUAL
+			| BGFX_STENCIL_FUNC_RMASK(0xff)
+			| BGFX_STENCIL_OP_FAIL_S_ZERO
+			| BGFX_STENCIL_OP_FAIL_Z_ZERO
+			| BGFX_STENCIL_OP_PASS_Z_ZERO
+			);
 	}
 
 	static void glnvg__convexFill(struct GLNVGcontext* gl, struct GLNVGcall* call)
@@ -658,16 +878,9 @@ namespace
 		struct GLNVGpath* paths = &gl->paths[call->pathOffset];
 		int i, npaths = call->pathCount;
 
-		nvgRenderSetUniforms(gl, call->uniformOffset, call->image);
-
 		for (i = 0; i < npaths; i++)
 		{
-			if (paths[i].fillCount == 0) continue;
-			bgfx::setState(gl->state);
-			bgfx::setVertexBuffer(0, &gl->tvb);
-			bgfx::setTexture(0, gl->s_tex, gl->th);
-			fan(paths[i].fillOffset, paths[i].fillCount);
-			bgfx::submit(gl->viewId, gl->prog);
+			glnvg__fan(gl, paths[i].fillOffset, paths[i].fillCount);
 		}
 
 		if (gl->edgeAntiAlias)
@@ -675,12 +888,7 @@ namespace
 			// Draw fringes
 			for (i = 0; i < npaths; i++)
 			{
-				bgfx::setState(gl->state
-					| BGFX_STATE_PT_TRISTRIP
-					);
-				bgfx::setVertexBuffer(0, &gl->tvb, paths[i].strokeOffset, paths[i].strokeCount);
-				bgfx::setTexture(0, gl->s_tex, gl->th);
-				bgfx::submit(gl->viewId, gl->prog);
+				glnvg__strip(gl, paths[i].strokeOffset, paths[i].strokeCount);
 			}
 		}
 	}
@@ -690,31 +898,32 @@ namespace
 		struct GLNVGpath* paths = &gl->paths[call->pathOffset];
 		int npaths = call->pathCount, i;
 
-		nvgRenderSetUniforms(gl, call->uniformOffset, call->image);
-
 		// Draw Strokes
 		for (i = 0; i < npaths; i++)
 		{
-			bgfx::setState(gl->state
-				| BGFX_STATE_PT_TRISTRIP
-				);
-			bgfx::setVertexBuffer(0, &gl->tvb, paths[i].strokeOffset, paths[i].strokeCount);
-			bgfx::setTexture(0, gl->s_tex, gl->th);
-			bgfx::submit(gl->viewId, gl->prog);
+			glnvg__strip(gl, paths[i].strokeOffset, paths[i].strokeCount);
 		}
 	}
 
 	static void glnvg__triangles(struct GLNVGcontext* gl, struct GLNVGcall* call)
 	{
-		if (3 <= call->vertexCount)
-		{
-			nvgRenderSetUniforms(gl, call->uniformOffset, call->image);
+		glnvg__list(gl, call->vertexOffset, call->vertexCount);
+	}
 
-			bgfx::setState(gl->state);
-			bgfx::setVertexBuffer(0, &gl->tvb, call->vertexOffset, call->vertexCount);
-			bgfx::setTexture(0, gl->s_tex, gl->th);
-			bgfx::submit(gl->viewId, gl->prog);
-		}
+	// Calls without stencil can be drawn with one draw call when they are
+	// using the same image and blending. With batch shaders paints can differ
+	// as long as they are in the same paint texture page, since vertices
+	// select their paint. Otherwise paint is uniform, and it must be the same.
+	static bool glnvg__canMerge(struct GLNVGcontext* gl, const struct GLNVGcall* _call, const struct GLNVGcall* _next)
+	{
+		return GLNVG_FILL != _next->type
+			&& _call->image == _next->image
+			&& 0 == bx::memCmp(&_call->blendFunc, &_next->blendFunc, sizeof(GLNVGblend) )
+			&& (gl->batch
+				? _call->paintPage == _next->paintPage
+				: 0 == bx::memCmp(&_call->paint, &_next->paint, sizeof(GLNVGfragUniforms) )
+				)
+			;
 	}
 
 	static const uint64_t s_blend[] =
@@ -756,11 +965,110 @@ namespace
 		return blend;
 	}
 
+	static bgfx::TextureHandle glnvg__paintPage(struct GLNVGcontext* gl, int page)
+	{
+		if (page == gl->npaintPages)
+		{
+			gl->paintPages = (bgfx::TextureHandle*)BX_REALLOC(gl->allocator, gl->paintPages, sizeof(bgfx::TextureHandle) * (page + 1) );
+			gl->paintPages[page] = bgfx::createTexture2D(
+				  kPaintTextureWidth
+				, kPaintTextureHeight
+				, false
+				, 1
+				, bgfx::TextureFormat::RGBA32F
+				, BGFX_SAMPLER_POINT|BGFX_SAMPLER_UVW_CLAMP
+				);
+			gl->npaintPages++;
+		}
+
+		return gl->paintPages[page];
+	}
+
+	// Uploads paints of calls, and copies vertices tagged with index of their
+	// call paint. Texture updates are executed before draws of the frame, so
+	// paint rows can't be reused within the same frame. Calls are split into
+	// chunks that fit into one paint texture page, and new pages are created
+	// when rows of existing ones are used up in the frame.
+	static void glnvg__uploadPaints(struct GLNVGcontext* gl)
+	{
+		// Transient buffers are reset every frame, vertex buffer allocated at
+		// or before the previous one means it's a new frame, and all paint
+		// rows are free.
+		if (gl->tvb.startVertex <= gl->paintStartVertex)
+		{
+			gl->paintPage = 0;
+			gl->paintRow  = 0;
+		}
+
+		gl->paintStartVertex = gl->tvb.startVertex;
+
+		struct GLNVGvertex* verts = (struct GLNVGvertex*)gl->tvb.data;
+
+		for (int first = 0; first < gl->ncalls; first += kPaintsPerPage)
+		{
+			const int num = bx::min<int>(gl->ncalls - first, kPaintsPerPage);
+			const uint16_t numRows = uint16_t( (num + kPaintsPerRow - 1) / kPaintsPerRow);
+
+			if (gl->paintRow + numRows > kPaintTextureHeight)
+			{
+				gl->paintPage++;
+				gl->paintRow = 0;
+			}
+
+			const bgfx::TextureHandle page = glnvg__paintPage(gl, gl->paintPage);
+
+			const bgfx::Memory* mem = bgfx::alloc(numRows*kPaintTextureWidth*4*sizeof(float) );
+			bx::memSet(mem->data, 0, mem->size);
+
+			for (int ii = 0; ii < num; ++ii)
+			{
+				struct GLNVGcall* call = &gl->calls[first + ii];
+				call->paintPage = gl->paintPage;
+
+				bx::memCopy(&mem->data[ii*sizeof(GLNVGfragUniforms)], &call->paint, sizeof(GLNVGfragUniforms) );
+
+				const float paint = float(gl->paintRow*kPaintsPerRow + ii);
+				const int end = bx::min(call->vertexAllocOffset + call->vertexAllocCount, gl->nverts);
+
+				for (int vv = call->vertexAllocOffset; vv < end; ++vv)
+				{
+					bx::memCopy(&verts[vv], &gl->verts[vv], sizeof(struct NVGvertex) );
+					verts[vv].paint = paint;
+				}
+			}
+
+			bgfx::updateTexture2D(page, 0, 0, 0, gl->paintRow, kPaintTextureWidth, numRows, mem);
+
+			gl->paintRow += numRows;
+		}
+	}
+
 	static void nvgRenderFlush(void* _userPtr)
 	{
 		struct GLNVGcontext* gl = (struct GLNVGcontext*)_userPtr;
 
-		if (gl->ncalls > 0)
+		bx::memSet(&gl->stats, 0, sizeof(gl->stats) );
+		gl->stats.numCalls = gl->ncalls;
+
+		uint32_t numIndices = 0;
+		for (int ii = 0; ii < gl->ncalls; ++ii)
+		{
+			numIndices += glnvg__numIndices(gl, &gl->calls[ii]);
+			gl->stats.numDrawsUnmerged += glnvg__numDrawsUnmerged(gl, &gl->calls[ii]);
+
+			// Stencil fill sets two paints, and each paint is seven uniforms.
+			gl->stats.numUniformsUnmerged += (GLNVG_FILL == gl->calls[ii].type ? 2 : 1) * 7;
+		}
+
+		const bool index32 = gl->nverts > UINT16_MAX;
+
+		if (gl->ncalls > 0
+		&&  0 < numIndices
+		&&  numIndices > bgfx::getAvailTransientIndexBuffer(numIndices, index32) )
+		{
+			BX_WARN(false, "Frame skipped due to transient index buffer overflow");
+		}
+		else if (gl->ncalls > 0)
 		{
 			bgfx::allocTransientVertexBuffer(&gl->tvb, gl->nverts, s_nvgLayout);
 
@@ -772,11 +1080,28 @@ namespace
 				BX_WARN(true, "Vertex number truncated due to transient vertex buffer overflow");
 			}
 
-			bx::memCopy(gl->tvb.data, gl->verts, gl->nverts * sizeof(struct NVGvertex) );
+			if (gl->batch)
+			{
+				glnvg__uploadPaints(gl);
+			}
+			else
+			{
+				bx::memCopy(gl->tvb.data, gl->verts, gl->nverts * sizeof(struct NVGvertex) );
+			}
+
+			gl->nindices = 0;
+			if (0 < numIndices)
+			{
+				bgfx::allocTransientIndexBuffer(&gl->tib, numIndices, index32);
+			}
+
+			// Uniform values are retained between draws in sequential view,
+			// only changed values are set.
+			bx::memSet(&gl->uniformCache, 0xff, sizeof(gl->uniformCache) );
 
 			bgfx::setUniform(gl->u_viewSize, gl->view);
 
-			for (uint32_t ii = 0, num = gl->ncalls; ii < num; ++ii)
+			for (uint32_t ii = 0, num = gl->ncalls; ii < num;)
 			{
 				struct GLNVGcall* call = &gl->calls[ii];
 				const GLNVGblend* blend = &call->blendFunc;
@@ -784,32 +1109,50 @@ namespace
 					| BGFX_STATE_WRITE_RGB
 					| BGFX_STATE_WRITE_A
 					;
-				switch (call->type)
+
+				if (GLNVG_FILL == call->type)
 				{
-				case GLNVG_FILL:
 					glnvg__fill(gl, call);
-					break;
-
-				case GLNVG_CONVEXFILL:
-					glnvg__convexFill(gl, call);
-					break;
+					++ii;
+					continue;
+				}
 
-				case GLNVG_STROKE:
-					glnvg__stroke(gl, call);
-					break;
+				const uint32_t first = gl->nindices;
+				nvgRenderSetUniforms(gl, call);
 
-				case GLNVG_TRIANGLES:
-					glnvg__triangles(gl, call);
-					break;
+				// Triangles of merged calls stay in call order, so blending
+				// order is preserved.
+				uint32_t jj = ii;
+				do
+				{
+					struct GLNVGcall* merged = &gl->calls[jj++];
+
+					switch (merged->type)
+					{
+					case GLNVG_CONVEXFILL:
+						glnvg__convexFill(gl, merged);
+						break;
+
+					case GLNVG_STROKE:
+						glnvg__stroke(gl, merged);
+						break;
+
+					case GLNVG_TRIANGLES:
+						glnvg__triangles(gl, merged);
+						break;
+					}
 				}
+				while (jj < num && glnvg__canMerge(gl, call, &gl->calls[jj]) );
+
+				glnvg__submit(gl, first, gl->state);
+				ii = jj;
 			}
 		}
 
 		// Reset calls
-		gl->nverts    = 0;
-		gl->npaths    = 0;
-		gl->ncalls    = 0;
-		gl->nuniforms = 0;
+		gl->nverts = 0;
+		gl->npaths = 0;
+		gl->ncalls = 0;
 	}
 
 	static int glnvg__maxVertCount(const struct NVGpath* paths, int npaths)
@@ -871,19 +1214,6 @@ namespace
 		return ret;
 	}
 
-	static int glnvg__allocFragUniforms(struct GLNVGcontext* gl, int n)
-	{
-		int ret = 0, structSize = gl->fragSize;
-		if (gl->nuniforms+n > gl->cuniforms)
-		{
-			gl->cuniforms = gl->cuniforms == 0 ? glnvg__maxi(n, 32) : gl->cuniforms * 2;
-			gl->uniforms = (unsigned char*)BX_REALLOC(gl->allocator, gl->uniforms, gl->cuniforms * structSize);
-		}
-		ret = gl->nuniforms * structSize;
-		gl->nuniforms += n;
-		return ret;
-	}
-
 	static void glnvg__vset(struct NVGvertex* vtx, float x, float y, float u, float v)
 	{
 		vtx->x = x;
@@ -907,7 +1237,6 @@ namespace
 
 		struct GLNVGcall* call = glnvg__allocCall(gl);
 		struct NVGvertex* quad;
-		struct GLNVGfragUniforms* frag;
 		int i, maxverts, offset;
 
 		call->type = GLNVG_FILL;
@@ -924,6 +1253,8 @@ namespace
 		// Allocate vertices for all the paths.
 		maxverts = glnvg__maxVertCount(paths, npaths) + 6;
 		offset = glnvg__allocVerts(gl, maxverts);
+		call->vertexAllocOffset = offset;
+		call->vertexAllocCount = maxverts;
 
 		for (i = 0; i < npaths; i++)
 		{
@@ -959,23 +1290,8 @@ namespace
 		glnvg__vset(&quad[4], bounds[2], bounds[1], 0.5f, 1.0f);
 		glnvg__vset(&quad[5], bounds[0], bounds[1], 0.5f, 1.0f);
 
-		// Setup uniforms for draw calls
-		if (call->type == GLNVG_FILL)
-		{
-			call->uniformOffset = glnvg__allocFragUniforms(gl, 2);
-			// Simple shader for stencil
-			frag = nvg__fragUniformPtr(gl, call->uniformOffset);
-			bx::memSet(frag, 0, sizeof(*frag) );
-			frag->type = NSVG_SHADER_SIMPLE;
-			// Fill shader
-			glnvg__convertPaint(gl, nvg__fragUniformPtr(gl, call->uniformOffset + gl->fragSize), paint, scissor, fringe, fringe);
-		}
-		else
-		{
-			call->uniformOffset = glnvg__allocFragUniforms(gl, 1);
-			// Fill shader
-			glnvg__convertPaint(gl, nvg__fragUniformPtr(gl, call->uniformOffset), paint, scissor, fringe, fringe);
-		}
+		// Fill shader, stencil pass doesn't write color and needs no paint.
+		glnvg__convertPaint(gl, &call->paint, paint, scissor, fringe, fringe);
 	}
 
 	static void nvgRenderStroke(
@@ -1003,6 +1319,8 @@ namespace
 		// Allocate vertices for all the paths.
 		maxverts = glnvg__maxVertCount(paths, npaths);
 		offset = glnvg__allocVerts(gl, maxverts);
+		call->vertexAllocOffset = offset;
+		call->vertexAllocCount = maxverts;
 
 		for (i = 0; i < npaths; i++)
 		{
@@ -1019,8 +1337,7 @@ namespace
 		}
 
 		// Fill shader
-		call->uniformOffset = glnvg__allocFragUniforms(gl, 1);
-		glnvg__convertPaint(gl, nvg__fragUniformPtr(gl, call->uniformOffset), paint, scissor, strokeWidth, fringe);
+		glnvg__convertPaint(gl, &call->paint, paint, scissor, strokeWidth, fringe);
 	}
 
 	static void nvgRenderTriangles(void* _userPtr, struct NVGpaint* paint, NVGcompositeOperationState compositeOperation, struct NVGscissor* scissor,
@@ -1028,7 +1345,7 @@ namespace
 	{
 		struct GLNVGcontext* gl = (struct GLNVGcontext*)_userPtr;
 		struct GLNVGcall* call = glnvg__allocCall(gl);
-		struct GLNVGfragUniforms* frag;
+		struct GLNVGfragUniforms* frag = &call->paint;
 
 		call->type = GLNVG_TRIANGLES;
 		call->image = paint->image;
@@ -1037,11 +1354,11 @@ namespace
 		// Allocate vertices for all the paths.
 		call->vertexOffset = glnvg__allocVerts(gl, nverts);
 		call->vertexCount = nverts;
+		call->vertexAllocOffset = call->vertexOffset;
+		call->vertexAllocCount = nverts;
 		bx::memCopy(&gl->verts[call->vertexOffset], verts, sizeof(struct NVGvertex) * nverts);
 
 		// Fill shader
-		call->uniformOffset = glnvg__allocFragUniforms(gl, 1);
-		frag = nvg__fragUniformPtr(gl, call->uniformOffset);
 		glnvg__convertPaint(gl, frag, paint, scissor, 1.0f, 1.0f);
 		frag->type = NSVG_SHADER_IMG;
 	}
@@ -1058,16 +1375,29 @@ namespace
 		bgfx::destroy(gl->prog);
 		bgfx::destroy(gl->texMissing);
 
-		bgfx::destroy(gl->u_scissorMat);
-		bgfx::destroy(gl->u_paintMat);
-		bgfx::destroy(gl->u_innerCol);
-		bgfx::destroy(gl->u_outerCol);
 		bgfx::destroy(gl->u_viewSize);
-		bgfx::destroy(gl->u_scissorExtScale);
-		bgfx::destroy(gl->u_extentRadius);
-		bgfx::destroy(gl->u_params);
 		bgfx::destroy(gl->s_tex);
 
+		if (gl->batch)
+		{
+			for (int ii = 0; ii < gl->npaintPages; ++ii)
+			{
+				bgfx::destroy(gl->paintPages[ii]);
+			}
+
+			bgfx::destroy(gl->s_paint);
+		}
+		else
+		{
+			bgfx::destroy(gl->u_scissorMat);
+			bgfx::destroy(gl->u_paintMat);
+			bgfx::destroy(gl->u_innerCol);
+			bgfx::destroy(gl->u_outerCol);
+			bgfx::destroy(gl->u_scissorExtScale);
+			bgfx::destroy(gl->u_extentRadius);
+			bgfx::destroy(gl->u_params);
+		}
+
 		if (bgfx::isValid(gl->u_halfTexel) )
 		{
 			bgfx::destroy(gl->u_halfTexel);
@@ -1082,7 +1412,7 @@ namespace
 			}
 		}
 
-		BX_FREE(gl->allocator, gl->uniforms);
+		BX_FREE(gl->allocator, gl->paintPages);
 		BX_FREE(gl->allocator, gl->verts);
 		BX_FREE(gl->allocator, gl->paths);
 		BX_FREE(gl->allocator, gl->calls);
@@ -1167,6 +1497,13 @@ uint16_t nvgGetViewId(struct NVGcontext* _ctx)
 	return gl->viewId;
 }
 
+void nvgGetDrawStats(NVGcontext* _ctx, NVGdrawStats* _stats)
+{
+	struct NVGparams* params = nvgInternalParams(_ctx);
+	struct GLNVGcontext* gl = (struct GLNVGcontext*)params->userPtr;
+	*_stats = gl->stats;
+}
+
 bgfx::TextureHandle nvglImageHandle(NVGcontext* _ctx, int32_t _image)
 {
 	GLNVGcontext* gl = (GLNVGcontext*)nvgInternalParams(_ctx)->userPtr;
@@ -12,6 +12,16 @@ namespace bx { struct AllocatorI; }
 
 struct NVGcontext;
 
+/// Draw statistics of last nanovg frame.
+struct NVGdrawStats
+{
+	uint32_t numCalls;            //!< Number of fill, stroke and triangles calls.
+	uint32_t numDraws;            //!< Number of submitted draws.
+	uint32_t numDrawsUnmerged;    //!< Number of draws without merging calls and paths.
+	uint32_t numUniforms;         //!< Number of uniforms set.
+	uint32_t numUniformsUnmerged; //!< Number of uniforms set without skipping unchanged values.
+};
+
 struct NVGLUframebuffer
 {
   NVGcontext* ctx;
@@ -35,6 +45,13 @@ void nvgSetViewId(NVGcontext* _ctx, bgfx::ViewId _viewId);
 ///
 uint16_t nvgGetViewId(struct NVGcontext* _ctx);
 
+/// Draw statistics of last frame. Consecutive convex fills, strokes and
+/// triangles with the same paint, image and blending are merged into one
+/// draw. Uniform values are retained between draws, so view must be in
+/// sequential mode.
+///
+void nvgGetDrawStats(NVGcontext* _ctx, NVGdrawStats* _stats);
+
 // Helper functions to create bgfx framebuffer to render to.
 // Example:
 //		float scale = 2;
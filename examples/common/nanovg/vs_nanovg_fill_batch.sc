@@ -0,0 +1,30 @@
+$input a_position, a_texcoord0, a_texcoord1
+$output v_position, v_texcoord0, v_paint
+
+#include "../common.sh"
+
+#define NEED_HALF_TEXEL (BGFX_SHADER_LANGUAGE_HLSL < 400)
+
+// Paint texture page is 256x128 texels, each row holds 32 paints of 8 texels.
+#define PAINTS_PER_ROW 32.0
+
+uniform vec4 u_viewSize;
+
+#if NEED_HALF_TEXEL
+uniform vec4 u_halfTexel;
+#endif // NEED_HALF_TEXEL
+
+void main()
+{
+#if !NEED_HALF_TEXEL
+	const vec4 u_halfTexel = vec4_splat(0.0);
+#endif // !NEED_HALF_TEXEL
+
+	float row = floor(a_texcoord1/PAINTS_PER_ROW);
+	float col = a_texcoord1 - row*PAINTS_PER_ROW;
+
+	v_position  = a_position;
+	v_texcoord0 = a_texcoord0+u_halfTexel.xy;
+	v_paint     = vec2(col*8.0 + 0.5, row + 0.5) / vec2(256.0, 128.0);
+	gl_Position = vec4(2.0*v_position.x/u_viewSize.x - 1.0, 1.0 - 2.0*v_position.y/u_viewSize.y, 0.0, 1.0);
+}
@@ -0,0 +1,571 @@
+/*
+ * Copyright 2011-2022 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include <bx/cpu.h>
+#include <bx/math.h>
+#include "occlusion.h"
+
+// Bin size in pixels, bins are rasterized independently by worker threads.
+static const int32_t kBinSize = 32;
+
+// Tile size in pixels, each tile stores farthest depth of its pixels.
+static const int32_t kTileSize = 8;
+
+// Maximum number of polygon vertices after clipping triangle against five
+// planes.
+static const uint32_t kMaxClipVertices = 8;
+
+// Clip planes in clip space, first plane is near plane which depends on
+// depth range.
+static const float s_clipPlanes[5][4] =
+{
+	{  0.0f,  0.0f, 1.0f, 0.0f }, // near
+	{  1.0f,  0.0f, 0.0f, 1.0f }, // left
+	{ -1.0f,  0.0f, 0.0f, 1.0f }, // right
+	{  0.0f,  1.0f, 0.0f, 1.0f }, // bottom
+	{  0.0f, -1.0f, 0.0f, 1.0f }, // top
+};
+
+static float planeDistance(const float* _plane, const float* _clip)
+{
+	return _plane[0]*_clip[0] + _plane[1]*_clip[1] + _plane[2]*_clip[2] + _plane[3]*_clip[3];
+}
+
+static uint32_t clipPolygon(float _out[][4], const float _in[][4], uint32_t _num, const float* _plane)
+{
+	uint32_t num = 0;
+
+	for (uint32_t ii = 0; ii < _num; ++ii)
+	{
+		const float* aa = _in[ii];
+		const float* bb = _in[(ii + 1) % _num];
+		const float da = planeDistance(_plane, aa);
+		const float db = planeDistance(_plane, bb);
+
+		if (da >= 0.0f)
+		{
+			bx::memCopy(_out[num++], aa, 4*sizeof(float) );
+		}
+
+		if ( (da >= 0.0f) != (db >= 0.0f) )
+		{
+			const float tt = da/(da - db);
+			_out[num][0] = bx::lerp(aa[0], bb[0], tt);
+			_out[num][1] = bx::lerp(aa[1], bb[1], tt);
+			_out[num][2] = bx::lerp(aa[2], bb[2], tt);
+			_out[num][3] = bx::lerp(aa[3], bb[3], tt);
+			++num;
+		}
+	}
+
+	return num;
+}
+
+OcclusionRasterizer::OcclusionRasterizer(bx::AllocatorI* _allocator, uint16_t _width, uint16_t _height, uint32_t _numThreads)
+	: m_allocator(_allocator)
+	, m_width(uint16_t( (bx::max<uint32_t>(_width,  1) + kTileSize - 1) & ~(kTileSize - 1) ) )
+	, m_height(uint16_t( (bx::max<uint32_t>(_height, 1) + kTileSize - 1) & ~(kTileSize - 1) ) )
+	, m_nextBin(0)
+	, m_exit(false)
+{
+	m_numBinsX  = uint16_t( (m_width  + kBinSize - 1) / kBinSize);
+	m_numBinsY  = uint16_t( (m_height + kBinSize - 1) / kBinSize);
+	m_numTilesX = uint16_t(m_width  / kTileSize);
+	m_numTilesY = uint16_t(m_height / kTileSize);
+
+	m_depth = (float*)BX_ALIGNED_ALLOC(m_allocator, m_width*m_height*sizeof(float), 16);
+	m_hiz   = (float*)BX_ALLOC(m_allocator, m_numTilesX*m_numTilesY*sizeof(float) );
+	bx::memSet(m_depth, 0, m_width*m_height*sizeof(float) );
+	bx::memSet(m_hiz,   0, m_numTilesX*m_numTilesY*sizeof(float) );
+
+	m_bins.resize(m_numBinsX*m_numBinsY);
+
+	bx::mtxIdentity(m_viewProj);
+	bx::memCopy(m_nearPlane, s_clipPlanes[0], sizeof(m_nearPlane) );
+
+	// Calling thread rasterizes bins too.
+	for (uint32_t ii = 1; ii < _numThreads; ++ii)
+	{
+		bx::Thread* thread = BX_NEW(m_allocator, bx::Thread);
+		thread->init(threadFunc, this, 0, "occlusion rasterizer");
+		m_threads.push_back(thread);
+	}
+}
+
+OcclusionRasterizer::~OcclusionRasterizer()
+{
+	m_exit = true;
+	m_start.post(uint32_t(m_threads.size() ) );
+
+	for (uint32_t ii = 0, num = uint32_t(m_threads.size() ); ii < num; ++ii)
+	{
+		m_threads[ii]->shutdown();
+		BX_DELETE(m_allocator, m_threads[ii]);
+	}
+
+	BX_ALIGNED_FREE(m_allocator, m_depth, 16);
+	BX_FREE(m_allocator, m_hiz);
+}
+
+void OcclusionRasterizer::begin(const float* _viewProj, bool _homogeneousDepth)
+{
+	bx::memCopy(m_viewProj, _viewProj, sizeof(m_viewProj) );
+
+	// Near plane is z >= -w for [-1, 1] depth range, and z >= 0 otherwise.
+	m_nearPlane[3] = _homogeneousDepth ? 1.0f : 0.0f;
+
+	bx::memSet(m_depth, 0, m_width*m_height*sizeof(float) );
+	bx::memSet(m_hiz,   0, m_numTilesX*m_numTilesY*sizeof(float) );
+
+	m_triangles.clear();
+
+	for (uint32_t ii = 0, num = uint32_t(m_bins.size() ); ii < num; ++ii)
+	{
+		m_bins[ii].clear();
+	}
+}
+
+void OcclusionRasterizer::addOccluder(
+	  const void* _vertices
+	, uint32_t _stride
+	, uint32_t _numVertices
+	, const uint16_t* _indices
+	, uint32_t _numIndices
+	, const float* _mtx
+	, CullMode::Enum _cull
+	)
+{
+	using namespace bx;
+
+	float mvp[16];
+	const float* mtx = m_viewProj;
+
+	if (NULL != _mtx)
+	{
+		bx::mtxMul(mvp, _mtx, m_viewProj);
+		mtx = mvp;
+	}
+
+	const simd128_t row0 = simd_ld<simd128_t>(mtx[ 0], mtx[ 1], mtx[ 2], mtx[ 3]);
+	const simd128_t row1 = simd_ld<simd128_t>(mtx[ 4], mtx[ 5], mtx[ 6], mtx[ 7]);
+	const simd128_t row2 = simd_ld<simd128_t>(mtx[ 8], mtx[ 9], mtx[10], mtx[11]);
+	const simd128_t row3 = simd_ld<simd128_t>(mtx[12], mtx[13], mtx[14], mtx[15]);
+
+	m_clip.resize(_numVertices);
+	m_outcode.resize(_numVertices);
+
+	const uint8_t* vertices = (const uint8_t*)_vertices;
+
+	for (uint32_t ii = 0; ii < _numVertices; ++ii)
+	{
+		const float* pos = (const float*)&vertices[ii*_stride];
+
+		m_clip[ii] = simd_madd(simd_splat<simd128_t>(pos[0]), row0
+			, simd_madd(simd_splat<simd128_t>(pos[1]), row1
+			, simd_madd(simd_splat<simd128_t>(pos[2]), row2, row3) ) );
+
+		const float* clip = (const float*)&m_clip[ii];
+
+		uint8_t outcode = planeDistance(m_nearPlane, clip) < 0.0f ? 1 : 0;
+		for (uint32_t jj = 1; jj < BX_COUNTOF(s_clipPlanes); ++jj)
+		{
+			outcode |= planeDistance(s_clipPlanes[jj], clip) < 0.0f ? uint8_t(1<<jj) : 0;
+		}
+
+		m_outcode[ii] = outcode;
+	}
+
+	for (uint32_t ii = 0; ii + 2 < _numIndices; ii += 3)
+	{
+		const uint16_t i0 = _indices[ii+0];
+		const uint16_t i1 = _indices[ii+1];
+		const uint16_t i2 = _indices[ii+2];
+
+		const uint8_t c0 = m_outcode[i0];
+		const uint8_t c1 = m_outcode[i1];
+		const uint8_t c2 = m_outcode[i2];
+
+		// All vertices are outside of the same plane.
+		if (0 != (c0 & c1 & c2) )
+		{
+			continue;
+		}
+
+		const float* v0 = (const float*)&m_clip[i0];
+		const float* v1 = (const float*)&m_clip[i1];
+		const float* v2 = (const float*)&m_clip[i2];
+
+		const uint8_t outcode = c0 | c1 | c2;
+		if (0 == outcode)
+		{
+			addTriangle(v0, v1, v2, _cull);
+			continue;
+		}
+
+		float polygon[2][kMaxClipVertices + 1][4];
+		bx::memCopy(polygon[0][0], v0, 4*sizeof(float) );
+		bx::memCopy(polygon[0][1], v1, 4*sizeof(float) );
+		bx::memCopy(polygon[0][2], v2, 4*sizeof(float) );
+
+		uint32_t num = 3;
+		uint32_t curr = 0;
+
+		for (uint32_t jj = 0; jj < BX_COUNTOF(s_clipPlanes) && 3 <= num; ++jj)
+		{
+			if (0 != (outcode & (1<<jj) ) )
+			{
+				const float* plane = 0 == jj ? m_nearPlane : s_clipPlanes[jj];
+				num  = clipPolygon(polygon[curr^1], polygon[curr], num, plane);
+				curr ^= 1;
+			}
+		}
+
+		for (uint32_t jj = 2; jj < num; ++jj)
+		{
+			addTriangle(polygon[curr][0], polygon[curr][jj-1], polygon[curr][jj], _cull);
+		}
+	}
+}
+
+void OcclusionRasterizer::addTriangle(const float* _v0, const float* _v1, const float* _v2, CullMode::Enum _cull)
+{
+	const float halfWidth  = float(m_width )*0.5f;
+	const float halfHeight = float(m_height)*0.5f;
+
+	// Screen space with y pointing down, and 1/w which is linear in screen
+	// space.
+	float iw[3] = { 1.0f/_v0[3], 1.0f/_v1[3], 1.0f/_v2[3] };
+	float xx[3] = { (_v0[0]*iw[0] + 1.0f)*halfWidth,  (_v1[0]*iw[1] + 1.0f)*halfWidth,  (_v2[0]*iw[2] + 1.0f)*halfWidth  };
+	float yy[3] = { (1.0f - _v0[1]*iw[0])*halfHeight, (1.0f - _v1[1]*iw[1])*halfHeight, (1.0f - _v2[1]*iw[2])*halfHeight };
+
+	// Counter-clockwise triangle in NDC has negative area in screen space.
+	float area = (xx[1] - xx[0])*(yy[2] - yy[0]) - (xx[2] - xx[0])*(yy[1] - yy[0]);
+
+	if (0.0f == area
+	|| (CullMode::Ccw == _cull && area < 0.0f)
+	|| (CullMode::Cw  == _cull && area > 0.0f) )
+	{
+		return;
+	}
+
+	if (area < 0.0f)
+	{
+		bx::swap(xx[1], xx[2]);
+		bx::swap(yy[1], yy[2]);
+		bx::swap(iw[1], iw[2]);
+		area = -area;
+	}
+
+	const int32_t minX = bx::max(int32_t(bx::floor(bx::min(xx[0], bx::min(xx[1], xx[2]) ) ) ), 0);
+	const int32_t minY = bx::max(int32_t(bx::floor(bx::min(yy[0], bx::min(yy[1], yy[2]) ) ) ), 0);
+	const int32_t maxX = bx::min(int32_t(bx::floor(bx::max(xx[0], bx::max(xx[1], xx[2]) ) ) ), m_width  - 1);
+	const int32_t maxY = bx::min(int32_t(bx::floor(bx::max(yy[0], bx::max(yy[1], yy[2]) ) ) ), m_height - 1);
+
+	if (minX > maxX
+	||  minY > maxY)
+	{
+		return;
+	}
+
+	Triangle tri;
+
+	// Edge ii is opposite of vertex ii, and it's positive inside of triangle.
+	for (uint32_t ii = 0; ii < 3; ++ii)
+	{
+		const uint32_t aa = (ii + 1) % 3;
+		const uint32_t bb = (ii + 2) % 3;
+		tri.m_edgeA[ii] = yy[aa] - yy[bb];
+		tri.m_edgeB[ii] = xx[bb] - xx[aa];
+		tri.m_edgeC[ii] = xx[aa]*yy[bb] - yy[aa]*xx[bb];
+	}
+
+	const float invArea = 1.0f/area;
+	tri.m_depth[0] = (tri.m_edgeA[0]*iw[0] + tri.m_edgeA[1]*iw[1] + tri.m_edgeA[2]*iw[2])*invArea;
+	tri.m_depth[1] = (tri.m_edgeB[0]*iw[0] + tri.m_edgeB[1]*iw[1] + tri.m_edgeB[2]*iw[2])*invArea;
+	tri.m_depth[2] = (tri.m_edgeC[0]*iw[0] + tri.m_edgeC[1]*iw[1] + tri.m_edgeC[2]*iw[2])*invArea;
+
+	// Depth is sampled at pixel center, offset it to farthest depth inside of
+	// pixel so that occluders stay conservative.
+	tri.m_depth[2] -= (bx::abs(tri.m_depth[0]) + bx::abs(tri.m_depth[1]) )*0.5f;
+
+	tri.m_minX = minX;
+	tri.m_minY = minY;
+	tri.m_maxX = maxX;
+	tri.m_maxY = maxY;
+
+	const uint32_t index = uint32_t(m_triangles.size() );
+	m_triangles.push_back(tri);
+
+	for (int32_t binY = minY/kBinSize, binYEnd = maxY/kBinSize; binY <= binYEnd; ++binY)
+	{
+		for (int32_t binX = minX/kBinSize, binXEnd = maxX/kBinSize; binX <= binXEnd; ++binX)
+		{
+			m_bins[binY*m_numBinsX + binX].push_back(index);
+		}
+	}
+}
+
+void OcclusionRasterizer::rasterize()
+{
+	m_nextBin = 0;
+	m_start.post(uint32_t(m_threads.size() ) );
+
+	rasterizeBins();
+
+	for (uint32_t ii = 0, num = uint32_t(m_threads.size() ); ii < num; ++ii)
+	{
+		m_done.wait();
+	}
+}
+
+void OcclusionRasterizer::rasterizeBins()
+{
+	const int32_t numBins = int32_t(m_bins.size() );
+
+	for (int32_t bin = bx::atomicFetchAndAdd(&m_nextBin, 1); bin < numBins; bin = bx::atomicFetchAndAdd(&m_nextBin, 1) )
+	{
+		rasterizeBin(uint32_t(bin) );
+	}
+}
+
+void OcclusionRasterizer::rasterizeBin(uint32_t _bin)
+{
+	using namespace bx;
+
+	const int32_t binMinX = int32_t(_bin % m_numBinsX) * kBinSize;
+	const int32_t binMinY = int32_t(_bin / m_numBinsX) * kBinSize;
+	const int32_t binMaxX = bx::min(binMinX + kBinSize, int32_t(m_width ) ) - 1;
+	const int32_t binMaxY = bx::min(binMinY + kBinSize, int32_t(m_height) ) - 1;
+
+	const simd128_t zero   = simd_zero<simd128_t>();
+	const simd128_t offset = simd_ld<simd128_t>(0.5f, 1.5f, 2.5f, 3.5f);
+
+	const tinystl::vector<uint32_t>& bin = m_bins[_bin];
+
+	for (uint32_t ii = 0, num = uint32_t(bin.size() ); ii < num; ++ii)
+	{
+		const Triangle& tri = m_triangles[bin[ii] ];
+
+		// Bin and row are multiple of 4 pixels, so 4 pixel blocks never cross
+		// into other bins.
+		const int32_t minX = bx::max(tri.m_minX, binMinX) & ~3;
+		const int32_t minY = bx::max(tri.m_minY, binMinY);
+		const int32_t maxX = bx::min(tri.m_maxX, binMaxX);
+		const int32_t maxY = bx::min(tri.m_maxY, binMaxY);
+
+		const simd128_t a0 = simd_splat<simd128_t>(tri.m_edgeA[0]);
+		const simd128_t a1 = simd_splat<simd128_t>(tri.m_edgeA[1]);
+		const simd128_t a2 = simd_splat<simd128_t>(tri.m_edgeA[2]);
+		const simd128_t ad = simd_splat<simd128_t>(tri.m_depth[0]);
+
+		for (int32_t yy = minY; yy <= maxY; ++yy)
+		{
+			const float py = float(yy) + 0.5f;
+			const simd128_t r0 = simd_splat<simd128_t>(tri.m_edgeB[0]*py + tri.m_edgeC[0]);
+			const simd128_t r1 = simd_splat<simd128_t>(tri.m_edgeB[1]*py + tri.m_edgeC[1]);
+			const simd128_t r2 = simd_splat<simd128_t>(tri.m_edgeB[2]*py + tri.m_edgeC[2]);
+			const simd128_t rd = simd_splat<simd128_t>(tri.m_depth[1]*py + tri.m_depth[2]);
+
+			float* row = &m_depth[yy*m_width];
+
+			for (int32_t xx = minX; xx <= maxX; xx += 4)
+			{
+				const simd128_t px = simd_add(simd_splat<simd128_t>(float(xx) ), offset);
+				const simd128_t e0 = simd_madd(a0, px, r0);
+				const simd128_t e1 = simd_madd(a1, px, r1);
+				const simd128_t e2 = simd_madd(a2, px, r2);
+
+				const simd128_t inside = simd_and(simd_cmpge(e0, zero)
+					, simd_and(simd_cmpge(e1, zero), simd_cmpge(e2, zero) ) );
+
+				if (0 == simd_signbitsmask(inside) )
+				{
+					continue;
+				}
+
+				const simd128_t depth = simd_madd(ad, px, rd);
+				const simd128_t prev  = simd_ld<simd128_t>(&row[xx]);
+				simd_st(&row[xx], simd_selb(inside, simd_max(prev, depth), prev) );
+			}
+		}
+	}
+
+	// Update farthest depth of tiles inside of bin.
+	for (int32_t ty = binMinY/kTileSize, tyEnd = (binMaxY + 1)/kTileSize; ty < tyEnd; ++ty)
+	{
+		for (int32_t tx = binMinX/kTileSize, txEnd = (binMaxX + 1)/kTileSize; tx < txEnd; ++tx)
+		{
+			simd128_t farthest = simd_splat<simd128_t>(bx::kFloatMax);
+
+			for (int32_t yy = 0; yy < kTileSize; ++yy)
+			{
+				const float* row = &m_depth[(ty*kTileSize + yy)*m_width + tx*kTileSize];
+				farthest = simd_min(farthest, simd_min(simd_ld<simd128_t>(&row[0]), simd_ld<simd128_t>(&row[4]) ) );
+			}
+
+			m_hiz[ty*m_numTilesX + tx] = bx::min(
+				  bx::min(simd_x(farthest), simd_y(farthest) )
+				, bx::min(simd_z(farthest), simd_w(farthest) )
+				);
+		}
+	}
+}
+
+int32_t OcclusionRasterizer::threadFunc(bx::Thread* _thread, void* _userData)
+{
+	BX_UNUSED(_thread);
+
+	OcclusionRasterizer& rasterizer = *(OcclusionRasterizer*)_userData;
+
+	for (;;)
+	{
+		rasterizer.m_start.wait();
+
+		if (rasterizer.m_exit)
+		{
+			break;
+		}
+
+		rasterizer.rasterizeBins();
+		rasterizer.m_done.post();
+	}
+
+	return bx::kExitSuccess;
+}
+
+bool OcclusionRasterizer::isVisible(const bx::Aabb& _aabb, const float* _mtx) const
+{
+	float mvp[16];
+	const float* mtx = m_viewProj;
+
+	if (NULL != _mtx)
+	{
+		bx::mtxMul(mvp, _mtx, m_viewProj);
+		mtx = mvp;
+	}
+
+	const float halfWidth  = float(m_width )*0.5f;
+	const float halfHeight = float(m_height)*0.5f;
+
+	float minX    =  bx::kFloatMax;
+	float minY    =  bx::kFloatMax;
+	float maxX    = -bx::kFloatMax;
+	float maxY    = -bx::kFloatMax;
+	float nearest = 0.0f;
+	uint32_t numBehind = 0;
+
+	for (uint32_t ii = 0; ii < 8; ++ii)
+	{
+		const float px = ii & 1 ? _aabb.max.x : _aabb.min.x;
+		const float py = ii & 2 ? _aabb.max.y : _aabb.min.y;
+		const float pz = ii & 4 ? _aabb.max.z : _aabb.min.z;
+
+		const float pos[4] = { px, py, pz, 1.0f };
+		float clip[4];
+		bx::vec4MulMtx(clip, pos, mtx);
+
+		if (planeDistance(m_nearPlane, clip) < 0.0f)
+		{
+			++numBehind;
+			continue;
+		}
+
+		const float iw = 1.0f/clip[3];
+		const float sx = (clip[0]*iw + 1.0f)*halfWidth;
+		const float sy = (1.0f - clip[1]*iw)*halfHeight;
+
+		minX    = bx::min(minX, sx);
+		minY    = bx::min(minY, sy);
+		maxX    = bx::max(maxX, sx);
+		maxY    = bx::max(maxY, sy);
+		nearest = bx::max(nearest, iw);
+	}
+
+	// Box behind near plane is hidden, and box crossing it is always visible.
+	if (0 != numBehind)
+	{
+		return 8 != numBehind;
+	}
+
+	const int32_t x0 = bx::max(int32_t(bx::floor(bx::max(minX, -1.0f) ) ), 0);
+	const int32_t y0 = bx::max(int32_t(bx::floor(bx::max(minY, -1.0f) ) ), 0);
+	const int32_t x1 = bx::min(int32_t(bx::floor(bx::min(maxX, float(m_width ) ) ) ), m_width  - 1);
+	const int32_t y1 = bx::min(int32_t(bx::floor(bx::min(maxY, float(m_height) ) ) ), m_height - 1);
+
+	if (x0 > x1
+	||  y0 > y1)
+	{
+		return false;
+	}
+
+	for (int32_t ty = y0/kTileSize, tyEnd = y1/kTileSize; ty <= tyEnd; ++ty)
+	{
+		for (int32_t tx = x0/kTileSize, txEnd = x1/kTileSize; tx <= txEnd; ++tx)
+		{
+			// Every pixel of tile is in front of box.
+			if (m_hiz[ty*m_numTilesX + tx] > nearest)
+			{
+				continue;
+			}
+
+			const int32_t minPx = bx::max(x0, tx*kTileSize);
+			const int32_t minPy = bx::max(y0, ty*kTileSize);
+			const int32_t maxPx = bx::min(x1, tx*kTileSize + kTileSize - 1);
+			const int32_t maxPy = bx::min(y1, ty*kTileSize + kTileSize - 1);
+
+			for (int32_t yy = minPy; yy <= maxPy; ++yy)
+			{
+				const float* row = &m_depth[yy*m_width];
+
+				for (int32_t xx = minPx; xx <= maxPx; ++xx)
+				{
+					if (row[xx] <= nearest)
+					{
+						return true;
+					}
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+uint32_t OcclusionRasterizer::cull(uint32_t* _result, const bx::Aabb* _aabbs, const uint32_t* _indices, uint32_t _num) const
+{
+	uint32_t num = 0;
+
+	for (uint32_t ii = 0; ii < _num; ++ii)
+	{
+		const uint32_t index = _indices[ii];
+
+		if (isVisible(_aabbs[index]) )
+		{
+			_result[num++] = index;
+		}
+	}
+
+	return num;
+}
+
+const float* OcclusionRasterizer::getDepthBuffer() const
+{
+	return m_depth;
+}
+
+uint16_t OcclusionRasterizer::getWidth() const
+{
+	return m_width;
+}
+
+uint16_t OcclusionRasterizer::getHeight() const
+{
+	return m_height;
+}
+
+uint32_t OcclusionRasterizer::getNumTriangles() const
+{
+	return uint32_t(m_triangles.size() );
+}
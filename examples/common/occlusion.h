@@ -0,0 +1,165 @@
+/*
+ * Copyright 2011-2022 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#ifndef OCCLUSION_H_HEADER_GUARD
+#define OCCLUSION_H_HEADER_GUARD
+
+#include <bx/allocator.h>
+#include <bx/bounds.h>
+#include <bx/semaphore.h>
+#include <bx/simd_t.h>
+#include <bx/thread.h>
+#include <tinystl/allocator.h>
+#include <tinystl/vector.h>
+
+/// Software occlusion culling. Occluders are rasterized on CPU into low
+/// resolution depth buffer, and occludee bounding boxes are tested against
+/// it in the same frame, without GPU readback latency.
+///
+/// Depth buffer is split into bins, which are rasterized in parallel by
+/// worker threads. Pixels are rasterized four at a time with SIMD.
+///
+class OcclusionRasterizer
+{
+public:
+	/// Occluder triangle culling.
+	struct CullMode
+	{
+		enum Enum
+		{
+			None, //!< Rasterize both sides.
+			Cw,   //!< Skip triangles with clockwise winding in NDC.
+			Ccw,  //!< Skip triangles with counter-clockwise winding in NDC.
+
+			Count
+		};
+	};
+
+	/// @param[in] _allocator Allocator.
+	/// @param[in] _width Depth buffer width, rounded up to multiple of 8.
+	/// @param[in] _height Depth buffer height, rounded up to multiple of 8.
+	/// @param[in] _numThreads Number of threads rasterizing bins, including
+	///   calling thread.
+	///
+	OcclusionRasterizer(bx::AllocatorI* _allocator, uint16_t _width, uint16_t _height, uint32_t _numThreads = 1);
+
+	///
+	~OcclusionRasterizer();
+
+	/// Clear depth buffer, and set view projection matrix used by following
+	/// calls.
+	///
+	/// @param[in] _viewProj View projection matrix.
+	/// @param[in] _homogeneousDepth True if depth range is [-1, 1], see
+	///   `bgfx::Caps::homogeneousDepth`.
+	///
+	void begin(const float* _viewProj, bool _homogeneousDepth);
+
+	/// Clip and bin occluder triangles. Triangles are rasterized by
+	/// `rasterize`.
+	///
+	/// @param[in] _vertices Vertex positions, three floats per vertex.
+	/// @param[in] _stride Vertex stride in bytes.
+	/// @param[in] _numVertices Number of vertices.
+	/// @param[in] _indices Triangle list indices.
+	/// @param[in] _numIndices Number of indices.
+	/// @param[in] _mtx Model matrix, or NULL when vertices are in world space.
+	/// @param[in] _cull Triangle culling.
+	///
+	void addOccluder(
+		  const void* _vertices
+		, uint32_t _stride
+		, uint32_t _numVertices
+		, const uint16_t* _indices
+		, uint32_t _numIndices
+		, const float* _mtx = NULL
+		, CullMode::Enum _cull = CullMode::None
+		);
+
+	/// Rasterize occluders added since `begin`. Bins are distributed among
+	/// worker threads.
+	///
+	void rasterize();
+
+	/// Test AABB against rasterized occluders.
+	///
+	/// @param[in] _aabb AABB.
+	/// @param[in] _mtx Model matrix, or NULL when AABB is in world space.
+	/// @returns False if AABB is completely hidden behind occluders, outside
+	///   of screen, or behind near plane.
+	///
+	bool isVisible(const bx::Aabb& _aabb, const float* _mtx = NULL) const;
+
+	/// Test world space AABBs against rasterized occluders.
+	///
+	/// @param[out] _result Indices of visible AABBs. Can be the same as
+	///   `_indices`.
+	/// @param[in] _aabbs AABBs.
+	/// @param[in] _indices Indices of tested AABBs.
+	/// @param[in] _num Number of indices.
+	/// @returns Number of visible AABBs.
+	///
+	uint32_t cull(uint32_t* _result, const bx::Aabb* _aabbs, const uint32_t* _indices, uint32_t _num) const;
+
+	/// Depth buffer, stores 1/w where zero is empty.
+	///
+	const float* getDepthBuffer() const;
+
+	///
+	uint16_t getWidth() const;
+
+	///
+	uint16_t getHeight() const;
+
+	/// Number of triangles rasterized after clipping and culling.
+	///
+	uint32_t getNumTriangles() const;
+
+private:
+	struct Triangle
+	{
+		float m_edgeA[3];
+		float m_edgeB[3];
+		float m_edgeC[3];
+		float m_depth[3];
+		int32_t m_minX;
+		int32_t m_minY;
+		int32_t m_maxX;
+		int32_t m_maxY;
+	};
+
+	void addTriangle(const float* _v0, const float* _v1, const float* _v2, CullMode::Enum _cull);
+	void rasterizeBin(uint32_t _bin);
+	void rasterizeBins();
+
+	static int32_t threadFunc(bx::Thread* _thread, void* _userData);
+
+	bx::AllocatorI* m_allocator;
+	float* m_depth;
+	float* m_hiz;
+
+	uint16_t m_width;
+	uint16_t m_height;
+	uint16_t m_numBinsX;
+	uint16_t m_numBinsY;
+	uint16_t m_numTilesX;
+	uint16_t m_numTilesY;
+
+	float m_viewProj[16];
+	float m_nearPlane[4];
+
+	tinystl::vector<Triangle> m_triangles;
+	tinystl::vector<tinystl::vector<uint32_t> > m_bins;
+	tinystl::vector<bx::simd128_t> m_clip;
+	tinystl::vector<uint8_t> m_outcode;
+
+	tinystl::vector<bx::Thread*> m_threads;
+	bx::Semaphore m_start;
+	bx::Semaphore m_done;
+	int32_t m_nextBin;
+	bool m_exit;
+};
+
+#endif // OCCLUSION_H_HEADER_GUARD
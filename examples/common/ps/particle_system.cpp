@@ -12,6 +12,12 @@
 
 #include <bx/easing.h>
 #include <bx/handlealloc.h>
+#include <bx/cpu.h>
+#include <bx/semaphore.h>
+#include <bx/simd_t.h>
+#include <bx/sort.h>
+#include <bx/thread.h>
+#include <bx/timer.h>
 
 #include "vs_particle.bin.h"
 #include "fs_particle.bin.h"
@@ -96,25 +102,35 @@ void EmitterUniforms::reset()
 
 namespace ps
 {
-	struct Particle
+	// Particle data is stored as structure of arrays, so that update, spawn
+	// and render kernels can process 4 particles at the time with SIMD.
+	struct ParticleStream
 	{
-		bx::Vec3 start;
-		bx::Vec3 end[2];
-		float blendStart;
-		float blendEnd;
-		float scaleStart;
-		float scaleEnd;
-
-		uint32_t rgba[5];
-
-		float life;
-		float lifeSpan;
-	};
-
-	struct ParticleSort
-	{
-		float    dist;
-		uint32_t idx;
+		enum Enum
+		{
+			Life,
+			LifeSpan,
+			StartX,
+			StartY,
+			StartZ,
+			End0X,
+			End0Y,
+			End0Z,
+			End1X,
+			End1Y,
+			End1Z,
+			BlendStart,
+			BlendEnd,
+			ScaleStart,
+			ScaleEnd,
+			Rgba0,
+			Rgba1,
+			Rgba2,
+			Rgba3,
+			Rgba4,
+
+			Count
+		};
 	};
 
 	inline uint32_t toAbgr(const float* _rgba)
@@ -138,6 +154,8 @@ namespace ps
 	}
 
 #define SPRITE_TEXTURE_SIZE 1024
+#define PS_MAX_WORKER_THREADS 16
+#define PS_RENDER_JOB_PARTICLES (4<<10)
 	template<uint16_t MaxHandlesT = 256, uint16_t TextureSizeT = 1024>
 	struct SpriteT
 	{
@@ -197,21 +215,32 @@ namespace ps
 
 		void update(float _dt)
 		{
-			uint32_t num = m_num;
-			for (uint32_t ii = 0; ii < num; ++ii)
+			using namespace bx;
+
+			float* life = m_stream[ParticleStream::Life];
+			const float* lifeSpan = m_stream[ParticleStream::LifeSpan];
+
+			// Streams are padded to multiple of 4 particles, tail doesn't
+			// need special handling.
+			const simd128_t dt = simd_splat(_dt);
+			for (uint32_t ii = 0, num = m_num; ii < num; ii += 4)
 			{
-				Particle& particle = m_particles[ii];
-				particle.life += _dt * 1.0f/particle.lifeSpan;
+				const simd128_t tt   = simd_ld(&life[ii]);
+				const simd128_t span = simd_ld(&lifeSpan[ii]);
+				simd_st(&life[ii], simd_add(tt, simd_div(dt, span) ) );
+			}
 
-				if (particle.life > 1.0f)
+			uint32_t num = m_num;
+			for (uint32_t ii = 0; ii < num;)
+			{
+				if (life[ii] > 1.0f)
 				{
-					if (ii != num-1)
-					{
-						bx::memCopy(&particle, &m_particles[num-1], sizeof(Particle) );
-						--ii;
-					}
-
 					--num;
+					copy(ii, num);
+				}
+				else
+				{
+					++ii;
 				}
 			}
 
@@ -223,6 +252,15 @@ namespace ps
 			}
 		}
 
+		void copy(uint32_t _dst, uint32_t _src)
+		{
+			for (uint32_t ii = 0; ii < ParticleStream::Count; ++ii)
+			{
+				uint32_t* stream = (uint32_t*)m_stream[ii];
+				stream[_dst] = stream[_src];
+			}
+		}
+
 		void spawn(float _dt)
 		{
 			float mtx[16];
@@ -239,13 +277,28 @@ namespace ps
 
 			constexpr bx::Vec3 up = { 0.0f, 1.0f, 0.0f };
 
+			float* life       = m_stream[ParticleStream::Life];
+			float* lifeSpan   = m_stream[ParticleStream::LifeSpan];
+			float* startX     = m_stream[ParticleStream::StartX];
+			float* startY     = m_stream[ParticleStream::StartY];
+			float* startZ     = m_stream[ParticleStream::StartZ];
+			float* endX       = m_stream[ParticleStream::End0X];
+			float* endY       = m_stream[ParticleStream::End0Y];
+			float* endZ       = m_stream[ParticleStream::End0Z];
+			float* blendStart = m_stream[ParticleStream::BlendStart];
+			float* blendEnd   = m_stream[ParticleStream::BlendEnd];
+			float* scaleStart = m_stream[ParticleStream::ScaleStart];
+			float* scaleEnd   = m_stream[ParticleStream::ScaleEnd];
+
+			const uint32_t first = m_num;
+
 			float time = 0.0f;
 			for (uint32_t ii = 0
 				; ii < numParticles && m_num < m_max
 				; ++ii
 				)
 			{
-				Particle& particle = m_particles[m_num];
+				const uint32_t idx = m_num;
 				m_num++;
 
 				bx::Vec3 pos(bx::init::None);
@@ -301,29 +354,136 @@ namespace ps
 				const bx::Vec3 tmp1 = bx::mul(dir, endOffset);
 				const bx::Vec3 end  = bx::add(tmp1, start);
 
-				particle.life = time;
-				particle.lifeSpan = bx::lerp(m_uniforms.m_lifeSpan[0], m_uniforms.m_lifeSpan[1], bx::frnd(&m_rng) );
-
-				const bx::Vec3 gravity = { 0.0f, -9.81f * m_uniforms.m_gravityScale * bx::square(particle.lifeSpan), 0.0f };
+				life[idx]     = time;
+				lifeSpan[idx] = bx::lerp(m_uniforms.m_lifeSpan[0], m_uniforms.m_lifeSpan[1], bx::frnd(&m_rng) );
 
-				particle.start  = bx::mul(start, mtx);
-				particle.end[0] = bx::mul(end,   mtx);
-				particle.end[1] = bx::add(particle.end[0], gravity);
+				// Emitter space, transformed to world space below.
+				startX[idx] = start.x;
+				startY[idx] = start.y;
+				startZ[idx] = start.z;
+				endX[idx]   = end.x;
+				endY[idx]   = end.y;
+				endZ[idx]   = end.z;
 
-				bx::memCopy(particle.rgba, m_uniforms.m_rgba, BX_COUNTOF(m_uniforms.m_rgba)*sizeof(uint32_t) );
+				for (uint32_t jj = 0; jj < BX_COUNTOF(m_uniforms.m_rgba); ++jj)
+				{
+					uint32_t* rgba = (uint32_t*)m_stream[ParticleStream::Rgba0+jj];
+					rgba[idx] = m_uniforms.m_rgba[jj];
+				}
 
-				particle.blendStart = bx::lerp(m_uniforms.m_blendStart[0], m_uniforms.m_blendStart[1], bx::frnd(&m_rng) );
-				particle.blendEnd   = bx::lerp(m_uniforms.m_blendEnd[0],   m_uniforms.m_blendEnd[1],   bx::frnd(&m_rng) );
+				blendStart[idx] = bx::lerp(m_uniforms.m_blendStart[0], m_uniforms.m_blendStart[1], bx::frnd(&m_rng) );
+				blendEnd[idx]   = bx::lerp(m_uniforms.m_blendEnd[0],   m_uniforms.m_blendEnd[1],   bx::frnd(&m_rng) );
 
-				particle.scaleStart = bx::lerp(m_uniforms.m_scaleStart[0], m_uniforms.m_scaleStart[1], bx::frnd(&m_rng) );
-				particle.scaleEnd   = bx::lerp(m_uniforms.m_scaleEnd[0],   m_uniforms.m_scaleEnd[1],   bx::frnd(&m_rng) );
+				scaleStart[idx] = bx::lerp(m_uniforms.m_scaleStart[0], m_uniforms.m_scaleStart[1], bx::frnd(&m_rng) );
+				scaleEnd[idx]   = bx::lerp(m_uniforms.m_scaleEnd[0],   m_uniforms.m_scaleEnd[1],   bx::frnd(&m_rng) );
 
 				time += timePerParticle;
 			}
+
+			transform(first, m_num, mtx);
 		}
 
-		uint32_t render(const float _uv[4], const float* _mtxView, const bx::Vec3& _eye, uint32_t _first, uint32_t _max, ParticleSort* _outSort, PosColorTexCoord0Vertex* _outVertices)
+		void transform(uint32_t _idx, const float* _mtx, float _gravity)
 		{
+			float* startX = m_stream[ParticleStream::StartX];
+			float* startY = m_stream[ParticleStream::StartY];
+			float* startZ = m_stream[ParticleStream::StartZ];
+			float* endX   = m_stream[ParticleStream::End0X];
+			float* endY   = m_stream[ParticleStream::End0Y];
+			float* endZ   = m_stream[ParticleStream::End0Z];
+
+			const bx::Vec3 start = bx::mul(bx::Vec3(startX[_idx], startY[_idx], startZ[_idx]), _mtx);
+			const bx::Vec3 end   = bx::mul(bx::Vec3(endX[_idx],   endY[_idx],   endZ[_idx]),   _mtx);
+
+			startX[_idx] = start.x;
+			startY[_idx] = start.y;
+			startZ[_idx] = start.z;
+			endX[_idx]   = end.x;
+			endY[_idx]   = end.y;
+			endZ[_idx]   = end.z;
+
+			const float span = m_stream[ParticleStream::LifeSpan][_idx];
+			m_stream[ParticleStream::End1X][_idx] = end.x;
+			m_stream[ParticleStream::End1Y][_idx] = end.y + _gravity * span * span;
+			m_stream[ParticleStream::End1Z][_idx] = end.z;
+		}
+
+		void transform(uint32_t _first, uint32_t _last, const float* _mtx)
+		{
+			using namespace bx;
+
+			const float gravity = -9.81f * m_uniforms.m_gravityScale;
+
+			uint32_t ii = _first;
+
+			for (; ii < _last && 0 != (ii & 3); ++ii)
+			{
+				transform(ii, _mtx, gravity);
+			}
+
+			const simd128_t m0  = simd_splat(_mtx[ 0]);
+			const simd128_t m1  = simd_splat(_mtx[ 1]);
+			const simd128_t m2  = simd_splat(_mtx[ 2]);
+			const simd128_t m4  = simd_splat(_mtx[ 4]);
+			const simd128_t m5  = simd_splat(_mtx[ 5]);
+			const simd128_t m6  = simd_splat(_mtx[ 6]);
+			const simd128_t m8  = simd_splat(_mtx[ 8]);
+			const simd128_t m9  = simd_splat(_mtx[ 9]);
+			const simd128_t m10 = simd_splat(_mtx[10]);
+			const simd128_t m12 = simd_splat(_mtx[12]);
+			const simd128_t m13 = simd_splat(_mtx[13]);
+			const simd128_t m14 = simd_splat(_mtx[14]);
+			const simd128_t gg  = simd_splat(gravity);
+
+			for (; ii+4 <= _last; ii += 4)
+			{
+				for (uint32_t jj = 0; jj < 2; ++jj)
+				{
+					float* xx = m_stream[ParticleStream::StartX + jj*3];
+					float* yy = m_stream[ParticleStream::StartY + jj*3];
+					float* zz = m_stream[ParticleStream::StartZ + jj*3];
+
+					const simd128_t px = simd_ld(&xx[ii]);
+					const simd128_t py = simd_ld(&yy[ii]);
+					const simd128_t pz = simd_ld(&zz[ii]);
+
+					simd_st(&xx[ii], simd_madd(px, m0, simd_madd(py, m4, simd_madd(pz, m8,  m12) ) ) );
+					simd_st(&yy[ii], simd_madd(px, m1, simd_madd(py, m5, simd_madd(pz, m9,  m13) ) ) );
+					simd_st(&zz[ii], simd_madd(px, m2, simd_madd(py, m6, simd_madd(pz, m10, m14) ) ) );
+				}
+
+				const simd128_t span = simd_ld(&m_stream[ParticleStream::LifeSpan][ii]);
+				const simd128_t endY = simd_ld(&m_stream[ParticleStream::End0Y][ii]);
+
+				simd_st(&m_stream[ParticleStream::End1X][ii], simd_ld(&m_stream[ParticleStream::End0X][ii]) );
+				simd_st(&m_stream[ParticleStream::End1Y][ii], simd_madd(simd_mul(gg, span), span, endY) );
+				simd_st(&m_stream[ParticleStream::End1Z][ii], simd_ld(&m_stream[ParticleStream::End0Z][ii]) );
+			}
+
+			for (; ii < _last; ++ii)
+			{
+				transform(ii, _mtx, gravity);
+			}
+		}
+
+		// Generates vertices and sort keys for particles in [_begin, _end)
+		// range, _begin must be multiple of 4. Output for particle ii is
+		// written at _first+ii, so ranges can be processed concurrently.
+		void render(
+			  const float _uv[4]
+			, const float* _mtxView
+			, const bx::Vec3& _eye
+			, uint32_t _first
+			, uint32_t _begin
+			, uint32_t _end
+			, uint32_t* _outKeys
+			, uint32_t* _outValues
+			, PosColorTexCoord0Vertex* _outVertices
+			, bx::Aabb& _outAabb
+			) const
+		{
+			using namespace bx;
+
 			bx::EaseFn easeRgba  = bx::getEaseFunc(m_uniforms.m_easeRgba);
 			bx::EaseFn easePos   = bx::getEaseFunc(m_uniforms.m_easePos);
 			bx::EaseFn easeBlend = bx::getEaseFunc(m_uniforms.m_easeBlend);
@@ -335,87 +495,148 @@ namespace ps
 				{ -bx::kInfinity, -bx::kInfinity, -bx::kInfinity },
 			};
 
-			for (uint32_t jj = 0, num = m_num, current = _first
-				; jj < num && current < _max
-				; ++jj, ++current
-				)
+			const float* life       = m_stream[ParticleStream::Life];
+			const float* startX     = m_stream[ParticleStream::StartX];
+			const float* startY     = m_stream[ParticleStream::StartY];
+			const float* startZ     = m_stream[ParticleStream::StartZ];
+			const float* end0X      = m_stream[ParticleStream::End0X];
+			const float* end0Y      = m_stream[ParticleStream::End0Y];
+			const float* end0Z      = m_stream[ParticleStream::End0Z];
+			const float* end1X      = m_stream[ParticleStream::End1X];
+			const float* end1Y      = m_stream[ParticleStream::End1Y];
+			const float* end1Z      = m_stream[ParticleStream::End1Z];
+			const float* blendStart = m_stream[ParticleStream::BlendStart];
+			const float* blendEnd   = m_stream[ParticleStream::BlendEnd];
+			const float* scaleStart = m_stream[ParticleStream::ScaleStart];
+			const float* scaleEnd   = m_stream[ParticleStream::ScaleEnd];
+
+			const simd128_t eyeX = simd_splat(_eye.x);
+			const simd128_t eyeY = simd_splat(_eye.y);
+			const simd128_t eyeZ = simd_splat(_eye.z);
+
+			BX_ASSERT(0 == (_begin & 3), "Particle range must start at multiple of 4 (%d).", _begin);
+
+			for (uint32_t jj = _begin; jj < _end; jj += 4)
 			{
-				const Particle& particle = m_particles[jj];
-
-				const float ttPos   = easePos(particle.life);
-				const float ttScale = easeScale(particle.life);
-				const float ttBlend = bx::clamp(easeBlend(particle.life), 0.0f, 1.0f);
-				const float ttRgba  = bx::clamp(easeRgba(particle.life),  0.0f, 1.0f);
-
-				const bx::Vec3 p0  = bx::lerp(particle.start,  particle.end[0], ttPos);
-				const bx::Vec3 p1  = bx::lerp(particle.end[0], particle.end[1], ttPos);
-				const bx::Vec3 pos = bx::lerp(p0, p1, ttPos);
-
-				ParticleSort& sort = _outSort[current];
-				const bx::Vec3 tmp0 = bx::sub(_eye, pos);
-				sort.dist = bx::length(tmp0);
-				sort.idx  = current;
-
-				uint32_t idx = uint32_t(ttRgba*4);
-				float ttmod = bx::mod(ttRgba, 0.25f)/0.25f;
-				uint32_t rgbaStart = particle.rgba[idx];
-				uint32_t rgbaEnd   = particle.rgba[idx+1];
-
-				float rr = bx::lerp( ( (uint8_t*)&rgbaStart)[0], ( (uint8_t*)&rgbaEnd)[0], ttmod)/255.0f;
-				float gg = bx::lerp( ( (uint8_t*)&rgbaStart)[1], ( (uint8_t*)&rgbaEnd)[1], ttmod)/255.0f;
-				float bb = bx::lerp( ( (uint8_t*)&rgbaStart)[2], ( (uint8_t*)&rgbaEnd)[2], ttmod)/255.0f;
-				float aa = bx::lerp( ( (uint8_t*)&rgbaStart)[3], ( (uint8_t*)&rgbaEnd)[3], ttmod)/255.0f;
-
-				float blend = bx::lerp(particle.blendStart, particle.blendEnd, ttBlend);
-				float scale = bx::lerp(particle.scaleStart, particle.scaleEnd, ttScale);
-
-				uint32_t abgr = toAbgr(rr, gg, bb, aa);
-
-				const bx::Vec3 udir = { _mtxView[0]*scale, _mtxView[4]*scale, _mtxView[8]*scale };
-				const bx::Vec3 vdir = { _mtxView[1]*scale, _mtxView[5]*scale, _mtxView[9]*scale };
-
-				PosColorTexCoord0Vertex* vertex = &_outVertices[current*4];
-
-				const bx::Vec3 ul = bx::sub(bx::sub(pos, udir), vdir);
-				bx::store(&vertex->m_x, ul);
-				aabbExpand(aabb, ul);
-				vertex->m_abgr  = abgr;
-				vertex->m_u     = _uv[0];
-				vertex->m_v     = _uv[1];
-				vertex->m_blend = blend;
-				++vertex;
-
-				const bx::Vec3 ur = bx::sub(bx::add(pos, udir), vdir);
-				bx::store(&vertex->m_x, ur);
-				aabbExpand(aabb, ur);
-				vertex->m_abgr  = abgr;
-				vertex->m_u     = _uv[2];
-				vertex->m_v     = _uv[1];
-				vertex->m_blend = blend;
-				++vertex;
-
-				const bx::Vec3 br = bx::add(bx::add(pos, udir), vdir);
-				bx::store(&vertex->m_x, br);
-				aabbExpand(aabb, br);
-				vertex->m_abgr  = abgr;
-				vertex->m_u     = _uv[2];
-				vertex->m_v     = _uv[3];
-				vertex->m_blend = blend;
-				++vertex;
-
-				const bx::Vec3 bl = bx::add(bx::sub(pos, udir), vdir);
-				bx::store(&vertex->m_x, bl);
-				aabbExpand(aabb, bl);
-				vertex->m_abgr  = abgr;
-				vertex->m_u     = _uv[0];
-				vertex->m_v     = _uv[3];
-				vertex->m_blend = blend;
-				++vertex;
-			}
+				BX_ALIGN_DECL_16(float ttPos[4]);
+				BX_ALIGN_DECL_16(float posX[4]);
+				BX_ALIGN_DECL_16(float posY[4]);
+				BX_ALIGN_DECL_16(float posZ[4]);
+				BX_ALIGN_DECL_16(float dist[4]);
 
-			m_aabb = aabb;
+				const uint32_t count = bx::uint32_min(4, _end - jj);
 
-			return m_num;
+				for (uint32_t kk = 0; kk < 4; ++kk)
+				{
+					ttPos[kk] = kk < count ? easePos(life[jj+kk]) : 0.0f;
+				}
+
+				const simd128_t tt = simd_ld(ttPos);
+
+				const simd128_t sx  = simd_ld(&startX[jj]);
+				const simd128_t sy  = simd_ld(&startY[jj]);
+				const simd128_t sz  = simd_ld(&startZ[jj]);
+				const simd128_t e0x = simd_ld(&end0X[jj]);
+				const simd128_t e0y = simd_ld(&end0Y[jj]);
+				const simd128_t e0z = simd_ld(&end0Z[jj]);
+				const simd128_t e1x = simd_ld(&end1X[jj]);
+				const simd128_t e1y = simd_ld(&end1Y[jj]);
+				const simd128_t e1z = simd_ld(&end1Z[jj]);
+
+				const simd128_t p0x = simd_madd(simd_sub(e0x, sx),  tt, sx);
+				const simd128_t p0y = simd_madd(simd_sub(e0y, sy),  tt, sy);
+				const simd128_t p0z = simd_madd(simd_sub(e0z, sz),  tt, sz);
+				const simd128_t p1x = simd_madd(simd_sub(e1x, e0x), tt, e0x);
+				const simd128_t p1y = simd_madd(simd_sub(e1y, e0y), tt, e0y);
+				const simd128_t p1z = simd_madd(simd_sub(e1z, e0z), tt, e0z);
+				const simd128_t px  = simd_madd(simd_sub(p1x, p0x), tt, p0x);
+				const simd128_t py  = simd_madd(simd_sub(p1y, p0y), tt, p0y);
+				const simd128_t pz  = simd_madd(simd_sub(p1z, p0z), tt, p0z);
+
+				const simd128_t dx = simd_sub(eyeX, px);
+				const simd128_t dy = simd_sub(eyeY, py);
+				const simd128_t dz = simd_sub(eyeZ, pz);
+				const simd128_t dd = simd_madd(dx, dx, simd_madd(dy, dy, simd_mul(dz, dz) ) );
+
+				simd_st(posX, px);
+				simd_st(posY, py);
+				simd_st(posZ, pz);
+				simd_st(dist, simd_sqrt(dd) );
+
+				for (uint32_t kk = 0; kk < count; ++kk)
+				{
+					const uint32_t ii      = jj + kk;
+					const uint32_t current = _first + ii;
+
+					const float ttScale = easeScale(life[ii]);
+					const float ttBlend = bx::clamp(easeBlend(life[ii]), 0.0f, 1.0f);
+					const float ttRgba  = bx::clamp(easeRgba(life[ii]),  0.0f, 1.0f);
+
+					const bx::Vec3 pos = { posX[kk], posY[kk], posZ[kk] };
+
+					// Back to front.
+					_outKeys[current]   = bx::floatFlip(bx::floatToBits(dist[kk]) ) ^ UINT32_MAX;
+					_outValues[current] = current;
+
+					const uint32_t idx = bx::uint32_min(uint32_t(ttRgba*4.0f), 3);
+					const float ttmod = bx::clamp(ttRgba*4.0f - float(idx), 0.0f, 1.0f);
+					uint32_t rgbaStart = ( (const uint32_t*)m_stream[ParticleStream::Rgba0+idx  ])[ii];
+					uint32_t rgbaEnd   = ( (const uint32_t*)m_stream[ParticleStream::Rgba0+idx+1])[ii];
+
+					float rr = bx::lerp( ( (uint8_t*)&rgbaStart)[0], ( (uint8_t*)&rgbaEnd)[0], ttmod)/255.0f;
+					float gg = bx::lerp( ( (uint8_t*)&rgbaStart)[1], ( (uint8_t*)&rgbaEnd)[1], ttmod)/255.0f;
+					float bb = bx::lerp( ( (uint8_t*)&rgbaStart)[2], ( (uint8_t*)&rgbaEnd)[2], ttmod)/255.0f;
+					float aa = bx::lerp( ( (uint8_t*)&rgbaStart)[3], ( (uint8_t*)&rgbaEnd)[3], ttmod)/255.0f;
+
+					float blend = bx::lerp(blendStart[ii], blendEnd[ii], ttBlend);
+					float scale = bx::lerp(scaleStart[ii], scaleEnd[ii], ttScale);
+
+					uint32_t abgr = toAbgr(rr, gg, bb, aa);
+
+					const bx::Vec3 udir = { _mtxView[0]*scale, _mtxView[4]*scale, _mtxView[8]*scale };
+					const bx::Vec3 vdir = { _mtxView[1]*scale, _mtxView[5]*scale, _mtxView[9]*scale };
+
+					PosColorTexCoord0Vertex* vertex = &_outVertices[current*4];
+
+					const bx::Vec3 ul = bx::sub(bx::sub(pos, udir), vdir);
+					bx::store(&vertex->m_x, ul);
+					aabbExpand(aabb, ul);
+					vertex->m_abgr  = abgr;
+					vertex->m_u     = _uv[0];
+					vertex->m_v     = _uv[1];
+					vertex->m_blend = blend;
+					++vertex;
+
+					const bx::Vec3 ur = bx::sub(bx::add(pos, udir), vdir);
+					bx::store(&vertex->m_x, ur);
+					aabbExpand(aabb, ur);
+					vertex->m_abgr  = abgr;
+					vertex->m_u     = _uv[2];
+					vertex->m_v     = _uv[1];
+					vertex->m_blend = blend;
+					++vertex;
+
+					const bx::Vec3 br = bx::add(bx::add(pos, udir), vdir);
+					bx::store(&vertex->m_x, br);
+					aabbExpand(aabb, br);
+					vertex->m_abgr  = abgr;
+					vertex->m_u     = _uv[2];
+					vertex->m_v     = _uv[3];
+					vertex->m_blend = blend;
+					++vertex;
+
+					const bx::Vec3 bl = bx::add(bx::sub(pos, udir), vdir);
+					bx::store(&vertex->m_x, bl);
+					aabbExpand(aabb, bl);
+					vertex->m_abgr  = abgr;
+					vertex->m_u     = _uv[0];
+					vertex->m_v     = _uv[3];
+					vertex->m_blend = blend;
+					++vertex;
+				}
+			}
+
+			_outAabb = aabb;
 		}
 
 		EmitterShape::Enum     m_shape;
@@ -427,21 +648,115 @@ namespace ps
 
 		bx::Aabb m_aabb;
 
-		Particle* m_particles;
+		float* m_stream[ParticleStream::Count];
 		uint32_t m_num;
 		uint32_t m_max;
 	};
 
-	static int32_t particleSortFn(const void* _lhs, const void* _rhs)
+	// Minimal fork-join pool. Calling thread participates in processing, and
+	// run() returns when all jobs are done.
+	struct WorkerPool
 	{
-		const ParticleSort& lhs = *(const ParticleSort*)_lhs;
-		const ParticleSort& rhs = *(const ParticleSort*)_rhs;
-		return lhs.dist > rhs.dist ? -1 : 1;
-	}
+		typedef void (*JobFn)(uint32_t _idx, void* _userData);
+
+		void init(uint32_t _numThreads)
+		{
+			m_num  = bx::uint32_min(_numThreads, PS_MAX_WORKER_THREADS);
+			m_exit = false;
+
+			for (uint32_t ii = 0; ii < m_num; ++ii)
+			{
+				m_thread[ii].init(threadFunc, this, 0, "ps-worker");
+			}
+		}
+
+		void shutdown()
+		{
+			m_exit = true;
+			m_start.post(m_num);
+
+			for (uint32_t ii = 0; ii < m_num; ++ii)
+			{
+				m_thread[ii].shutdown();
+			}
+
+			m_num = 0;
+		}
+
+		void run(uint32_t _numJobs, JobFn _fn, void* _userData)
+		{
+			m_fn       = _fn;
+			m_userData = _userData;
+			m_numJobs  = int32_t(_numJobs);
+			m_next     = 0;
+
+			const uint32_t numThreads = bx::uint32_min(m_num, _numJobs > 0 ? _numJobs-1 : 0);
+
+			m_start.post(numThreads);
+
+			process();
+
+			for (uint32_t ii = 0; ii < numThreads; ++ii)
+			{
+				m_done.wait();
+			}
+		}
+
+		void process()
+		{
+			for (int32_t idx = bx::atomicFetchAndAdd(&m_next, 1); idx < m_numJobs; idx = bx::atomicFetchAndAdd(&m_next, 1) )
+			{
+				m_fn(uint32_t(idx), m_userData);
+			}
+		}
+
+		static int32_t threadFunc(bx::Thread* _thread, void* _userData)
+		{
+			BX_UNUSED(_thread);
+
+			WorkerPool* pool = (WorkerPool*)_userData;
+
+			for (;;)
+			{
+				pool->m_start.wait();
+
+				if (pool->m_exit)
+				{
+					break;
+				}
+
+				pool->process();
+				pool->m_done.post();
+			}
+
+			return bx::kExitSuccess;
+		}
+
+		bx::Thread    m_thread[PS_MAX_WORKER_THREADS];
+		bx::Semaphore m_start;
+		bx::Semaphore m_done;
+
+		JobFn   m_fn;
+		void*   m_userData;
+		int32_t m_numJobs;
+		int32_t m_next;
+		uint32_t m_num;
+		volatile bool m_exit;
+	};
+
+	struct RenderJob
+	{
+		float    uv[4];
+		uint16_t emitter;
+		uint32_t first;
+		uint32_t begin;
+		uint32_t end;
+		bx::Aabb aabb;
+	};
 
 	struct ParticleSystem
 	{
-		void init(uint16_t _maxEmitters, bx::AllocatorI* _allocator)
+		void init(uint16_t _maxEmitters, bx::AllocatorI* _allocator, uint32_t _numThreads)
 		{
 			m_allocator = _allocator;
 
@@ -458,6 +773,17 @@ namespace ps
 
 			m_num = 0;
 
+			m_sortKeys = NULL;
+			m_sortMax  = 0;
+
+			m_renderJob    = NULL;
+			m_renderJobMax = 0;
+
+			m_workers.init(_numThreads);
+
+			m_updateTime = 0;
+			m_renderTime = 0;
+
 			s_texColor = bgfx::createUniform("s_texColor", bgfx::UniformType::Sampler);
 			m_texture  = bgfx::createTexture2D(
 				  SPRITE_TEXTURE_SIZE
@@ -477,12 +803,16 @@ namespace ps
 
 		void shutdown()
 		{
+			m_workers.shutdown();
+
 			bgfx::destroy(m_particleProgram);
 			bgfx::destroy(m_texture);
 			bgfx::destroy(s_texColor);
 
 			bx::destroyHandleAlloc(m_allocator, m_emitterAlloc);
 			BX_FREE(m_allocator, m_emitter);
+			BX_FREE(m_allocator, m_sortKeys);
+			BX_FREE(m_allocator, m_renderJob);
 
 			m_allocator = NULL;
 		}
@@ -514,30 +844,98 @@ namespace ps
 			m_sprite.destroy(_handle);
 		}
 
+		static void updateJob(uint32_t _idx, void* _userData)
+		{
+			ParticleSystem* ps = (ParticleSystem*)_userData;
+			const uint16_t idx = ps->m_emitterAlloc->getHandleAt(uint16_t(_idx) );
+			ps->m_emitter[idx].update(ps->m_dt);
+		}
+
 		void update(float _dt)
 		{
+			const int64_t start = bx::getHPCounter();
+
+			// Emitters are independent, each one is updated on its own worker.
+			const uint16_t numEmitters = m_emitterAlloc->getNumHandles();
+
+			m_dt = _dt;
+			m_workers.run(numEmitters, updateJob, this);
+
 			uint32_t numParticles = 0;
-			for (uint16_t ii = 0, num = m_emitterAlloc->getNumHandles(); ii < num; ++ii)
+			for (uint16_t ii = 0; ii < numEmitters; ++ii)
 			{
 				const uint16_t idx = m_emitterAlloc->getHandleAt(ii);
-				Emitter& emitter = m_emitter[idx];
-				emitter.update(_dt);
-				numParticles += emitter.m_num;
+				numParticles += m_emitter[idx].m_num;
 			}
 
 			m_num = numParticles;
+
+			m_updateTime = bx::getHPCounter() - start;
+		}
+
+		static void renderJob(uint32_t _idx, void* _userData)
+		{
+			ParticleSystem* ps = (ParticleSystem*)_userData;
+			RenderJob& job = ps->m_renderJob[_idx];
+
+			ps->m_emitter[job.emitter].render(
+				  job.uv
+				, ps->m_mtxView
+				, ps->m_eye
+				, job.first
+				, job.begin
+				, job.end
+				, ps->m_sortKeys
+				, &ps->m_sortKeys[ps->m_sortMax]
+				, ps->m_vertices
+				, job.aabb
+				);
+		}
+
+		template<typename IndexT>
+		static void indexJob(uint32_t _idx, void* _userData)
+		{
+			ParticleSystem* ps = (ParticleSystem*)_userData;
+
+			const uint32_t* sortValues = &ps->m_sortKeys[ps->m_sortMax];
+			IndexT* indices = (IndexT*)ps->m_indices;
+
+			const uint32_t begin = _idx*PS_RENDER_JOB_PARTICLES;
+			const uint32_t end   = bx::uint32_min(begin+PS_RENDER_JOB_PARTICLES, ps->m_numRender);
+
+			for (uint32_t ii = begin; ii < end; ++ii)
+			{
+				IndexT* index = &indices[ii*6];
+				const IndexT idx = IndexT(sortValues[ii]);
+				index[0] = idx*4+0;
+				index[1] = idx*4+1;
+				index[2] = idx*4+2;
+				index[3] = idx*4+2;
+				index[4] = idx*4+3;
+				index[5] = idx*4+0;
+			}
 		}
 
 		void render(uint8_t _view, const float* _mtxView, const bx::Vec3& _eye)
 		{
+			const int64_t start = bx::getHPCounter();
+
 			if (0 != m_num)
 			{
 				bgfx::TransientVertexBuffer tvb;
 				bgfx::TransientIndexBuffer tib;
 
+				// 16-bit indices address at most 64K vertices, above that
+				// switch to 32-bit indices when they are supported.
+				const bool index32 = true
+					&& m_num*4 > UINT16_MAX+1
+					&& 0 != (bgfx::getCaps()->supported & BGFX_CAPS_INDEX32)
+					;
+
 				const uint32_t numVertices = bgfx::getAvailTransientVertexBuffer(m_num*4, PosColorTexCoord0Vertex::ms_layout);
-				const uint32_t numIndices  = bgfx::getAvailTransientIndexBuffer(m_num*6);
-				const uint32_t max = bx::uint32_min(numVertices/4, numIndices/6);
+				const uint32_t numIndices  = bgfx::getAvailTransientIndexBuffer(m_num*6, index32);
+				const uint32_t maxIndexed  = index32 ? UINT32_MAX : (UINT16_MAX+1)/4;
+				const uint32_t max = bx::uint32_min(bx::uint32_min(numVertices/4, numIndices/6), maxIndexed);
 				BX_WARN(m_num == max
 					, "Truncating transient buffer for particles to maximum available (requested %d, available %d)."
 					, m_num
@@ -551,11 +949,24 @@ namespace ps
 						, max*4
 						, &tib
 						, max*6
+						, index32
 						);
-					PosColorTexCoord0Vertex* vertices = (PosColorTexCoord0Vertex*)tvb.data;
 
-					ParticleSort* particleSort = (ParticleSort*)BX_ALLOC(m_allocator, max*sizeof(ParticleSort) );
+					if (m_sortMax < max)
+					{
+						m_sortMax  = bx::uint32_max(max, m_sortMax*2);
+						m_sortKeys = (uint32_t*)BX_REALLOC(m_allocator, m_sortKeys, m_sortMax*4*sizeof(uint32_t) );
+					}
 
+					m_mtxView   = _mtxView;
+					m_eye       = _eye;
+					m_vertices  = (PosColorTexCoord0Vertex*)tvb.data;
+					m_indices   = tib.data;
+					m_numRender = max;
+
+					// Split emitters into fixed size particle ranges writing
+					// into disjoint parts of transient buffer.
+					uint32_t numJobs = 0;
 					uint32_t pos = 0;
 					for (uint16_t ii = 0, numEmitters = m_emitterAlloc->getNumHandles(); ii < numEmitters; ++ii)
 					{
@@ -564,38 +975,64 @@ namespace ps
 
 						const Pack2D& pack = m_sprite.get(emitter.m_uniforms.m_handle);
 						const float invTextureSize = 1.0f/SPRITE_TEXTURE_SIZE;
-						const float uv[4] =
+
+						const uint32_t num = pos < max ? bx::uint32_min(emitter.m_num, max - pos) : 0;
+
+						for (uint32_t begin = 0; begin < num; begin += PS_RENDER_JOB_PARTICLES)
 						{
-							 pack.m_x                  * invTextureSize,
-							 pack.m_y                  * invTextureSize,
-							(pack.m_x + pack.m_width ) * invTextureSize,
-							(pack.m_y + pack.m_height) * invTextureSize,
+							if (numJobs == m_renderJobMax)
+							{
+								m_renderJobMax = bx::uint32_max(64, m_renderJobMax*2);
+								m_renderJob = (RenderJob*)BX_REALLOC(m_allocator, m_renderJob, m_renderJobMax*sizeof(RenderJob) );
+							}
+
+							RenderJob& job = m_renderJob[numJobs++];
+							job.uv[0]   =  pack.m_x                  * invTextureSize;
+							job.uv[1]   =  pack.m_y                  * invTextureSize;
+							job.uv[2]   = (pack.m_x + pack.m_width ) * invTextureSize;
+							job.uv[3]   = (pack.m_y + pack.m_height) * invTextureSize;
+							job.emitter = idx;
+							job.first   = pos;
+							job.begin   = begin;
+							job.end     = bx::uint32_min(begin+PS_RENDER_JOB_PARTICLES, num);
+						}
+
+						emitter.m_aabb =
+						{
+							{  bx::kInfinity,  bx::kInfinity,  bx::kInfinity },
+							{ -bx::kInfinity, -bx::kInfinity, -bx::kInfinity },
 						};
 
-						pos += emitter.render(uv, _mtxView, _eye, pos, max, particleSort, vertices);
+						pos += emitter.m_num;
 					}
 
-					qsort(particleSort
-						, max
-						, sizeof(ParticleSort)
-						, particleSortFn
-						);
+					m_workers.run(numJobs, renderJob, this);
 
-					uint16_t* indices = (uint16_t*)tib.data;
-					for (uint32_t ii = 0; ii < max; ++ii)
+					for (uint32_t ii = 0; ii < numJobs; ++ii)
 					{
-						const ParticleSort& sort = particleSort[ii];
-						uint16_t* index = &indices[ii*6];
-						uint16_t idx = (uint16_t)sort.idx;
-						index[0] = idx*4+0;
-						index[1] = idx*4+1;
-						index[2] = idx*4+2;
-						index[3] = idx*4+2;
-						index[4] = idx*4+3;
-						index[5] = idx*4+0;
+						const RenderJob& job = m_renderJob[ii];
+						bx::Aabb& aabb = m_emitter[job.emitter].m_aabb;
+						aabbExpand(aabb, job.aabb.min);
+						aabbExpand(aabb, job.aabb.max);
 					}
 
-					BX_FREE(m_allocator, particleSort);
+					uint32_t* sortKeys       = &m_sortKeys[0];
+					uint32_t* sortValues     = &m_sortKeys[m_sortMax];
+					uint32_t* sortTempKeys   = &m_sortKeys[m_sortMax*2];
+					uint32_t* sortTempValues = &m_sortKeys[m_sortMax*3];
+
+					bx::radixSort(sortKeys, sortTempKeys, sortValues, sortTempValues, max);
+
+					const uint32_t numIndexJobs = (max + PS_RENDER_JOB_PARTICLES - 1) / PS_RENDER_JOB_PARTICLES;
+
+					if (index32)
+					{
+						m_workers.run(numIndexJobs, indexJob<uint32_t>, this);
+					}
+					else
+					{
+						m_workers.run(numIndexJobs, indexJob<uint16_t>, this);
+					}
 
 					bgfx::setState(0
 						| BGFX_STATE_WRITE_RGB
@@ -610,6 +1047,15 @@ namespace ps
 					bgfx::submit(_view, m_particleProgram);
 				}
 			}
+
+			m_renderTime = bx::getHPCounter() - start;
+		}
+
+		void getStats(ParticleSystemStats& _outStats)
+		{
+			_outStats.m_numParticles = m_num;
+			_outStats.m_updateTime   = m_updateTime;
+			_outStats.m_renderTime   = m_renderTime;
 		}
 
 		EmitterHandle createEmitter(EmitterShape::Enum _shape, EmitterDirection::Enum _direction, uint32_t _maxParticles)
@@ -675,6 +1121,25 @@ namespace ps
 		bgfx::TextureHandle m_texture;
 		bgfx::ProgramHandle m_particleProgram;
 
+		uint32_t* m_sortKeys;
+		uint32_t  m_sortMax;
+
+		WorkerPool m_workers;
+
+		RenderJob* m_renderJob;
+		uint32_t   m_renderJobMax;
+
+		// Per call state shared with update and render jobs.
+		float                    m_dt;
+		const float*             m_mtxView;
+		bx::Vec3                 m_eye{bx::init::None};
+		PosColorTexCoord0Vertex* m_vertices;
+		uint8_t*                 m_indices;
+		uint32_t                 m_numRender;
+
+		int64_t m_updateTime;
+		int64_t m_renderTime;
+
 		uint32_t m_num;
 	};
 
@@ -687,22 +1152,37 @@ namespace ps
 		m_shape     = _shape;
 		m_direction = _direction;
 		m_max       = _maxParticles;
-		m_particles = (Particle*)BX_ALLOC(s_ctx.m_allocator, m_max*sizeof(Particle) );
+
+		// Streams are padded to multiple of 4 particles, and aligned for
+		// SIMD loads and stores.
+		const uint32_t stride = bx::strideAlign(m_max, 4);
+		float* data = (float*)BX_ALIGNED_ALLOC(s_ctx.m_allocator, ParticleStream::Count*stride*sizeof(float), 16);
+		bx::memSet(data, 0, ParticleStream::Count*stride*sizeof(float) );
+
+		for (uint32_t ii = 0; ii < ParticleStream::Count; ++ii)
+		{
+			m_stream[ii] = &data[ii*stride];
+		}
+
+		for (uint32_t ii = 0; ii < stride; ++ii)
+		{
+			m_stream[ParticleStream::LifeSpan][ii] = 1.0f;
+		}
 	}
 
 	void Emitter::destroy()
 	{
-		BX_FREE(s_ctx.m_allocator, m_particles);
-		m_particles = NULL;
+		BX_ALIGNED_FREE(s_ctx.m_allocator, m_stream[0], 16);
+		bx::memSet(m_stream, 0, sizeof(m_stream) );
 	}
 
 } // namespace ps
 
 using namespace ps;
 
-void psInit(uint16_t _maxEmitters, bx::AllocatorI* _allocator)
+void psInit(uint16_t _maxEmitters, bx::AllocatorI* _allocator, uint32_t _numThreads)
 {
-	s_ctx.init(_maxEmitters, _allocator);
+	s_ctx.init(_maxEmitters, _allocator, _numThreads);
 }
 
 void psShutdown()
@@ -749,3 +1229,8 @@ void psRender(uint8_t _view, const float* _mtxView, const bx::Vec3& _eye)
 {
 	s_ctx.render(_view, _mtxView, _eye);
 }
+
+void psGetStats(ParticleSystemStats& _outStats)
+{
+	s_ctx.getStats(_outStats);
+}
@@ -73,7 +73,22 @@ struct EmitterUniforms
 };
 
 ///
-void psInit(uint16_t _maxEmitters = 64, bx::AllocatorI* _allocator = NULL);
+struct ParticleSystemStats
+{
+	uint32_t m_numParticles; ///< Number of live particles.
+	int64_t  m_updateTime;   ///< Last psUpdate CPU time in bx::getHPCounter ticks.
+	int64_t  m_renderTime;   ///< Last psRender CPU time in bx::getHPCounter ticks.
+};
+
+/// Initialize particle system.
+///
+/// @param[in] _maxEmitters Maximum number of emitters.
+/// @param[in] _allocator Allocator, default allocator is used when NULL.
+/// @param[in] _numThreads Number of worker threads used to update emitters
+///   and generate vertices in addition to calling thread. When 0 everything
+///   is processed on calling thread.
+///
+void psInit(uint16_t _maxEmitters = 64, bx::AllocatorI* _allocator = NULL, uint32_t _numThreads = 0);
 
 ///
 void psShutdown();
@@ -102,4 +117,7 @@ void psUpdate(float _dt);
 ///
 void psRender(uint8_t _view, const float* _mtxView, const bx::Vec3& _eye);
 
+///
+void psGetStats(ParticleSystemStats& _outStats);
+
 #endif // PARTICLE_SYSTEM_H_HEADER_GUARD
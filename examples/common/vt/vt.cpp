@@ -0,0 +1,2533 @@
+/*
+ * Copyright 2018 Ales Mlakar. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+ /*
+  * Reference(s):
+  * - Sparse Virtual Textures by Sean Barrett
+  *   http://web.archive.org/web/20190103162611/http://silverspaceship.com/src/svt/
+  * - Based on Virtual Texture Demo by Brad Blanchard
+  *   http://web.archive.org/web/20190103162638/http://linedef.com/virtual-texture-demo.html
+  * - Mars texture
+  *   http://web.archive.org/web/20190103162730/http://www.celestiamotherlode.net/catalog/mars.php
+  */
+
+#include <bimg/encode.h>
+#include <bx/cpu.h>
+#include <bx/file.h>
+#include <bx/hash.h>
+#include <bx/sort.h>
+#include <bx/timer.h>
+
+#include "vt.h"
+
+#if BX_PLATFORM_WINDOWS
+#	include <windows.h>
+#elif BX_PLATFORM_POSIX
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif // BX_PLATFORM_*
+
+namespace vt
+{
+
+// Constants
+static const int s_channelCount = 4;
+static const int s_tileFileDataOffset = sizeof(VirtualTextureInfo);
+
+static int getPageDataSize(int pagesize, bgfx::TextureFormat::Enum format)
+{
+	switch (format)
+	{
+	case bgfx::TextureFormat::BC1:
+		return (pagesize / 4) * (pagesize / 4) * 8;
+
+	case bgfx::TextureFormat::BC3:
+	case bgfx::TextureFormat::BC7:
+		return (pagesize / 4) * (pagesize / 4) * 16;
+
+	default:
+		break;
+	}
+
+	return pagesize * pagesize * s_channelCount;
+}
+
+// Page
+Page::operator size_t() const
+{
+	return size_t((uint32_t(m_mip) << 16) | uint32_t((uint16_t(m_x) << 8) | uint16_t(m_y)));
+}
+
+// PageCount
+PageCount::PageCount(Page _page, int _count)
+	: m_page(_page)
+	, m_count(_count)
+{
+}
+
+int PageCount::compareTo(const PageCount& other) const
+{
+	if (other.m_page.m_mip != m_page.m_mip)
+	{
+		return bx::clamp<int>(other.m_page.m_mip - m_page.m_mip, -1, 1);
+	}
+
+	return bx::clamp<int>(other.m_count - m_count, -1, 1);
+}
+
+// VirtualTextureInfo
+VirtualTextureInfo::VirtualTextureInfo()
+	: m_virtualTextureSize(0)
+	, m_tileSize(0)
+	, m_borderSize(0)
+	, m_format(bgfx::TextureFormat::BGRA8)
+{
+}
+
+int VirtualTextureInfo::GetPageSize() const
+{
+	return m_tileSize + 2 * m_borderSize;
+}
+
+int VirtualTextureInfo::GetPageDataSize() const
+{
+	return getPageDataSize(GetPageSize(), m_format);
+}
+
+int VirtualTextureInfo::GetPageTableSize() const
+{
+	return m_virtualTextureSize / m_tileSize;
+}
+
+StagingPool::StagingPool(int _width, int _height, int _count, bool _readBack, bgfx::TextureFormat::Enum _format)
+	: m_stagingTextureIndex(0)
+	, m_width(_width)
+	, m_height(_height)
+	, m_flags(0)
+	, m_format(_format)
+{
+	m_flags = BGFX_TEXTURE_BLIT_DST | BGFX_SAMPLER_UVW_CLAMP;
+	if (_readBack)
+	{
+		m_flags |= BGFX_TEXTURE_READ_BACK;
+	}
+	grow(_count);
+}
+
+StagingPool::~StagingPool()
+{
+	for (int i = 0; i < (int)m_stagingTextures.size(); ++i)
+	{
+		bgfx::destroy(m_stagingTextures[i]);
+	}
+}
+
+void StagingPool::grow(int count)
+{
+	while ((int)m_stagingTextures.size() < count)
+	{
+		auto stagingTexture = bgfx::createTexture2D((uint16_t)m_width, (uint16_t)m_height, false, 1, m_format, m_flags);
+		m_stagingTextures.push_back(stagingTexture);
+	}
+}
+
+bgfx::TextureHandle StagingPool::getTexture()
+{
+	return m_stagingTextures[m_stagingTextureIndex];
+}
+
+void StagingPool::next()
+{
+	m_stagingTextureIndex = (m_stagingTextureIndex + 1) % (int)m_stagingTextures.size();
+}
+
+PageIndexer::PageIndexer(VirtualTextureInfo* _info)
+	: m_info(_info)
+{
+	m_mipcount = int(bx::log2((float)m_info->GetPageTableSize()) + 1);
+
+	m_sizes.resize(m_mipcount);
+	for (int i = 0; i < m_mipcount; ++i)
+	{
+		m_sizes[i] = (m_info->m_virtualTextureSize / m_info->m_tileSize) >> i;
+	}
+
+	m_offsets.resize(m_mipcount);
+	m_count = 0;
+
+	for (int i = 0; i < m_mipcount; ++i)
+	{
+		m_offsets[i] = m_count;
+		m_count += m_sizes[i] * m_sizes[i];
+	}
+
+	// Calculate reverse mapping
+	m_reverse.resize(m_count);
+
+	for (int i = 0; i < m_mipcount; ++i)
+	{
+		int size = m_sizes[i];
+		for (int y = 0; y < size; ++y)
+		{
+			for (int x = 0; x < size; ++x)
+			{
+				Page page = { x, y, i };
+				m_reverse[getIndexFromPage(page)] = page;
+			}
+		}
+	}
+}
+
+int PageIndexer::getIndexFromPage(Page page)
+{
+	int offset = m_offsets[page.m_mip];
+	int stride = m_sizes[page.m_mip];
+
+	return offset + page.m_y * stride + page.m_x;
+}
+
+Page PageIndexer::getPageFromIndex(int index)
+{
+	return m_reverse[index];
+}
+
+bool PageIndexer::isValid(Page page)
+{
+	if (page.m_mip < 0)
+	{
+		return false;
+	}
+
+	if (page.m_mip >= m_mipcount)
+	{
+		return false;
+	}
+
+	if (page.m_x < 0)
+	{
+		return false;
+	}
+
+	if (page.m_x >= m_sizes[page.m_mip])
+	{
+		return false;
+	}
+
+	if (page.m_y < 0)
+	{
+		return false;
+	}
+
+	if (page.m_y >= m_sizes[page.m_mip])
+	{
+		return false;
+	}
+
+	return true;
+}
+
+int PageIndexer::getCount() const
+{
+	return m_count;
+}
+
+int PageIndexer::getMipCount() const
+{
+	return m_mipcount;
+}
+
+SimpleImage::SimpleImage(int _width, int _height, int _channelCount, uint8_t _clearValue)
+	: m_width(_width)
+	, m_height(_height)
+	, m_channelCount(_channelCount)
+{
+	m_data.resize(m_width * m_height * m_channelCount);
+	clear(_clearValue);
+}
+
+SimpleImage::SimpleImage(int _width, int _height, int _channelCount, tinystl::vector<uint8_t>& _data)
+	: m_width(_width)
+	, m_height(_height)
+	, m_channelCount(_channelCount)
+{
+	m_data = _data;
+}
+
+void SimpleImage::copy(Point dest_offset, SimpleImage& src, Rect src_rect)
+{
+	int width = bx::min(m_width - dest_offset.m_x, src_rect.m_width);
+	int height = bx::min(m_height - dest_offset.m_y, src_rect.m_height);
+	int channels = bx::min(m_channelCount, src.m_channelCount);
+
+	for (int j = 0; j < height; ++j)
+	{
+		for (int i = 0; i < width; ++i)
+		{
+			int i1 = ((j + dest_offset.m_y) * m_width + (i + dest_offset.m_x)) * m_channelCount;
+			int i2 = ((j + src_rect.m_y) * src.m_width + (i + src_rect.m_x)) * src.m_channelCount;
+			for (int c = 0; c < channels; ++c)
+			{
+				m_data[i1 + c] = src.m_data[i2 + c];
+			}
+		}
+	}
+}
+
+void SimpleImage::clear(uint8_t clearValue)
+{
+	bx::memSet(&m_data[0], clearValue, m_width * m_height * m_channelCount);
+}
+
+void SimpleImage::fill(Rect rect, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+	for (int y = rect.minY(); y < rect.maxY(); ++y)
+	{
+		for (int x = rect.minX(); x < rect.maxX(); ++x)
+		{
+			m_data[m_channelCount * (y * m_width + x) + 0] = b;
+			m_data[m_channelCount * (y * m_width + x) + 1] = g;
+			m_data[m_channelCount * (y * m_width + x) + 2] = r;
+			m_data[m_channelCount * (y * m_width + x) + 3] = a;
+		}
+	}
+}
+
+void SimpleImage::mipmap(uint8_t* source, int size, int channels, uint8_t* dest)
+{
+	int mipsize = size / 2;
+
+	for (int y = 0; y < mipsize; ++y)
+	{
+		for (int x = 0; x < mipsize; ++x)
+		{
+			for (int c = 0; c < channels; ++c)
+			{
+				int index = channels * ((y * 2) * size + (x * 2)) + c;
+				int sum_value = 4 >> 1;
+				sum_value += source[index + channels * (0 * size + 0)];
+				sum_value += source[index + channels * (0 * size + 1)];
+				sum_value += source[index + channels * (1 * size + 0)];
+				sum_value += source[index + channels * (1 * size + 1)];
+				dest[channels * (y * mipsize + x) + c] = (uint8_t)(sum_value / 4);
+			}
+		}
+	}
+}
+
+Quadtree::Quadtree(Rect _rect, int _level)
+	: m_rectangle(_rect)
+	, m_level(_level)
+{
+	for (int i = 0; i < 4; ++i)
+	{
+		m_children[i] = nullptr;
+	}
+}
+
+Quadtree::~Quadtree()
+{
+	for (int i = 0; i < 4; ++i)
+	{
+		if (m_children[i] != nullptr)
+		{
+			BX_DELETE(VirtualTexture::getAllocator(), m_children[i]);
+		}
+	}
+}
+
+void Quadtree::add(Page request, Point mapping)
+{
+	int scale = 1 << request.m_mip; // Same as pow( 2, mip )
+	int x = request.m_x * scale;
+	int y = request.m_y * scale;
+
+	Quadtree* node = this;
+
+	while (request.m_mip < node->m_level)
+	{
+		for (int i = 0; i < 4; ++i)
+		{
+			auto rect = node->getRectangle(i);
+			if (rect.contains({ x, y }))
+			{
+				// Create a new one if needed
+				if (node->m_children[i] == nullptr)
+				{
+					node->m_children[i] = BX_NEW(VirtualTexture::getAllocator(), Quadtree)(rect, node->m_level - 1);
+					node = node->m_children[i];
+					break;
+				}
+				// Otherwise traverse the tree
+				else
+				{
+					node = node->m_children[i];
+					break;
+				}
+			}
+		}
+	}
+
+	// We have created the correct node, now set the mapping
+	node->m_mapping = mapping;
+}
+
+void Quadtree::remove(Page request)
+{
+	int  index;
+	auto node = findPage(this, request, &index);
+
+	if (node != nullptr)
+	{
+		BX_DELETE(VirtualTexture::getAllocator(), node->m_children[index]);
+		node->m_children[index] = nullptr;
+	}
+}
+
+void Quadtree::write(SimpleImage& image, int miplevel)
+{
+	write(this, image, miplevel);
+}
+
+Rect Quadtree::getRectangle(int index)
+{
+	int x = m_rectangle.m_x;
+	int y = m_rectangle.m_y;
+	int w = m_rectangle.m_width / 2;
+	int h = m_rectangle.m_width / 2;
+
+	switch (index)
+	{
+	case 0: return { x    , y    , w, h };
+	case 1: return { x + w, y    , w, h };
+	case 2: return { x + w, y + h, w, h };
+	case 3: return { x    , y + h, w, h };
+	default: break;
+	}
+
+	return { 0, 0, 0, 0 };
+}
+
+void Quadtree::write(Quadtree* node, SimpleImage& image, int miplevel)
+{
+	if (node->m_level >= miplevel)
+	{
+		int rx = node->m_rectangle.m_x >> miplevel;
+		int ry = node->m_rectangle.m_y >> miplevel;
+		int rw = node->m_rectangle.m_width >> miplevel;
+		int rh = node->m_rectangle.m_width >> miplevel;
+
+		image.fill({ rx, ry, rw, rh }, (uint8_t)node->m_mapping.m_x, (uint8_t)node->m_mapping.m_y, (uint8_t)node->m_level, 255);
+
+		for (int i = 0; i < 4; ++i)
+		{
+			auto child = node->m_children[i];
+			if (child != nullptr)
+			{
+				Quadtree::write(child, image, miplevel);
+			}
+		}
+	}
+}
+
+Quadtree* Quadtree::findPage(Quadtree* node, Page request, int* index)
+{
+	int scale = 1 << request.m_mip; // Same as pow( 2, mip )
+	int x = request.m_x * scale;
+	int y = request.m_y * scale;
+
+	// Find the parent of the child we want to remove
+	bool exitloop = false;
+	while (!exitloop)
+	{
+		exitloop = true;
+		for (int i = 0; i < 4; ++i)
+		{
+			if (node->m_children[i] != nullptr && node->m_children[i]->m_rectangle.contains({ x, y }))
+			{
+				// We found it
+				if (request.m_mip == node->m_level - 1)
+				{
+					*index = i;
+					return node;
+				}
+				// Check the children
+				else
+				{
+					node = node->m_children[i];
+					exitloop = false;
+				}
+			}
+		}
+	}
+
+	// We couldn't find it so it must not exist anymore
+	*index = -1;
+	return nullptr;
+}
+
+// PageTable
+PageTable::PageTable(PageCache* _cache, VirtualTextureInfo* _info, PageIndexer* _indexer)
+	: m_info(_info)
+	, m_indexer(_indexer)
+	, m_quadtree(nullptr)
+	, m_quadtreeDirty(true) // Force quadtree dirty on startup
+{
+	auto size = m_info->GetPageTableSize();
+	m_quadtree = BX_NEW(VirtualTexture::getAllocator(), Quadtree)({ 0, 0, size, size }, (int)bx::log2((float)size));
+	m_texture = bgfx::createTexture2D((uint16_t)size, (uint16_t)size, true, 1, bgfx::TextureFormat::BGRA8, BGFX_SAMPLER_UVW_CLAMP | BGFX_SAMPLER_POINT | BGFX_TEXTURE_BLIT_DST);
+
+	_cache->added = [=](Page page, Point pt) { m_quadtreeDirty = true; m_quadtree->add(page, pt); };
+	_cache->removed = [=](Page page, Point pt) { m_quadtreeDirty = true; m_quadtree->remove(page); BX_UNUSED(pt); };
+
+	auto PageTableSizeLog2 = m_indexer->getMipCount();
+
+	for (int i = 0; i < PageTableSizeLog2; ++i)
+	{
+		int  mipSize = m_info->GetPageTableSize() >> i;
+		auto simpleImage = BX_NEW(VirtualTexture::getAllocator(), SimpleImage)(mipSize, mipSize, s_channelCount);
+		auto stagingTexture = bgfx::createTexture2D((uint16_t)mipSize, (uint16_t)mipSize, false, 1, bgfx::TextureFormat::BGRA8, BGFX_SAMPLER_UVW_CLAMP | BGFX_SAMPLER_POINT);
+		m_images.push_back(simpleImage);
+		m_stagingTextures.push_back(stagingTexture);
+	}
+}
+
+PageTable::~PageTable()
+{
+	BX_DELETE(VirtualTexture::getAllocator(), m_quadtree);
+	bgfx::destroy(m_texture);
+
+	for (int i = 0; i < (int)m_images.size(); ++i)
+	{
+		BX_DELETE(VirtualTexture::getAllocator(), m_images[i]);
+	}
+
+	for (int i = 0; i < (int)m_stagingTextures.size(); ++i)
+	{
+		bgfx::destroy(m_stagingTextures[i]);
+	}
+}
+
+void PageTable::update(bgfx::ViewId blitViewId)
+{
+	if (!m_quadtreeDirty)
+	{
+		return;
+	}
+
+	m_quadtreeDirty = false;
+	auto PageTableSizeLog2 = m_indexer->getMipCount();
+
+	for (int i = 0; i < PageTableSizeLog2; ++i)
+	{
+		m_quadtree->write(*m_images[i], i);
+		auto stagingTexture = m_stagingTextures[i];
+		auto size = uint16_t(m_info->GetPageTableSize() >> i);
+		bgfx::updateTexture2D(stagingTexture, 0, 0, 0, 0, size, size, bgfx::copy(&m_images[i]->m_data[0], size * size * s_channelCount));
+		bgfx::blit(blitViewId, m_texture, uint8_t(i), 0, 0, 0, stagingTexture, 0, 0, 0, 0, size, size);
+	}
+}
+
+bgfx::TextureHandle PageTable::getTexture()
+{
+	return m_texture;
+}
+
+// PageLoader
+PageLoader::PageLoader(TileDataFile* _tileDataFile, PageIndexer* _indexer, VirtualTextureInfo* _info, bgfx::TextureFormat::Enum _format, int _numThreads, int _queueSize)
+	: m_colorMipLevels(false)
+	, m_showBorders(false)
+	, m_tileDataFile(_tileDataFile)
+	, m_indexer(_indexer)
+	, m_info(_info)
+	, m_format(_format)
+	, m_exit(false)
+	, m_latencyTotal(0)
+	, m_bytesRead(0)
+	, m_streamTime(bx::getHPCounter())
+	, m_streamBytes(0)
+{
+	int pagesize = m_info->GetPageSize();
+
+	m_states.resize(bx::max(_queueSize, 1));
+	for (auto& state : m_states)
+	{
+		state.m_state = ReadState::Free;
+		state.m_data.resize(getPageDataSize(pagesize, m_format));
+
+		// Scratch memory for transcoding
+		if (m_format != bgfx::TextureFormat::BGRA8)
+		{
+			state.m_bgra.resize(pagesize * pagesize * s_channelCount);
+		}
+
+		if (m_info->m_format != bgfx::TextureFormat::BGRA8)
+		{
+			state.m_file.resize(m_info->GetPageDataSize());
+		}
+	}
+
+	m_uploads.reserve(m_states.size());
+	m_dropped.reserve(m_states.size());
+
+	for (int i = 0; i < bx::max(_numThreads, 1); ++i)
+	{
+		bx::Thread* thread = BX_NEW(VirtualTexture::getAllocator(), bx::Thread);
+		thread->init(threadFunc, this, 0, "vt page loader");
+		m_threads.push_back(thread);
+	}
+}
+
+PageLoader::~PageLoader()
+{
+	m_exit = true;
+	m_sem.post(uint32_t(m_threads.size()));
+
+	for (auto thread : m_threads)
+	{
+		thread->shutdown();
+		BX_DELETE(VirtualTexture::getAllocator(), thread);
+	}
+}
+
+// Queue page for loading, or raise priority of already queued page
+bool PageLoader::submit(Page request, uint32_t priority)
+{
+	int   freeIndex = -1;
+	int   evictIndex = -1;
+	int   numQueued = 0;
+	Page  evicted = {};
+	bool  queued = false;
+
+	{
+		bx::MutexScope lock(m_mutex);
+
+		for (int i = 0; i < (int)m_states.size(); ++i)
+		{
+			ReadState& state = m_states[i];
+
+			numQueued += state.m_state == ReadState::Queued;
+
+			if (state.m_state == ReadState::Free)
+			{
+				freeIndex = freeIndex < 0 ? i : freeIndex;
+			}
+			else if (state.m_page == request)
+			{
+				if (state.m_state == ReadState::Queued)
+				{
+					state.m_priority = bx::max(state.m_priority, priority);
+				}
+
+				return true;
+			}
+			else if (state.m_state == ReadState::Queued
+				&&  (evictIndex < 0 || state.m_priority < m_states[evictIndex].m_priority))
+			{
+				evictIndex = i;
+			}
+		}
+
+		int index = freeIndex;
+
+		if (index < 0
+		&&  evictIndex >= 0
+		&&  m_states[evictIndex].m_priority < priority)
+		{
+			// Queue is full, replace lowest priority request which wasn't picked up by worker yet
+			index = evictIndex;
+			evicted = m_states[index].m_page;
+		}
+
+		if (index < 0)
+		{
+			++m_stats.m_totalDropped;
+			return false;
+		}
+
+		ReadState& state = m_states[index];
+		state.m_page = request;
+		state.m_priority = priority;
+		state.m_time = bx::getHPCounter();
+		state.m_state = ReadState::Queued;
+
+		queued = index == freeIndex;
+	}
+
+	if (queued)
+	{
+		m_stats.m_queueDepthMax = bx::max(m_stats.m_queueDepthMax, numQueued + 1);
+		m_sem.post();
+	}
+	else
+	{
+		++m_stats.m_totalDropped;
+		loadDropped(evicted);
+	}
+
+	return true;
+}
+
+// Drop all requests which weren't picked up by worker yet
+void PageLoader::cancel()
+{
+	m_dropped.clear();
+
+	{
+		bx::MutexScope lock(m_mutex);
+
+		for (auto& state : m_states)
+		{
+			if (state.m_state == ReadState::Queued)
+			{
+				state.m_state = ReadState::Free;
+				m_dropped.push_back(state.m_page);
+			}
+		}
+	}
+
+	for (auto& page : m_dropped)
+	{
+		loadDropped(page);
+	}
+}
+
+// Hand loaded pages back to the page cache, highest priority first, at most uploads pages
+void PageLoader::update(int uploads)
+{
+	m_uploads.clear();
+
+	{
+		bx::MutexScope lock(m_mutex);
+
+		m_stats.m_queueDepth = 0;
+		m_stats.m_loading = 0;
+		m_stats.m_pending = 0;
+		m_stats.m_totalBytesRead = m_bytesRead;
+
+		for (auto& state : m_states)
+		{
+			m_stats.m_queueDepth += state.m_state == ReadState::Queued;
+			m_stats.m_loading += state.m_state == ReadState::Loading;
+			m_stats.m_pending += state.m_state == ReadState::Loaded;
+		}
+
+		for (int i = 0; i < (int)m_states.size(); ++i)
+		{
+			if (m_states[i].m_state == ReadState::Loaded)
+			{
+				m_uploads.push_back(i);
+			}
+		}
+	}
+
+	// Sort by priority, loaded states are not touched by worker threads
+	for (int i = 1; i < (int)m_uploads.size(); ++i)
+	{
+		for (int j = i; j > 0 && m_states[m_uploads[j - 1]].m_priority < m_states[m_uploads[j]].m_priority; --j)
+		{
+			bx::swap(m_uploads[j - 1], m_uploads[j]);
+		}
+	}
+
+	const int64_t now = bx::getHPCounter();
+	const double toMs = 1000.0 / double(bx::getHPFrequency());
+
+	int count = bx::min((int)m_uploads.size(), bx::max(uploads, 0));
+	for (int i = 0; i < count; ++i)
+	{
+		ReadState& state = m_states[m_uploads[i]];
+		loadComplete(state.m_page, &state.m_data[0]);
+
+		const int64_t latency = now - state.m_time;
+		m_latencyTotal += latency;
+		m_stats.m_latencyMax = bx::max(m_stats.m_latencyMax, float(double(latency) * toMs));
+	}
+
+	{
+		bx::MutexScope lock(m_mutex);
+
+		for (int i = 0; i < count; ++i)
+		{
+			m_states[m_uploads[i]].m_state = ReadState::Free;
+		}
+	}
+
+	m_stats.m_uploaded = count;
+	m_stats.m_totalUploaded += count;
+	m_stats.m_pending -= count;
+	m_stats.m_latencyAvg = 0 < m_stats.m_totalUploaded
+		? float(double(m_latencyTotal) * toMs / double(m_stats.m_totalUploaded))
+		: 0.0f
+		;
+
+	const int64_t streamTime = now - m_streamTime;
+	if (streamTime >= bx::getHPFrequency())
+	{
+		const int64_t bytes = m_stats.m_totalBytesRead - m_streamBytes;
+		m_stats.m_streamed = float(double(bytes) / (1024.0 * 1024.0) / (double(streamTime) * toMs / 1000.0));
+		m_streamTime = now;
+		m_streamBytes = m_stats.m_totalBytesRead;
+	}
+}
+
+const PageLoaderStats& PageLoader::getStats() const
+{
+	return m_stats;
+}
+
+int32_t PageLoader::threadFunc(bx::Thread* _thread, void* _userData)
+{
+	BX_UNUSED(_thread);
+
+	PageLoader* loader = (PageLoader*)_userData;
+
+	for (;;)
+	{
+		loader->m_sem.wait();
+
+		if (loader->m_exit)
+		{
+			break;
+		}
+
+		int index = -1;
+
+		{
+			bx::MutexScope lock(loader->m_mutex);
+
+			index = loader->findState(ReadState::Queued);
+			if (index >= 0)
+			{
+				loader->m_states[index].m_state = ReadState::Loading;
+			}
+		}
+
+		if (index < 0)
+		{
+			// Request was cancelled
+			continue;
+		}
+
+		int bytesRead = loader->loadPage(loader->m_states[index]);
+
+		{
+			bx::MutexScope lock(loader->m_mutex);
+			loader->m_states[index].m_state = ReadState::Loaded;
+			loader->m_bytesRead += bytesRead;
+		}
+	}
+
+	return bx::kExitSuccess;
+}
+
+// Find highest priority state, must be called with mutex locked
+int PageLoader::findState(ReadState::Enum state)
+{
+	int index = -1;
+
+	for (int i = 0; i < (int)m_states.size(); ++i)
+	{
+		if (m_states[i].m_state == state
+		&& (index < 0 || m_states[i].m_priority > m_states[index].m_priority))
+		{
+			index = i;
+		}
+	}
+
+	return index;
+}
+
+// Returns number of bytes read from tile data file
+int PageLoader::loadPage(ReadState& state)
+{
+	const bgfx::TextureFormat::Enum fileFormat = m_info->m_format;
+	const int index = m_indexer->getIndexFromPage(state.m_page);
+
+	if (!m_colorMipLevels
+	&&  !m_showBorders
+	&&  fileFormat == m_format)
+	{
+		// Tile data is already in atlas format, it's uploaded as is
+		if (m_tileDataFile == nullptr)
+		{
+			return 0;
+		}
+
+		m_tileDataFile->readPage(index, &state.m_data[0]);
+		return m_info->GetPageDataSize();
+	}
+
+	// Decode to BGRA8, apply debug overlays, and encode to atlas format
+	const uint32_t pagesize = uint32_t(m_info->GetPageSize());
+	const uint32_t pitch = pagesize * s_channelCount;
+	uint8_t* bgra = m_format == bgfx::TextureFormat::BGRA8 ? &state.m_data[0] : &state.m_bgra[0];
+	int bytesRead = 0;
+
+	if (m_colorMipLevels)
+	{
+		copyColor(bgra, state.m_page);
+	}
+	else if (m_tileDataFile != nullptr)
+	{
+		if (fileFormat == bgfx::TextureFormat::BGRA8)
+		{
+			m_tileDataFile->readPage(index, bgra);
+		}
+		else
+		{
+			m_tileDataFile->readPage(index, &state.m_file[0]);
+			bimg::imageDecodeToBgra8(
+				  VirtualTexture::getAllocator()
+				, bgra
+				, &state.m_file[0]
+				, pagesize
+				, pagesize
+				, pitch
+				, bimg::TextureFormat::Enum(fileFormat)
+				);
+		}
+
+		bytesRead = m_info->GetPageDataSize();
+	}
+
+	if (m_showBorders)
+	{
+		copyBorder(bgra);
+	}
+
+	if (m_format != bgfx::TextureFormat::BGRA8)
+	{
+		bimg::imageSwizzleBgra8(bgra, pitch, pagesize, pagesize, bgra, pitch);
+
+		bx::Error err;
+		bimg::imageEncodeFromRgba8(
+			  VirtualTexture::getAllocator()
+			, &state.m_data[0]
+			, bgra
+			, pagesize
+			, pagesize
+			, 1
+			, bimg::TextureFormat::Enum(m_format)
+			, bimg::Quality::Fastest
+			, &err
+			);
+	}
+
+	return bytesRead;
+}
+
+void PageLoader::copyBorder(uint8_t* image)
+{
+	int pagesize = m_info->GetPageSize();
+	int bordersize = m_info->m_borderSize;
+
+	for (int i = 0; i < pagesize; ++i)
+	{
+		int xindex = bordersize * pagesize + i;
+		image[xindex * s_channelCount + 0] = 0;
+		image[xindex * s_channelCount + 1] = 255;
+		image[xindex * s_channelCount + 2] = 0;
+		image[xindex * s_channelCount + 3] = 255;
+
+		int yindex = i * pagesize + bordersize;
+		image[yindex * s_channelCount + 0] = 0;
+		image[yindex * s_channelCount + 1] = 255;
+		image[yindex * s_channelCount + 2] = 0;
+		image[yindex * s_channelCount + 3] = 255;
+	}
+}
+
+void PageLoader::copyColor(uint8_t* image, Page request)
+{
+	static const Color colors[] =
+	{
+		{   0,   0, 255, 255 },
+		{   0, 255, 255, 255 },
+		{ 255,   0,   0, 255 },
+		{ 255,   0, 255, 255 },
+		{ 255, 255,   0, 255 },
+		{  64,  64, 192, 255 },
+		{  64, 192,  64, 255 },
+		{  64, 192, 192, 255 },
+		{ 192,  64,  64, 255 },
+		{ 192,  64, 192, 255 },
+		{ 192, 192,  64, 255 },
+		{   0, 255,   0, 255 },
+	};
+
+	int pagesize = m_info->GetPageSize();
+
+	for (int y = 0; y < pagesize; ++y)
+	{
+		for (int x = 0; x < pagesize; ++x)
+		{
+			image[(y * pagesize + x) * s_channelCount + 0] = colors[request.m_mip].m_b;
+			image[(y * pagesize + x) * s_channelCount + 1] = colors[request.m_mip].m_g;
+			image[(y * pagesize + x) * s_channelCount + 2] = colors[request.m_mip].m_r;
+			image[(y * pagesize + x) * s_channelCount + 3] = colors[request.m_mip].m_a;
+		}
+	}
+}
+
+PageCache::PageCache(TextureAtlas* _atlas, PageLoader* _loader, int _count)
+	: m_atlas(_atlas)
+	, m_loader(_loader)
+	, m_count(_count)
+{
+	clear();
+	m_loader->loadComplete = [&](Page page, uint8_t* data) { loadComplete(page, data); };
+	m_loader->loadDropped = [&](Page page) { loadDropped(page); };
+}
+
+// Update the pages's position in the lru
+bool PageCache::touch(Page page)
+{
+	if (m_loading.find(page) == m_loading.end())
+	{
+		if (m_lru_used.find(page) != m_lru_used.end())
+		{
+			// Find the page (slow!!) and add it to the back of the list
+			for (auto it = m_lru.begin(); it != m_lru.end(); ++it)
+			{
+				if (it->m_page == page)
+				{
+					auto lruPage = *it;
+					m_lru.erase(it);
+					m_lru.push_back(lruPage);
+					return true;
+				}
+			}
+			return false;
+		}
+	}
+
+	return false;
+}
+
+// Schedule a load if not already loaded or loading
+bool PageCache::request(Page request, uint32_t priority, bgfx::ViewId blitViewId)
+{
+	m_blitViewId = blitViewId;
+	if (m_loading.find(request) == m_loading.end())
+	{
+		if (m_lru_used.find(request) == m_lru_used.end())
+		{
+			if (m_loader->submit(request, priority))
+			{
+				m_loading.insert(request);
+				return true;
+			}
+		}
+	}
+	else
+	{
+		// Still visible, keep up priority of the queued request
+		m_loader->submit(request, priority);
+	}
+
+	return false;
+}
+
+void PageCache::clear()
+{
+	for (auto& lru_page : m_lru)
+	{
+		if (m_lru_used.find(lru_page.m_page) != m_lru_used.end())
+		{
+			removed(lru_page.m_page, lru_page.m_point);
+		}
+	}
+	m_lru_used.clear();
+	m_lru.clear();
+	m_lru.reserve(m_count * m_count);
+	m_current = 0;
+}
+
+// Request was dropped by the loader before it was loaded
+void PageCache::loadDropped(Page page)
+{
+	m_loading.erase(page);
+}
+
+int PageCache::getResidentCount() const
+{
+	return (int)m_lru.size();
+}
+
+void PageCache::loadComplete(Page page, uint8_t* data)
+{
+	m_loading.erase(page);
+
+	// Find a place in the atlas for the data
+	Point pt;
+
+	if (m_current == m_count * m_count)
+	{
+		// Remove the oldest lru page and remember it's location so we can use it
+		auto lru_page = m_lru[0];
+		m_lru.erase(m_lru.begin());
+		m_lru_used.erase(lru_page.m_page);
+		pt = lru_page.m_point;
+		// Notify that we removed a page
+		removed(lru_page.m_page, lru_page.m_point);
+	}
+	else
+	{
+		pt = { m_current % m_count, m_current / m_count };
+		++m_current;
+
+		if (m_current == m_count * m_count)
+		{
+			bx::debugPrintf("Atlas is full!");
+		}
+	}
+
+	// Notify atlas that he can upload the page and add the page to lru
+	m_atlas->uploadPage(pt, data, m_blitViewId);
+	m_lru.push_back({ page, pt });
+	m_lru_used.insert(page);
+
+	// Signal that we added a page
+	added(page, pt);
+}
+
+// TextureAtlas
+TextureAtlas::TextureAtlas(VirtualTextureInfo* _info, int _count, int _uploadsperframe, bgfx::TextureFormat::Enum _format)
+	: m_info(_info)
+	, m_stagingPool(_info->GetPageSize(), _info->GetPageSize(), _uploadsperframe, false, _format)
+{
+	// Create atlas texture
+	int pagesize = m_info->GetPageSize();
+	int size = _count * pagesize;
+
+	m_pageDataSize = getPageDataSize(pagesize, _format);
+
+	// Compressed pages are uploaded as is, page size is multiple of block size
+	m_texture = bgfx::createTexture2D(
+		  (uint16_t)size
+		, (uint16_t)size
+		, false
+		, 1
+		, _format
+		, BGFX_SAMPLER_UVW_CLAMP | BGFX_TEXTURE_BLIT_DST
+		);
+}
+
+TextureAtlas::~TextureAtlas()
+{
+	bgfx::destroy(m_texture);
+}
+
+void TextureAtlas::setUploadsPerFrame(int count)
+{
+	m_stagingPool.grow(count);
+}
+
+void TextureAtlas::uploadPage(Point pt, uint8_t* data, bgfx::ViewId blitViewId)
+{
+	// Get next staging texture to write to
+	auto writer = m_stagingPool.getTexture();
+	m_stagingPool.next();
+
+	// Update texture with new atlas data
+	auto   pagesize = uint16_t(m_info->GetPageSize());
+	bgfx::updateTexture2D(
+		  writer
+		, 0
+		, 0
+		, 0
+		, 0
+		, pagesize
+		, pagesize
+		, bgfx::copy(data, m_pageDataSize)
+		);
+
+	// Copy the texture part to the actual atlas texture
+	auto xpos = uint16_t(pt.m_x * pagesize);
+	auto ypos = uint16_t(pt.m_y * pagesize);
+	bgfx::blit(blitViewId, m_texture, 0, xpos, ypos, 0, writer, 0, 0, 0, 0, pagesize, pagesize);
+}
+
+bgfx::TextureHandle TextureAtlas::getTexture()
+{
+	return m_texture;
+}
+
+// FeedbackBuffer
+FeedbackBuffer::FeedbackBuffer(VirtualTextureInfo* _info, int _width, int _height)
+	: m_info(_info)
+	, m_width(_width)
+	, m_height(_height)
+	, m_stagingPool(_width, _height, 1, true)
+{
+	// Setup classes
+	m_indexer = BX_NEW(VirtualTexture::getAllocator(), PageIndexer)(m_info);
+	m_requests.resize(m_indexer->getCount());
+
+	// Initialize and clear buffers
+	m_downloadBuffer.resize(m_width * m_height * s_channelCount);
+	bx::memSet(&m_downloadBuffer[0], 0, m_width * m_height * s_channelCount);
+	clear();
+
+	// Initialize feedback frame buffer
+	bgfx::TextureHandle feedbackFrameBufferTextures[] =
+	{
+		bgfx::createTexture2D(uint16_t(m_width), uint16_t(m_height), false, 1, bgfx::TextureFormat::BGRA8, BGFX_TEXTURE_RT),
+		bgfx::createTexture2D(uint16_t(m_width), uint16_t(m_height), false, 1, bgfx::TextureFormat::D32F,  BGFX_TEXTURE_RT),
+	};
+
+	m_feedbackFrameBuffer = bgfx::createFrameBuffer(BX_COUNTOF(feedbackFrameBufferTextures), feedbackFrameBufferTextures, true);
+	m_lastStagingTexture = { bgfx::kInvalidHandle };
+}
+
+FeedbackBuffer::~FeedbackBuffer()
+{
+	BX_DELETE(VirtualTexture::getAllocator(), m_indexer);
+	bgfx::destroy(m_feedbackFrameBuffer);
+}
+
+void FeedbackBuffer::clear()
+{
+	// Clear Table
+	bx::memSet(&m_requests[0], 0, sizeof(int) * m_indexer->getCount());
+}
+
+void FeedbackBuffer::copy(bgfx::ViewId viewId)
+{
+	m_lastStagingTexture = m_stagingPool.getTexture();
+	// Copy feedback buffer render target to staging texture
+	bgfx::blit(viewId, m_lastStagingTexture, 0, 0, bgfx::getTexture(m_feedbackFrameBuffer));
+	m_stagingPool.next();
+}
+
+void FeedbackBuffer::download()
+{
+	// Check if there's an already rendered feedback buffer available
+	if (m_lastStagingTexture.idx == bgfx::kInvalidHandle)
+	{
+		return;
+	}
+
+	// Read the texture
+	bgfx::readTexture(m_lastStagingTexture, &m_downloadBuffer[0]);
+	// Loop through pixels and check if anything was written
+	auto data = &m_downloadBuffer[0];
+	auto colors = (Color*)data;
+	auto dataSize = m_width * m_height;
+
+	for (int i = 0; i < dataSize; ++i)
+	{
+		auto& color = colors[i];
+		if (color.m_a >= 0xff)
+		{
+			// Page found! Add it to the request queue
+			Page request = { color.m_b, color.m_g, color.m_r };
+			addRequestAndParents(request);
+			// Clear the pixel, so that we don't have to do it in another pass
+			color = { 0,0,0,0 };
+		}
+	}
+}
+
+// This function validates the pages and adds the page's parents
+// We do this so that we can fall back to them if we run out of memory
+void FeedbackBuffer::addRequestAndParents(Page request)
+{
+	auto PageTableSizeLog2 = m_indexer->getMipCount();
+	auto count = PageTableSizeLog2 - request.m_mip;
+
+	for (int i = 0; i < count; ++i)
+	{
+		int xpos = request.m_x >> i;
+		int ypos = request.m_y >> i;
+
+		Page page = { xpos, ypos, request.m_mip + i };
+
+		// If it's not a valid page (position or mip out of range) just skip it
+		if (!m_indexer->isValid(page))
+		{
+			return;
+		}
+
+		++m_requests[m_indexer->getIndexFromPage(page)];
+	}
+}
+
+const tinystl::vector<int>& FeedbackBuffer::getRequests() const
+{
+	return m_requests;
+}
+
+bgfx::FrameBufferHandle FeedbackBuffer::getFrameBuffer()
+{
+	return m_feedbackFrameBuffer;
+}
+
+int FeedbackBuffer::getWidth() const
+{
+	return m_width;
+}
+
+int FeedbackBuffer::getHeight() const
+{
+	return m_height;
+}
+
+// VirtualTexture
+VirtualTexture::VirtualTexture(TileDataFile* _tileDataFile, VirtualTextureInfo* _info, int _atlassize, int _uploadsperframe, int _mipBias, int _loaderThreads, int _loaderQueueSize)
+	: m_tileDataFile(_tileDataFile)
+	, m_info(_info)
+	, m_uploadsPerFrame(_uploadsperframe)
+	, m_mipBias(_mipBias)
+
+{
+	m_atlasCount = _atlassize / m_info->GetPageSize();
+	m_atlasFormat = getAtlasFormat(m_info->m_format);
+
+	// Setup indexer
+	m_indexer = BX_NEW(VirtualTexture::getAllocator(), PageIndexer)(m_info);
+	m_pagesToLoad.reserve(m_indexer->getCount());
+
+	// Setup classes
+	m_atlas = BX_NEW(VirtualTexture::getAllocator(), TextureAtlas)(m_info, m_atlasCount, m_uploadsPerFrame, m_atlasFormat);
+	m_loader = BX_NEW(VirtualTexture::getAllocator(), PageLoader)(m_tileDataFile, m_indexer, m_info, m_atlasFormat, _loaderThreads, _loaderQueueSize);
+	m_cache = BX_NEW(VirtualTexture::getAllocator(), PageCache)(m_atlas, m_loader, m_atlasCount);
+	m_pageTable = BX_NEW(VirtualTexture::getAllocator(), PageTable)(m_cache, m_info, m_indexer);
+
+	// Create uniforms
+	u_vt_settings_1 = bgfx::createUniform("u_vt_settings_1", bgfx::UniformType::Vec4);
+	u_vt_settings_2 = bgfx::createUniform("u_vt_settings_2", bgfx::UniformType::Vec4);
+	s_vt_page_table = bgfx::createUniform("s_vt_page_table", bgfx::UniformType::Sampler);
+	s_vt_texture_atlas = bgfx::createUniform("s_vt_texture_atlas", bgfx::UniformType::Sampler);
+}
+
+VirtualTexture::~VirtualTexture()
+{
+	// Destroy, loader first to stop worker threads
+	BX_DELETE(VirtualTexture::getAllocator(), m_loader);
+	BX_DELETE(VirtualTexture::getAllocator(), m_indexer);
+	BX_DELETE(VirtualTexture::getAllocator(), m_atlas);
+	BX_DELETE(VirtualTexture::getAllocator(), m_cache);
+	BX_DELETE(VirtualTexture::getAllocator(), m_pageTable);
+	// Destroy all uniforms and textures
+	bgfx::destroy(u_vt_settings_1);
+	bgfx::destroy(u_vt_settings_2);
+	bgfx::destroy(s_vt_page_table);
+	bgfx::destroy(s_vt_texture_atlas);
+}
+
+int VirtualTexture::getMipBias() const
+{
+	return m_mipBias;
+}
+
+void VirtualTexture::setMipBias(int value)
+{
+	m_mipBias = bx::max(0, value);
+}
+
+void VirtualTexture::setUniforms()
+{
+	struct
+	{
+		struct
+		{
+			float VirtualTextureSize;
+			float ooAtlasScale;
+			float BorderScale;
+			float BorderOffset;
+		} m_settings_1;
+
+		struct
+		{
+			float MipBias;
+			float PageTableSize;
+			float unused1;
+			float unused2;
+		} m_settings_2;
+
+	} uniforms;
+
+	int pagesize = m_info->GetPageSize();
+	uniforms.m_settings_1.VirtualTextureSize = (float)m_info->m_virtualTextureSize;
+	uniforms.m_settings_1.ooAtlasScale = 1.0f / (float)m_atlasCount;
+	uniforms.m_settings_1.BorderScale = (float)((pagesize - 2.0f * m_info->m_borderSize) / pagesize);
+	uniforms.m_settings_1.BorderOffset = (float)m_info->m_borderSize / (float)pagesize;
+	uniforms.m_settings_2.MipBias = (float)m_mipBias;
+	uniforms.m_settings_2.PageTableSize = (float)m_info->GetPageTableSize();
+	uniforms.m_settings_2.unused1 = uniforms.m_settings_2.unused2 = 0.0f;
+
+	bgfx::setUniform(u_vt_settings_1, &uniforms.m_settings_1);
+	bgfx::setUniform(u_vt_settings_2, &uniforms.m_settings_2);
+
+	bgfx::setTexture(0, s_vt_page_table, m_pageTable->getTexture());
+	bgfx::setTexture(1, s_vt_texture_atlas, m_atlas->getTexture());
+}
+
+void VirtualTexture::setUploadsPerFrame(int count)
+{
+	m_uploadsPerFrame = count;
+	m_atlas->setUploadsPerFrame(count);
+}
+
+int VirtualTexture::getUploadsPerFrame() const
+{
+	return m_uploadsPerFrame;
+}
+
+
+void VirtualTexture::enableShowBoarders(bool enable)
+{
+	if (m_loader->m_showBorders == enable)
+	{
+		return;
+	}
+
+	m_loader->m_showBorders = enable;
+	clear();
+}
+
+bool VirtualTexture::isShowBoardersEnabled() const
+{
+	return m_loader->m_showBorders;
+}
+
+void VirtualTexture::enableColorMipLevels(bool enable)
+{
+	if (m_loader->m_colorMipLevels == enable)
+	{
+		return;
+	}
+
+	m_loader->m_colorMipLevels = enable;
+	clear();
+}
+
+bool VirtualTexture::isColorMipLevelsEnabled() const
+{
+	return m_loader->m_colorMipLevels;
+}
+
+bgfx::TextureHandle VirtualTexture::getAtlastTexture()
+{
+	return m_atlas->getTexture();
+}
+
+bgfx::TextureHandle VirtualTexture::getPageTableTexture()
+{
+	return m_pageTable->getTexture();
+}
+
+const PageLoaderStats& VirtualTexture::getLoaderStats() const
+{
+	return m_loader->getStats();
+}
+
+bgfx::TextureFormat::Enum VirtualTexture::getAtlasFormat() const
+{
+	return m_atlasFormat;
+}
+
+int VirtualTexture::getAtlasCapacity() const
+{
+	return m_atlasCount * m_atlasCount;
+}
+
+int VirtualTexture::getResidentCount() const
+{
+	return m_cache->getResidentCount();
+}
+
+uint32_t VirtualTexture::getAtlasMemorySize() const
+{
+	return uint32_t(getPageDataSize(m_info->GetPageSize(), m_atlasFormat) * getAtlasCapacity());
+}
+
+void VirtualTexture::clear()
+{
+	m_loader->cancel();
+	m_cache->clear();
+}
+
+void VirtualTexture::update(const tinystl::vector<int>& requests, bgfx::ViewId blitViewId)
+{
+	m_pagesToLoad.clear();
+
+	// Find out what is already in memory
+	// If it is, update it's position in the LRU collection
+	// Otherwise add it to the list of pages to load
+	int touched = 0;
+	for (int i = 0; i < (int)requests.size(); ++i)
+	{
+		if (requests[i] > 0)
+		{
+			PageCount pc(m_indexer->getPageFromIndex(i), requests[i]);
+			if (!m_cache->touch(pc.m_page))
+			{
+				m_pagesToLoad.push_back(pc);
+			}
+			else
+			{
+				++touched;
+			}
+		}
+	}
+
+	// Check to make sure we don't thrash
+	if (touched < m_atlasCount * m_atlasCount)
+	{
+		// sort by low res to high res and number of requests
+		bx::quickSort(
+			m_pagesToLoad.begin()
+			, uint32_t(m_pagesToLoad.size())
+			, sizeof(vt::PageCount)
+			, [](const void* _a, const void* _b) -> int32_t {
+			const vt::PageCount& lhs = *(const vt::PageCount*)(_a);
+			const vt::PageCount& rhs = *(const vt::PageCount*)(_b);
+			return lhs.compareTo(rhs);
+		});
+
+		// if more pages than will fit in memory drop high res pages with lowest use count, loader queue
+		// is bounded and keeps only the highest priority requests
+		int loadcount = bx::min((int)m_pagesToLoad.size(), m_atlasCount * m_atlasCount);
+		for (int i = 0; i < loadcount; ++i)
+		{
+			const PageCount& pc = m_pagesToLoad[i];
+			const uint32_t priority = (uint32_t(pc.m_page.m_mip) << 24) | uint32_t(bx::min(pc.m_count, 0xffffff));
+			m_cache->request(pc.m_page, priority, blitViewId);
+		}
+	}
+	else
+	{
+		// The problem here is that all pages in cache are requested and the new or high res ones don't get uploaded
+		// We can adjust the mip bias to make it all fit. This solves the problem of page cache thrashing
+		--m_mipBias;
+	}
+
+	// Upload pages loaded by worker threads, limited by per-frame budget
+	m_loader->update(m_uploadsPerFrame);
+
+	// Update the page table
+	m_pageTable->update(blitViewId);
+}
+
+bx::AllocatorI* VirtualTexture::s_allocator = nullptr;
+
+void VirtualTexture::setAllocator(bx::AllocatorI* allocator)
+{
+	s_allocator = allocator;
+}
+
+bx::AllocatorI* VirtualTexture::getAllocator()
+{
+	return s_allocator;
+}
+
+bgfx::TextureFormat::Enum VirtualTexture::getAtlasFormat(bgfx::TextureFormat::Enum _format)
+{
+	const bgfx::Caps* caps = bgfx::getCaps();
+
+	if (0 != (caps->formats[_format] & BGFX_CAPS_FORMAT_TEXTURE_2D)
+	&&  0 != (caps->supported & BGFX_CAPS_TEXTURE_BLIT))
+	{
+		return _format;
+	}
+
+	return bgfx::TextureFormat::BGRA8;
+}
+
+TileDataFile::TileDataFile(const bx::FilePath& filename, VirtualTextureInfo* _info, bool _readWrite)
+	: m_info(_info)
+	, m_file(nullptr)
+	, m_mapping(nullptr)
+	, m_mappingSize(0)
+{
+	// Read only tile data is memory mapped, so that pages can be read by multiple threads without seeking
+	if (_readWrite)
+	{
+		m_file = fopen(filename.getCPtr(), "r+b");
+
+		if (m_file == nullptr)
+		{
+			m_file = fopen(filename.getCPtr(), "w+b");
+		}
+	}
+	else if (!map(filename))
+	{
+		m_file = fopen(filename.getCPtr(), "rb");
+	}
+
+	m_size = m_info->GetPageDataSize();
+}
+
+TileDataFile::~TileDataFile()
+{
+	unmap();
+
+	if (m_file != nullptr)
+	{
+		fclose(m_file);
+	}
+}
+
+bool TileDataFile::isOpen() const
+{
+	return m_file != nullptr
+		|| m_mapping != nullptr
+		;
+}
+
+bool TileDataFile::map(const bx::FilePath& filename)
+{
+#if BX_PLATFORM_WINDOWS
+	HANDLE file = CreateFileA(filename.getCPtr(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (INVALID_HANDLE_VALUE == file)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	if (GetFileSizeEx(file, &size)
+	&&  0 < size.QuadPart)
+	{
+		HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (NULL != mapping)
+		{
+			// View keeps mapping alive after handles are closed
+			m_mapping = (const uint8_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			m_mappingSize = m_mapping != nullptr ? size_t(size.QuadPart) : 0;
+			CloseHandle(mapping);
+		}
+	}
+
+	CloseHandle(file);
+#elif BX_PLATFORM_POSIX
+	int fd = open(filename.getCPtr(), O_RDONLY);
+	if (fd < 0)
+	{
+		return false;
+	}
+
+	struct stat st;
+	if (0 == fstat(fd, &st)
+	&&  0 < st.st_size)
+	{
+		void* ptr = mmap(NULL, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		if (MAP_FAILED != ptr)
+		{
+			m_mapping = (const uint8_t*)ptr;
+			m_mappingSize = size_t(st.st_size);
+		}
+	}
+
+	close(fd);
+#else
+	BX_UNUSED(filename);
+#endif // BX_PLATFORM_*
+
+	return m_mapping != nullptr;
+}
+
+void TileDataFile::unmap()
+{
+	if (m_mapping == nullptr)
+	{
+		return;
+	}
+
+#if BX_PLATFORM_WINDOWS
+	UnmapViewOfFile(m_mapping);
+#elif BX_PLATFORM_POSIX
+	munmap((void*)m_mapping, m_mappingSize);
+#endif // BX_PLATFORM_*
+
+	m_mapping = nullptr;
+	m_mappingSize = 0;
+}
+
+void TileDataFile::seek(int64_t offset)
+{
+	// Tile data of large virtual textures doesn't fit into 32-bit offsets
+#if BX_PLATFORM_WINDOWS
+	_fseeki64(m_file, offset, SEEK_SET);
+#elif BX_PLATFORM_POSIX
+	fseeko(m_file, off_t(offset), SEEK_SET);
+#else
+	fseek(m_file, long(offset), SEEK_SET);
+#endif // BX_PLATFORM_*
+}
+
+void TileDataFile::readInfo()
+{
+	if (m_mapping != nullptr)
+	{
+		if (m_mappingSize >= sizeof(*m_info))
+		{
+			bx::memCopy(m_info, m_mapping, sizeof(*m_info));
+		}
+	}
+	else
+	{
+		seek(0);
+		auto ret = fread(m_info, sizeof(*m_info), 1, m_file);
+		BX_UNUSED(ret);
+	}
+
+	m_size = m_info->GetPageDataSize();
+}
+
+void TileDataFile::writeInfo()
+{
+	seek(0);
+	auto ret = fwrite(m_info, sizeof(*m_info), 1, m_file);
+	BX_UNUSED(ret);
+}
+
+void TileDataFile::readPage(int index, uint8_t* data)
+{
+	const int64_t offset = int64_t(m_size) * index + s_tileFileDataOffset;
+
+	if (m_mapping != nullptr)
+	{
+		if (size_t(offset + m_size) <= m_mappingSize)
+		{
+			bx::memCopy(data, m_mapping + offset, m_size);
+		}
+
+		return;
+	}
+
+	bx::MutexScope lock(m_mutex);
+	seek(offset);
+	auto ret = fread(data, m_size, 1, m_file);
+	BX_UNUSED(ret);
+}
+
+void TileDataFile::writePage(int index, uint8_t* data)
+{
+	bx::MutexScope lock(m_mutex);
+	seek(int64_t(m_size) * index + s_tileFileDataOffset);
+	auto ret = fwrite(data, m_size, 1, m_file);
+	BX_UNUSED(ret);
+}
+
+// TileSource
+// Source image is streamed in rows when it's stored uncompressed in container (DDS, KTX, PVR),
+// other images are decoded into memory as whole.
+struct TileSource
+{
+	TileSource();
+	~TileSource();
+
+	bool open(const bx::FilePath& _filePath);
+
+	// Reads rows as BGRA8, rows outside of image are clamped to edge
+	void readRows(int _y, int _count, uint8_t* _dst);
+
+	bx::FileReader			m_reader;
+	bx::Mutex				m_mutex;
+	bimg::ImageContainer*	m_image;
+
+	int64_t		m_offset;
+	uint32_t	m_pitch;
+	int			m_width;
+	int			m_height;
+	bool		m_swizzle;
+	bool		m_streamed;
+};
+
+TileSource::TileSource()
+	: m_image(nullptr)
+	, m_offset(0)
+	, m_pitch(0)
+	, m_width(0)
+	, m_height(0)
+	, m_swizzle(false)
+	, m_streamed(false)
+{
+}
+
+TileSource::~TileSource()
+{
+	if (m_streamed)
+	{
+		bx::close(&m_reader);
+	}
+
+	if (m_image != nullptr)
+	{
+		bimg::imageFree(m_image);
+	}
+}
+
+bool TileSource::open(const bx::FilePath& _filePath)
+{
+	bx::Error err;
+
+	if (!bx::open(&m_reader, _filePath, &err) )
+	{
+		bx::debugPrintf("Image open failed'%s'.\n", _filePath.getCPtr() );
+		return false;
+	}
+
+	// Parse only header, and stream rows from file if data is not compressed
+	bimg::ImageContainer imageContainer;
+
+	if (bimg::imageParse(imageContainer, &m_reader, &err)
+	&&  (bimg::TextureFormat::BGRA8 == imageContainer.m_format || bimg::TextureFormat::RGBA8 == imageContainer.m_format)
+	&&  1 == imageContainer.m_depth
+	&&  !imageContainer.m_cubeMap)
+	{
+		bx::debugPrintf("Streaming image '%s'.\n", _filePath.getCPtr() );
+
+		m_width    = int(imageContainer.m_width);
+		m_height   = int(imageContainer.m_height);
+		m_pitch    = imageContainer.m_width * s_channelCount;
+		m_offset   = int64_t(imageContainer.m_offset) + (imageContainer.m_ktx ? sizeof(uint32_t) : 0);
+		m_swizzle  = bimg::TextureFormat::RGBA8 == imageContainer.m_format;
+		m_streamed = true;
+		return true;
+	}
+
+	bx::debugPrintf("Reading image '%s'.\n", _filePath.getCPtr() );
+
+	int64_t size = bx::getSize(&m_reader);
+
+	if (0 == size)
+	{
+		bx::debugPrintf("Image '%s' size is 0.\n", _filePath.getCPtr() );
+		bx::close(&m_reader);
+		return false;
+	}
+
+	uint8_t* rawImage = (uint8_t*)BX_ALLOC(VirtualTexture::getAllocator(), size_t(size) );
+
+	bx::Error readErr;
+	bx::seek(&m_reader, 0, bx::Whence::Begin);
+	bx::read(&m_reader, rawImage, int32_t(size), &readErr);
+	bx::close(&m_reader);
+
+	if (!readErr.isOk() )
+	{
+		bx::debugPrintf("Image read failed'%s'.\n", _filePath.getCPtr() );
+		BX_FREE(VirtualTexture::getAllocator(), rawImage);
+		return false;
+	}
+
+	m_image = bimg::imageParse(VirtualTexture::getAllocator(), rawImage, uint32_t(size), bimg::TextureFormat::BGRA8, &readErr);
+	BX_FREE(VirtualTexture::getAllocator(), rawImage);
+
+	if (!readErr.isOk()
+	||  m_image == nullptr)
+	{
+		bx::debugPrintf("Image parse failed'%s'.\n", _filePath.getCPtr() );
+		return false;
+	}
+
+	m_width  = int(m_image->m_width);
+	m_height = int(m_image->m_height);
+	m_pitch  = m_image->m_width * s_channelCount;
+	return true;
+}
+
+void TileSource::readRows(int _y, int _count, uint8_t* _dst)
+{
+	if (!m_streamed)
+	{
+		const uint8_t* src = (const uint8_t*)m_image->m_data;
+
+		for (int iy = 0; iy < _count; ++iy)
+		{
+			const int ry = bx::clamp(_y + iy, 0, m_height - 1);
+			bx::memCopy(&_dst[iy * m_pitch], &src[ry * m_pitch], m_pitch);
+		}
+
+		return;
+	}
+
+	bx::MutexScope lock(m_mutex);
+
+	for (int iy = 0; iy < _count; ++iy)
+	{
+		const int ry = bx::clamp(_y + iy, 0, m_height - 1);
+		uint8_t* dst = &_dst[iy * m_pitch];
+
+		bx::Error err;
+		bx::seek(&m_reader, m_offset + int64_t(ry) * m_pitch, bx::Whence::Begin);
+		bx::read(&m_reader, dst, int32_t(m_pitch), &err);
+
+		if (m_swizzle)
+		{
+			bimg::imageSwizzleBgra8(dst, m_pitch, uint32_t(m_width), 1, dst, m_pitch);
+		}
+	}
+}
+
+// TileWorker
+// Scratch images used by single generator thread
+struct TileWorker
+{
+	TileWorker(int _tilesize, int _pagesize);
+
+	SimpleImage m_page1Image;
+	SimpleImage m_page2Image;
+	SimpleImage m_2xtileImage;
+	SimpleImage m_4xtileImage;
+
+	tinystl::vector<uint8_t> m_rows;
+	tinystl::vector<uint8_t> m_rgba;
+	tinystl::vector<uint8_t> m_blocks;
+};
+
+TileWorker::TileWorker(int _tilesize, int _pagesize)
+	: m_page1Image(_pagesize, _pagesize, s_channelCount, 0xff)
+	, m_page2Image(_pagesize, _pagesize, s_channelCount, 0xff)
+	, m_2xtileImage(_tilesize * 2, _tilesize * 2, s_channelCount, 0xff)
+	, m_4xtileImage(_tilesize * 4, _tilesize * 4, s_channelCount, 0xff)
+{
+}
+
+// Tile hash file
+// Stored next to tile data file, it's used to find pages which need to be rebuilt
+static const uint32_t s_tileHashMagic = BX_MAKEFOURCC('V', 'T', 'H', 0x0);
+
+struct TileHashHeader
+{
+	uint32_t			m_magic;
+	VirtualTextureInfo	m_info;
+	uint64_t			m_sourceSize;
+	int64_t				m_sourceTime;
+	int32_t				m_count;
+};
+
+static bx::FilePath getHashFilePath(const bx::FilePath& _filePath)
+{
+	char tmp[bx::kMaxFilePath];
+	bx::snprintf(tmp, sizeof(tmp), "%s.hash", _filePath.getCPtr() );
+
+	return bx::FilePath(tmp);
+}
+
+static bool fileExists(const bx::FilePath& _filePath)
+{
+	bx::Error err;
+	bx::FileReader fileReader;
+
+	if (bx::open(&fileReader, _filePath, &err) )
+	{
+		bx::close(&fileReader);
+		return true;
+	}
+
+	return false;
+}
+
+static bool getFileStamp(const bx::FilePath& _filePath, uint64_t& _size, int64_t& _time)
+{
+#if BX_PLATFORM_WINDOWS
+	WIN32_FILE_ATTRIBUTE_DATA data;
+	if (!GetFileAttributesExA(_filePath.getCPtr(), GetFileExInfoStandard, &data) )
+	{
+		return false;
+	}
+
+	_size = (uint64_t(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+	_time = (int64_t(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+	return true;
+#elif BX_PLATFORM_POSIX
+	struct stat st;
+	if (0 != stat(_filePath.getCPtr(), &st) )
+	{
+		return false;
+	}
+
+	_size = uint64_t(st.st_size);
+	_time = int64_t(st.st_mtime);
+	return true;
+#else
+	// Without time stamp, source image is always checked for changes
+	BX_UNUSED(_filePath, _size, _time);
+	return false;
+#endif // BX_PLATFORM_*
+}
+
+static bool readTileHashes(const bx::FilePath& _filePath, TileHashHeader& _header, tinystl::vector<uint32_t>& _hashes)
+{
+	bx::Error err;
+	bx::FileReader reader;
+
+	if (!bx::open(&reader, _filePath, &err) )
+	{
+		return false;
+	}
+
+	bx::read(&reader, &_header, int32_t(sizeof(_header) ), &err);
+
+	const bool valid = err.isOk()
+		&& s_tileHashMagic == _header.m_magic
+		&& 0 < _header.m_count
+		;
+
+	if (valid)
+	{
+		_hashes.resize(_header.m_count);
+		bx::read(&reader, &_hashes[0], int32_t(sizeof(uint32_t) * _header.m_count), &err);
+	}
+
+	bx::close(&reader);
+
+	return valid && err.isOk();
+}
+
+static void writeTileHashes(const bx::FilePath& _filePath, TileHashHeader& _header, const tinystl::vector<uint32_t>& _hashes)
+{
+	bx::Error err;
+	bx::FileWriter writer;
+
+	if (!bx::open(&writer, _filePath, false, &err) )
+	{
+		bx::debugPrintf("Failed to write tile hash file '%s'.\n", _filePath.getCPtr() );
+		return;
+	}
+
+	_header.m_magic = s_tileHashMagic;
+	_header.m_count = int32_t(_hashes.size() );
+
+	bx::write(&writer, &_header, int32_t(sizeof(_header) ), &err);
+	bx::write(&writer, &_hashes[0], int32_t(sizeof(uint32_t) * _hashes.size() ), &err);
+	bx::close(&writer);
+}
+
+static bool isSameLayout(const VirtualTextureInfo& _a, const VirtualTextureInfo& _b)
+{
+	return _a.m_virtualTextureSize == _b.m_virtualTextureSize
+		&& _a.m_tileSize           == _b.m_tileSize
+		&& _a.m_borderSize         == _b.m_borderSize
+		&& _a.m_format             == _b.m_format
+		;
+}
+
+// Page of previous mip level, 4x4 pages around request are used to generate page with border
+static Page getSourcePage(Page _request, int _x, int _y, int _size)
+{
+	Page page = { (_request.m_x << 1) + _x - 1, (_request.m_y << 1) + _y - 1, _request.m_mip - 1 };
+
+	// Wrap so we get the border sections of other pages
+	page.m_x = (int)bx::mod((float)page.m_x, (float)_size);
+	page.m_y = (int)bx::mod((float)page.m_y, (float)_size);
+
+	return page;
+}
+
+// TileGenerator
+TileGenerator::TileGenerator(VirtualTextureInfo* _info, int _numThreads)
+	: m_info(_info)
+	, m_indexer(nullptr)
+	, m_tileDataFile(nullptr)
+	, m_encodeDataFile(nullptr)
+	, m_source(nullptr)
+	, m_full(true)
+	, m_jobType(GenerateRows)
+	, m_jobMip(0)
+	, m_jobCount(0)
+	, m_jobNext(0)
+	, m_jobWorker(0)
+	, m_jobFailed(0)
+{
+	m_tilesize = m_info->m_tileSize;
+	m_pagesize = m_info->GetPageSize();
+	m_numThreads = bx::max(_numThreads, 1);
+}
+
+TileGenerator::~TileGenerator()
+{
+	BX_DELETE(VirtualTexture::getAllocator(), m_tileDataFile);
+	BX_DELETE(VirtualTexture::getAllocator(), m_encodeDataFile);
+	BX_DELETE(VirtualTexture::getAllocator(), m_source);
+	BX_DELETE(VirtualTexture::getAllocator(), m_indexer);
+
+	for (auto worker : m_workers)
+	{
+		BX_DELETE(VirtualTexture::getAllocator(), worker);
+	}
+}
+
+bx::FilePath TileGenerator::getFilePath(const bx::FilePath& _filePath, bgfx::TextureFormat::Enum _format)
+{
+	const bx::StringView baseName = _filePath.getBaseName();
+
+	// Generate cache filename
+	char tmp[256];
+	bx::snprintf(tmp, sizeof(tmp), "%.*s_%s.vt"
+		, baseName.getLength()
+		, baseName.getPtr()
+		, bimg::getName(bimg::TextureFormat::Enum(_format) )
+		);
+
+	bx::FilePath cacheFilePath("temp");
+	cacheFilePath.join(tmp);
+
+	return cacheFilePath;
+}
+
+bool TileGenerator::generate(const bx::FilePath& _filePath)
+{
+	// Pages of every format are multiple of block size, so that BGRA8 tile data file can be used
+	// as source for block compressed formats. Border is grown to keep tile size.
+	while (0 != m_info->GetPageSize() % 4)
+	{
+		++m_info->m_borderSize;
+	}
+
+	m_pagesize = m_info->GetPageSize();
+
+	for (int i = 0; i < m_numThreads; ++i)
+	{
+		m_workers.push_back(BX_NEW(VirtualTexture::getAllocator(), TileWorker)(m_tilesize, m_pagesize) );
+	}
+
+	// Mip levels are generated from BGRA8 pages of previous level, compressed tile data is encoded
+	// from BGRA8 tile data file in second pass
+	const bx::FilePath rawFilePath     = getFilePath(_filePath, bgfx::TextureFormat::BGRA8);
+	const bx::FilePath rawHashFilePath = getHashFilePath(rawFilePath);
+
+	uint64_t sourceSize = 0;
+	int64_t  sourceTime = 0;
+	const bool hasStamp = getFileStamp(_filePath, sourceSize, sourceTime);
+
+	// Check if tile data file exists and if it's up to date with source image
+	bool full     = true;
+	bool upToDate = false;
+
+	TileHashHeader header;
+
+	if (readTileHashes(rawHashFilePath, header, m_hashes)
+	&&  fileExists(rawFilePath) )
+	{
+		full = header.m_info.m_tileSize   != m_info->m_tileSize
+			|| header.m_info.m_borderSize != m_info->m_borderSize
+			;
+
+		upToDate = !full
+			&& hasStamp
+			&& header.m_sourceSize == sourceSize
+			&& header.m_sourceTime == sourceTime
+			;
+
+		if (!full)
+		{
+			m_info->m_virtualTextureSize = header.m_info.m_virtualTextureSize;
+		}
+	}
+
+	if (upToDate)
+	{
+		bx::debugPrintf("Tile data file '%s' is up to date.\n", rawFilePath.getCPtr() );
+		m_indexer = BX_NEW(VirtualTexture::getAllocator(), PageIndexer)(m_info);
+	}
+	else if (!generateTiles(_filePath, rawFilePath, rawHashFilePath, full) )
+	{
+		return false;
+	}
+
+	if (bgfx::TextureFormat::BGRA8 != m_info->m_format
+	&&  !encodeTiles(rawFilePath, getFilePath(_filePath, m_info->m_format) ) )
+	{
+		return false;
+	}
+
+	bx::debugPrintf("Done!\n");
+	return true;
+}
+
+bool TileGenerator::generateTiles(const bx::FilePath& _srcFilePath, const bx::FilePath& _dstFilePath, const bx::FilePath& _hashFilePath, bool _full)
+{
+	m_source = BX_NEW(VirtualTexture::getAllocator(), TileSource);
+
+	if (!m_source->open(_srcFilePath) )
+	{
+		return false;
+	}
+
+	// Everything is rebuilt when virtual texture size changed
+	_full |= m_info->m_virtualTextureSize != m_source->m_width;
+
+	// Setup
+	m_info->m_virtualTextureSize = m_source->m_width;
+	m_indexer = BX_NEW(VirtualTexture::getAllocator(), PageIndexer)(m_info);
+
+	const int count = m_indexer->getCount();
+
+	if (_full
+	||  count != int(m_hashes.size() ) )
+	{
+		_full = true;
+		remove(_dstFilePath.getCPtr() );
+
+		m_hashes.clear();
+		m_hashes.resize(count, 0);
+	}
+
+	m_full = _full;
+	m_dirty.clear();
+	m_dirty.resize(count, 0);
+
+	VirtualTextureInfo rawInfo = *m_info;
+	rawInfo.m_format = bgfx::TextureFormat::BGRA8;
+
+	// Open tile data file
+	m_tileDataFile = BX_NEW(VirtualTexture::getAllocator(), TileDataFile)(_dstFilePath, &rawInfo, true);
+
+	if (!m_tileDataFile->isOpen() )
+	{
+		bx::debugPrintf("Failed to open tile data file '%s'.\n", _dstFilePath.getCPtr() );
+		return false;
+	}
+
+	// Generate tiles, pages of one mip level are independent of each other, and they depend only
+	// on pages of previous mip level
+	bx::debugPrintf("%s tiles\n", m_full ? "Generating" : "Updating");
+	auto mipcount = m_indexer->getMipCount();
+	for (int i = 0; i < mipcount; ++i)
+	{
+		int size = m_info->GetPageTableSize() >> i;
+
+		m_jobMip = i;
+
+		if (0 == i)
+		{
+			// Mip 0 is generated in page rows, so that source image rows are read only once
+			dispatch(GenerateRows, size);
+		}
+		else
+		{
+			dispatch(GeneratePages, size * size);
+		}
+
+		Page first = { 0, 0, i };
+		int offset = m_indexer->getIndexFromPage(first);
+		int dirty = 0;
+
+		for (int j = 0; j < size * size; ++j)
+		{
+			dirty += m_dirty[offset + j];
+		}
+
+		bx::debugPrintf("Generating Mip:%d Count:%dx%d Updated:%d\n", i, size, size, dirty);
+	}
+
+	bx::debugPrintf("Finising\n");
+	// Write header
+	m_tileDataFile->writeInfo();
+	// Close tile file
+	BX_DELETE(VirtualTexture::getAllocator(), m_tileDataFile);
+	m_tileDataFile = nullptr;
+
+	BX_DELETE(VirtualTexture::getAllocator(), m_source);
+	m_source = nullptr;
+
+	TileHashHeader header;
+	header.m_info       = rawInfo;
+	header.m_sourceSize = 0;
+	header.m_sourceTime = 0;
+	getFileStamp(_srcFilePath, header.m_sourceSize, header.m_sourceTime);
+
+	writeTileHashes(_hashFilePath, header, m_hashes);
+
+	return true;
+}
+
+bool TileGenerator::encodeTiles(const bx::FilePath& _srcFilePath, const bx::FilePath& _dstFilePath)
+{
+	const bx::FilePath hashFilePath = getHashFilePath(_dstFilePath);
+	const int count = m_indexer->getCount();
+
+	TileHashHeader header;
+
+	if (!readTileHashes(hashFilePath, header, m_encodedHashes)
+	||  !isSameLayout(header.m_info, *m_info)
+	||  count != int(m_encodedHashes.size() )
+	||  !fileExists(_dstFilePath) )
+	{
+		remove(_dstFilePath.getCPtr() );
+
+		m_encodedHashes.clear();
+		m_encodedHashes.resize(count, 0);
+	}
+
+	// Page is encoded when its BGRA8 data changed since it was encoded last time
+	m_encodeIndices.clear();
+
+	for (int i = 0; i < count; ++i)
+	{
+		if (0 == m_encodedHashes[i]
+		||  m_encodedHashes[i] != m_hashes[i])
+		{
+			m_encodeIndices.push_back(i);
+		}
+	}
+
+	if (m_encodeIndices.empty() )
+	{
+		bx::debugPrintf("Tile data file '%s' is up to date.\n", _dstFilePath.getCPtr() );
+		return true;
+	}
+
+	bx::debugPrintf("Encoding %d tiles to %s\n"
+		, int(m_encodeIndices.size() )
+		, bimg::getName(bimg::TextureFormat::Enum(m_info->m_format) )
+		);
+
+	VirtualTextureInfo rawInfo = *m_info;
+	rawInfo.m_format = bgfx::TextureFormat::BGRA8;
+
+	m_tileDataFile   = BX_NEW(VirtualTexture::getAllocator(), TileDataFile)(_srcFilePath, &rawInfo);
+	m_encodeDataFile = BX_NEW(VirtualTexture::getAllocator(), TileDataFile)(_dstFilePath, m_info, true);
+
+	const bool isOpen = m_tileDataFile->isOpen() && m_encodeDataFile->isOpen();
+
+	if (isOpen)
+	{
+		m_jobFailed = 0;
+		dispatch(EncodePages, int(m_encodeIndices.size() ) );
+
+		m_encodeDataFile->writeInfo();
+	}
+
+	BX_DELETE(VirtualTexture::getAllocator(), m_tileDataFile);
+	BX_DELETE(VirtualTexture::getAllocator(), m_encodeDataFile);
+	m_tileDataFile   = nullptr;
+	m_encodeDataFile = nullptr;
+
+	if (!isOpen)
+	{
+		bx::debugPrintf("Failed to open tile data file '%s'.\n", _dstFilePath.getCPtr() );
+		return false;
+	}
+
+	// Pages which failed to encode keep old hash, and they are encoded again next time
+	header.m_info       = *m_info;
+	header.m_sourceSize = 0;
+	header.m_sourceTime = 0;
+	writeTileHashes(hashFilePath, header, m_encodedHashes);
+
+	if (0 != m_jobFailed)
+	{
+		bx::debugPrintf("Failed to encode %d tiles.\n", m_jobFailed);
+		return false;
+	}
+
+	return true;
+}
+
+void TileGenerator::dispatch(JobType type, int count)
+{
+	m_jobType   = type;
+	m_jobCount  = count;
+	m_jobNext   = 0;
+	m_jobWorker = 0;
+
+	// Calling thread is a worker too
+	const int numThreads = bx::min(m_numThreads, bx::max(count, 1) );
+	tinystl::vector<bx::Thread*> threads;
+
+	for (int i = 0; i < numThreads - 1; ++i)
+	{
+		bx::Thread* thread = BX_NEW(VirtualTexture::getAllocator(), bx::Thread);
+		thread->init(threadFunc, this, 0, "vt tile generator");
+		threads.push_back(thread);
+	}
+
+	threadFunc(nullptr, this);
+
+	for (auto thread : threads)
+	{
+		thread->shutdown();
+		BX_DELETE(VirtualTexture::getAllocator(), thread);
+	}
+}
+
+int32_t TileGenerator::threadFunc(bx::Thread* _thread, void* _userData)
+{
+	BX_UNUSED(_thread);
+
+	TileGenerator& generator = *(TileGenerator*)_userData;
+	TileWorker& worker = *generator.m_workers[bx::atomicFetchAndAdd(&generator.m_jobWorker, 1)];
+
+	for (int32_t job = bx::atomicFetchAndAdd(&generator.m_jobNext, 1); job < generator.m_jobCount; job = bx::atomicFetchAndAdd(&generator.m_jobNext, 1) )
+	{
+		generator.execute(worker, job);
+	}
+
+	return bx::kExitSuccess;
+}
+
+void TileGenerator::execute(TileWorker& worker, int job)
+{
+	switch (m_jobType)
+	{
+	case GenerateRows:
+		generateRow(worker, job);
+		break;
+
+	case GeneratePages:
+		{
+			int size = m_info->GetPageTableSize() >> m_jobMip;
+			Page page = { job % size, job / size, m_jobMip };
+			generatePage(worker, page);
+		}
+		break;
+
+	case EncodePages:
+		encodePage(worker, m_encodeIndices[job]);
+		break;
+	}
+}
+
+void TileGenerator::generateRow(TileWorker& worker, int row)
+{
+	// Source rows covering page row, including border
+	worker.m_rows.resize(size_t(m_source->m_pitch) * m_pagesize);
+	m_source->readRows(row * m_tilesize - m_info->m_borderSize, m_pagesize, &worker.m_rows[0]);
+
+	int size = m_info->GetPageTableSize();
+
+	for (int x = 0; x < size; ++x)
+	{
+		Page page = { x, row, 0 };
+		CopyTile(worker, worker.m_page1Image, page);
+		writePage(m_indexer->getIndexFromPage(page), worker.m_page1Image);
+	}
+}
+
+void TileGenerator::generatePage(TileWorker& worker, Page request)
+{
+	// Page is rebuilt only if any page of previous mip level it's generated from changed
+	if (!m_full)
+	{
+		int size = m_info->GetPageTableSize() >> (request.m_mip - 1);
+		bool dirty = false;
+
+		for (int y = 0; y < 4 && !dirty; ++y)
+		{
+			for (int x = 0; x < 4 && !dirty; ++x)
+			{
+				dirty = 0 != m_dirty[m_indexer->getIndexFromPage(getSourcePage(request, x, y, size) )];
+			}
+		}
+
+		if (!dirty)
+		{
+			return;
+		}
+	}
+
+	CopyTile(worker, worker.m_page1Image, request);
+	writePage(m_indexer->getIndexFromPage(request), worker.m_page1Image);
+}
+
+bool TileGenerator::writePage(int index, SimpleImage& image)
+{
+	// Unchanged pages are not written, and pages generated from them are skipped
+	const uint32_t hash = bx::hash<bx::HashMurmur2A>(&image.m_data[0], uint32_t(image.m_data.size() ) );
+
+	if (!m_full
+	&&  hash == m_hashes[index])
+	{
+		return false;
+	}
+
+	m_tileDataFile->writePage(index, &image.m_data[0]);
+	m_hashes[index] = hash;
+	m_dirty[index]  = 1;
+
+	return true;
+}
+
+void TileGenerator::encodePage(TileWorker& worker, int index)
+{
+	const uint32_t pagesize = uint32_t(m_pagesize);
+	const uint32_t pitch = pagesize * s_channelCount;
+
+	worker.m_rgba.resize(pitch * pagesize);
+	worker.m_blocks.resize(m_info->GetPageDataSize() );
+
+	m_tileDataFile->readPage(index, &worker.m_rgba[0]);
+	bimg::imageSwizzleBgra8(&worker.m_rgba[0], pitch, pagesize, pagesize, &worker.m_rgba[0], pitch);
+
+	// Whole page including border is encoded, so that blocks on page edges match neighbours
+	bx::Error err;
+	bimg::imageEncodeFromRgba8(
+		  VirtualTexture::getAllocator()
+		, &worker.m_blocks[0]
+		, &worker.m_rgba[0]
+		, pagesize
+		, pagesize
+		, 1
+		, bimg::TextureFormat::Enum(m_info->m_format)
+		, bimg::Quality::Default
+		, &err
+		);
+
+	if (!err.isOk() )
+	{
+		bx::atomicFetchAndAdd(&m_jobFailed, 1);
+		return;
+	}
+
+	m_encodeDataFile->writePage(index, &worker.m_blocks[0]);
+	m_encodedHashes[index] = m_hashes[index];
+}
+
+void TileGenerator::CopyTile(TileWorker& worker, SimpleImage& image, Page request)
+{
+	if (request.m_mip == 0)
+	{
+		int x = request.m_x * m_tilesize - m_info->m_borderSize;
+		// Copy sub-image with border, rows were already clamped when read from source
+		auto srcPitch = m_source->m_pitch;
+		auto src = &worker.m_rows[0];
+		auto dstPitch = image.m_width * image.m_channelCount;
+		auto dst = &image.m_data[0];
+		for (int iy = 0; iy < m_pagesize; ++iy)
+		{
+			for (int ix = 0; ix < m_pagesize; ++ix)
+			{
+				int rx = bx::clamp(x + ix, 0, m_source->m_width - 1);
+				bx::memCopy(&dst[iy * dstPitch + ix * image.m_channelCount], &src[iy * srcPitch + rx * s_channelCount], image.m_channelCount);
+			}
+		}
+	}
+	else
+	{
+		int size = m_info->GetPageTableSize() >> (request.m_mip - 1);
+
+		worker.m_4xtileImage.clear((uint8_t)request.m_mip);
+
+		for (int y = 0; y < 4; ++y)
+		{
+			for (int x = 0; x < 4; ++x)
+			{
+				Page page = getSourcePage(request, x, y, size);
+
+				m_tileDataFile->readPage(m_indexer->getIndexFromPage(page), &worker.m_page2Image.m_data[0]);
+
+				Rect src_rect = { m_info->m_borderSize, m_info->m_borderSize, m_tilesize, m_tilesize };
+				Point dst_offset = { x * m_tilesize, y * m_tilesize };
+
+				worker.m_4xtileImage.copy(dst_offset, worker.m_page2Image, src_rect);
+			}
+		}
+
+		SimpleImage::mipmap(&worker.m_4xtileImage.m_data[0], worker.m_4xtileImage.m_width, s_channelCount, &worker.m_2xtileImage.m_data[0]);
+
+		Rect srect = { m_tilesize / 2 - m_info->m_borderSize, m_tilesize / 2 - m_info->m_borderSize, m_pagesize, m_pagesize };
+		image.copy({ 0,0 }, worker.m_2xtileImage, srect);
+	}
+}
+
+} // namespace vt
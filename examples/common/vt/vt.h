@@ -16,13 +16,16 @@
 #pragma once
 
 #include <bimg/decode.h>
+#include <bx/mutex.h>
+#include <bx/semaphore.h>
+#include <bx/thread.h>
 #include <tinystl/allocator.h>
 #include <tinystl/unordered_set.h>
 #include <tinystl/vector.h>
 #include <functional>
 
-#include "common.h"
-#include "bgfx_utils.h"
+#include "../common.h"
+#include "../bgfx_utils.h"
 
 #include <stdio.h> // FILE
 
@@ -103,18 +106,22 @@ struct VirtualTextureInfo
 {
 	VirtualTextureInfo();
 	int GetPageSize() const;
+	int GetPageDataSize() const;
 	int GetPageTableSize() const;
 
 	int m_virtualTextureSize = 0;
 	int m_tileSize = 0;
 	int m_borderSize = 0;
+
+	// Tile data format, BGRA8, BC1, BC3 or BC7
+	bgfx::TextureFormat::Enum m_format = bgfx::TextureFormat::BGRA8;
 };
 
 // StagingPool
 class StagingPool
 {
 public:
-	StagingPool(int _width, int _height, int _count, bool _readBack);
+	StagingPool(int _width, int _height, int _count, bool _readBack, bgfx::TextureFormat::Enum _format = bgfx::TextureFormat::BGRA8);
 	~StagingPool();
 
 	void grow(int count);
@@ -129,6 +136,8 @@ private:
 	int			m_width;
 	int			m_height;
 	uint64_t	m_flags;
+
+	bgfx::TextureFormat::Enum m_format;
 };
 
 // PageIndexer
@@ -214,32 +223,92 @@ private:
 	tinystl::vector<bgfx::TextureHandle>	m_stagingTextures;
 };
 
+// PageLoaderStats
+struct PageLoaderStats
+{
+	int   m_queueDepth = 0;    // Requests waiting for worker thread
+	int   m_queueDepthMax = 0; // Highest queue depth since start
+	int   m_loading = 0;       // Requests being read by worker threads
+	int   m_pending = 0;       // Loaded pages waiting for upload budget
+	int   m_uploaded = 0;      // Pages uploaded during last update
+	int   m_totalUploaded = 0; // Pages uploaded since start
+	int   m_totalDropped = 0;  // Requests dropped or evicted because queue was full
+	float m_latencyAvg = 0.0f; // Average time from request to upload in milliseconds
+	float m_latencyMax = 0.0f; // Longest time from request to upload in milliseconds
+	float m_streamed = 0.0f;   // Tile data read from file in MB/s, averaged over last second
+
+	int64_t m_totalBytesRead = 0; // Tile data read from file since start
+};
+
 // PageLoader
+// Pages are read by worker threads from bounded request queue, higher priority requests are
+// loaded first and evict lowest priority queued requests when queue is full. Loaded pages are
+// handed back on the calling thread in update, limited by per-frame upload budget. Pages are
+// transcoded to atlas format only when it's different from tile data format.
 class PageLoader
 {
 public:
-	struct ReadState
-	{
-		Page						m_page;
-		tinystl::vector<uint8_t>	m_data;
-	};
+	PageLoader(TileDataFile* _tileDataFile, PageIndexer* _indexer, VirtualTextureInfo* _info, bgfx::TextureFormat::Enum _format, int _numThreads, int _queueSize);
+	~PageLoader();
 
-	PageLoader(TileDataFile* _tileDataFile, PageIndexer* _indexer, VirtualTextureInfo* _info);
-	void submit(Page request);
-	void loadPage(ReadState& state);
-	void onPageLoadComplete(ReadState& state);
+	bool submit(Page request, uint32_t priority);
+	void cancel();
+	void update(int uploads);
 	void copyBorder(uint8_t* image);
 	void copyColor(uint8_t* image, Page request);
 
+	const PageLoaderStats& getStats() const;
+
 	std::function<void(Page, uint8_t*)> loadComplete;
+	std::function<void(Page)>           loadDropped;
 
 	bool m_colorMipLevels;
 	bool m_showBorders;
 
 private:
+	struct ReadState
+	{
+		enum Enum
+		{
+			Free,
+			Queued,
+			Loading,
+			Loaded,
+		};
+
+		Page						m_page;
+		uint32_t					m_priority;
+		int64_t						m_time;
+		Enum						m_state;
+		tinystl::vector<uint8_t>	m_data;
+		tinystl::vector<uint8_t>	m_bgra;
+		tinystl::vector<uint8_t>	m_file;
+	};
+
+	static int32_t threadFunc(bx::Thread* _thread, void* _userData);
+	int  loadPage(ReadState& state);
+	int  findState(ReadState::Enum state);
+
 	TileDataFile*		m_tileDataFile;
 	PageIndexer*        m_indexer;
 	VirtualTextureInfo* m_info;
+
+	bgfx::TextureFormat::Enum m_format;
+
+	tinystl::vector<ReadState>	 m_states;
+	tinystl::vector<bx::Thread*> m_threads;
+	tinystl::vector<int>		 m_uploads;
+	tinystl::vector<Page>		 m_dropped;
+
+	bx::Mutex	  m_mutex;
+	bx::Semaphore m_sem;
+	volatile bool m_exit;
+
+	PageLoaderStats m_stats;
+	int64_t			m_latencyTotal;
+	int64_t			m_bytesRead;
+	int64_t			m_streamTime;
+	int64_t			m_streamBytes;
 };
 
 // PageCache
@@ -248,9 +317,12 @@ class PageCache
 public:
 	PageCache(TextureAtlas* _atlas, PageLoader* _loader, int _count);
 	bool touch(Page page);
-	bool request(Page request, bgfx::ViewId blitViewId);
+	bool request(Page request, uint32_t priority, bgfx::ViewId blitViewId);
 	void clear();
 	void loadComplete(Page page, uint8_t* data);
+	void loadDropped(Page page);
+
+	int  getResidentCount() const;
 
 	// These callbacks are used to notify the other systems
 	std::function<void(Page, Point)> removed;
@@ -286,7 +358,7 @@ private:
 class TextureAtlas
 {
 public:
-	TextureAtlas(VirtualTextureInfo* _info, int count, int uploadsperframe);
+	TextureAtlas(VirtualTextureInfo* _info, int count, int uploadsperframe, bgfx::TextureFormat::Enum _format);
 	~TextureAtlas();
 
 	void setUploadsPerFrame(int count);
@@ -298,6 +370,7 @@ private:
 	VirtualTextureInfo*  m_info;
 	bgfx::TextureHandle  m_texture;
 	StagingPool          m_stagingPool;
+	int                  m_pageDataSize;
 };
 
 // FeedbackBuffer
@@ -342,7 +415,7 @@ private:
 class VirtualTexture
 {
 public:
-	VirtualTexture(TileDataFile* _tileDataFile, VirtualTextureInfo* _info, int _atlassize, int _uploadsperframe, int _mipBias = 4);
+	VirtualTexture(TileDataFile* _tileDataFile, VirtualTextureInfo* _info, int _atlassize, int _uploadsperframe, int _mipBias = 4, int _loaderThreads = 2, int _loaderQueueSize = 64);
 	~VirtualTexture();
 
 	int  getMipBias() const;
@@ -360,6 +433,13 @@ public:
 	bgfx::TextureHandle getAtlastTexture();
 	bgfx::TextureHandle getPageTableTexture();
 
+	const PageLoaderStats& getLoaderStats() const;
+
+	bgfx::TextureFormat::Enum getAtlasFormat() const;
+	int getAtlasCapacity() const;
+	int getResidentCount() const;
+	uint32_t getAtlasMemorySize() const;
+
 	void clear();
 	void update(const tinystl::vector<int>& requests, bgfx::ViewId blitViewId);
 
@@ -368,6 +448,9 @@ public:
 	static void setAllocator(bx::AllocatorI* allocator);
 	static bx::AllocatorI* getAllocator();
 
+	// Returns tile data format if it's supported by renderer, otherwise BGRA8
+	static bgfx::TextureFormat::Enum getAtlasFormat(bgfx::TextureFormat::Enum _format);
+
 private:
 	TileDataFile*		m_tileDataFile;
 	VirtualTextureInfo* m_info;
@@ -380,6 +463,8 @@ private:
 	int m_atlasCount;
 	int m_uploadsPerFrame;
 
+	bgfx::TextureFormat::Enum m_atlasFormat;
+
 	tinystl::vector<PageCount> m_pagesToLoad;
 
 	int m_mipBias;
@@ -396,48 +481,96 @@ private:
 class TileDataFile
 {
 public:
+	// Read/write tile data file is opened for update when it exists, so that it can be rebuilt incrementally
 	TileDataFile(const bx::FilePath& filename, VirtualTextureInfo* _info, bool _readWrite = false);
 	~TileDataFile();
 
+	bool isOpen() const;
+
 	void readInfo();
 	void writeInfo();
 
+	// readPage is thread safe, pages are copied from memory mapped file when possible
 	void readPage(int index, uint8_t* data);
 	void writePage(int index, uint8_t* data);
 
 private:
+	bool map(const bx::FilePath& filename);
+	void unmap();
+	void seek(int64_t offset);
+
 	VirtualTextureInfo*	m_info;
 	int					m_size;
 	FILE*				m_file;
+	bx::Mutex			m_mutex;
+
+	const uint8_t*		m_mapping;
+	size_t				m_mappingSize;
 };
 
+struct TileSource;
+struct TileWorker;
+
 // TileGenerator
 class TileGenerator
 {
 public:
-	TileGenerator(VirtualTextureInfo* _info);
+	TileGenerator(VirtualTextureInfo* _info, int _numThreads = 4);
 	~TileGenerator();
 
+	// Generates tile data file in format selected by VirtualTextureInfo::m_format. When tile data
+	// file already exists, only pages which changed since last generation are rebuilt.
 	bool generate(const bx::FilePath& filename);
 
+	static bx::FilePath getFilePath(const bx::FilePath& filename, bgfx::TextureFormat::Enum format);
+
 private:
-	void CopyTile(SimpleImage& image, Page request);
+	enum JobType
+	{
+		GenerateRows,
+		GeneratePages,
+		EncodePages,
+	};
+
+	bool generateTiles(const bx::FilePath& srcFilePath, const bx::FilePath& dstFilePath, const bx::FilePath& hashFilePath, bool full);
+	bool encodeTiles(const bx::FilePath& srcFilePath, const bx::FilePath& dstFilePath);
+
+	void dispatch(JobType type, int count);
+	void execute(TileWorker& worker, int job);
+	static int32_t threadFunc(bx::Thread* _thread, void* _userData);
+
+	void generateRow(TileWorker& worker, int row);
+	void generatePage(TileWorker& worker, Page request);
+	void encodePage(TileWorker& worker, int index);
+	void CopyTile(TileWorker& worker, SimpleImage& image, Page request);
+	bool writePage(int index, SimpleImage& image);
 
 private:
 	VirtualTextureInfo* m_info;
 	PageIndexer*		m_indexer;
 	TileDataFile*		m_tileDataFile;
+	TileDataFile*		m_encodeDataFile;
+	TileSource*			m_source;
 
 	int	m_tilesize;
 	int	m_pagesize;
-
-	bimg::ImageContainer*	m_sourceImage;
-
-	SimpleImage* m_page1Image;
-	SimpleImage* m_page2Image;
-	SimpleImage* m_2xtileImage;
-	SimpleImage* m_4xtileImage;
-	SimpleImage* m_tileImage;
+	int	m_numThreads;
+
+	tinystl::vector<TileWorker*>	m_workers;
+
+	// Per page hash of BGRA8 page data, and pages which changed during this generation
+	tinystl::vector<uint32_t>	m_hashes;
+	tinystl::vector<uint32_t>	m_encodedHashes;
+	tinystl::vector<uint8_t>	m_dirty;
+	tinystl::vector<int>		m_encodeIndices;
+	bool						m_full;
+
+	JobType	m_jobType;
+	int		m_jobMip;
+	int32_t	m_jobCount;
+	int32_t	m_jobNext;
+	int32_t	m_jobWorker;
+	int32_t	m_jobFailed;
 };
 
 } // namespace vt
@@ -1014,6 +1014,23 @@ namespace bgfx
 		EncoderStats* encoderStats;         //!< Array of encoder stats.
 	};
 
+	/// Trace replay statistics.
+	///
+	/// @remarks All time values are high-resolution timestamps, while
+	///   time frequency defines timestamps-per-second.
+	struct ReplayStats
+	{
+		uint32_t numLoops;      //!< Number of times trace was replayed.
+		uint32_t numFrames;     //!< Number of frames submitted to renderer.
+		uint32_t numCommands;   //!< Number of resource commands executed.
+		int64_t  submitTime;    //!< Total time spent in renderer submit.
+		int64_t  submitTimeMin; //!< Fastest renderer submit.
+		int64_t  submitTimeMax; //!< Slowest renderer submit.
+		int64_t  flipTime;      //!< Total time spent in renderer flip.
+		int64_t  totalTime;     //!< Total replay time, including resource creation.
+		int64_t  timerFreq;     //!< Timer frequency.
+	};
+
 	/// Encoders are used for submitting draw calls from multiple threads. Only one encoder
 	/// per thread should be used. Use `bgfx::begin()` to obtain an encoder for a thread.
 	///
@@ -4163,6 +4180,54 @@ namespace bgfx
 		, const char* _filePath
 		);
 
+	/// Compile pipeline state for program, state and vertex layout combination ahead of first
+	/// draw call that uses it, so it doesn't cause hitch when it's used for the first time.
+	///
+	/// @param[in] _id View id. Pipeline is compiled against frame buffer currently set on view.
+	/// @param[in] _program Program.
+	/// @param[in] _state State flags. See: `BGFX_STATE_*`.
+	/// @param[in] _layout Vertex layout of vertex stream. Use empty layout for draw calls
+	///   without vertex streams.
+	/// @param[in] _numInstanceData Number of instance data `vec4` elements per instance.
+	/// @param[in] _fstencil Front stencil state. See: `BGFX_STENCIL_*`.
+	/// @param[in] _bstencil Back stencil state. See: `BGFX_STENCIL_*`.
+	///
+	/// @remarks
+	///   Pipelines are compiled on background threads. Only Vulkan renderer implements it, other
+	///   renderers ignore this call.
+	///
+	void prewarmPipeline(
+		  ViewId _id
+		, ProgramHandle _program
+		, uint64_t _state
+		, const VertexLayout& _layout
+		, uint8_t _numInstanceData = 0
+		, uint32_t _fstencil = BGFX_STENCIL_NONE
+		, uint32_t _bstencil = BGFX_STENCIL_NONE
+		);
+
+	/// Replay trace recorded by capture renderer (`BGFX_CONFIG_RENDERER_CAPTURE`) through
+	/// active renderer.
+	///
+	/// @param[in] _filePath Trace file path.
+	/// @param[in] _numLoops Number of times trace is replayed.
+	/// @param[in] _backBuffer Frame buffer used instead of back buffer. Must be valid when
+	///   renderer is created without window (headless).
+	/// @param[out] _stats Replay statistics.
+	/// @returns True if trace was replayed successfully.
+	///
+	/// @remarks
+	///   Must be called from API thread, and only when bgfx is used in single threaded mode
+	///   (`bgfx::renderFrame` called before `bgfx::init`). Trace must be captured with the same
+	///   bgfx build configuration, and shaders in trace must be compatible with active renderer.
+	///
+	bool replayTrace(
+		  const char* _filePath
+		, uint32_t _numLoops
+		, FrameBufferHandle _backBuffer
+		, ReplayStats* _stats = NULL
+		);
+
 	void setupRaytracing();
 
 	void createRtScene(VertexBufferHandle _vbh,IndexBufferHandle _ibh);
@@ -0,0 +1,58 @@
+project ("bench")
+	uuid (os.uuid("bench") )
+	kind "ConsoleApp"
+
+	configuration {}
+
+	includedirs {
+		path.join(BIMG_DIR, "include"),
+		path.join(BGFX_DIR, "include"),
+		path.join(BGFX_DIR, "3rdparty"),
+		path.join(MODULE_DIR, "include"),
+		path.join(MODULE_DIR, "3rdparty"),
+	}
+
+	files {
+		path.join(MODULE_DIR, "tools/bench/**"),
+		path.join(BGFX_DIR,   "examples/common/culling.cpp"),
+		path.join(BGFX_DIR,   "examples/common/culling.h"),
+		path.join(BGFX_DIR,   "examples/common/occlusion.cpp"),
+		path.join(BGFX_DIR,   "examples/common/occlusion.h"),
+	}
+
+	links {
+		"bimg_decode",
+		"bimg",
+		"bgfx",
+	}
+
+	using_bx()
+
+	configuration { "mingw-*" }
+		targetextension ".exe"
+
+	configuration { "vs20* or mingw*" }
+		links {
+			"gdi32",
+			"psapi",
+		}
+
+	configuration { "linux-* or freebsd" }
+		links {
+			"X11",
+			"GL",
+			"pthread",
+		}
+
+	configuration { "osx*" }
+		linkoptions {
+			"-framework Cocoa",
+			"-framework IOKit",
+			"-framework Metal",
+			"-framework OpenGL",
+			"-framework QuartzCore",
+		}
+
+	configuration {}
+
+	strip()
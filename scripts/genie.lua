@@ -234,6 +234,7 @@ function exampleProjectDefaults()
 		"example-glue",
 		"example-common",
 		"bgfx",
+		"bimg_encode",
 		"bimg_decode",
 		"bimg",
 	}
@@ -528,7 +529,9 @@ if _OPTIONS["with-shared-lib"] then
 	bgfxProject("-shared-lib", "SharedLib", BGFX_CONFIG)
 end
 
-if _OPTIONS["with-tools"] then
+if _OPTIONS["with-examples"]
+or _OPTIONS["with-combined-examples"]
+or _OPTIONS["with-tools"] then
 	group "libs"
 	dofile(path.join(BIMG_DIR, "scripts/bimg_encode.lua"))
 end
@@ -610,4 +613,7 @@ if _OPTIONS["with-tools"] then
 	dofile "texturev.lua"
 	dofile "geometryc.lua"
 	dofile "geometryv.lua"
+	dofile "tracereplay.lua"
+	dofile "bench.lua"
+	dofile "pipelinetest.lua"
 end
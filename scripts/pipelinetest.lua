@@ -0,0 +1,54 @@
+project ("pipelinetest")
+	uuid (os.uuid("pipelinetest") )
+	kind "ConsoleApp"
+
+	configuration {}
+
+	includedirs {
+		path.join(BIMG_DIR, "include"),
+		path.join(BGFX_DIR, "include"),
+		path.join(BGFX_DIR, "3rdparty"),
+		path.join(MODULE_DIR, "include"),
+		path.join(MODULE_DIR, "3rdparty"),
+	}
+
+	files {
+		path.join(MODULE_DIR, "tools/pipelinetest/**"),
+	}
+
+	links {
+		"bimg_decode",
+		"bimg",
+		"bgfx",
+	}
+
+	using_bx()
+
+	configuration { "mingw-*" }
+		targetextension ".exe"
+
+	configuration { "vs20* or mingw*" }
+		links {
+			"gdi32",
+			"psapi",
+		}
+
+	configuration { "linux-* or freebsd" }
+		links {
+			"X11",
+			"GL",
+			"pthread",
+		}
+
+	configuration { "osx*" }
+		linkoptions {
+			"-framework Cocoa",
+			"-framework IOKit",
+			"-framework Metal",
+			"-framework OpenGL",
+			"-framework QuartzCore",
+		}
+
+	configuration {}
+
+	strip()
@@ -12,6 +12,7 @@
 #include "glcontext_html5.cpp"
 #include "nvapi.cpp"
 #include "renderer_agc.cpp"
+#include "renderer_capture.cpp"
 #include "renderer_d3d11.cpp"
 #include "renderer_d3d12.cpp"
 #include "renderer_d3d9.cpp"
@@ -10,6 +10,7 @@
 #include <bx/file.h>
 #include <bx/mutex.h>
 
+#include "renderer_capture.h"
 #include "topology.h"
 
 #if BX_PLATFORM_OSX || BX_PLATFORM_IOS
@@ -2325,6 +2326,8 @@ namespace bgfx
 
 	void Context::swap()
 	{
+		BGFX_PROFILER_BEGIN_LITERAL("bgfx/Swap", 0xff2040ff);
+
 		freeDynamicBuffers();
 		m_submit->m_resolution = m_init.resolution;
 		m_init.resolution.reset &= ~BGFX_RESET_INTERNAL_FORCE;
@@ -2349,6 +2352,8 @@ namespace bgfx
 
 		bx::memCopy(m_render->m_occlusion, m_submit->m_occlusion, sizeof(m_submit->m_occlusion) );
 
+		BGFX_PROFILER_END();
+
 		if (!BX_ENABLED(BGFX_CONFIG_MULTITHREADED)
 		||  m_singleThreaded)
 		{
@@ -2760,6 +2765,12 @@ namespace bgfx
 			s_rendererCreator[renderer].supported = false;
 		}
 
+		if (BX_ENABLED(BGFX_CONFIG_RENDERER_CAPTURE)
+		&&  NULL != renderCtx)
+		{
+			renderCtx = capture::rendererCreate(renderCtx);
+		}
+
 		return renderCtx;
 	}
 
@@ -2767,6 +2778,11 @@ namespace bgfx
 	{
 		if (NULL != _renderCtx)
 		{
+			if (BX_ENABLED(BGFX_CONFIG_RENDERER_CAPTURE) )
+			{
+				_renderCtx = capture::rendererDestroy(_renderCtx);
+			}
+
 			s_rendererCreator[_renderCtx->getRendererType()].destroyFn();
 		}
 	}
@@ -3349,6 +3365,32 @@ namespace bgfx
 				}
 				break;
 
+			case CommandBuffer::PrewarmPipeline:
+				{
+					BGFX_PROFILER_SCOPE("PrewarmPipeline", 0xff2040ff);
+
+					FrameBufferHandle fbh;
+					_cmdbuf.read(fbh);
+
+					ProgramHandle program;
+					_cmdbuf.read(program);
+
+					uint64_t state;
+					_cmdbuf.read(state);
+
+					uint64_t stencil;
+					_cmdbuf.read(stencil);
+
+					VertexLayout layout;
+					_cmdbuf.read(layout);
+
+					uint8_t numInstanceData;
+					_cmdbuf.read(numInstanceData);
+
+					m_renderCtx->prewarmPipeline(fbh, program, state, stencil, layout, numInstanceData);
+				}
+				break;
+
 			default:
 				BX_ASSERT(false, "Invalid command: %d", command);
 				break;
@@ -5519,6 +5561,26 @@ namespace bgfx
 		s_ctx->requestScreenShot(_handle, _filePath);
 	}
 
+	bool replayTrace(const char* _filePath, uint32_t _numLoops, FrameBufferHandle _backBuffer, ReplayStats* _stats)
+	{
+		BGFX_CHECK_API_THREAD();
+
+		if (BX_ENABLED(BGFX_CONFIG_MULTITHREADED)
+		&&  !s_ctx->m_singleThreaded)
+		{
+			BX_TRACE("Trace replay requires single threaded mode.");
+			return false;
+		}
+
+		return capture::replay(s_ctx, bx::FilePath(_filePath), _numLoops, _backBuffer, _stats);
+	}
+
+	void prewarmPipeline(ViewId _id, ProgramHandle _program, uint64_t _state, const VertexLayout& _layout, uint8_t _numInstanceData, uint32_t _fstencil, uint32_t _bstencil)
+	{
+		BGFX_CHECK_API_THREAD();
+		s_ctx->prewarmPipeline(_id, _program, _state, _fstencil, _bstencil, _layout, _numInstanceData);
+	}
+
 	void setupRaytracing()
 	{
 		s_ctx->m_renderCtx->setupRaytracing();
@@ -834,6 +834,7 @@ namespace bgfx
 			UpdateViewName,
 			InvalidateOcclusionQuery,
 			SetName,
+			PrewarmPipeline,
 			End,
 			RendererShutdownEnd,
 			DestroyVertexLayout,
@@ -2975,6 +2976,7 @@ namespace bgfx
 		virtual void submit(Frame* _render, ClearQuad& _clearQuad, TextVideoMemBlitter& _textVideoMemBlitter) = 0;
 		virtual void blitSetup(TextVideoMemBlitter& _blitter) = 0;
 		virtual void blitRender(TextVideoMemBlitter& _blitter, uint32_t _numIndices) = 0;
+		virtual void prewarmPipeline(FrameBufferHandle /*_fbh*/, ProgramHandle /*_program*/, uint64_t /*_state*/, uint64_t /*_stencil*/, const VertexLayout& /*_layout*/, uint8_t /*_numInstanceData*/) { }
 		virtual void setupRaytracing() { }
 		virtual void initRayTracingScene(const char* filename) { }
 		virtual void createRtScene(VertexBufferHandle _vbh, IndexBufferHandle _ibh) {}
@@ -4917,6 +4919,26 @@ namespace bgfx
 			m_colorPaletteDirty = 2;
 		}
 
+		BGFX_API_FUNC(void prewarmPipeline(ViewId _id, ProgramHandle _program, uint64_t _state, uint32_t _fstencil, uint32_t _bstencil, const VertexLayout& _layout, uint8_t _numInstanceData) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("prewarmPipeline", m_programHandle, _program);
+			BX_ASSERT(_numInstanceData <= BGFX_CONFIG_MAX_INSTANCE_DATA_COUNT
+				, "Number of instance data %d exceeds maximum %d."
+				, _numInstanceData
+				, BGFX_CONFIG_MAX_INSTANCE_DATA_COUNT
+				);
+
+			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::PrewarmPipeline);
+			cmdbuf.write(m_view[_id].m_fbh);
+			cmdbuf.write(_program);
+			cmdbuf.write(_state);
+			cmdbuf.write(packStencil(_fstencil, _bstencil) );
+			cmdbuf.write(_layout);
+			cmdbuf.write(_numInstanceData);
+		}
+
 		BGFX_API_FUNC(void setViewName(ViewId _id, const char* _name) )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
@@ -187,6 +187,17 @@
 #	define BGFX_CONFIG_RENDERER_USE_EXTENSIONS 1
 #endif // BGFX_CONFIG_RENDERER_USE_EXTENSIONS
 
+/// Enable capture renderer. When enabled, every renderer call is serialized
+/// into trace file, which can be replayed with `tracereplay` tool.
+#ifndef BGFX_CONFIG_RENDERER_CAPTURE
+#	define BGFX_CONFIG_RENDERER_CAPTURE 0
+#endif // BGFX_CONFIG_RENDERER_CAPTURE
+
+/// Capture renderer trace file path.
+#ifndef BGFX_CONFIG_RENDERER_CAPTURE_FILE_PATH
+#	define BGFX_CONFIG_RENDERER_CAPTURE_FILE_PATH "bgfx.trace"
+#endif // BGFX_CONFIG_RENDERER_CAPTURE_FILE_PATH
+
 /// Enable use of tinystl.
 #ifndef BGFX_CONFIG_USE_TINYSTL
 #	define BGFX_CONFIG_USE_TINYSTL 1
@@ -392,4 +403,62 @@ BX_STATIC_ASSERT(bx::isPowerOf2(BGFX_CONFIG_MAX_VIEWS), "BGFX_CONFIG_MAX_VIEWS m
 #	define BGFX_CONFIG_ENCODER_API_ONLY 0
 #endif // BGFX_CONFIG_ENCODER_API_ONLY
 
+#ifndef BGFX_CONFIG_MAX_PIPELINE_COMPILE_THREADS
+// Number of background threads used to compile pipeline state objects (Vulkan only). When 0
+// pipelines are compiled on render thread at first use.
+#	define BGFX_CONFIG_MAX_PIPELINE_COMPILE_THREADS 2
+#endif // BGFX_CONFIG_MAX_PIPELINE_COMPILE_THREADS
+
+#ifndef BGFX_CONFIG_PIPELINE_SKIP_DRAW_UNTIL_READY
+// Skip draw calls whose pipeline state object is still being compiled, instead of stalling
+// render thread until it's ready (Vulkan only).
+#	define BGFX_CONFIG_PIPELINE_SKIP_DRAW_UNTIL_READY 0
+#endif // BGFX_CONFIG_PIPELINE_SKIP_DRAW_UNTIL_READY
+
+#ifndef BGFX_CONFIG_PIPELINE_CACHE_BLOB
+// Persist whole pipeline cache as single blob through CallbackI::cacheRead/cacheWrite,
+// instead of one cache entry per pipeline (Vulkan only).
+#	define BGFX_CONFIG_PIPELINE_CACHE_BLOB 1
+#endif // BGFX_CONFIG_PIPELINE_CACHE_BLOB
+
+#ifndef BGFX_CONFIG_PIPELINE_CACHE_SAVE_INTERVAL
+// Number of frames between saving pipeline cache blob when new pipelines were compiled.
+// When 0 pipeline cache blob is saved only on shutdown.
+#	define BGFX_CONFIG_PIPELINE_CACHE_SAVE_INTERVAL 600
+#endif // BGFX_CONFIG_PIPELINE_CACHE_SAVE_INTERVAL
+
+#ifndef BGFX_CONFIG_MAX_COMMAND_RECORD_THREADS
+// Number of background threads used to record draw calls into secondary command buffers
+// (Vulkan only). When 0 all commands are recorded on render thread.
+#	define BGFX_CONFIG_MAX_COMMAND_RECORD_THREADS 3
+#endif // BGFX_CONFIG_MAX_COMMAND_RECORD_THREADS
+
+#ifndef BGFX_CONFIG_COMMAND_RECORD_MIN_DRAWS
+// Minimum number of draw calls in view before it's recorded into secondary command buffers,
+// and minimum number of draw calls per secondary command buffer (Vulkan only).
+#	define BGFX_CONFIG_COMMAND_RECORD_MIN_DRAWS 256
+#endif // BGFX_CONFIG_COMMAND_RECORD_MIN_DRAWS
+
+#ifndef BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE
+// Size of device memory block buffers and textures are sub-allocated from (Vulkan only).
+// Must be power of two.
+#	define BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE (64<<20)
+#endif // BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE
+
+#ifndef BGFX_CONFIG_DEVICE_MEMORY_MIN_ALLOC_SIZE
+// Smallest sub-allocation from device memory block (Vulkan only). Must be power of two.
+#	define BGFX_CONFIG_DEVICE_MEMORY_MIN_ALLOC_SIZE 256
+#endif // BGFX_CONFIG_DEVICE_MEMORY_MIN_ALLOC_SIZE
+
+#ifndef BGFX_CONFIG_DEVICE_MEMORY_DEDICATED_IMAGE_SIZE
+// Images of this size or larger get dedicated device memory allocation (Vulkan only).
+#	define BGFX_CONFIG_DEVICE_MEMORY_DEDICATED_IMAGE_SIZE (16<<20)
+#endif // BGFX_CONFIG_DEVICE_MEMORY_DEDICATED_IMAGE_SIZE
+
+#ifndef BGFX_CONFIG_STAGING_BUFFER_SIZE
+// Size of staging buffer per frame in flight texture and buffer uploads are copied
+// through (Vulkan only). Uploads that don't fit get dedicated staging buffer.
+#	define BGFX_CONFIG_STAGING_BUFFER_SIZE (16<<20)
+#endif // BGFX_CONFIG_STAGING_BUFFER_SIZE
+
 #endif // BGFX_CONFIG_H_HEADER_GUARD
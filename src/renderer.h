@@ -371,6 +371,28 @@ namespace bgfx
 			}
 		}
 
+		typedef bool (*FilterFn)(const Ty& _value, uint16_t _idx);
+
+		void invalidateIf(FilterFn _fn, uint16_t _idx)
+		{
+			for (uint16_t ii = 0; ii < m_alloc.getNumHandles();)
+			{
+				uint16_t handle = m_alloc.getHandleAt(ii);
+				Data& data = m_data[handle];
+
+				if (_fn(data.m_value, _idx) )
+				{
+					m_alloc.free(handle);
+					m_hashMap.erase(m_hashMap.find(data.m_hash) );
+					release(data.m_value);
+				}
+				else
+				{
+					++ii;
+				}
+			}
+		}
+
 		void invalidate()
 		{
 			for (uint16_t ii = 0, num = m_alloc.getNumHandles(); ii < num; ++ii)
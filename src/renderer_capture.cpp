@@ -0,0 +1,1947 @@
+/*
+ * Copyright 2011-2022 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include "bgfx_p.h"
+#include "renderer_capture.h"
+
+#include <bx/file.h>
+
+namespace bgfx { namespace capture
+{
+	constexpr uint32_t kTraceMagic   = BX_MAKEFOURCC('B', 'T', 'R', 0x0);
+	constexpr uint32_t kTraceVersion = 1;
+
+	struct TraceCommand
+	{
+		enum Enum
+		{
+			CreateIndexBuffer,
+			DestroyIndexBuffer,
+			CreateVertexLayout,
+			DestroyVertexLayout,
+			CreateVertexBuffer,
+			DestroyVertexBuffer,
+			CreateDynamicIndexBuffer,
+			UpdateDynamicIndexBuffer,
+			DestroyDynamicIndexBuffer,
+			CreateDynamicVertexBuffer,
+			UpdateDynamicVertexBuffer,
+			DestroyDynamicVertexBuffer,
+			CreateShader,
+			DestroyShader,
+			CreateProgram,
+			DestroyProgram,
+			CreateTexture,
+			UpdateTextureBegin,
+			UpdateTexture,
+			UpdateTextureEnd,
+			ResizeTexture,
+			DestroyTexture,
+			CreateFrameBuffer,
+			CreateWindowFrameBuffer,
+			DestroyFrameBuffer,
+			CreateUniform,
+			DestroyUniform,
+			InvalidateOcclusionQuery,
+			Submit,
+			End,
+
+			Count
+		};
+	};
+
+	// Trace stores internal structures as-is, header is used to reject traces captured with
+	// different bgfx build configuration.
+	struct TraceHeader
+	{
+		void init()
+		{
+			bx::memSet(this, 0, sizeof(TraceHeader) );
+			m_magic          = kTraceMagic;
+			m_version        = kTraceVersion;
+			m_apiVersion     = BGFX_API_VERSION;
+			m_sizeView       = sizeof(View);
+			m_sizeRenderItem = sizeof(RenderItem);
+			m_sizeRenderBind = sizeof(RenderBind);
+			m_sizeBlitItem   = sizeof(BlitItem);
+			m_maxViews       = BGFX_CONFIG_MAX_VIEWS;
+			m_maxDrawCalls   = BGFX_CONFIG_MAX_DRAW_CALLS;
+			m_maxEncoders    = g_caps.limits.maxEncoders;
+			m_rendererType   = uint8_t(g_caps.rendererType);
+		}
+
+		bool isCompatible(const TraceHeader& _header) const
+		{
+			return true
+				&& m_magic          == _header.m_magic
+				&& m_version        == _header.m_version
+				&& m_apiVersion     == _header.m_apiVersion
+				&& m_sizeView       == _header.m_sizeView
+				&& m_sizeRenderItem == _header.m_sizeRenderItem
+				&& m_sizeRenderBind == _header.m_sizeRenderBind
+				&& m_sizeBlitItem   == _header.m_sizeBlitItem
+				&& m_maxViews       == _header.m_maxViews
+				&& m_maxDrawCalls   == _header.m_maxDrawCalls
+				;
+		}
+
+		uint32_t m_magic;
+		uint32_t m_version;
+		uint32_t m_apiVersion;
+		uint32_t m_sizeView;
+		uint32_t m_sizeRenderItem;
+		uint32_t m_sizeRenderBind;
+		uint32_t m_sizeBlitItem;
+		uint32_t m_maxViews;
+		uint32_t m_maxDrawCalls;
+		uint16_t m_maxEncoders;
+		uint8_t  m_rendererType;
+	};
+
+	static bool isCompute(uint64_t _key)
+	{
+		return 0 == (_key & kSortKeyDrawBit);
+	}
+
+	static void getSortKeyProgram(uint64_t _key, uint64_t& _mask, uint8_t& _shift)
+	{
+		if (isCompute(_key) )
+		{
+			_mask  = kSortKeyComputeProgramMask;
+			_shift = kSortKeyComputeProgramShift;
+			return;
+		}
+
+		const uint64_t type = _key & kSortKeyDrawTypeMask;
+
+		if (kSortKeyDrawTypeDepth == type)
+		{
+			_mask  = kSortKeyDraw1ProgramMask;
+			_shift = kSortKeyDraw1ProgramShift;
+		}
+		else if (kSortKeyDrawTypeSequence == type)
+		{
+			_mask  = kSortKeyDraw2ProgramMask;
+			_shift = kSortKeyDraw2ProgramShift;
+		}
+		else
+		{
+			_mask  = kSortKeyDraw0ProgramMask;
+			_shift = kSortKeyDraw0ProgramShift;
+		}
+	}
+
+	struct RendererContextCapture : public RendererContextI
+	{
+		RendererContextCapture(RendererContextI* _renderCtx)
+			: m_renderCtx(_renderCtx)
+			, m_numFrames(0)
+			, m_capturing(false)
+		{
+			if (bx::open(&m_writer, BGFX_CONFIG_RENDERER_CAPTURE_FILE_PATH, false, &m_err) )
+			{
+				TraceHeader header;
+				header.init();
+				bx::write(&m_writer, header, &m_err);
+
+				m_capturing = m_err.isOk();
+
+				if (!m_capturing)
+				{
+					bx::close(&m_writer);
+				}
+			}
+
+			BX_WARN(m_capturing, "Failed to open trace file \"%s\".", BGFX_CONFIG_RENDERER_CAPTURE_FILE_PATH);
+		}
+
+		~RendererContextCapture()
+		{
+			if (beginCommand(TraceCommand::End) )
+			{
+				BX_TRACE("Captured %d frames into \"%s\".", m_numFrames, BGFX_CONFIG_RENDERER_CAPTURE_FILE_PATH);
+				bx::close(&m_writer);
+			}
+		}
+
+		bool beginCommand(TraceCommand::Enum _command)
+		{
+			if (m_capturing)
+			{
+				if (!m_err.isOk() )
+				{
+					BX_TRACE("Failed to write trace file, capture stopped after %d frames.", m_numFrames);
+					bx::close(&m_writer);
+					m_capturing = false;
+					return false;
+				}
+
+				write(uint8_t(_command) );
+			}
+
+			return m_capturing;
+		}
+
+		template<typename Ty>
+		void write(const Ty& _value)
+		{
+			bx::write(&m_writer, _value, &m_err);
+		}
+
+		void write(const void* _data, uint32_t _size)
+		{
+			if (0 < _size)
+			{
+				bx::write(&m_writer, _data, int32_t(_size), &m_err);
+			}
+		}
+
+		void write(const Memory* _mem)
+		{
+			write(_mem->size);
+			write(_mem->data, _mem->size);
+		}
+
+		void writeFrame(Frame* _render)
+		{
+			const Frame& frame = *_render;
+
+			write(frame.m_resolution);
+			write(frame.m_debug);
+			write(frame.m_viewRemap,    sizeof(frame.m_viewRemap) );
+			write(frame.m_colorPalette, sizeof(frame.m_colorPalette) );
+
+			// Only views referenced by sort keys are stored. View 0 is always used by renderers
+			// to initialize view state.
+			bool used[BGFX_CONFIG_MAX_VIEWS] = { true };
+			uint16_t numViews = 1;
+
+			const uint32_t numRenderItems = frame.m_numRenderItems;
+			for (uint32_t ii = 0; ii < numRenderItems; ++ii)
+			{
+				const ViewId view = frame.m_viewRemap[SortKey::decodeView(frame.m_sortKeys[ii])];
+				numViews += !used[view];
+				used[view] = true;
+			}
+
+			write(numViews);
+			for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_VIEWS; ++ii)
+			{
+				if (used[ii])
+				{
+					write(ViewId(ii) );
+					write(frame.m_view[ii]);
+				}
+			}
+
+			write(numRenderItems);
+			write(frame.m_sortKeys,       uint32_t(numRenderItems*sizeof(uint64_t) ) );
+			write(frame.m_sortValues,     uint32_t(numRenderItems*sizeof(RenderItemCount) ) );
+			write(frame.m_renderItem,     uint32_t(numRenderItems*sizeof(RenderItem) ) );
+			write(frame.m_renderItemBind, uint32_t(numRenderItems*sizeof(RenderBind) ) );
+
+			const uint16_t numBlitItems = frame.m_numBlitItems;
+			write(numBlitItems);
+			write(frame.m_blitKeys, uint32_t(numBlitItems*sizeof(uint32_t) ) );
+			write(frame.m_blitItem, uint32_t(numBlitItems*sizeof(BlitItem) ) );
+
+			const MatrixCache& matrixCache = frame.m_frameCache.m_matrixCache;
+			write(matrixCache.m_num);
+			write(matrixCache.m_cache, uint32_t(matrixCache.m_num*sizeof(Matrix4) ) );
+
+			const RectCache& rectCache = frame.m_frameCache.m_rectCache;
+			write(rectCache.m_num);
+			write(rectCache.m_cache, uint32_t(rectCache.m_num*sizeof(Rect) ) );
+
+			// Uniform buffers are already finished at this point, used size is derived from
+			// uniform ranges of render items.
+			const uint32_t maxEncoders = g_caps.limits.maxEncoders;
+			uint32_t* uniformEnd = (uint32_t*)alloca(sizeof(uint32_t)*maxEncoders);
+			bx::memSet(uniformEnd, 0, sizeof(uint32_t)*maxEncoders);
+
+			for (uint32_t ii = 0; ii < numRenderItems; ++ii)
+			{
+				const RenderItem& renderItem = frame.m_renderItem[frame.m_sortValues[ii] ];
+
+				uint8_t  uniformIdx;
+				uint32_t end;
+
+				if (isCompute(frame.m_sortKeys[ii]) )
+				{
+					uniformIdx = renderItem.compute.m_uniformIdx;
+					end        = renderItem.compute.m_uniformEnd;
+				}
+				else
+				{
+					uniformIdx = renderItem.draw.m_uniformIdx;
+					end        = renderItem.draw.m_uniformEnd;
+				}
+
+				if (uniformIdx < maxEncoders)
+				{
+					uniformEnd[uniformIdx] = bx::max(uniformEnd[uniformIdx], end);
+				}
+			}
+
+			uint8_t numUniformBuffers = 0;
+			for (uint32_t ii = 0; ii < maxEncoders; ++ii)
+			{
+				numUniformBuffers += 0 != uniformEnd[ii];
+			}
+
+			write(numUniformBuffers);
+			for (uint32_t ii = 0; ii < maxEncoders; ++ii)
+			{
+				const uint32_t size = uniformEnd[ii];
+
+				if (0 != size)
+				{
+					UniformBuffer* uniformBuffer = frame.m_uniformBuffer[ii];
+					uniformBuffer->reset();
+
+					write(uint8_t(ii) );
+					write(size);
+					write(uniformBuffer->read(size), size);
+
+					uniformBuffer->reset();
+				}
+			}
+
+			write(frame.m_iboffset);
+			if (0 < frame.m_iboffset)
+			{
+				write(frame.m_transientIb->handle);
+				write(frame.m_transientIb->data, frame.m_iboffset);
+			}
+
+			write(frame.m_vboffset);
+			if (0 < frame.m_vboffset)
+			{
+				write(frame.m_transientVb->handle);
+				write(frame.m_transientVb->data, frame.m_vboffset);
+			}
+		}
+
+		RendererType::Enum getRendererType() const override
+		{
+			return m_renderCtx->getRendererType();
+		}
+
+		const char* getRendererName() const override
+		{
+			return m_renderCtx->getRendererName();
+		}
+
+		bool isDeviceRemoved() override
+		{
+			return m_renderCtx->isDeviceRemoved();
+		}
+
+		void flip() override
+		{
+			m_renderCtx->flip();
+		}
+
+		void createIndexBuffer(IndexBufferHandle _handle, const Memory* _mem, uint16_t _flags) override
+		{
+			if (beginCommand(TraceCommand::CreateIndexBuffer) )
+			{
+				write(_handle);
+				write(_flags);
+				write(_mem);
+			}
+
+			m_renderCtx->createIndexBuffer(_handle, _mem, _flags);
+		}
+
+		void destroyIndexBuffer(IndexBufferHandle _handle) override
+		{
+			if (beginCommand(TraceCommand::DestroyIndexBuffer) )
+			{
+				write(_handle);
+			}
+
+			m_renderCtx->destroyIndexBuffer(_handle);
+		}
+
+		void createVertexLayout(VertexLayoutHandle _handle, const VertexLayout& _layout) override
+		{
+			if (beginCommand(TraceCommand::CreateVertexLayout) )
+			{
+				write(_handle);
+				write(_layout);
+			}
+
+			m_renderCtx->createVertexLayout(_handle, _layout);
+		}
+
+		void destroyVertexLayout(VertexLayoutHandle _handle) override
+		{
+			if (beginCommand(TraceCommand::DestroyVertexLayout) )
+			{
+				write(_handle);
+			}
+
+			m_renderCtx->destroyVertexLayout(_handle);
+		}
+
+		void createVertexBuffer(VertexBufferHandle _handle, const Memory* _mem, VertexLayoutHandle _layoutHandle, uint16_t _flags) override
+		{
+			if (beginCommand(TraceCommand::CreateVertexBuffer) )
+			{
+				write(_handle);
+				write(_layoutHandle);
+				write(_flags);
+				write(_mem);
+			}
+
+			m_renderCtx->createVertexBuffer(_handle, _mem, _layoutHandle, _flags);
+		}
+
+		void destroyVertexBuffer(VertexBufferHandle _handle) override
+		{
+			if (beginCommand(TraceCommand::DestroyVertexBuffer) )
+			{
+				write(_handle);
+			}
+
+			m_renderCtx->destroyVertexBuffer(_handle);
+		}
+
+		void createDynamicIndexBuffer(IndexBufferHandle _handle, uint32_t _size, uint16_t _flags) override
+		{
+			if (beginCommand(TraceCommand::CreateDynamicIndexBuffer) )
+			{
+				write(_handle);
+				write(_size);
+				write(_flags);
+			}
+
+			m_renderCtx->createDynamicIndexBuffer(_handle, _size, _flags);
+		}
+
+		void updateDynamicIndexBuffer(IndexBufferHandle _handle, uint32_t _offset, uint32_t _size, const Memory* _mem) override
+		{
+			if (beginCommand(TraceCommand::UpdateDynamicIndexBuffer) )
+			{
+				write(_handle);
+				write(_offset);
+				write(_size);
+				write(_mem);
+			}
+
+			m_renderCtx->updateDynamicIndexBuffer(_handle, _offset, _size, _mem);
+		}
+
+		void destroyDynamicIndexBuffer(IndexBufferHandle _handle) override
+		{
+			if (beginCommand(TraceCommand::DestroyDynamicIndexBuffer) )
+			{
+				write(_handle);
+			}
+
+			m_renderCtx->destroyDynamicIndexBuffer(_handle);
+		}
+
+		void createDynamicVertexBuffer(VertexBufferHandle _handle, uint32_t _size, uint16_t _flags) override
+		{
+			if (beginCommand(TraceCommand::CreateDynamicVertexBuffer) )
+			{
+				write(_handle);
+				write(_size);
+				write(_flags);
+			}
+
+			m_renderCtx->createDynamicVertexBuffer(_handle, _size, _flags);
+		}
+
+		void updateDynamicVertexBuffer(VertexBufferHandle _handle, uint32_t _offset, uint32_t _size, const Memory* _mem) override
+		{
+			if (beginCommand(TraceCommand::UpdateDynamicVertexBuffer) )
+			{
+				write(_handle);
+				write(_offset);
+				write(_size);
+				write(_mem);
+			}
+
+			m_renderCtx->updateDynamicVertexBuffer(_handle, _offset, _size, _mem);
+		}
+
+		void destroyDynamicVertexBuffer(VertexBufferHandle _handle) override
+		{
+			if (beginCommand(TraceCommand::DestroyDynamicVertexBuffer) )
+			{
+				write(_handle);
+			}
+
+			m_renderCtx->destroyDynamicVertexBuffer(_handle);
+		}
+
+		void createShader(ShaderHandle _handle, const Memory* _mem) override
+		{
+			if (beginCommand(TraceCommand::CreateShader) )
+			{
+				write(_handle);
+				write(_mem);
+			}
+
+			m_renderCtx->createShader(_handle, _mem);
+		}
+
+		void destroyShader(ShaderHandle _handle) override
+		{
+			if (beginCommand(TraceCommand::DestroyShader) )
+			{
+				write(_handle);
+			}
+
+			m_renderCtx->destroyShader(_handle);
+		}
+
+		void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh) override
+		{
+			if (beginCommand(TraceCommand::CreateProgram) )
+			{
+				write(_handle);
+				write(_vsh);
+				write(_fsh);
+			}
+
+			m_renderCtx->createProgram(_handle, _vsh, _fsh);
+		}
+
+		void destroyProgram(ProgramHandle _handle) override
+		{
+			if (beginCommand(TraceCommand::DestroyProgram) )
+			{
+				write(_handle);
+			}
+
+			m_renderCtx->destroyProgram(_handle);
+		}
+
+		void* createTexture(TextureHandle _handle, const Memory* _mem, uint64_t _flags, uint8_t _skip) override
+		{
+			if (beginCommand(TraceCommand::CreateTexture) )
+			{
+				write(_handle);
+				write(_flags);
+				write(_skip);
+				write(_mem);
+			}
+
+			return m_renderCtx->createTexture(_handle, _mem, _flags, _skip);
+		}
+
+		void updateTextureBegin(TextureHandle _handle, uint8_t _side, uint8_t _mip) override
+		{
+			if (beginCommand(TraceCommand::UpdateTextureBegin) )
+			{
+				write(_handle);
+				write(_side);
+				write(_mip);
+			}
+
+			m_renderCtx->updateTextureBegin(_handle, _side, _mip);
+		}
+
+		void updateTexture(TextureHandle _handle, uint8_t _side, uint8_t _mip, const Rect& _rect, uint16_t _z, uint16_t _depth, uint16_t _pitch, const Memory* _mem) override
+		{
+			if (beginCommand(TraceCommand::UpdateTexture) )
+			{
+				write(_handle);
+				write(_side);
+				write(_mip);
+				write(_rect);
+				write(_z);
+				write(_depth);
+				write(_pitch);
+				write(_mem);
+			}
+
+			m_renderCtx->updateTexture(_handle, _side, _mip, _rect, _z, _depth, _pitch, _mem);
+		}
+
+		void updateTextureEnd() override
+		{
+			beginCommand(TraceCommand::UpdateTextureEnd);
+
+			m_renderCtx->updateTextureEnd();
+		}
+
+		void readTexture(TextureHandle _handle, void* _data, uint8_t _mip) override
+		{
+			m_renderCtx->readTexture(_handle, _data, _mip);
+		}
+
+		void resizeTexture(TextureHandle _handle, uint16_t _width, uint16_t _height, uint8_t _numMips, uint16_t _numLayers) override
+		{
+			if (beginCommand(TraceCommand::ResizeTexture) )
+			{
+				write(_handle);
+				write(_width);
+				write(_height);
+				write(_numMips);
+				write(_numLayers);
+			}
+
+			m_renderCtx->resizeTexture(_handle, _width, _height, _numMips, _numLayers);
+		}
+
+		void overrideInternal(TextureHandle _handle, uintptr_t _ptr) override
+		{
+			m_renderCtx->overrideInternal(_handle, _ptr);
+		}
+
+		uintptr_t getInternal(TextureHandle _handle) override
+		{
+			return m_renderCtx->getInternal(_handle);
+		}
+
+		void destroyTexture(TextureHandle _handle) override
+		{
+			if (beginCommand(TraceCommand::DestroyTexture) )
+			{
+				write(_handle);
+			}
+
+			m_renderCtx->destroyTexture(_handle);
+		}
+
+		void createFrameBuffer(FrameBufferHandle _handle, uint8_t _num, const Attachment* _attachment) override
+		{
+			if (beginCommand(TraceCommand::CreateFrameBuffer) )
+			{
+				write(_handle);
+				write(_num);
+				write(_attachment, uint32_t(_num*sizeof(Attachment) ) );
+			}
+
+			m_renderCtx->createFrameBuffer(_handle, _num, _attachment);
+		}
+
+		void createFrameBuffer(FrameBufferHandle _handle, void* _nwh, uint32_t _width, uint32_t _height, TextureFormat::Enum _format, TextureFormat::Enum _depthFormat) override
+		{
+			if (beginCommand(TraceCommand::CreateWindowFrameBuffer) )
+			{
+				write(_handle);
+				write(_width);
+				write(_height);
+				write(uint8_t(_format) );
+				write(uint8_t(_depthFormat) );
+			}
+
+			m_renderCtx->createFrameBuffer(_handle, _nwh, _width, _height, _format, _depthFormat);
+		}
+
+		void destroyFrameBuffer(FrameBufferHandle _handle) override
+		{
+			if (beginCommand(TraceCommand::DestroyFrameBuffer) )
+			{
+				write(_handle);
+			}
+
+			m_renderCtx->destroyFrameBuffer(_handle);
+		}
+
+		void createUniform(UniformHandle _handle, UniformType::Enum _type, uint16_t _num, const char* _name) override
+		{
+			if (beginCommand(TraceCommand::CreateUniform) )
+			{
+				const uint16_t len = uint16_t(bx::strLen(_name) );
+
+				write(_handle);
+				write(uint8_t(_type) );
+				write(_num);
+				write(len);
+				write(_name, len);
+			}
+
+			m_renderCtx->createUniform(_handle, _type, _num, _name);
+		}
+
+		void destroyUniform(UniformHandle _handle) override
+		{
+			if (beginCommand(TraceCommand::DestroyUniform) )
+			{
+				write(_handle);
+			}
+
+			m_renderCtx->destroyUniform(_handle);
+		}
+
+		void requestScreenShot(FrameBufferHandle _handle, const char* _filePath) override
+		{
+			m_renderCtx->requestScreenShot(_handle, _filePath);
+		}
+
+		void updateViewName(ViewId _id, const char* _name) override
+		{
+			m_renderCtx->updateViewName(_id, _name);
+		}
+
+		void updateUniform(uint16_t _loc, const void* _data, uint32_t _size) override
+		{
+			m_renderCtx->updateUniform(_loc, _data, _size);
+		}
+
+		void invalidateOcclusionQuery(OcclusionQueryHandle _handle) override
+		{
+			if (beginCommand(TraceCommand::InvalidateOcclusionQuery) )
+			{
+				write(_handle);
+			}
+
+			m_renderCtx->invalidateOcclusionQuery(_handle);
+		}
+
+		void setMarker(const char* _marker, uint16_t _len) override
+		{
+			m_renderCtx->setMarker(_marker, _len);
+		}
+
+		void setName(Handle _handle, const char* _name, uint16_t _len) override
+		{
+			m_renderCtx->setName(_handle, _name, _len);
+		}
+
+		void submit(Frame* _render, ClearQuad& _clearQuad, TextVideoMemBlitter& _textVideoMemBlitter) override
+		{
+			if (beginCommand(TraceCommand::Submit) )
+			{
+				writeFrame(_render);
+				++m_numFrames;
+			}
+
+			m_renderCtx->submit(_render, _clearQuad, _textVideoMemBlitter);
+		}
+
+		void blitSetup(TextVideoMemBlitter& _blitter) override
+		{
+			m_renderCtx->blitSetup(_blitter);
+		}
+
+		void blitRender(TextVideoMemBlitter& _blitter, uint32_t _numIndices) override
+		{
+			m_renderCtx->blitRender(_blitter, _numIndices);
+		}
+
+		void prewarmPipeline(FrameBufferHandle _fbh, ProgramHandle _program, uint64_t _state, uint64_t _stencil, const VertexLayout& _layout, uint8_t _numInstanceData) override
+		{
+			m_renderCtx->prewarmPipeline(_fbh, _program, _state, _stencil, _layout, _numInstanceData);
+		}
+
+		void setupRaytracing() override
+		{
+			m_renderCtx->setupRaytracing();
+		}
+
+		void initRayTracingScene(const char* filename) override
+		{
+			m_renderCtx->initRayTracingScene(filename);
+		}
+
+		void createRtScene(VertexBufferHandle _vbh, IndexBufferHandle _ibh) override
+		{
+			m_renderCtx->createRtScene(_vbh, _ibh);
+		}
+
+		RendererContextI* m_renderCtx;
+		bx::FileWriter m_writer;
+		bx::Error m_err;
+		uint32_t m_numFrames;
+		bool m_capturing;
+	};
+
+	RendererContextI* rendererCreate(RendererContextI* _renderCtx)
+	{
+		return BX_NEW(g_allocator, RendererContextCapture)(_renderCtx);
+	}
+
+	RendererContextI* rendererDestroy(RendererContextI* _renderCtx)
+	{
+		RendererContextCapture* capture = static_cast<RendererContextCapture*>(_renderCtx);
+		RendererContextI* renderCtx = capture->m_renderCtx;
+		BX_DELETE(g_allocator, capture);
+		return renderCtx;
+	}
+
+	constexpr uint8_t kRemapDynamic = 0x1;
+	constexpr uint8_t kRemapAlias   = 0x2;
+
+	// Maps handles recorded in trace to handles allocated from context, so that replayed
+	// resources don't collide with resources owned by context (debug text, clear quad, etc.).
+	template<uint16_t MaxHandlesT>
+	struct HandleRemapT
+	{
+		void init(bx::HandleAlloc* _handleAlloc)
+		{
+			m_handleAlloc = _handleAlloc;
+			bx::memSet(m_remap, 0xff, sizeof(m_remap) );
+			bx::memSet(m_flags, 0,    sizeof(m_flags) );
+		}
+
+		uint16_t create(uint16_t _idx, uint8_t _flags = 0)
+		{
+			if (_idx >= MaxHandlesT)
+			{
+				return kInvalidHandle;
+			}
+
+			if (kInvalidHandle == m_remap[_idx])
+			{
+				m_remap[_idx] = m_handleAlloc->alloc();
+				m_flags[_idx] = _flags;
+			}
+
+			return m_remap[_idx];
+		}
+
+		void alias(uint16_t _idx, uint16_t _handle)
+		{
+			if (_idx < MaxHandlesT)
+			{
+				m_remap[_idx] = _handle;
+				m_flags[_idx] = kRemapAlias;
+			}
+		}
+
+		uint16_t find(uint16_t _idx) const
+		{
+			return _idx < MaxHandlesT ? m_remap[_idx] : kInvalidHandle;
+		}
+
+		uint8_t getFlags(uint16_t _idx) const
+		{
+			return _idx < MaxHandlesT ? m_flags[_idx] : 0;
+		}
+
+		uint16_t destroy(uint16_t _idx)
+		{
+			const uint16_t handle = find(_idx);
+
+			if (kInvalidHandle != handle)
+			{
+				if (0 == (m_flags[_idx] & kRemapAlias) )
+				{
+					m_handleAlloc->free(handle);
+				}
+
+				m_remap[_idx] = kInvalidHandle;
+				m_flags[_idx] = 0;
+			}
+
+			return handle;
+		}
+
+		bx::HandleAlloc* m_handleAlloc;
+		uint16_t m_remap[MaxHandlesT];
+		uint8_t  m_flags[MaxHandlesT];
+	};
+
+	class TraceReplay
+	{
+	public:
+		TraceReplay(Context* _ctx, FrameBufferHandle _backBuffer)
+			: m_ctx(_ctx)
+			, m_reader(NULL)
+			, m_backBuffer(_backBuffer)
+		{
+			m_indexBuffer.init(&_ctx->m_indexBufferHandle);
+			m_layout.init(&_ctx->m_layoutHandle);
+			m_vertexBuffer.init(&_ctx->m_vertexBufferHandle);
+			m_shader.init(&_ctx->m_shaderHandle);
+			m_program.init(&_ctx->m_programHandle);
+			m_texture.init(&_ctx->m_textureHandle);
+			m_frameBuffer.init(&_ctx->m_frameBufferHandle);
+			m_uniform.init(&_ctx->m_uniformHandle);
+			m_occlusionQuery.init(&_ctx->m_occlusionQueryHandle);
+
+			bx::memSet(&m_transientIb, 0, sizeof(m_transientIb) );
+			bx::memSet(&m_transientVb, 0, sizeof(m_transientVb) );
+
+			m_frame = BX_ALIGNED_NEW(g_allocator, Frame, Context::kAlignment);
+			m_frame->create(BGFX_CONFIG_MIN_RESOURCE_COMMAND_BUFFER_SIZE);
+			m_frame->m_transientIb = &m_transientIb;
+			m_frame->m_transientVb = &m_transientVb;
+		}
+
+		~TraceReplay()
+		{
+			destroyResources();
+
+			m_frame->destroy();
+			BX_ALIGNED_DELETE(g_allocator, m_frame, Context::kAlignment);
+		}
+
+		bool readHeader(bx::ReaderI* _reader)
+		{
+			m_reader = _reader;
+			m_err.reset();
+
+			TraceHeader header;
+			bx::memSet(&header, 0, sizeof(header) );
+			read(header);
+
+			TraceHeader expected;
+			expected.init();
+
+			if (!m_err.isOk()
+			||  !expected.isCompatible(header) )
+			{
+				BX_TRACE("Trace file is not compatible with this build of bgfx.");
+				return false;
+			}
+
+			BX_TRACE("Replaying trace captured with %s renderer (active renderer %s)."
+				, getRendererName(RendererType::Enum(bx::min<uint8_t>(header.m_rendererType, RendererType::Count-1) ) )
+				, getRendererName(g_caps.rendererType)
+				);
+
+			return true;
+		}
+
+		bool run(bx::ReaderI* _reader, ReplayStats& _stats)
+		{
+			m_reader = _reader;
+			m_err.reset();
+
+			RendererContextI* renderCtx = m_ctx->m_renderCtx;
+
+			for (;;)
+			{
+				uint8_t command = TraceCommand::End;
+				read(command);
+
+				if (!m_err.isOk() )
+				{
+					BX_TRACE("Trace file is truncated.");
+					return false;
+				}
+
+				switch (command)
+				{
+				case TraceCommand::CreateIndexBuffer:
+					{
+						IndexBufferHandle handle;
+						read(handle);
+
+						uint16_t flags;
+						read(flags);
+
+						const Memory* mem = readMemory();
+
+						handle.idx = m_indexBuffer.create(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->createIndexBuffer(handle, mem, flags);
+						}
+					}
+					break;
+
+				case TraceCommand::DestroyIndexBuffer:
+				case TraceCommand::DestroyDynamicIndexBuffer:
+					{
+						IndexBufferHandle handle;
+						read(handle);
+
+						const bool dynamic = 0 != (m_indexBuffer.getFlags(handle.idx) & kRemapDynamic);
+						handle.idx = m_indexBuffer.destroy(handle.idx);
+						if (isValid(handle) )
+						{
+							if (dynamic)
+							{
+								renderCtx->destroyDynamicIndexBuffer(handle);
+							}
+							else
+							{
+								renderCtx->destroyIndexBuffer(handle);
+							}
+						}
+					}
+					break;
+
+				case TraceCommand::CreateVertexLayout:
+					{
+						VertexLayoutHandle handle;
+						read(handle);
+
+						VertexLayout layout;
+						read(layout);
+
+						handle.idx = m_layout.create(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->createVertexLayout(handle, layout);
+						}
+					}
+					break;
+
+				case TraceCommand::DestroyVertexLayout:
+					{
+						VertexLayoutHandle handle;
+						read(handle);
+
+						handle.idx = m_layout.destroy(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->destroyVertexLayout(handle);
+						}
+					}
+					break;
+
+				case TraceCommand::CreateVertexBuffer:
+					{
+						VertexBufferHandle handle;
+						read(handle);
+
+						VertexLayoutHandle layoutHandle;
+						read(layoutHandle);
+
+						uint16_t flags;
+						read(flags);
+
+						const Memory* mem = readMemory();
+
+						handle.idx       = m_vertexBuffer.create(handle.idx);
+						layoutHandle.idx = m_layout.find(layoutHandle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->createVertexBuffer(handle, mem, layoutHandle, flags);
+						}
+					}
+					break;
+
+				case TraceCommand::DestroyVertexBuffer:
+				case TraceCommand::DestroyDynamicVertexBuffer:
+					{
+						VertexBufferHandle handle;
+						read(handle);
+
+						const bool dynamic = 0 != (m_vertexBuffer.getFlags(handle.idx) & kRemapDynamic);
+						handle.idx = m_vertexBuffer.destroy(handle.idx);
+						if (isValid(handle) )
+						{
+							if (dynamic)
+							{
+								renderCtx->destroyDynamicVertexBuffer(handle);
+							}
+							else
+							{
+								renderCtx->destroyVertexBuffer(handle);
+							}
+						}
+					}
+					break;
+
+				case TraceCommand::CreateDynamicIndexBuffer:
+					{
+						IndexBufferHandle handle;
+						read(handle);
+
+						uint32_t size;
+						read(size);
+
+						uint16_t flags;
+						read(flags);
+
+						handle.idx = m_indexBuffer.create(handle.idx, kRemapDynamic);
+						if (isValid(handle) )
+						{
+							renderCtx->createDynamicIndexBuffer(handle, size, flags);
+						}
+					}
+					break;
+
+				case TraceCommand::UpdateDynamicIndexBuffer:
+					{
+						IndexBufferHandle handle;
+						read(handle);
+
+						uint32_t offset;
+						read(offset);
+
+						uint32_t size;
+						read(size);
+
+						const Memory* mem = readMemory();
+
+						handle.idx = m_indexBuffer.find(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->updateDynamicIndexBuffer(handle, offset, size, mem);
+						}
+					}
+					break;
+
+				case TraceCommand::CreateDynamicVertexBuffer:
+					{
+						VertexBufferHandle handle;
+						read(handle);
+
+						uint32_t size;
+						read(size);
+
+						uint16_t flags;
+						read(flags);
+
+						handle.idx = m_vertexBuffer.create(handle.idx, kRemapDynamic);
+						if (isValid(handle) )
+						{
+							renderCtx->createDynamicVertexBuffer(handle, size, flags);
+						}
+					}
+					break;
+
+				case TraceCommand::UpdateDynamicVertexBuffer:
+					{
+						VertexBufferHandle handle;
+						read(handle);
+
+						uint32_t offset;
+						read(offset);
+
+						uint32_t size;
+						read(size);
+
+						const Memory* mem = readMemory();
+
+						handle.idx = m_vertexBuffer.find(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->updateDynamicVertexBuffer(handle, offset, size, mem);
+						}
+					}
+					break;
+
+				case TraceCommand::CreateShader:
+					{
+						ShaderHandle handle;
+						read(handle);
+
+						const Memory* mem = readMemory();
+
+						handle.idx = m_shader.create(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->createShader(handle, mem);
+						}
+					}
+					break;
+
+				case TraceCommand::DestroyShader:
+					{
+						ShaderHandle handle;
+						read(handle);
+
+						handle.idx = m_shader.destroy(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->destroyShader(handle);
+						}
+					}
+					break;
+
+				case TraceCommand::CreateProgram:
+					{
+						ProgramHandle handle;
+						read(handle);
+
+						ShaderHandle vsh;
+						read(vsh);
+
+						ShaderHandle fsh;
+						read(fsh);
+
+						handle.idx = m_program.create(handle.idx);
+						vsh.idx    = m_shader.find(vsh.idx);
+						fsh.idx    = m_shader.find(fsh.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->createProgram(handle, vsh, fsh);
+						}
+					}
+					break;
+
+				case TraceCommand::DestroyProgram:
+					{
+						ProgramHandle handle;
+						read(handle);
+
+						handle.idx = m_program.destroy(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->destroyProgram(handle);
+						}
+					}
+					break;
+
+				case TraceCommand::CreateTexture:
+					{
+						TextureHandle handle;
+						read(handle);
+
+						uint64_t flags;
+						read(flags);
+
+						uint8_t skip;
+						read(skip);
+
+						const Memory* mem = readMemory();
+
+						handle.idx = m_texture.create(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->createTexture(handle, mem, flags, skip);
+						}
+					}
+					break;
+
+				case TraceCommand::UpdateTextureBegin:
+					{
+						TextureHandle handle;
+						read(handle);
+
+						uint8_t side;
+						read(side);
+
+						uint8_t mip;
+						read(mip);
+
+						handle.idx = m_texture.find(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->updateTextureBegin(handle, side, mip);
+						}
+					}
+					break;
+
+				case TraceCommand::UpdateTexture:
+					{
+						TextureHandle handle;
+						read(handle);
+
+						uint8_t side;
+						read(side);
+
+						uint8_t mip;
+						read(mip);
+
+						Rect rect;
+						read(rect);
+
+						uint16_t zz;
+						read(zz);
+
+						uint16_t depth;
+						read(depth);
+
+						uint16_t pitch;
+						read(pitch);
+
+						const Memory* mem = readMemory();
+
+						handle.idx = m_texture.find(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->updateTexture(handle, side, mip, rect, zz, depth, pitch, mem);
+						}
+					}
+					break;
+
+				case TraceCommand::UpdateTextureEnd:
+					renderCtx->updateTextureEnd();
+					break;
+
+				case TraceCommand::ResizeTexture:
+					{
+						TextureHandle handle;
+						read(handle);
+
+						uint16_t width;
+						read(width);
+
+						uint16_t height;
+						read(height);
+
+						uint8_t numMips;
+						read(numMips);
+
+						uint16_t numLayers;
+						read(numLayers);
+
+						handle.idx = m_texture.find(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->resizeTexture(handle, width, height, numMips, numLayers);
+						}
+					}
+					break;
+
+				case TraceCommand::DestroyTexture:
+					{
+						TextureHandle handle;
+						read(handle);
+
+						handle.idx = m_texture.destroy(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->destroyTexture(handle);
+						}
+					}
+					break;
+
+				case TraceCommand::CreateFrameBuffer:
+					{
+						FrameBufferHandle handle;
+						read(handle);
+
+						uint8_t num;
+						read(num);
+
+						if (num > BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS)
+						{
+							BX_TRACE("Invalid number of frame buffer attachments %d.", num);
+							return false;
+						}
+
+						Attachment attachment[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS];
+						read(attachment, uint32_t(num*sizeof(Attachment) ) );
+
+						for (uint32_t ii = 0; ii < num; ++ii)
+						{
+							attachment[ii].handle.idx = m_texture.find(attachment[ii].handle.idx);
+						}
+
+						handle.idx = m_frameBuffer.create(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->createFrameBuffer(handle, num, attachment);
+						}
+					}
+					break;
+
+				case TraceCommand::CreateWindowFrameBuffer:
+					{
+						FrameBufferHandle handle;
+						read(handle);
+
+						uint32_t width;
+						read(width);
+
+						uint32_t height;
+						read(height);
+
+						uint8_t format;
+						read(format);
+
+						uint8_t depthFormat;
+						read(depthFormat);
+
+						// Native window handles can't be replayed, window frame buffers are
+						// redirected to back buffer.
+						m_frameBuffer.alias(handle.idx, m_backBuffer.idx);
+					}
+					break;
+
+				case TraceCommand::DestroyFrameBuffer:
+					{
+						FrameBufferHandle handle;
+						read(handle);
+
+						const bool alias = 0 != (m_frameBuffer.getFlags(handle.idx) & kRemapAlias);
+						handle.idx = m_frameBuffer.destroy(handle.idx);
+						if (isValid(handle)
+						&&  !alias)
+						{
+							renderCtx->destroyFrameBuffer(handle);
+						}
+					}
+					break;
+
+				case TraceCommand::CreateUniform:
+					{
+						UniformHandle handle;
+						read(handle);
+
+						uint8_t type;
+						read(type);
+
+						uint16_t num;
+						read(num);
+
+						uint16_t len;
+						read(len);
+
+						char name[256];
+						if (len >= BX_COUNTOF(name) )
+						{
+							BX_TRACE("Invalid uniform name length %d.", len);
+							return false;
+						}
+
+						read(name, len);
+						name[len] = '\0';
+
+						handle.idx = m_uniform.create(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->createUniform(handle, UniformType::Enum(type), num, name);
+						}
+					}
+					break;
+
+				case TraceCommand::DestroyUniform:
+					{
+						UniformHandle handle;
+						read(handle);
+
+						handle.idx = m_uniform.destroy(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->destroyUniform(handle);
+						}
+					}
+					break;
+
+				case TraceCommand::InvalidateOcclusionQuery:
+					{
+						OcclusionQueryHandle handle;
+						read(handle);
+
+						handle.idx = m_occlusionQuery.destroy(handle.idx);
+						if (isValid(handle) )
+						{
+							renderCtx->invalidateOcclusionQuery(handle);
+						}
+					}
+					break;
+
+				case TraceCommand::Submit:
+					{
+						if (!readFrame() )
+						{
+							return false;
+						}
+
+						const int64_t submitBegin = bx::getHPCounter();
+						renderCtx->submit(m_frame, m_ctx->m_clearQuad, m_ctx->m_textVideoMemBlitter);
+						const int64_t flipBegin = bx::getHPCounter();
+						renderCtx->flip();
+						const int64_t flipEnd = bx::getHPCounter();
+
+						const int64_t submitTime = flipBegin - submitBegin;
+						_stats.submitTime   += submitTime;
+						_stats.submitTimeMin = bx::min(_stats.submitTimeMin, submitTime);
+						_stats.submitTimeMax = bx::max(_stats.submitTimeMax, submitTime);
+						_stats.flipTime     += flipEnd - flipBegin;
+						++_stats.numFrames;
+					}
+					continue;
+
+				case TraceCommand::End:
+					return m_err.isOk();
+
+				default:
+					BX_TRACE("Invalid trace command %d.", command);
+					return false;
+				}
+
+				++_stats.numCommands;
+			}
+		}
+
+		void destroyResources()
+		{
+			RendererContextI* renderCtx = m_ctx->m_renderCtx;
+
+			for (uint16_t ii = 0; ii < BGFX_CONFIG_MAX_PROGRAMS; ++ii)
+			{
+				ProgramHandle handle = { m_program.destroy(ii) };
+				if (isValid(handle) )
+				{
+					renderCtx->destroyProgram(handle);
+				}
+			}
+
+			for (uint16_t ii = 0; ii < BGFX_CONFIG_MAX_SHADERS; ++ii)
+			{
+				ShaderHandle handle = { m_shader.destroy(ii) };
+				if (isValid(handle) )
+				{
+					renderCtx->destroyShader(handle);
+				}
+			}
+
+			for (uint16_t ii = 0; ii < BGFX_CONFIG_MAX_FRAME_BUFFERS; ++ii)
+			{
+				const bool alias = 0 != (m_frameBuffer.getFlags(ii) & kRemapAlias);
+				FrameBufferHandle handle = { m_frameBuffer.destroy(ii) };
+				if (isValid(handle)
+				&&  !alias)
+				{
+					renderCtx->destroyFrameBuffer(handle);
+				}
+			}
+
+			for (uint16_t ii = 0; ii < BGFX_CONFIG_MAX_TEXTURES; ++ii)
+			{
+				TextureHandle handle = { m_texture.destroy(ii) };
+				if (isValid(handle) )
+				{
+					renderCtx->destroyTexture(handle);
+				}
+			}
+
+			for (uint16_t ii = 0; ii < BGFX_CONFIG_MAX_UNIFORMS; ++ii)
+			{
+				UniformHandle handle = { m_uniform.destroy(ii) };
+				if (isValid(handle) )
+				{
+					renderCtx->destroyUniform(handle);
+				}
+			}
+
+			for (uint16_t ii = 0; ii < BGFX_CONFIG_MAX_INDEX_BUFFERS; ++ii)
+			{
+				const bool dynamic = 0 != (m_indexBuffer.getFlags(ii) & kRemapDynamic);
+				IndexBufferHandle handle = { m_indexBuffer.destroy(ii) };
+				if (isValid(handle) )
+				{
+					if (dynamic)
+					{
+						renderCtx->destroyDynamicIndexBuffer(handle);
+					}
+					else
+					{
+						renderCtx->destroyIndexBuffer(handle);
+					}
+				}
+			}
+
+			for (uint16_t ii = 0; ii < BGFX_CONFIG_MAX_VERTEX_BUFFERS; ++ii)
+			{
+				const bool dynamic = 0 != (m_vertexBuffer.getFlags(ii) & kRemapDynamic);
+				VertexBufferHandle handle = { m_vertexBuffer.destroy(ii) };
+				if (isValid(handle) )
+				{
+					if (dynamic)
+					{
+						renderCtx->destroyDynamicVertexBuffer(handle);
+					}
+					else
+					{
+						renderCtx->destroyVertexBuffer(handle);
+					}
+				}
+			}
+
+			for (uint16_t ii = 0; ii < BGFX_CONFIG_MAX_VERTEX_LAYOUTS; ++ii)
+			{
+				VertexLayoutHandle handle = { m_layout.destroy(ii) };
+				if (isValid(handle) )
+				{
+					renderCtx->destroyVertexLayout(handle);
+				}
+			}
+
+			for (uint16_t ii = 0; ii < BGFX_CONFIG_MAX_OCCLUSION_QUERIES; ++ii)
+			{
+				OcclusionQueryHandle handle = { m_occlusionQuery.destroy(ii) };
+				if (isValid(handle) )
+				{
+					renderCtx->invalidateOcclusionQuery(handle);
+				}
+			}
+		}
+
+	private:
+		template<typename Ty>
+		void read(Ty& _value)
+		{
+			if (m_err.isOk() )
+			{
+				bx::read(m_reader, _value, &m_err);
+			}
+		}
+
+		void read(void* _data, uint32_t _size)
+		{
+			if (m_err.isOk()
+			&&  0 < _size)
+			{
+				bx::read(m_reader, _data, int32_t(_size), &m_err);
+			}
+		}
+
+		const Memory* readMemory()
+		{
+			uint32_t size = 0;
+			read(size);
+
+			m_memData.resize(size);
+			read(m_memData.data(), size);
+
+			m_mem.data = m_memData.data();
+			m_mem.size = size;
+
+			return &m_mem;
+		}
+
+		bool readFrame()
+		{
+			Frame& frame = *m_frame;
+
+			read(frame.m_resolution);
+			read(frame.m_debug);
+			read(frame.m_viewRemap,    sizeof(frame.m_viewRemap) );
+			read(frame.m_colorPalette, sizeof(frame.m_colorPalette) );
+
+			uint16_t numViews = 0;
+			read(numViews);
+
+			if (numViews > BGFX_CONFIG_MAX_VIEWS)
+			{
+				BX_TRACE("Invalid number of views %d.", numViews);
+				return false;
+			}
+
+			for (uint32_t ii = 0; ii < numViews; ++ii)
+			{
+				ViewId id = 0;
+				read(id);
+
+				if (id >= BGFX_CONFIG_MAX_VIEWS)
+				{
+					BX_TRACE("Invalid view id %d.", id);
+					return false;
+				}
+
+				View& view = frame.m_view[id];
+				read(view);
+
+				view.m_fbh.idx = isValid(view.m_fbh)
+					? m_frameBuffer.find(view.m_fbh.idx)
+					: m_backBuffer.idx
+					;
+			}
+
+			uint32_t numRenderItems = 0;
+			read(numRenderItems);
+
+			if (numRenderItems > BGFX_CONFIG_MAX_DRAW_CALLS)
+			{
+				BX_TRACE("Invalid number of render items %d.", numRenderItems);
+				return false;
+			}
+
+			frame.m_numRenderItems = numRenderItems;
+			read(frame.m_sortKeys,       uint32_t(numRenderItems*sizeof(uint64_t) ) );
+			read(frame.m_sortValues,     uint32_t(numRenderItems*sizeof(RenderItemCount) ) );
+			read(frame.m_renderItem,     uint32_t(numRenderItems*sizeof(RenderItem) ) );
+			read(frame.m_renderItemBind, uint32_t(numRenderItems*sizeof(RenderBind) ) );
+
+			uint16_t numBlitItems = 0;
+			read(numBlitItems);
+
+			if (numBlitItems > BGFX_CONFIG_MAX_BLIT_ITEMS)
+			{
+				BX_TRACE("Invalid number of blit items %d.", numBlitItems);
+				return false;
+			}
+
+			frame.m_numBlitItems = numBlitItems;
+			read(frame.m_blitKeys, uint32_t(numBlitItems*sizeof(uint32_t) ) );
+			read(frame.m_blitItem, uint32_t(numBlitItems*sizeof(BlitItem) ) );
+
+			MatrixCache& matrixCache = frame.m_frameCache.m_matrixCache;
+			read(matrixCache.m_num);
+
+			if (matrixCache.m_num > BGFX_CONFIG_MAX_MATRIX_CACHE)
+			{
+				BX_TRACE("Invalid number of matrices %d.", matrixCache.m_num);
+				return false;
+			}
+
+			read(matrixCache.m_cache, uint32_t(matrixCache.m_num*sizeof(Matrix4) ) );
+
+			RectCache& rectCache = frame.m_frameCache.m_rectCache;
+			read(rectCache.m_num);
+
+			if (rectCache.m_num > BGFX_CONFIG_MAX_RECT_CACHE)
+			{
+				BX_TRACE("Invalid number of rects %d.", rectCache.m_num);
+				return false;
+			}
+
+			read(rectCache.m_cache, uint32_t(rectCache.m_num*sizeof(Rect) ) );
+
+			uint8_t numUniformBuffers = 0;
+			read(numUniformBuffers);
+
+			for (uint32_t ii = 0; ii < numUniformBuffers; ++ii)
+			{
+				uint8_t idx = 0;
+				read(idx);
+
+				uint32_t size = 0;
+				read(size);
+
+				if (idx >= g_caps.limits.maxEncoders)
+				{
+					BX_TRACE("Trace uses more encoders than available (%d, max: %d).", idx+1, g_caps.limits.maxEncoders);
+					return false;
+				}
+
+				m_memData.resize(size);
+				read(m_memData.data(), size);
+
+				if (!readUniformBuffer(idx, m_memData.data(), size) )
+				{
+					return false;
+				}
+			}
+
+			read(frame.m_iboffset);
+			if (0 < frame.m_iboffset)
+			{
+				read(m_transientIb.handle);
+				m_transientIb.handle.idx = m_indexBuffer.find(m_transientIb.handle.idx);
+
+				m_transientIbData.resize(frame.m_iboffset);
+				read(m_transientIbData.data(), frame.m_iboffset);
+				m_transientIb.data = m_transientIbData.data();
+				m_transientIb.size = frame.m_iboffset;
+			}
+
+			read(frame.m_vboffset);
+			if (0 < frame.m_vboffset)
+			{
+				read(m_transientVb.handle);
+				m_transientVb.handle.idx = m_vertexBuffer.find(m_transientVb.handle.idx);
+
+				m_transientVbData.resize(frame.m_vboffset);
+				read(m_transientVbData.data(), frame.m_vboffset);
+				m_transientVb.data = m_transientVbData.data();
+				m_transientVb.size = frame.m_vboffset;
+			}
+
+			if (!m_err.isOk() )
+			{
+				BX_TRACE("Trace file is truncated.");
+				return false;
+			}
+
+			// Debug text is not captured, and video capture is not replayed.
+			frame.m_debug &= ~(BGFX_DEBUG_TEXT|BGFX_DEBUG_STATS);
+			frame.m_resolution.reset &= ~BGFX_RESET_CAPTURE;
+			frame.m_numScreenShots = 0;
+			frame.m_capture = false;
+
+			remapFrame();
+
+			return true;
+		}
+
+		bool readUniformBuffer(uint8_t _idx, const uint8_t* _data, uint32_t _size)
+		{
+			m_frame->m_uniformBuffer[_idx]->reset();
+			UniformBuffer::update(&m_frame->m_uniformBuffer[_idx], _size+16, _size+16);
+
+			UniformBuffer* uniformBuffer = m_frame->m_uniformBuffer[_idx];
+
+			for (uint32_t pos = 0; pos + sizeof(uint32_t) <= _size;)
+			{
+				uint32_t opcode;
+				bx::memCopy(&opcode, &_data[pos], sizeof(uint32_t) );
+				pos += sizeof(uint32_t);
+
+				if (UniformType::End == opcode)
+				{
+					uniformBuffer->write(opcode);
+					continue;
+				}
+
+				UniformType::Enum type;
+				uint16_t loc;
+				uint16_t num;
+				uint16_t copy;
+				UniformBuffer::decodeOpcode(opcode, type, loc, num, copy);
+
+				const uint32_t size = g_uniformTypeSize[bx::min<uint32_t>(type, UniformType::Count)]*num;
+				if (pos + size > _size)
+				{
+					BX_TRACE("Invalid uniform buffer.");
+					return false;
+				}
+
+				if (UniformType::Count > type)
+				{
+					loc = m_uniform.find(loc);
+				}
+
+				uniformBuffer->write(UniformBuffer::encodeOpcode(type, loc, num, copy) );
+				uniformBuffer->write(&_data[pos], size);
+				pos += size;
+			}
+
+			uniformBuffer->finish();
+
+			return true;
+		}
+
+		void remapFrame()
+		{
+			Frame& frame = *m_frame;
+
+			for (uint32_t ii = 0, num = frame.m_numRenderItems; ii < num; ++ii)
+			{
+				uint64_t& key = frame.m_sortKeys[ii];
+
+				uint64_t mask;
+				uint8_t  shift;
+				getSortKeyProgram(key, mask, shift);
+
+				// Keep invalid program (view touch) as is.
+				const uint16_t program = uint16_t( (key & mask) >> shift);
+				if (uint64_t(program) != (mask >> shift) )
+				{
+					key = (key & ~mask) | ( (uint64_t(m_program.find(program) ) << shift) & mask);
+				}
+
+				const RenderItemCount itemIdx = frame.m_sortValues[ii];
+				RenderItem& renderItem = frame.m_renderItem[itemIdx];
+
+				if (isCompute(key) )
+				{
+					RenderCompute& compute = renderItem.compute;
+					compute.m_indirectBuffer.idx = m_vertexBuffer.find(compute.m_indirectBuffer.idx);
+				}
+				else
+				{
+					RenderDraw& draw = renderItem.draw;
+
+					for (uint32_t stream = 0; stream < BGFX_CONFIG_MAX_VERTEX_STREAMS; ++stream)
+					{
+						draw.m_stream[stream].m_handle.idx       = m_vertexBuffer.find(draw.m_stream[stream].m_handle.idx);
+						draw.m_stream[stream].m_layoutHandle.idx = m_layout.find(draw.m_stream[stream].m_layoutHandle.idx);
+					}
+
+					draw.m_indexBuffer.idx        = m_indexBuffer.find(draw.m_indexBuffer.idx);
+					draw.m_instanceDataBuffer.idx = m_vertexBuffer.find(draw.m_instanceDataBuffer.idx);
+					draw.m_indirectBuffer.idx     = m_vertexBuffer.find(draw.m_indirectBuffer.idx);
+
+					// Occlusion queries are created implicitly on first use.
+					draw.m_occlusionQuery.idx = isValid(draw.m_occlusionQuery)
+						? m_occlusionQuery.create(draw.m_occlusionQuery.idx)
+						: kInvalidHandle
+						;
+				}
+
+				RenderBind& renderBind = frame.m_renderItemBind[itemIdx];
+				for (uint32_t stage = 0; stage < BGFX_CONFIG_MAX_TEXTURE_SAMPLERS; ++stage)
+				{
+					Binding& bind = renderBind.m_bind[stage];
+
+					switch (bind.m_type)
+					{
+					case Binding::Image:
+					case Binding::Texture:
+						bind.m_idx = m_texture.find(bind.m_idx);
+						break;
+
+					case Binding::IndexBuffer:
+						bind.m_idx = m_indexBuffer.find(bind.m_idx);
+						break;
+
+					case Binding::VertexBuffer:
+						bind.m_idx = m_vertexBuffer.find(bind.m_idx);
+						break;
+
+					default:
+						break;
+					}
+				}
+			}
+
+			for (uint32_t ii = 0, num = frame.m_numBlitItems; ii < num; ++ii)
+			{
+				BlitItem& blitItem = frame.m_blitItem[ii];
+				blitItem.m_src.idx = m_texture.find(blitItem.m_src.idx);
+				blitItem.m_dst.idx = m_texture.find(blitItem.m_dst.idx);
+			}
+		}
+
+		Context* m_ctx;
+		bx::ReaderI* m_reader;
+		bx::Error m_err;
+
+		FrameBufferHandle m_backBuffer;
+		Frame* m_frame;
+
+		Memory m_mem;
+		stl::vector<uint8_t> m_memData;
+
+		TransientIndexBuffer  m_transientIb;
+		TransientVertexBuffer m_transientVb;
+		stl::vector<uint8_t>  m_transientIbData;
+		stl::vector<uint8_t>  m_transientVbData;
+
+		HandleRemapT<BGFX_CONFIG_MAX_INDEX_BUFFERS>     m_indexBuffer;
+		HandleRemapT<BGFX_CONFIG_MAX_VERTEX_LAYOUTS>    m_layout;
+		HandleRemapT<BGFX_CONFIG_MAX_VERTEX_BUFFERS>    m_vertexBuffer;
+		HandleRemapT<BGFX_CONFIG_MAX_SHADERS>           m_shader;
+		HandleRemapT<BGFX_CONFIG_MAX_PROGRAMS>          m_program;
+		HandleRemapT<BGFX_CONFIG_MAX_TEXTURES>          m_texture;
+		HandleRemapT<BGFX_CONFIG_MAX_FRAME_BUFFERS>     m_frameBuffer;
+		HandleRemapT<BGFX_CONFIG_MAX_UNIFORMS>          m_uniform;
+		HandleRemapT<BGFX_CONFIG_MAX_OCCLUSION_QUERIES> m_occlusionQuery;
+	};
+
+	bool replay(Context* _ctx, const bx::FilePath& _filePath, uint32_t _numLoops, FrameBufferHandle _backBuffer, ReplayStats* _stats)
+	{
+		ReplayStats stats;
+		bx::memSet(&stats, 0, sizeof(stats) );
+		stats.submitTimeMin = INT64_MAX;
+		stats.timerFreq     = bx::getHPFrequency();
+
+		bx::FileReader reader;
+		if (!bx::open(&reader, _filePath) )
+		{
+			BX_TRACE("Failed to open trace file \"%s\".", _filePath.getCPtr() );
+			return false;
+		}
+
+		TraceReplay* traceReplay = BX_NEW(g_allocator, TraceReplay)(_ctx, _backBuffer);
+
+		const int64_t timeBegin = bx::getHPCounter();
+
+		bool ok = traceReplay->readHeader(&reader);
+		const int64_t offset = bx::seek(&reader);
+
+		for (uint32_t ii = 0; ii < _numLoops && ok; ++ii)
+		{
+			bx::seek(&reader, offset, bx::Whence::Begin);
+			ok = traceReplay->run(&reader, stats);
+			traceReplay->destroyResources();
+			stats.numLoops += ok;
+		}
+
+		stats.totalTime     = bx::getHPCounter() - timeBegin;
+		stats.submitTimeMin = 0 < stats.numFrames ? stats.submitTimeMin : 0;
+
+		BX_DELETE(g_allocator, traceReplay);
+		bx::close(&reader);
+
+		if (NULL != _stats)
+		{
+			*_stats = stats;
+		}
+
+		return ok;
+	}
+
+} /* namespace capture */ } // namespace bgfx
@@ -0,0 +1,33 @@
+/*
+ * Copyright 2011-2022 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#ifndef BGFX_RENDERER_CAPTURE_H_HEADER_GUARD
+#define BGFX_RENDERER_CAPTURE_H_HEADER_GUARD
+
+#include <bgfx/bgfx.h>
+#include <bx/filepath.h>
+
+namespace bgfx
+{
+	struct Context;
+	struct RendererContextI;
+
+	namespace capture
+	{
+		/// Wrap renderer context into capture renderer context, which records every renderer
+		/// call into trace file before forwarding it.
+		RendererContextI* rendererCreate(RendererContextI* _renderCtx);
+
+		/// Destroy capture renderer context, and return wrapped renderer context.
+		RendererContextI* rendererDestroy(RendererContextI* _renderCtx);
+
+		///
+		bool replay(Context* _ctx, const bx::FilePath& _filePath, uint32_t _numLoops, FrameBufferHandle _backBuffer, ReplayStats* _stats);
+
+	} // namespace capture
+
+} // namespace bgfx
+
+#endif // BGFX_RENDERER_CAPTURE_H_HEADER_GUARD
@@ -42,6 +42,13 @@ namespace bgfx { namespace gl
 	};
 	BX_STATIC_ASSERT(Topology::Count == BX_COUNTOF(s_primInfo)-1);
 
+	static const char* s_uniformBlockName[] =
+	{
+		"bgfx_VsUniforms",
+		"bgfx_FsUniforms",
+	};
+	BX_STATIC_ASSERT(kNumUniformBlocks == BX_COUNTOF(s_uniformBlockName) );
+
 	static const char* s_attribName[] =
 	{
 		"a_position",
@@ -498,6 +505,7 @@ namespace bgfx { namespace gl
 			APPLE_texture_format_BGRA8888,
 			APPLE_texture_max_level,
 
+			ARB_buffer_storage,
 			ARB_clip_control,
 			ARB_compute_shader,
 			ARB_conservative_depth,
@@ -715,6 +723,7 @@ namespace bgfx { namespace gl
 		{ "APPLE_texture_format_BGRA8888",            false,                             true  },
 		{ "APPLE_texture_max_level",                  false,                             true  },
 
+		{ "ARB_buffer_storage",                       BGFX_CONFIG_RENDERER_OPENGL >= 44, true  },
 		{ "ARB_clip_control",                         BGFX_CONFIG_RENDERER_OPENGL >= 43, true  },
 		{ "ARB_compute_shader",                       BGFX_CONFIG_RENDERER_OPENGL >= 43, true  },
 		{ "ARB_conservative_depth",                   BGFX_CONFIG_RENDERER_OPENGL >= 42, true  },
@@ -2187,6 +2196,9 @@ namespace bgfx { namespace gl
 			, m_msaaBackBufferFbo(0)
 			, m_clearQuadColor(BGFX_INVALID_HANDLE)
 			, m_clearQuadDepth(BGFX_INVALID_HANDLE)
+			, m_uniformBlockDirty(0)
+			, m_vaoCacheSupport(false)
+			, m_persistentBufferSupport(false)
 		{
 			bx::memSet(m_msaaBackBufferRbos, 0, sizeof(m_msaaBackBufferRbos) );
 		}
@@ -2867,11 +2879,48 @@ namespace bgfx { namespace gl
 					GL_CHECK(glGenVertexArrays(1, &m_vao) );
 				}
 
+				m_vaoCacheSupport = BX_ENABLED(BGFX_GL_CONFIG_VAO_CACHE)
+					&& m_vaoSupport
+					;
+
 				m_samplerObjectSupport = !BX_ENABLED(BX_PLATFORM_EMSCRIPTEN)
 					&& (m_gles3
 						|| s_extension[Extension::ARB_sampler_objects].m_supported
 						);
 
+#if BGFX_GL_CONFIG_UNIFORM_BUFFER
+				if (s_extension[Extension::ARB_uniform_buffer_object].m_supported)
+				{
+					GLint align = 256;
+					GL_CHECK(glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &align) );
+
+					const bool persistent = true
+						&& s_extension[Extension::ARB_buffer_storage].m_supported
+						&& NULL != glBufferStorage
+						&& NULL != glMapBufferRange
+						;
+
+					m_uniformRing.create(BGFX_GL_CONFIG_UNIFORM_BUFFER_SIZE, bx::max<GLint>(align, 16), persistent);
+					bx::memSet(m_uniformBlock, 0, sizeof(m_uniformBlock) );
+				}
+#endif // BGFX_GL_CONFIG_UNIFORM_BUFFER
+
+#if BGFX_GL_CONFIG_PERSISTENT_BUFFER
+				m_persistentBufferSupport = true
+					&& s_extension[Extension::ARB_buffer_storage].m_supported
+					&& NULL != glBufferStorage
+					&& NULL != glMapBufferRange
+					&& NULL != glFenceSync
+					&& NULL != glClientWaitSync
+					;
+
+				if (m_persistentBufferSupport
+				&&  NULL != glCopyBufferSubData)
+				{
+					m_stagingRing.create(GL_COPY_READ_BUFFER, BGFX_GL_CONFIG_STAGING_BUFFER_SIZE, 16, true);
+				}
+#endif // BGFX_GL_CONFIG_PERSISTENT_BUFFER
+
 				m_shadowSamplersSupport = !!(BGFX_CONFIG_RENDERER_OPENGL || m_gles3)
 					|| s_extension[Extension::EXT_shadow_samplers].m_supported
 					;
@@ -3124,6 +3173,8 @@ namespace bgfx { namespace gl
 
 		void shutdown()
 		{
+			m_vaoCache.invalidate();
+
 			if (m_vaoSupport)
 			{
 				GL_CHECK(glBindVertexArray(0) );
@@ -3135,6 +3186,14 @@ namespace bgfx { namespace gl
 
 			invalidateCache();
 
+#if BGFX_GL_CONFIG_UNIFORM_BUFFER
+			m_uniformRing.destroy();
+#endif // BGFX_GL_CONFIG_UNIFORM_BUFFER
+
+#if BGFX_GL_CONFIG_PERSISTENT_BUFFER
+			m_stagingRing.destroy();
+#endif // BGFX_GL_CONFIG_PERSISTENT_BUFFER
+
 			if (m_timerQuerySupport)
 			{
 				m_gpuTimer.destroy();
@@ -3205,6 +3264,7 @@ namespace bgfx { namespace gl
 
 		void destroyIndexBuffer(IndexBufferHandle _handle) override
 		{
+			m_vaoCache.invalidateIf(usesIndexBuffer, _handle.idx);
 			m_indexBuffers[_handle.idx].destroy();
 		}
 
@@ -3226,6 +3286,7 @@ namespace bgfx { namespace gl
 
 		void destroyVertexBuffer(VertexBufferHandle _handle) override
 		{
+			m_vaoCache.invalidateIf(usesVertexBuffer, _handle.idx);
 			m_vertexBuffers[_handle.idx].destroy();
 		}
 
@@ -3236,11 +3297,18 @@ namespace bgfx { namespace gl
 
 		void updateDynamicIndexBuffer(IndexBufferHandle _handle, uint32_t _offset, uint32_t _size, const Memory* _mem) override
 		{
-			m_indexBuffers[_handle.idx].update(_offset, bx::uint32_min(_size, _mem->size), _mem->data);
+			IndexBufferGL& ib = m_indexBuffers[_handle.idx];
+			const uint32_t size = bx::uint32_min(_size, _mem->size);
+
+			if (!stageBufferUpdate(ib.m_id, _offset, size, _mem->data) )
+			{
+				ib.update(_offset, size, _mem->data);
+			}
 		}
 
 		void destroyDynamicIndexBuffer(IndexBufferHandle _handle) override
 		{
+			m_vaoCache.invalidateIf(usesIndexBuffer, _handle.idx);
 			m_indexBuffers[_handle.idx].destroy();
 		}
 
@@ -3252,11 +3320,18 @@ namespace bgfx { namespace gl
 
 		void updateDynamicVertexBuffer(VertexBufferHandle _handle, uint32_t _offset, uint32_t _size, const Memory* _mem) override
 		{
-			m_vertexBuffers[_handle.idx].update(_offset, bx::uint32_min(_size, _mem->size), _mem->data);
+			VertexBufferGL& vb = m_vertexBuffers[_handle.idx];
+			const uint32_t size = bx::uint32_min(_size, _mem->size);
+
+			if (!stageBufferUpdate(vb.m_id, _offset, size, _mem->data) )
+			{
+				vb.update(_offset, size, _mem->data);
+			}
 		}
 
 		void destroyDynamicVertexBuffer(VertexBufferHandle _handle) override
 		{
+			m_vaoCache.invalidateIf(usesVertexBuffer, _handle.idx);
 			m_vertexBuffers[_handle.idx].destroy();
 		}
 
@@ -3278,6 +3353,7 @@ namespace bgfx { namespace gl
 
 		void destroyProgram(ProgramHandle _handle) override
 		{
+			m_vaoCache.invalidateWithParent(_handle.idx);
 			m_program[_handle.idx].destroy();
 		}
 
@@ -4395,10 +4471,275 @@ namespace bgfx { namespace gl
 			}
 		}
 
+		void bindVertexStreams(ProgramGL& _program, const RenderDraw& _draw)
+		{
+			_program.bindAttributesBegin();
+
+			if (UINT8_MAX != _draw.m_streamMask)
+			{
+				for (uint32_t idx = 0, streamMask = _draw.m_streamMask
+					; 0 != streamMask
+					; streamMask >>= 1, idx += 1
+					)
+				{
+					const uint32_t ntz = bx::uint32_cnttz(streamMask);
+					streamMask >>= ntz;
+					idx         += ntz;
+
+					const VertexBufferGL& vb = m_vertexBuffers[_draw.m_stream[idx].m_handle.idx];
+					const uint16_t decl = isValid(_draw.m_stream[idx].m_layoutHandle)
+						? _draw.m_stream[idx].m_layoutHandle.idx
+						: vb.m_layoutHandle.idx;
+					GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vb.m_id) );
+					_program.bindAttributes(m_vertexLayouts[decl], _draw.m_stream[idx].m_startVertex);
+				}
+			}
+
+			if (isValid(_draw.m_instanceDataBuffer) )
+			{
+				GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffers[_draw.m_instanceDataBuffer.idx].m_id) );
+				_program.bindInstanceData(_draw.m_instanceDataStride, _draw.m_instanceDataOffset);
+			}
+
+			_program.bindAttributesEnd();
+		}
+
+		void bindIndexBuffer(IndexBufferHandle _handle)
+		{
+			GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, isValid(_handle) ? m_indexBuffers[_handle.idx].m_id : 0) );
+		}
+
+		// Draws sourcing transient buffers change start vertex every draw and
+		// every frame, caching their VAOs would only churn cache.
+		bool isVaoCacheable(const Frame* _render, const RenderDraw& _draw) const
+		{
+			const uint16_t transientVb = _render->m_transientVb->handle.idx;
+
+			// Transient buffers change GL buffer id every frame.
+			if (_draw.m_instanceDataBuffer.idx == transientVb
+			||  _draw.m_indexBuffer.idx == _render->m_transientIb->handle.idx)
+			{
+				return false;
+			}
+
+			if (UINT8_MAX != _draw.m_streamMask)
+			{
+				for (uint32_t idx = 0, streamMask = _draw.m_streamMask
+					; 0 != streamMask
+					; streamMask >>= 1, idx += 1
+					)
+				{
+					const uint32_t ntz = bx::uint32_cnttz(streamMask);
+					streamMask >>= ntz;
+					idx         += ntz;
+
+					if (_draw.m_stream[idx].m_handle.idx == transientVb)
+					{
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+
+		uint64_t getVaoHash(ProgramHandle _program, const RenderDraw& _draw) const
+		{
+			bx::HashMurmur2A murmur;
+			murmur.begin();
+			murmur.add(_program.idx);
+			murmur.add(_draw.m_indexBuffer.idx);
+			murmur.add(_draw.m_streamMask);
+
+			if (UINT8_MAX != _draw.m_streamMask)
+			{
+				for (uint32_t idx = 0, streamMask = _draw.m_streamMask
+					; 0 != streamMask
+					; streamMask >>= 1, idx += 1
+					)
+				{
+					const uint32_t ntz = bx::uint32_cnttz(streamMask);
+					streamMask >>= ntz;
+					idx         += ntz;
+
+					const VertexBufferGL& vb = m_vertexBuffers[_draw.m_stream[idx].m_handle.idx];
+					const uint16_t decl = isValid(_draw.m_stream[idx].m_layoutHandle)
+						? _draw.m_stream[idx].m_layoutHandle.idx
+						: vb.m_layoutHandle.idx;
+
+					murmur.add(idx);
+					murmur.add(_draw.m_stream[idx].m_handle.idx);
+					murmur.add(m_vertexLayouts[decl].m_hash);
+					murmur.add(_draw.m_stream[idx].m_startVertex);
+				}
+			}
+
+			murmur.add(_draw.m_instanceDataBuffer.idx);
+			murmur.add(_draw.m_instanceDataOffset);
+			murmur.add(_draw.m_instanceDataStride);
+
+			return murmur.end();
+		}
+
+		// Buffers referenced by VAO, so that destroying buffer invalidates only
+		// VAOs using it.
+		void initVaoBuffers(VaoGL& _vao, const RenderDraw& _draw) const
+		{
+			_vao.m_indexBuffer      = _draw.m_indexBuffer.idx;
+			_vao.m_numVertexBuffers = 0;
+
+			if (UINT8_MAX != _draw.m_streamMask)
+			{
+				for (uint32_t idx = 0, streamMask = _draw.m_streamMask
+					; 0 != streamMask
+					; streamMask >>= 1, idx += 1
+					)
+				{
+					const uint32_t ntz = bx::uint32_cnttz(streamMask);
+					streamMask >>= ntz;
+					idx         += ntz;
+
+					_vao.m_vertexBuffer[_vao.m_numVertexBuffers++] = _draw.m_stream[idx].m_handle.idx;
+				}
+			}
+
+			if (isValid(_draw.m_instanceDataBuffer) )
+			{
+				_vao.m_vertexBuffer[_vao.m_numVertexBuffers++] = _draw.m_instanceDataBuffer.idx;
+			}
+		}
+
+		bool stageBufferUpdate(GLuint _id, uint32_t _offset, uint32_t _size, const void* _data)
+		{
+#if BGFX_GL_CONFIG_PERSISTENT_BUFFER
+			// Buffer might still be read by frames in flight, instead of stalling
+			// in glBufferSubData, write update into mapped staging ring and let GPU
+			// copy it in order with other commands.
+			if (NULL != m_stagingRing.m_data
+			&&  0 != _size
+			&&  _size <= m_stagingRing.m_size)
+			{
+				const uint32_t srcOffset = m_stagingRing.write(_data, _size);
+
+				GL_CHECK(glBindBuffer(GL_COPY_READ_BUFFER,  m_stagingRing.m_id) );
+				GL_CHECK(glBindBuffer(GL_COPY_WRITE_BUFFER, _id) );
+				GL_CHECK(glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, srcOffset, _offset, _size) );
+				GL_CHECK(glBindBuffer(GL_COPY_WRITE_BUFFER, 0) );
+				GL_CHECK(glBindBuffer(GL_COPY_READ_BUFFER,  0) );
+				return true;
+			}
+#else
+			BX_UNUSED(_id, _offset, _size, _data);
+#endif // BGFX_GL_CONFIG_PERSISTENT_BUFFER
+
+			return false;
+		}
+
+		template<typename Ty>
+		void uploadTransientBuffer(Ty& _buffer, GLenum _target, uint8_t* _data, uint32_t _size)
+		{
+#if BGFX_GL_CONFIG_PERSISTENT_BUFFER
+			if (m_persistentBufferSupport
+			&&  NULL == _buffer.m_persistent)
+			{
+				PersistentBufferGL* persistent = BX_NEW(g_allocator, PersistentBufferGL);
+
+				if (persistent->create(_target, _buffer.m_size) )
+				{
+					m_vaoCache.invalidate();
+					_buffer.destroy();
+					_buffer.m_persistent = persistent;
+					_buffer.m_id         = persistent->getId();
+				}
+				else
+				{
+					BX_DELETE(g_allocator, persistent);
+					m_persistentBufferSupport = false;
+				}
+			}
+
+			if (NULL != _buffer.m_persistent)
+			{
+				uint8_t* dst = _buffer.m_persistent->getData();
+
+				// Once redirected, Frame writes directly into mapped storage and
+				// there is nothing to upload.
+				if (dst != _data)
+				{
+					bx::memCopy(dst, _data, _size);
+				}
+
+				return;
+			}
+#else
+			BX_UNUSED(_target);
+#endif // BGFX_GL_CONFIG_PERSISTENT_BUFFER
+
+			_buffer.update(0, _size, _data, true);
+		}
+
+		template<typename Ty>
+		uint8_t* frameTransientBuffer(Ty& _buffer, uint8_t* _data)
+		{
+#if BGFX_GL_CONFIG_PERSISTENT_BUFFER
+			if (NULL != _buffer.m_persistent)
+			{
+				_buffer.m_persistent->frame();
+				_buffer.m_id = _buffer.m_persistent->getId();
+				return _buffer.m_persistent->getData();
+			}
+#else
+			BX_UNUSED(_buffer);
+#endif // BGFX_GL_CONFIG_PERSISTENT_BUFFER
+
+			return _data;
+		}
+
 		void setProgram(GLuint program)
 		{
 			m_uniformStateCache.saveCurrentProgram(program);
 			GL_CHECK(glUseProgram(program) );
+
+			// Block layout is per program, rebind ranges on next draw.
+			m_uniformBlockDirty = UINT8_MAX;
+		}
+
+		void setUniformBlock(uint32_t _loc, const void* _data, uint32_t _size)
+		{
+			const uint8_t  slot   = uint8_t( (_loc>>16) & UINT8_MAX);
+			const uint32_t offset = _loc & UINT16_MAX;
+
+			if (slot < kNumUniformBlocks
+			&&  offset + _size <= BGFX_GL_CONFIG_UNIFORM_BLOCK_SIZE)
+			{
+				uint8_t* dst = &m_uniformBlock[slot][offset];
+				if (0 != bx::memCmp(dst, _data, _size) )
+				{
+					bx::memCopy(dst, _data, _size);
+					m_uniformBlockDirty |= 1<<slot;
+				}
+			}
+		}
+
+		void commitUniformBlocks(const ProgramGL& _program)
+		{
+#if BGFX_GL_CONFIG_UNIFORM_BUFFER
+			for (uint8_t slot = 0; slot < kNumUniformBlocks; ++slot)
+			{
+				const uint32_t size = _program.m_uniformBlockSize[slot];
+
+				if (0 != size
+				&&  0 != (m_uniformBlockDirty & (1<<slot) ) )
+				{
+					const uint32_t offset = m_uniformRing.write(m_uniformBlock[slot], size);
+					GL_CHECK(glBindBufferRange(GL_UNIFORM_BUFFER, slot, m_uniformRing.m_id, offset, size) );
+				}
+			}
+#else
+			BX_UNUSED(_program);
+#endif // BGFX_GL_CONFIG_UNIFORM_BUFFER
+
+			m_uniformBlockDirty = 0;
 		}
 
 		// Cache uniform uploads to avoid redundant uploading of state that is
@@ -4438,6 +4779,12 @@ namespace bgfx { namespace gl
 
 		void setUniform4fv(uint32_t loc, int num, const float *data)
 		{
+			if (0 != (loc & kUniformBlockLoc) )
+			{
+				setUniformBlock(loc, data, num*16);
+				return;
+			}
+
 			bool changed = false;
 			for(int i = 0; i < num; ++i)
 			{
@@ -4454,6 +4801,16 @@ namespace bgfx { namespace gl
 
 		void setUniformMatrix3fv(uint32_t loc, int num, GLboolean transpose, const float *data)
 		{
+			if (0 != (loc & kUniformBlockLoc) )
+			{
+				// std140 pads each mat3 column to vec4.
+				for (int ii = 0; ii < num*3; ++ii)
+				{
+					setUniformBlock(loc + ii*16, &data[ii*3], 12);
+				}
+				return;
+			}
+
 			bool changed = false;
 			for(int i = 0; i < num; ++i)
 			{
@@ -4470,6 +4827,12 @@ namespace bgfx { namespace gl
 
 		void setUniformMatrix4fv(uint32_t loc, int num, GLboolean transpose, const float *data)
 		{
+			if (0 != (loc & kUniformBlockLoc) )
+			{
+				setUniformBlock(loc, data, num*64);
+				return;
+			}
+
 			bool changed = false;
 			for(int i = 0; i < num; ++i)
 			{
@@ -4505,6 +4868,16 @@ namespace bgfx { namespace gl
 		SamplerStateCache m_samplerStateCache;
 		UniformStateCache m_uniformStateCache;
 
+		RingBufferGL m_uniformRing;
+		uint8_t m_uniformBlock[kNumUniformBlocks][BGFX_GL_CONFIG_UNIFORM_BLOCK_SIZE]; // CPU copy of current program blocks.
+		uint8_t m_uniformBlockDirty;
+
+		StateCacheLru<VaoGL, BGFX_GL_CONFIG_VAO_CACHE_SIZE> m_vaoCache;
+		bool m_vaoCacheSupport;
+
+		RingBufferGL m_stagingRing;
+		bool m_persistentBufferSupport;
+
 		TextVideoMem m_textVideoMem;
 		bool m_rtMsaa;
 
@@ -4757,6 +5130,202 @@ namespace bgfx { namespace gl
 		return UniformType::End;
 	}
 
+#if BGFX_GL_CONFIG_UNIFORM_BUFFER || BGFX_GL_CONFIG_PERSISTENT_BUFFER
+	static void waitSync(GLsync& _fence, uint32_t& _numStalls)
+	{
+		if (NULL == _fence)
+		{
+			return;
+		}
+
+		GLenum result = glClientWaitSync(_fence, 0, 0);
+
+		if (GL_TIMEOUT_EXPIRED == result)
+		{
+			++_numStalls;
+
+			do
+			{
+				result = glClientWaitSync(_fence, GL_SYNC_FLUSH_COMMANDS_BIT, UINT64_C(1000000) );
+			}
+			while (GL_TIMEOUT_EXPIRED == result);
+		}
+
+		BX_WARN(GL_WAIT_FAILED != result, "Buffer fence wait failed.");
+
+		GL_CHECK(glDeleteSync(_fence) );
+		_fence = NULL;
+	}
+
+	static void deleteSync(GLsync& _fence)
+	{
+		if (NULL != _fence)
+		{
+			GL_CHECK(glDeleteSync(_fence) );
+			_fence = NULL;
+		}
+	}
+
+	static uint8_t* createPersistentBuffer(GLuint& _id, GLenum _target, uint32_t _size)
+	{
+		const GLbitfield access = 0
+			| GL_MAP_WRITE_BIT
+			| GL_MAP_PERSISTENT_BIT
+			| GL_MAP_COHERENT_BIT
+			;
+
+		GL_CHECK(glGenBuffers(1, &_id) );
+		GL_CHECK(glBindBuffer(_target, _id) );
+		GL_CHECK(glBufferStorage(_target, _size, NULL, access|GL_DYNAMIC_STORAGE_BIT) );
+		uint8_t* data = (uint8_t*)glMapBufferRange(_target, 0, _size, access);
+		GL_CHECK(glBindBuffer(_target, 0) );
+
+		return data;
+	}
+
+	static void destroyPersistentBuffer(GLuint& _id, GLenum _target, uint8_t*& _data)
+	{
+		if (NULL != _data)
+		{
+			GL_CHECK(glBindBuffer(_target, _id) );
+			GL_CHECK(glUnmapBuffer(_target) );
+			GL_CHECK(glBindBuffer(_target, 0) );
+			_data = NULL;
+		}
+
+		if (0 != _id)
+		{
+			GL_CHECK(glDeleteBuffers(1, &_id) );
+			_id = 0;
+		}
+	}
+
+	void RingBufferGL::create(GLenum _target, uint32_t _size, uint32_t _align, bool _persistent)
+	{
+		m_target = _target;
+		m_size   = bx::strideAlign(_size, _align);
+		m_pos    = 0;
+		m_align  = _align;
+		m_frame  = 0;
+		m_data   = NULL;
+
+		const uint32_t totalSize = m_size*BGFX_GL_CONFIG_PERSISTENT_BUFFER_FRAMES;
+
+		if (_persistent)
+		{
+			m_data = createPersistentBuffer(m_id, m_target, totalSize);
+			BX_WARN(NULL != m_data, "Failed to persistently map ring buffer, using glBufferSubData.");
+		}
+		else
+		{
+			GL_CHECK(glGenBuffers(1, &m_id) );
+			GL_CHECK(glBindBuffer(m_target, m_id) );
+			GL_CHECK(glBufferData(m_target, totalSize, NULL, GL_DYNAMIC_DRAW) );
+			GL_CHECK(glBindBuffer(m_target, 0) );
+		}
+
+		BX_TRACE("Ring buffer 0x%04x: %d x %d bytes, align %d, %s."
+			, m_target
+			, BGFX_GL_CONFIG_PERSISTENT_BUFFER_FRAMES
+			, m_size
+			, m_align
+			, NULL != m_data ? "persistent" : "glBufferSubData"
+			);
+	}
+
+	void RingBufferGL::destroy()
+	{
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_fence); ++ii)
+		{
+			deleteSync(m_fence[ii]);
+		}
+
+		destroyPersistentBuffer(m_id, m_target, m_data);
+	}
+
+	void RingBufferGL::frame()
+	{
+		m_fence[m_frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		m_frame = (m_frame + 1) % BGFX_GL_CONFIG_PERSISTENT_BUFFER_FRAMES;
+
+		// Segment is reused only after GPU consumed commands recorded into it
+		// BGFX_GL_CONFIG_PERSISTENT_BUFFER_FRAMES frames ago. Waiting here rather
+		// than at the beginning of submit covers buffer updates executed before
+		// next submit.
+		waitSync(m_fence[m_frame], m_numStalls);
+
+		m_pos = 0;
+	}
+
+	uint32_t RingBufferGL::write(const void* _data, uint32_t _size)
+	{
+		BX_ASSERT(_size <= m_size, "Write size %d is larger than ring segment %d.", _size, m_size);
+
+		if (m_pos + _size > m_size)
+		{
+			// Segment exhausted mid frame, wait until GPU consumed everything
+			// recorded so far, and then start over from segment beginning.
+			++m_numOverflows;
+			BX_TRACE("Ring buffer 0x%04x segment overflow, consider increasing its size.", m_target);
+			GL_CHECK(glFinish() );
+			m_pos = 0;
+		}
+
+		const uint32_t offset = m_frame*m_size + m_pos;
+
+		if (NULL != m_data)
+		{
+			bx::memCopy(&m_data[offset], _data, _size);
+		}
+		else
+		{
+			GL_CHECK(glBindBuffer(m_target, m_id) );
+			GL_CHECK(glBufferSubData(m_target, offset, _size, _data) );
+		}
+
+		m_pos = bx::strideAlign(m_pos + _size, m_align);
+
+		return offset;
+	}
+
+	bool PersistentBufferGL::create(GLenum _target, uint32_t _size)
+	{
+		m_target  = _target;
+		m_size    = _size;
+		m_current = 0;
+
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_id); ++ii)
+		{
+			m_data[ii] = createPersistentBuffer(m_id[ii], m_target, m_size);
+
+			if (NULL == m_data[ii])
+			{
+				BX_TRACE("Failed to persistently map buffer 0x%04x, %d bytes.", m_target, m_size);
+				destroy();
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void PersistentBufferGL::destroy()
+	{
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_id); ++ii)
+		{
+			deleteSync(m_fence[ii]);
+			destroyPersistentBuffer(m_id[ii], m_target, m_data[ii]);
+		}
+	}
+
+	void PersistentBufferGL::frame()
+	{
+		m_fence[m_current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		m_current = (m_current + 1) % BGFX_GL_CONFIG_PERSISTENT_BUFFER_FRAMES;
+		waitSync(m_fence[m_current], m_numStalls);
+	}
+#endif // BGFX_GL_CONFIG_UNIFORM_BUFFER || BGFX_GL_CONFIG_PERSISTENT_BUFFER
+
 	void ProgramGL::create(const ShaderGL& _vsh, const ShaderGL& _fsh)
 	{
 		m_id = glCreateProgram();
@@ -4906,6 +5475,50 @@ namespace bgfx { namespace gl
 		m_numPredefined = 0;
 		m_numSamplers = 0;
 
+		uint8_t blockSlot[8];
+		bx::memSet(blockSlot, UINT8_MAX, sizeof(blockSlot) );
+		bx::memSet(m_uniformBlockSize, 0, sizeof(m_uniformBlockSize) );
+
+#if BGFX_GL_CONFIG_UNIFORM_BUFFER
+		if (s_renderGL->m_uniformRing.isValid() )
+		{
+			GLint activeBlocks = 0;
+			GL_CHECK(glGetProgramiv(m_id, GL_ACTIVE_UNIFORM_BLOCKS, &activeBlocks) );
+
+			BX_TRACE("Uniform blocks (%d):", activeBlocks);
+			for (int32_t ii = 0, num = bx::min<int32_t>(activeBlocks, BX_COUNTOF(blockSlot) ); ii < num; ++ii)
+			{
+				char blockName[64];
+				GL_CHECK(glGetActiveUniformBlockName(m_id, ii, BX_COUNTOF(blockName), NULL, blockName) );
+
+				GLint size = 0;
+				GL_CHECK(glGetActiveUniformBlockiv(m_id, ii, GL_UNIFORM_BLOCK_DATA_SIZE, &size) );
+
+				for (uint8_t slot = 0; slot < kNumUniformBlocks; ++slot)
+				{
+					if (0 == bx::strCmp(blockName, s_uniformBlockName[slot]) )
+					{
+						BX_WARN(size <= BGFX_GL_CONFIG_UNIFORM_BLOCK_SIZE
+							, "Uniform block %s size %d is larger than BGFX_GL_CONFIG_UNIFORM_BLOCK_SIZE (%d)."
+							, blockName
+							, size
+							, BGFX_GL_CONFIG_UNIFORM_BLOCK_SIZE
+							);
+
+						if (size <= BGFX_GL_CONFIG_UNIFORM_BLOCK_SIZE)
+						{
+							GL_CHECK(glUniformBlockBinding(m_id, ii, slot) );
+							blockSlot[ii] = slot;
+							m_uniformBlockSize[slot] = uint16_t(size);
+						}
+					}
+				}
+
+				BX_TRACE("\t%s binding %d, size %d", blockName, blockSlot[ii], size);
+			}
+		}
+#endif // BGFX_GL_CONFIG_UNIFORM_BUFFER
+
 		BX_TRACE("Uniforms (%d):", activeUniforms);
 		for (int32_t ii = 0; ii < activeUniforms; ++ii)
 		{
@@ -4954,6 +5567,35 @@ namespace bgfx { namespace gl
 
 			num = bx::uint32_max(num, 1);
 
+#if BGFX_GL_CONFIG_UNIFORM_BUFFER
+			if (s_renderGL->m_uniformRing.isValid() )
+			{
+				const GLuint index = GLuint(ii);
+				GLint blockIdx = -1;
+				GL_CHECK(glGetActiveUniformsiv(m_id, 1, &index, GL_UNIFORM_BLOCK_INDEX, &blockIdx) );
+
+				if (0 <= blockIdx)
+				{
+					const uint8_t slot = blockIdx < int32_t(BX_COUNTOF(blockSlot) ) ? blockSlot[blockIdx] : UINT8_MAX;
+					if (UINT8_MAX == slot)
+					{
+						continue;
+					}
+
+					GLint blockOffset = 0;
+					GL_CHECK(glGetActiveUniformsiv(m_id, 1, &index, GL_UNIFORM_OFFSET, &blockOffset) );
+					loc = GLint(toUniformBlockLoc(slot, blockOffset) );
+
+					// Block members are reported as "<block name>.<member name>".
+					const bx::StringView dot = bx::strFind(name, '.');
+					if (!dot.isEmpty() )
+					{
+						bx::memMove(name, dot.getPtr()+1, bx::strLen(dot.getPtr()+1)+1);
+					}
+				}
+			}
+#endif // BGFX_GL_CONFIG_UNIFORM_BUFFER
+
 			int32_t offset = 0;
 			const bx::StringView array = bx::strFind(name, '[');
 			if (!array.isEmpty() )
@@ -5241,15 +5883,63 @@ namespace bgfx { namespace gl
 		}
 	}
 
+	void release(VaoGL& _vao)
+	{
+		GL_CHECK(glDeleteVertexArrays(1, &_vao.m_id) );
+		_vao.m_id = 0;
+	}
+
+	bool usesIndexBuffer(const VaoGL& _vao, uint16_t _idx)
+	{
+		return _vao.m_indexBuffer == _idx;
+	}
+
+	bool usesVertexBuffer(const VaoGL& _vao, uint16_t _idx)
+	{
+		for (uint32_t ii = 0; ii < _vao.m_numVertexBuffers; ++ii)
+		{
+			if (_vao.m_vertexBuffer[ii] == _idx)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
 	void IndexBufferGL::destroy()
 	{
 		GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0) );
+
+#if BGFX_GL_CONFIG_PERSISTENT_BUFFER
+		if (NULL != m_persistent)
+		{
+			m_persistent->destroy();
+			BX_DELETE(g_allocator, m_persistent);
+			m_persistent = NULL;
+			m_id = 0;
+			return;
+		}
+#endif // BGFX_GL_CONFIG_PERSISTENT_BUFFER
+
 		GL_CHECK(glDeleteBuffers(1, &m_id) );
 	}
 
 	void VertexBufferGL::destroy()
 	{
 		GL_CHECK(glBindBuffer(m_target, 0) );
+
+#if BGFX_GL_CONFIG_PERSISTENT_BUFFER
+		if (NULL != m_persistent)
+		{
+			m_persistent->destroy();
+			BX_DELETE(g_allocator, m_persistent);
+			m_persistent = NULL;
+			m_id = 0;
+			return;
+		}
+#endif // BGFX_GL_CONFIG_PERSISTENT_BUFFER
+
 		GL_CHECK(glDeleteBuffers(1, &m_id) );
 	}
 
@@ -7203,6 +7893,10 @@ namespace bgfx { namespace gl
 		if (1 < m_numWindows
 		&&  m_vaoSupport)
 		{
+			// VAOs are not shared between contexts.
+			m_vaoCache.invalidate();
+			m_vaoCacheSupport = false;
+
 			m_vaoSupport = false;
 			GL_CHECK(glBindVertexArray(0) );
 			GL_CHECK(glDeleteVertexArrays(1, &m_vao) );
@@ -7235,14 +7929,14 @@ namespace bgfx { namespace gl
 		{
 			BGFX_PROFILER_SCOPE("bgfx/Update transient index buffer", kColorResource);
 			TransientIndexBuffer* ib = _render->m_transientIb;
-			m_indexBuffers[ib->handle.idx].update(0, _render->m_iboffset, ib->data, true);
+			uploadTransientBuffer(m_indexBuffers[ib->handle.idx], GL_ELEMENT_ARRAY_BUFFER, ib->data, _render->m_iboffset);
 		}
 
 		if (0 < _render->m_vboffset)
 		{
 			BGFX_PROFILER_SCOPE("bgfx/Update transient vertex buffer", kColorResource);
 			TransientVertexBuffer* vb = _render->m_transientVb;
-			m_vertexBuffers[vb->handle.idx].update(0, _render->m_vboffset, vb->data, true);
+			uploadTransientBuffer(m_vertexBuffers[vb->handle.idx], GL_ARRAY_BUFFER, vb->data, _render->m_vboffset);
 		}
 
 		_render->sort();
@@ -7468,6 +8162,7 @@ namespace bgfx { namespace gl
 							}
 
 							viewState.setPredefined<1>(this, view, program, _render, compute);
+							commitUniformBlocks(program);
 
 							if (isValid(compute.m_indirectBuffer) )
 							{
@@ -7921,6 +8616,7 @@ namespace bgfx { namespace gl
 					}
 
 					viewState.setPredefined<1>(this, view, program, _render, draw);
+					commitUniformBlocks(program);
 
 					{
 						GLbitfield barrier = 0;
@@ -8026,14 +8722,14 @@ namespace bgfx { namespace gl
 						{
 							currentState.m_indexBuffer = draw.m_indexBuffer;
 
-							if (isValid(draw.m_indexBuffer) )
+							if (m_vaoCacheSupport)
 							{
-								IndexBufferGL& ib = m_indexBuffers[draw.m_indexBuffer.idx];
-								GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ib.m_id) );
+								// Index buffer binding is VAO state, it's bound when VAO is selected.
+								bindAttribs = true;
 							}
 							else
 							{
-								GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0) );
+								bindIndexBuffer(draw.m_indexBuffer);
 							}
 						}
 
@@ -8046,43 +8742,49 @@ namespace bgfx { namespace gl
 						{
 							if (bindAttribs)
 							{
-								if (isValid(boundProgram) )
+								if (m_vaoCacheSupport
+								&&  isVaoCacheable(_render, draw) )
 								{
-									m_program[boundProgram.idx].unbindAttributes();
-									m_program[boundProgram.idx].unbindInstanceData();
-								}
+									const uint64_t hash = getVaoHash(currentProgram, draw);
+									VaoGL* vao = m_vaoCache.find(hash);
 
-								boundProgram = currentProgram;
+									if (NULL == vao)
+									{
+										VaoGL newVao;
+										GL_CHECK(glGenVertexArrays(1, &newVao.m_id) );
+										GL_CHECK(glBindVertexArray(newVao.m_id) );
+										initVaoBuffers(newVao, draw);
 
-								program.bindAttributesBegin();
+										bindIndexBuffer(draw.m_indexBuffer);
+										bindVertexStreams(program, draw);
 
-								if (UINT8_MAX != draw.m_streamMask)
-								{
-									for (uint32_t idx = 0, streamMask = draw.m_streamMask
-										; 0 != streamMask
-										; streamMask >>= 1, idx += 1
-										)
+										m_vaoCache.add(hash, newVao, currentProgram.idx);
+									}
+									else
 									{
-										const uint32_t ntz = bx::uint32_cnttz(streamMask);
-										streamMask >>= ntz;
-										idx         += ntz;
-
-										const VertexBufferGL& vb = m_vertexBuffers[draw.m_stream[idx].m_handle.idx];
-										const uint16_t decl = isValid(draw.m_stream[idx].m_layoutHandle)
-											? draw.m_stream[idx].m_layoutHandle.idx
-											: vb.m_layoutHandle.idx;
-										GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vb.m_id) );
-										program.bindAttributes(m_vertexLayouts[decl], draw.m_stream[idx].m_startVertex);
+										GL_CHECK(glBindVertexArray(vao->m_id) );
 									}
 								}
-
-								if (isValid(draw.m_instanceDataBuffer) )
+								else
 								{
-									GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffers[draw.m_instanceDataBuffer.idx].m_id) );
-									program.bindInstanceData(draw.m_instanceDataStride, draw.m_instanceDataOffset);
-								}
+									if (m_vaoCacheSupport)
+									{
+										// Uncached streams are specified on default VAO, which
+										// doesn't track current index buffer.
+										GL_CHECK(glBindVertexArray(m_vao) );
+										bindIndexBuffer(draw.m_indexBuffer);
+									}
 
-								program.bindAttributesEnd();
+									if (isValid(boundProgram) )
+									{
+										m_program[boundProgram.idx].unbindAttributes();
+										m_program[boundProgram.idx].unbindInstanceData();
+									}
+
+									boundProgram = currentProgram;
+
+									bindVertexStreams(program, draw);
+								}
 							}
 						}
 					}
@@ -8241,6 +8943,11 @@ namespace bgfx { namespace gl
 
 			if (isValid(boundProgram) )
 			{
+				if (m_vaoCacheSupport)
+				{
+					GL_CHECK(glBindVertexArray(m_vao) );
+				}
+
 				m_program[boundProgram.idx].unbindAttributes();
 				boundProgram = BGFX_INVALID_HANDLE;
 			}
@@ -8486,6 +9193,49 @@ namespace bgfx { namespace gl
 				}
 #endif // BGFX_CONFIG_RENDERER_OPENGL
 
+				if (m_vaoCacheSupport)
+				{
+					pos++;
+					tvm.printf(10, pos++, 0x8b, "     VAO cache: %4d / %4d "
+						, m_vaoCache.getCount()
+						, BGFX_GL_CONFIG_VAO_CACHE_SIZE
+						);
+				}
+
+#if BGFX_GL_CONFIG_UNIFORM_BUFFER
+				if (m_uniformRing.isValid() )
+				{
+					pos++;
+					tvm.printf(10, pos++, 0x8b, "  Uniform ring: %s, stalls %d, overflows %d "
+						, NULL != m_uniformRing.m_data ? "persistent" : "sub data"
+						, m_uniformRing.m_numStalls
+						, m_uniformRing.m_numOverflows
+						);
+				}
+#endif // BGFX_GL_CONFIG_UNIFORM_BUFFER
+
+#if BGFX_GL_CONFIG_PERSISTENT_BUFFER
+				if (m_persistentBufferSupport)
+				{
+					const IndexBufferGL&  tib = m_indexBuffers[_render->m_transientIb->handle.idx];
+					const VertexBufferGL& tvb = m_vertexBuffers[_render->m_transientVb->handle.idx];
+
+					pos++;
+					tvm.printf(10, pos++, 0x8b, " Transient buf: stalls %d / %d "
+						, NULL != tib.m_persistent ? tib.m_persistent->m_numStalls : 0
+						, NULL != tvb.m_persistent ? tvb.m_persistent->m_numStalls : 0
+						);
+
+					if (m_stagingRing.isValid() )
+					{
+						tvm.printf(10, pos++, 0x8b, "  Staging ring: stalls %d, overflows %d "
+							, m_stagingRing.m_numStalls
+							, m_stagingRing.m_numOverflows
+							);
+					}
+				}
+#endif // BGFX_GL_CONFIG_PERSISTENT_BUFFER
+
 				pos++;
 				double captureMs = double(captureElapsed)*toMs;
 				tvm.printf(10, pos++, 0x8b, "     Capture: %7.4f [ms] ", captureMs);
@@ -8511,6 +9261,36 @@ namespace bgfx { namespace gl
 
 			BGFX_GL_PROFILER_END();
 		}
+
+#if BGFX_GL_CONFIG_UNIFORM_BUFFER
+		if (m_uniformRing.isValid() )
+		{
+			m_uniformRing.frame();
+		}
+#endif // BGFX_GL_CONFIG_UNIFORM_BUFFER
+
+#if BGFX_GL_CONFIG_PERSISTENT_BUFFER
+		if (m_stagingRing.isValid() )
+		{
+			m_stagingRing.frame();
+		}
+
+		// Frame is handed back to API thread after submit, point its transient
+		// data to storage GPU is done with so that allocations are written in
+		// place. Capture renderer reads transient data when frame is recorded,
+		// and mapped storage is write only, so with capture frame keeps its
+		// CPU copy, and it's uploaded on submit.
+		TransientIndexBuffer*  tib = _render->m_transientIb;
+		TransientVertexBuffer* tvb = _render->m_transientVb;
+		uint8_t* ibData = frameTransientBuffer(m_indexBuffers[tib->handle.idx], tib->data);
+		uint8_t* vbData = frameTransientBuffer(m_vertexBuffers[tvb->handle.idx], tvb->data);
+
+		if (!BX_ENABLED(BGFX_CONFIG_RENDERER_CAPTURE) )
+		{
+			tib->data = ibData;
+			tvb->data = vbData;
+		}
+#endif // BGFX_GL_CONFIG_PERSISTENT_BUFFER
 	}
 } } // namespace bgfx
 
@@ -47,6 +47,44 @@
 #	define BGFX_GL_CONFIG_TEXTURE_READ_BACK_EMULATION 0
 #endif // BGFX_GL_CONFIG_TEXTURE_READ_BACK_EMULATION
 
+// Source uniforms of shaders compiled with `shaderc --uniform-buffer` from std140
+// uniform blocks in a persistently mapped ring buffer instead of glUniform* calls.
+#ifndef BGFX_GL_CONFIG_UNIFORM_BUFFER
+#	define BGFX_GL_CONFIG_UNIFORM_BUFFER (BGFX_CONFIG_RENDERER_OPENGL >= 31)
+#endif // BGFX_GL_CONFIG_UNIFORM_BUFFER
+
+#ifndef BGFX_GL_CONFIG_UNIFORM_BUFFER_SIZE
+#	define BGFX_GL_CONFIG_UNIFORM_BUFFER_SIZE (1<<20) // Ring size per frame in flight.
+#endif // BGFX_GL_CONFIG_UNIFORM_BUFFER_SIZE
+
+#ifndef BGFX_GL_CONFIG_UNIFORM_BLOCK_SIZE
+#	define BGFX_GL_CONFIG_UNIFORM_BLOCK_SIZE (16<<10) // GL_MAX_UNIFORM_BLOCK_SIZE minimum.
+#endif // BGFX_GL_CONFIG_UNIFORM_BLOCK_SIZE
+
+// Back transient buffers with persistently mapped storage that Frame writes
+// into directly, and stage dynamic buffer updates through a mapped ring buffer.
+#ifndef BGFX_GL_CONFIG_PERSISTENT_BUFFER
+#	define BGFX_GL_CONFIG_PERSISTENT_BUFFER (BGFX_CONFIG_RENDERER_OPENGL >= 31)
+#endif // BGFX_GL_CONFIG_PERSISTENT_BUFFER
+
+#ifndef BGFX_GL_CONFIG_PERSISTENT_BUFFER_FRAMES
+#	define BGFX_GL_CONFIG_PERSISTENT_BUFFER_FRAMES (BGFX_CONFIG_MAX_FRAME_LATENCY+1) // Fenced segments per buffer.
+#endif // BGFX_GL_CONFIG_PERSISTENT_BUFFER_FRAMES
+
+#ifndef BGFX_GL_CONFIG_STAGING_BUFFER_SIZE
+#	define BGFX_GL_CONFIG_STAGING_BUFFER_SIZE (4<<20) // Dynamic buffer update ring size per frame in flight.
+#endif // BGFX_GL_CONFIG_STAGING_BUFFER_SIZE
+
+// Cache one VAO per program/vertex stream/index buffer combination instead of
+// re-specifying vertex attributes on shared VAO whenever streams change.
+#ifndef BGFX_GL_CONFIG_VAO_CACHE
+#	define BGFX_GL_CONFIG_VAO_CACHE 1
+#endif // BGFX_GL_CONFIG_VAO_CACHE
+
+#ifndef BGFX_GL_CONFIG_VAO_CACHE_SIZE
+#	define BGFX_GL_CONFIG_VAO_CACHE_SIZE 1024 // Least recently used VAO is evicted when full.
+#endif // BGFX_GL_CONFIG_VAO_CACHE_SIZE
+
 #define BGFX_GL_PROFILER_BEGIN(_view, _abgr)                                               \
 	BX_MACRO_BLOCK_BEGIN                                                                   \
 		GL_CHECK(glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, s_viewName[view]) ); \
@@ -843,6 +881,82 @@ typedef uint64_t GLuint64;
 #	define GL_SHADER_STORAGE_BUFFER 0x90D2
 #endif // GL_SHADER_STORAGE_BUFFER
 
+#ifndef GL_UNIFORM_BUFFER
+#	define GL_UNIFORM_BUFFER 0x8A11
+#endif // GL_UNIFORM_BUFFER
+
+#ifndef GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+#	define GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT 0x8A34
+#endif // GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+
+#ifndef GL_ACTIVE_UNIFORM_BLOCKS
+#	define GL_ACTIVE_UNIFORM_BLOCKS 0x8A36
+#endif // GL_ACTIVE_UNIFORM_BLOCKS
+
+#ifndef GL_UNIFORM_BLOCK_INDEX
+#	define GL_UNIFORM_BLOCK_INDEX 0x8A3A
+#endif // GL_UNIFORM_BLOCK_INDEX
+
+#ifndef GL_UNIFORM_OFFSET
+#	define GL_UNIFORM_OFFSET 0x8A3B
+#endif // GL_UNIFORM_OFFSET
+
+#ifndef GL_UNIFORM_BLOCK_DATA_SIZE
+#	define GL_UNIFORM_BLOCK_DATA_SIZE 0x8A40
+#endif // GL_UNIFORM_BLOCK_DATA_SIZE
+
+#ifndef GL_INVALID_INDEX
+#	define GL_INVALID_INDEX 0xFFFFFFFFu
+#endif // GL_INVALID_INDEX
+
+#ifndef GL_MAP_WRITE_BIT
+#	define GL_MAP_WRITE_BIT 0x0002
+#endif // GL_MAP_WRITE_BIT
+
+#ifndef GL_MAP_PERSISTENT_BIT
+#	define GL_MAP_PERSISTENT_BIT 0x0040
+#endif // GL_MAP_PERSISTENT_BIT
+
+#ifndef GL_MAP_COHERENT_BIT
+#	define GL_MAP_COHERENT_BIT 0x0080
+#endif // GL_MAP_COHERENT_BIT
+
+#ifndef GL_DYNAMIC_STORAGE_BIT
+#	define GL_DYNAMIC_STORAGE_BIT 0x0100
+#endif // GL_DYNAMIC_STORAGE_BIT
+
+#ifndef GL_COPY_READ_BUFFER
+#	define GL_COPY_READ_BUFFER 0x8F36
+#endif // GL_COPY_READ_BUFFER
+
+#ifndef GL_COPY_WRITE_BUFFER
+#	define GL_COPY_WRITE_BUFFER 0x8F37
+#endif // GL_COPY_WRITE_BUFFER
+
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+#	define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#endif // GL_SYNC_GPU_COMMANDS_COMPLETE
+
+#ifndef GL_SYNC_FLUSH_COMMANDS_BIT
+#	define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#endif // GL_SYNC_FLUSH_COMMANDS_BIT
+
+#ifndef GL_ALREADY_SIGNALED
+#	define GL_ALREADY_SIGNALED 0x911A
+#endif // GL_ALREADY_SIGNALED
+
+#ifndef GL_TIMEOUT_EXPIRED
+#	define GL_TIMEOUT_EXPIRED 0x911B
+#endif // GL_TIMEOUT_EXPIRED
+
+#ifndef GL_CONDITION_SATISFIED
+#	define GL_CONDITION_SATISFIED 0x911C
+#endif // GL_CONDITION_SATISFIED
+
+#ifndef GL_WAIT_FAILED
+#	define GL_WAIT_FAILED 0x911D
+#endif // GL_WAIT_FAILED
+
 #ifndef GL_IMAGE_1D
 #	define GL_IMAGE_1D 0x904C
 #endif // GL_IMAGE_1D
@@ -1288,12 +1402,53 @@ namespace bgfx { namespace gl
 		HashMap m_hashMap;
 	};
 
+	/// Buffer backed by BGFX_GL_CONFIG_PERSISTENT_BUFFER_FRAMES persistently mapped
+	/// storages, one is written by CPU while GPU may still read the others.
+	struct PersistentBufferGL
+	{
+		PersistentBufferGL()
+			: m_size(0)
+			, m_target(0)
+			, m_current(0)
+			, m_numStalls(0)
+		{
+			bx::memSet(m_id,    0, sizeof(m_id)    );
+			bx::memSet(m_data,  0, sizeof(m_data)  );
+			bx::memSet(m_fence, 0, sizeof(m_fence) );
+		}
+
+		bool create(GLenum _target, uint32_t _size);
+		void destroy();
+
+		/// Fences current storage, and switches to next one once GPU is done with it.
+		void frame();
+
+		GLuint getId() const
+		{
+			return m_id[m_current];
+		}
+
+		uint8_t* getData() const
+		{
+			return m_data[m_current];
+		}
+
+		GLuint   m_id[BGFX_GL_CONFIG_PERSISTENT_BUFFER_FRAMES];
+		uint8_t* m_data[BGFX_GL_CONFIG_PERSISTENT_BUFFER_FRAMES];
+		GLsync   m_fence[BGFX_GL_CONFIG_PERSISTENT_BUFFER_FRAMES];
+		uint32_t m_size;
+		GLenum   m_target;
+		uint8_t  m_current;
+		uint32_t m_numStalls;
+	};
+
 	struct IndexBufferGL
 	{
 		void create(uint32_t _size, void* _data, uint16_t _flags)
 		{
 			m_size  = _size;
 			m_flags = _flags;
+			m_persistent = NULL;
 
 			GL_CHECK(glGenBuffers(1, &m_id) );
 			BX_ASSERT(0 != m_id, "Failed to generate buffer id.");
@@ -1331,6 +1486,7 @@ namespace bgfx { namespace gl
 		GLuint m_id;
 		uint32_t m_size;
 		uint16_t m_flags;
+		PersistentBufferGL* m_persistent; // Set for transient buffers, m_id follows current storage.
 	};
 
 	struct VertexBufferGL
@@ -1339,6 +1495,7 @@ namespace bgfx { namespace gl
 		{
 			m_size = _size;
 			m_layoutHandle = _layoutHandle;
+			m_persistent = NULL;
 			const bool drawIndirect = 0 != (_flags & BGFX_BUFFER_DRAW_INDIRECT);
 
 			m_target = drawIndirect ? GL_DRAW_INDIRECT_BUFFER : GL_ARRAY_BUFFER;
@@ -1380,6 +1537,7 @@ namespace bgfx { namespace gl
 		GLenum m_target;
 		uint32_t m_size;
 		VertexLayoutHandle m_layoutHandle;
+		PersistentBufferGL* m_persistent; // Set for transient buffers, m_id follows current storage.
 	};
 
 	struct TextureGL
@@ -1475,6 +1633,18 @@ namespace bgfx { namespace gl
 		Attachment m_attachment[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS];
 	};
 
+	/// Uniform locations with this bit set address a member of a shaderc emitted
+	/// uniform block, binding slot is in bits 16-23 and std140 offset in bits 0-15.
+	constexpr uint32_t kUniformBlockLoc = UINT32_C(0x80000000);
+
+	/// Uniform block binding slots, vertex (and compute) stage is 0, fragment stage is 1.
+	constexpr uint8_t kNumUniformBlocks = 2;
+
+	inline uint32_t toUniformBlockLoc(uint8_t _slot, uint32_t _offset)
+	{
+		return kUniformBlockLoc | (uint32_t(_slot)<<16) | _offset;
+	}
+
 	struct ProgramGL
 	{
 		ProgramGL()
@@ -1483,6 +1653,7 @@ namespace bgfx { namespace gl
 			, m_numPredefined(0)
 		{
 			m_instanceData[0] = -1;
+			bx::memSet(m_uniformBlockSize, 0, sizeof(m_uniformBlockSize) );
 		}
 
 		void create(const ShaderGL& _vsh, const ShaderGL& _fsh);
@@ -1508,8 +1679,65 @@ namespace bgfx { namespace gl
 		uint8_t m_numSamplers;
 
 		UniformBuffer* m_constantBuffer;
-		PredefinedUniform m_predefined[PredefinedUniform::Count];
+		PredefinedUniform m_predefined[PredefinedUniform::Count*kNumUniformBlocks]; // Block members are per stage.
 		uint8_t m_numPredefined;
+
+		uint16_t m_uniformBlockSize[kNumUniformBlocks];
+	};
+
+	struct VaoGL
+	{
+		GLuint m_id;
+		uint16_t m_indexBuffer;
+		uint16_t m_vertexBuffer[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1]; // Streams and instance data.
+		uint8_t m_numVertexBuffers;
+	};
+
+	void release(VaoGL& _vao);
+	bool usesIndexBuffer(const VaoGL& _vao, uint16_t _idx);
+	bool usesVertexBuffer(const VaoGL& _vao, uint16_t _idx);
+
+	/// Ring buffer split into BGFX_GL_CONFIG_PERSISTENT_BUFFER_FRAMES fenced per frame
+	/// segments, used for uniform blocks and dynamic buffer update staging.
+	struct RingBufferGL
+	{
+		RingBufferGL()
+			: m_id(0)
+			, m_target(0)
+			, m_data(NULL)
+			, m_size(0)
+			, m_pos(0)
+			, m_align(0)
+			, m_frame(0)
+			, m_numStalls(0)
+			, m_numOverflows(0)
+		{
+			bx::memSet(m_fence, 0, sizeof(m_fence) );
+		}
+
+		void create(GLenum _target, uint32_t _size, uint32_t _align, bool _persistent);
+		void destroy();
+
+		/// Fences current segment, and switches to next one once GPU is done with it.
+		void frame();
+
+		uint32_t write(const void* _data, uint32_t _size);
+
+		bool isValid() const
+		{
+			return 0 != m_id;
+		}
+
+		GLuint   m_id;
+		GLenum   m_target;
+		uint8_t* m_data; // NULL when not persistently mapped, writes go through glBufferSubData.
+		GLsync   m_fence[BGFX_GL_CONFIG_PERSISTENT_BUFFER_FRAMES];
+		uint32_t m_size; // Per frame segment size.
+		uint32_t m_pos;
+		uint32_t m_align;
+		uint32_t m_frame;
+		uint32_t m_numStalls;
+		uint32_t m_numOverflows;
 	};
 
 	struct TimerQueryGL
@@ -244,6 +244,10 @@ namespace bgfx { namespace noop
 			const int64_t timerFreq = bx::getHPFrequency();
 			const int64_t timeBegin = bx::getHPCounter();
 
+			// Nothing is rendered, but frame is still sorted like in every other renderer, so
+			// that noop renderer can be used to measure CPU overhead of bgfx API.
+			_render->sort();
+
 			Stats& perfStats = _render->m_perfStats;
 			perfStats.cpuTimeBegin  = timeBegin;
 			perfStats.cpuTimeEnd    = timeBegin;
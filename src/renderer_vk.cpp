@@ -838,7 +838,6 @@ VK_IMPORT_DEVICE
 	template<> VkObjectType getType<VkBuffer             >() { return VK_OBJECT_TYPE_BUFFER;                }
 	template<> VkObjectType getType<VkCommandPool        >() { return VK_OBJECT_TYPE_COMMAND_POOL;          }
 	template<> VkObjectType getType<VkDescriptorPool     >() { return VK_OBJECT_TYPE_DESCRIPTOR_POOL;       }
-	template<> VkObjectType getType<VkDescriptorSet      >() { return VK_OBJECT_TYPE_DESCRIPTOR_SET;        }
 	template<> VkObjectType getType<VkDescriptorSetLayout>() { return VK_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT; }
 	template<> VkObjectType getType<VkDeviceMemory       >() { return VK_OBJECT_TYPE_DEVICE_MEMORY;         }
 	template<> VkObjectType getType<VkFence              >() { return VK_OBJECT_TYPE_FENCE;                 }
@@ -881,6 +880,8 @@ VK_IMPORT_DEVICE
 		}
 	}
 
+	static BarrierStatsVK s_barrierStats;
+
 	void setMemoryBarrier(
 		  VkCommandBuffer _commandBuffer
 		, VkPipelineStageFlags _srcStages
@@ -893,6 +894,8 @@ VK_IMPORT_DEVICE
 		mb.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
 		mb.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
 
+		s_barrierStats.m_numPipelineBarriers++;
+
 		vkCmdPipelineBarrier(
 			  _commandBuffer
 			, _srcStages
@@ -907,16 +910,18 @@ VK_IMPORT_DEVICE
 			);
 	}
 
-	void setImageMemoryBarrier(
-		  VkCommandBuffer _commandBuffer
-		, VkImage _image
+	static void initImageMemoryBarrier(
+		  VkImage _image
 		, VkImageAspectFlags _aspectMask
 		, VkImageLayout _oldLayout
 		, VkImageLayout _newLayout
-		, uint32_t _baseMipLevel = 0
-		, uint32_t _levelCount = VK_REMAINING_MIP_LEVELS
-		, uint32_t _baseArrayLayer = 0
-		, uint32_t _layerCount = VK_REMAINING_ARRAY_LAYERS
+		, uint32_t _baseMipLevel
+		, uint32_t _levelCount
+		, uint32_t _baseArrayLayer
+		, uint32_t _layerCount
+		, VkImageMemoryBarrier* _imb
+		, VkPipelineStageFlags* _srcStageMask
+		, VkPipelineStageFlags* _dstStageMask
 		)
 	{
 		BX_ASSERT(true
@@ -1038,21 +1043,57 @@ VK_IMPORT_DEVICE
 			break;
 		}
 
+		_imb->sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		_imb->pNext = NULL;
+		_imb->srcAccessMask = srcAccessMask;
+		_imb->dstAccessMask = dstAccessMask;
+		_imb->oldLayout = _oldLayout;
+		_imb->newLayout = _newLayout;
+		_imb->srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		_imb->dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		_imb->image = _image;
+		_imb->subresourceRange.aspectMask     = _aspectMask;
+		_imb->subresourceRange.baseMipLevel   = _baseMipLevel;
+		_imb->subresourceRange.levelCount     = _levelCount;
+		_imb->subresourceRange.baseArrayLayer = _baseArrayLayer;
+		_imb->subresourceRange.layerCount     = _layerCount;
+
+		*_srcStageMask = srcStageMask;
+		*_dstStageMask = dstStageMask;
+	}
+
+	void setImageMemoryBarrier(
+		  VkCommandBuffer _commandBuffer
+		, VkImage _image
+		, VkImageAspectFlags _aspectMask
+		, VkImageLayout _oldLayout
+		, VkImageLayout _newLayout
+		, uint32_t _baseMipLevel = 0
+		, uint32_t _levelCount = VK_REMAINING_MIP_LEVELS
+		, uint32_t _baseArrayLayer = 0
+		, uint32_t _layerCount = VK_REMAINING_ARRAY_LAYERS
+		)
+	{
 		VkImageMemoryBarrier imb;
-		imb.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-		imb.pNext = NULL;
-		imb.srcAccessMask = srcAccessMask;
-		imb.dstAccessMask = dstAccessMask;
-		imb.oldLayout = _oldLayout;
-		imb.newLayout = _newLayout;
-		imb.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-		imb.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-		imb.image = _image;
-		imb.subresourceRange.aspectMask     = _aspectMask;
-		imb.subresourceRange.baseMipLevel   = _baseMipLevel;
-		imb.subresourceRange.levelCount     = _levelCount;
-		imb.subresourceRange.baseArrayLayer = _baseArrayLayer;
-		imb.subresourceRange.layerCount     = _layerCount;
+		VkPipelineStageFlags srcStageMask;
+		VkPipelineStageFlags dstStageMask;
+		initImageMemoryBarrier(
+			  _image
+			, _aspectMask
+			, _oldLayout
+			, _newLayout
+			, _baseMipLevel
+			, _levelCount
+			, _baseArrayLayer
+			, _layerCount
+			, &imb
+			, &srcStageMask
+			, &dstStageMask
+			);
+
+		s_barrierStats.m_numPipelineBarriers++;
+		s_barrierStats.m_numImageBarriers++;
+
 		vkCmdPipelineBarrier(_commandBuffer
 			, srcStageMask
 			, dstStageMask
@@ -1066,8 +1107,112 @@ VK_IMPORT_DEVICE
 			);
 	}
 
+	ImageBarrierBatchVK::ImageBarrierBatchVK()
+		: m_srcStageMask(0)
+		, m_dstStageMask(0)
+	{
+	}
+
+	void ImageBarrierBatchVK::add(VkImage _image, VkImageAspectFlags _aspectMask, VkImageLayout _oldLayout, VkImageLayout _newLayout)
+	{
+		VkImageMemoryBarrier imb;
+		VkPipelineStageFlags srcStageMask;
+		VkPipelineStageFlags dstStageMask;
+		initImageMemoryBarrier(
+			  _image
+			, _aspectMask
+			, _oldLayout
+			, _newLayout
+			, 0
+			, VK_REMAINING_MIP_LEVELS
+			, 0
+			, VK_REMAINING_ARRAY_LAYERS
+			, &imb
+			, &srcStageMask
+			, &dstStageMask
+			);
+
+		m_srcStageMask |= srcStageMask;
+		m_dstStageMask |= dstStageMask;
+
+		for (uint32_t ii = 0, num = uint32_t(m_barriers.size() ); ii < num; ++ii)
+		{
+			VkImageMemoryBarrier& barrier = m_barriers[ii];
+
+			if (barrier.image == imb.image)
+			{
+				// Image is transitioned again before anything used it, merge
+				// both transitions into one.
+				BX_ASSERT(barrier.newLayout == _oldLayout, "Image layout transitions are out of order.");
+				barrier.newLayout     = imb.newLayout;
+				barrier.dstAccessMask = imb.dstAccessMask;
+				return;
+			}
+		}
+
+		m_barriers.push_back(imb);
+	}
+
+	void ImageBarrierBatchVK::flush(VkCommandBuffer _commandBuffer)
+	{
+		if (m_barriers.empty() )
+		{
+			return;
+		}
+
+		// Top and bottom of pipe don't add anything when combined with other
+		// stages.
+		VkPipelineStageFlags srcStageMask = m_srcStageMask;
+		if (VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT != srcStageMask)
+		{
+			srcStageMask &= ~VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+		}
+
+		VkPipelineStageFlags dstStageMask = m_dstStageMask;
+		if (VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT != dstStageMask)
+		{
+			dstStageMask &= ~VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+		}
+
+		s_barrierStats.m_numPipelineBarriers++;
+		s_barrierStats.m_numImageBarriers += uint32_t(m_barriers.size() );
+
+		vkCmdPipelineBarrier(_commandBuffer
+			, srcStageMask
+			, dstStageMask
+			, 0
+			, 0
+			, NULL
+			, 0
+			, NULL
+			, uint32_t(m_barriers.size() )
+			, m_barriers.data()
+			);
+
+		m_barriers.clear();
+		m_srcStageMask = 0;
+		m_dstStageMask = 0;
+	}
+
 #define MAX_DESCRIPTOR_SETS (1024 * BGFX_CONFIG_MAX_FRAME_LATENCY)
 
+#define BGFX_VK_PIPELINE_CACHE_MAGIC   BX_MAKEFOURCC('V', 'K', 'P', 'C')
+#define BGFX_VK_PIPELINE_CACHE_VERSION 1
+// Key under which whole pipeline cache is stored with CallbackI::cacheWrite.
+#define BGFX_VK_PIPELINE_CACHE_ID      UINT64_C(0x62676678766b7063)
+
+	struct PipelineCacheHeaderVK
+	{
+		uint32_t m_magic;
+		uint32_t m_version;
+		uint32_t m_size;
+		uint32_t m_hash;
+		uint32_t m_vendorId;
+		uint32_t m_deviceId;
+		uint32_t m_driverVersion;
+		uint8_t  m_uuid[VK_UUID_SIZE];
+	};
+
 	struct RendererContextVK : public RendererContextI
 	{
 		RendererContextVK()
@@ -1860,6 +2005,8 @@ VK_IMPORT_DEVICE
 					goto error;
 				}
 
+				m_memoryAllocator.init(m_device, m_allocatorCb, m_numFramesInFlight);
+
 				result = m_cmd.alloc(&m_commandBuffer);
 
 				if (VK_SUCCESS != result)
@@ -1916,30 +2063,66 @@ VK_IMPORT_DEVICE
 					{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,          MAX_DESCRIPTOR_SETS * BGFX_CONFIG_MAX_TEXTURE_SAMPLERS },
 				};
 
+				// One pool per frame in flight. Descriptor sets are never freed
+				// individually, whole pool is reset once frame that used it is
+				// completed and cached sets are invalidated.
 				VkDescriptorPoolCreateInfo dpci;
 				dpci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
 				dpci.pNext = NULL;
-				dpci.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+				dpci.flags = 0;
 				dpci.maxSets       = MAX_DESCRIPTOR_SETS;
 				dpci.poolSizeCount = BX_COUNTOF(dps);
 				dpci.pPoolSizes    = dps;
 
-				result = vkCreateDescriptorPool(m_device, &dpci, m_allocatorCb, &m_descriptorPool);
-
-				if (VK_SUCCESS != result)
+				for (uint32_t ii = 0; ii < m_numFramesInFlight; ++ii)
 				{
-					BX_TRACE("Init error: vkCreateDescriptorPool failed %d: %s.", result, getName(result) );
-					goto error;
+					result = vkCreateDescriptorPool(m_device, &dpci, m_allocatorCb, &m_descriptorPool[ii]);
+
+					if (VK_SUCCESS != result)
+					{
+						BX_TRACE("Init error: vkCreateDescriptorPool failed %d: %s.", result, getName(result) );
+						goto error;
+					}
+
+					m_descriptorSetCount[ii] = 0;
 				}
 
+				m_descriptorSetCacheHits   = 0;
+				m_descriptorSetCacheMisses = 0;
+
+				bx::memSet(&m_pipelineCacheStats, 0, sizeof(m_pipelineCacheStats) );
+
 				VkPipelineCacheCreateInfo pcci;
 				pcci.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
 				pcci.pNext = NULL;
 				pcci.flags = 0;
 				pcci.initialDataSize = 0;
 				pcci.pInitialData    = NULL;
+
+				void* cacheData = NULL;
+
+				if (BX_ENABLED(BGFX_CONFIG_PIPELINE_CACHE_BLOB) )
+				{
+					cacheData = loadPipelineCache(pcci);
+				}
+
 				result = vkCreatePipelineCache(m_device, &pcci, m_allocatorCb, &m_pipelineCache);
 
+				if (VK_SUCCESS != result
+				&&  0 != pcci.initialDataSize)
+				{
+					BX_TRACE("Init: Discarding pipeline cache blob, vkCreatePipelineCache failed %d: %s.", result, getName(result) );
+
+					pcci.initialDataSize = 0;
+					pcci.pInitialData    = NULL;
+					result = vkCreatePipelineCache(m_device, &pcci, m_allocatorCb, &m_pipelineCache);
+				}
+
+				if (NULL != cacheData)
+				{
+					BX_FREE(g_allocator, cacheData);
+				}
+
 				if (VK_SUCCESS != result)
 				{
 					BX_TRACE("Init error: vkCreatePipelineCache failed %d: %s.", result, getName(result) );
@@ -1955,8 +2138,23 @@ VK_IMPORT_DEVICE
 					BX_TRACE("Create scratch buffer %d", ii);
 					m_scratchBuffer[ii].create(size, count);
 				}
+
+				result = m_stagingRing.create(BGFX_CONFIG_STAGING_BUFFER_SIZE, m_numFramesInFlight);
+				BX_WARN(VK_SUCCESS == result, "Failed to create staging ring, using dedicated staging buffers.");
 			}
 
+			bx::memSet(&m_pipelineStats, 0, sizeof(m_pipelineStats) );
+			m_pipelineCompiler.init(m_device, m_allocatorCb, BGFX_CONFIG_MAX_PIPELINE_COMPILE_THREADS);
+
+			result = m_commandRecorder.init(
+				  m_device
+				, m_allocatorCb
+				, m_globalQueueFamily
+				, m_numFramesInFlight
+				, BGFX_CONFIG_MAX_COMMAND_RECORD_THREADS
+				);
+			BX_WARN(VK_SUCCESS == result, "Failed to create command recorder, recording on render thread only.");
+
 			errorState = ErrorState::DescriptorCreated;
 
 			if (NULL == vkSetDebugUtilsObjectNameEXT)
@@ -2018,12 +2216,19 @@ VK_IMPORT_DEVICE
 				BX_FALLTHROUGH;
 
 			case ErrorState::DescriptorCreated:
+				m_pipelineCompiler.shutdown();
+				m_commandRecorder.shutdown();
+
 				for (uint32_t ii = 0; ii < m_numFramesInFlight; ++ii)
 				{
 					m_scratchBuffer[ii].destroy();
 				}
+				m_stagingRing.destroy();
 				vkDestroy(m_pipelineCache);
-				vkDestroy(m_descriptorPool);
+				for (uint32_t ii = 0; ii < m_numFramesInFlight; ++ii)
+				{
+					vkDestroy(m_descriptorPool[ii]);
+				}
 				BX_FALLTHROUGH;
 
 			case ErrorState::SwapChainCreated:
@@ -2032,6 +2237,7 @@ VK_IMPORT_DEVICE
 
 			case ErrorState::CommandQueueCreated:
 				m_cmd.shutdown();
+				m_memoryAllocator.shutdown();
 				BX_FALLTHROUGH;
 
 			case ErrorState::DeviceCreated:
@@ -2073,6 +2279,11 @@ VK_IMPORT_DEVICE
 
 			preReset();
 
+			m_pipelineCompiler.shutdown();
+			collectPipelines();
+
+			m_commandRecorder.shutdown();
+
 			m_pipelineStateCache.invalidate();
 			m_descriptorSetLayoutCache.invalidate();
 			m_renderPassCache.invalidate();
@@ -2085,6 +2296,8 @@ VK_IMPORT_DEVICE
 				m_scratchBuffer[ii].destroy();
 			}
 
+			m_stagingRing.destroy();
+
 			for (uint32_t ii = 0; ii < BX_COUNTOF(m_frameBuffers); ++ii)
 			{
 				m_frameBuffers[ii].destroy();
@@ -2113,9 +2326,20 @@ VK_IMPORT_DEVICE
 			m_backBuffer.destroy();
 
 			m_cmd.shutdown();
+			m_memoryAllocator.shutdown();
+
+			for (uint32_t ii = 0; ii < m_numFramesInFlight; ++ii)
+			{
+				m_descriptorSetCache[ii].invalidate();
+				vkDestroy(m_descriptorPool[ii]);
+			}
+
+			if (BX_ENABLED(BGFX_CONFIG_PIPELINE_CACHE_BLOB) )
+			{
+				savePipelineCache();
+			}
 
 			vkDestroy(m_pipelineCache);
-			vkDestroy(m_descriptorPool);
 
 			vkDestroyDevice(m_device, m_allocatorCb);
 
@@ -2239,6 +2463,7 @@ VK_IMPORT_DEVICE
 
 		void destroyShader(ShaderHandle _handle) override
 		{
+			waitPipelines();
 			m_shaders[_handle.idx].destroy();
 		}
 
@@ -2249,6 +2474,7 @@ VK_IMPORT_DEVICE
 
 		void destroyProgram(ProgramHandle _handle) override
 		{
+			waitPipelines();
 			m_program[_handle.idx].destroy();
 		}
 
@@ -2263,7 +2489,12 @@ VK_IMPORT_DEVICE
 
 		void updateTexture(TextureHandle _handle, uint8_t _side, uint8_t _mip, const Rect& _rect, uint16_t _z, uint16_t _depth, uint16_t _pitch, const Memory* _mem) override
 		{
-			m_textures[_handle.idx].update(m_commandBuffer, _side, _mip, _rect, _z, _depth, _pitch, _mem);
+			TextureVK& texture = m_textures[_handle.idx];
+
+			if (texture.update(m_commandBuffer, _side, _mip, _rect, _z, _depth, _pitch, _mem) )
+			{
+				m_textureCopies.push_back(&texture);
+			}
 		}
 
 		void updateTextureEnd() override
@@ -2272,6 +2503,8 @@ VK_IMPORT_DEVICE
 
 		void readTexture(TextureHandle _handle, void* _data, uint8_t _mip) override
 		{
+			flushTextureCopies();
+
 			TextureVK& texture = m_textures[_handle.idx];
 
 			uint32_t height = bx::uint32_max(1, texture.m_height >> _mip);
@@ -2528,11 +2761,49 @@ VK_IMPORT_DEVICE
 		{
 			if (VK_NULL_HANDLE != _object)
 			{
-				m_cmd.release(uint64_t(_object.vk), getType<Ty>() );
+				const VkObjectType type = getType<Ty>();
+
+				// Cached descriptor sets might reference released object, and
+				// its handle might be reused by driver once it's destroyed.
+				if (VK_OBJECT_TYPE_IMAGE_VIEW == type
+				||  VK_OBJECT_TYPE_BUFFER     == type
+				||  VK_OBJECT_TYPE_SAMPLER    == type)
+				{
+					for (uint32_t ii = 0; ii < m_numFramesInFlight; ++ii)
+					{
+						m_descriptorSetCache[ii].release(uint64_t(_object.vk) );
+					}
+				}
+
+				m_cmd.release(uint64_t(_object.vk), type);
 				_object = VK_NULL_HANDLE;
 			}
 		}
 
+		void release(DeviceMemoryAllocationVK& _allocation)
+		{
+			m_memoryAllocator.release(_allocation, m_cmd.m_currentFrameInFlight);
+		}
+
+		void resetDescriptorSets()
+		{
+			const uint32_t frame = m_cmd.m_currentFrameInFlight;
+
+			// Pool keeps cached sets alive across frames, it's reset only when
+			// it's getting full. Sets referencing released objects are evicted
+			// from cache, and reclaimed here.
+			if (m_descriptorSetCount[frame] > MAX_DESCRIPTOR_SETS/2)
+			{
+				m_descriptorSetCache[frame].invalidate();
+				VK_CHECK(vkResetDescriptorPool(m_device, m_descriptorPool[frame], 0) );
+
+				m_descriptorSetCount[frame] = 0;
+			}
+
+			m_descriptorSetCacheHits   = 0;
+			m_descriptorSetCacheMisses = 0;
+		}
+
 		void submitBlit(BlitState& _bs, uint16_t _view);
 
 		void submit(Frame* _render, ClearQuad& _clearQuad, TextVideoMemBlitter& _textVideoMemBlitter) override;
@@ -2658,6 +2929,8 @@ VK_IMPORT_DEVICE
 
 		void preReset()
 		{
+			waitPipelines();
+
 			for (uint32_t ii = 0; ii < BX_COUNTOF(m_frameBuffers); ++ii)
 			{
 				m_frameBuffers[ii].preReset();
@@ -2735,6 +3008,7 @@ VK_IMPORT_DEVICE
 			if (m_depthClamp != depthClamp)
 			{
 				m_depthClamp = depthClamp;
+				waitPipelines();
 				m_pipelineStateCache.invalidate();
 			}
 
@@ -2834,10 +3108,10 @@ VK_IMPORT_DEVICE
 				for (uint8_t ii = 0, num = oldFrameBuffer.m_num; ii < num; ++ii)
 				{
 					TextureVK& texture = m_textures[oldFrameBuffer.m_texture[ii].idx];
-					texture.setImageMemoryBarrier(m_commandBuffer, texture.m_sampledLayout);
+					texture.setImageMemoryBarrier(m_imageBarriers, texture.m_sampledLayout);
 					if (VK_NULL_HANDLE != texture.m_singleMsaaImage)
 					{
-						texture.setImageMemoryBarrier(m_commandBuffer, texture.m_sampledLayout, true);
+						texture.setImageMemoryBarrier(m_imageBarriers, texture.m_sampledLayout, true);
 					}
 				}
 
@@ -2848,7 +3122,7 @@ VK_IMPORT_DEVICE
 
 					if (!writeOnly)
 					{
-						texture.setImageMemoryBarrier(m_commandBuffer, texture.m_sampledLayout);
+						texture.setImageMemoryBarrier(m_imageBarriers, texture.m_sampledLayout);
 					}
 				}
 			}
@@ -2859,7 +3133,7 @@ VK_IMPORT_DEVICE
 				{
 					TextureVK& texture = m_textures[newFrameBuffer.m_texture[ii].idx];
 					texture.setImageMemoryBarrier(
-						  m_commandBuffer
+						  m_imageBarriers
 						, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
 						);
 				}
@@ -2868,7 +3142,7 @@ VK_IMPORT_DEVICE
 				{
 					TextureVK& texture = m_textures[newFrameBuffer.m_depth.idx];
 					texture.setImageMemoryBarrier(
-						  m_commandBuffer
+						  m_imageBarriers
 						, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
 						);
 				}
@@ -2876,6 +3150,10 @@ VK_IMPORT_DEVICE
 				newFrameBuffer.acquire(m_commandBuffer);
 			}
 
+			// Transitions of old and new framebuffer attachments are done with
+			// single barrier.
+			m_imageBarriers.flush(m_commandBuffer);
+
 			if (_acquire)
 			{
 				int64_t start = bx::getHPCounter();
@@ -2899,6 +3177,7 @@ VK_IMPORT_DEVICE
 			if (m_wireframe != wireframe)
 			{
 				m_wireframe = wireframe;
+				waitPipelines();
 				m_pipelineStateCache.invalidate();
 			}
 		}
@@ -3510,14 +3789,108 @@ VK_IMPORT_DEVICE
 			VK_CHECK(vkCreateComputePipelines(m_device, m_pipelineCache, 1, &cpci, m_allocatorCb, &pipeline) );
 
 			m_pipelineStateCache.add(hash, pipeline);
+			m_pipelineCacheStats.m_dirty = true;
 
 			return pipeline;
 		}
 
-		VkPipeline getPipeline(uint64_t _state, uint64_t _stencil, uint8_t _numStreams, const VertexLayout** _layouts, ProgramHandle _program, uint8_t _numInstanceData)
+		void* loadPipelineCache(VkPipelineCacheCreateInfo& _pcci)
 		{
-			ProgramVK& program = m_program[_program.idx];
+			const int64_t start = bx::getHPCounter();
+
+			const uint32_t length = g_callback->cacheReadSize(BGFX_VK_PIPELINE_CACHE_ID);
+			if (sizeof(PipelineCacheHeaderVK) >= length)
+			{
+				return NULL;
+			}
+
+			void* data = BX_ALLOC(g_allocator, length);
+			if (!g_callback->cacheRead(BGFX_VK_PIPELINE_CACHE_ID, data, length) )
+			{
+				BX_FREE(g_allocator, data);
+				return NULL;
+			}
+
+			const PipelineCacheHeaderVK& header = *(const PipelineCacheHeaderVK*)data;
+			const uint8_t* cacheData = (const uint8_t*)data + sizeof(PipelineCacheHeaderVK);
+			const uint32_t cacheSize = length - sizeof(PipelineCacheHeaderVK);
+
+			// Blob written by different device or driver is ignored, and overwritten on next save.
+			if (BGFX_VK_PIPELINE_CACHE_MAGIC   != header.m_magic
+			||  BGFX_VK_PIPELINE_CACHE_VERSION != header.m_version
+			||  m_deviceProperties.vendorID      != header.m_vendorId
+			||  m_deviceProperties.deviceID      != header.m_deviceId
+			||  m_deviceProperties.driverVersion != header.m_driverVersion
+			||  0 != bx::memCmp(m_deviceProperties.pipelineCacheUUID, header.m_uuid, VK_UUID_SIZE)
+			||  cacheSize != header.m_size
+			||  bx::hash<bx::HashMurmur2A>(cacheData, cacheSize) != header.m_hash)
+			{
+				BX_TRACE("Init: Pipeline cache blob doesn't match device/driver, ignoring it.");
+				BX_FREE(g_allocator, data);
+				return NULL;
+			}
+
+			_pcci.initialDataSize = cacheSize;
+			_pcci.pInitialData    = cacheData;
+
+			m_pipelineCacheStats.m_loadSize = cacheSize;
+			m_pipelineCacheStats.m_loadTime = bx::getHPCounter() - start;
+
+			BX_TRACE("Init: Pipeline cache blob loaded (size %d, %f ms)."
+				, cacheSize
+				, double(m_pipelineCacheStats.m_loadTime)*1000.0/double(bx::getHPFrequency() )
+				);
+
+			return data;
+		}
+
+		void savePipelineCache()
+		{
+			if (!m_pipelineCacheStats.m_dirty)
+			{
+				return;
+			}
+
+			const int64_t start = bx::getHPCounter();
+
+			size_t dataSize;
+			VK_CHECK(vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize, NULL) );
+
+			if (0 == dataSize)
+			{
+				return;
+			}
+
+			const uint32_t length = uint32_t(sizeof(PipelineCacheHeaderVK) + dataSize);
+			uint8_t* data = (uint8_t*)BX_ALLOC(g_allocator, length);
+			uint8_t* cacheData = data + sizeof(PipelineCacheHeaderVK);
+
+			if (VK_SUCCESS == vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize, cacheData) )
+			{
+				PipelineCacheHeaderVK& header = *(PipelineCacheHeaderVK*)data;
+				header.m_magic         = BGFX_VK_PIPELINE_CACHE_MAGIC;
+				header.m_version       = BGFX_VK_PIPELINE_CACHE_VERSION;
+				header.m_size          = uint32_t(dataSize);
+				header.m_hash          = bx::hash<bx::HashMurmur2A>(cacheData, uint32_t(dataSize) );
+				header.m_vendorId      = m_deviceProperties.vendorID;
+				header.m_deviceId      = m_deviceProperties.deviceID;
+				header.m_driverVersion = m_deviceProperties.driverVersion;
+				bx::memCopy(header.m_uuid, m_deviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
 
+				g_callback->cacheWrite(BGFX_VK_PIPELINE_CACHE_ID, data, length);
+
+				m_pipelineCacheStats.m_dirty    = false;
+				m_pipelineCacheStats.m_saveSize = uint32_t(dataSize);
+				++m_pipelineCacheStats.m_numSaves;
+			}
+
+			BX_FREE(g_allocator, data);
+
+			m_pipelineCacheStats.m_saveTime = bx::getHPCounter() - start;
+		}
+
+		uint32_t getPipelineHash(uint64_t& _state, uint64_t& _stencil, uint8_t _numStreams, const VertexLayout** _layouts, const ProgramVK& _program, uint8_t _numInstanceData)
+		{
 			_state &= 0
 				| BGFX_STATE_WRITE_MASK
 				| BGFX_STATE_DEPTH_TEST_MASK
@@ -3539,7 +3912,7 @@ VK_IMPORT_DEVICE
 			if (0 < _numStreams)
 			{
 				bx::memCopy(&layout, _layouts[0], sizeof(VertexLayout) );
-				const uint16_t* attrMask = program.m_vsh->m_attrMask;
+				const uint16_t* attrMask = _program.m_vsh->m_attrMask;
 
 				for (uint32_t ii = 0; ii < Attrib::Count; ++ii)
 				{
@@ -3558,12 +3931,12 @@ VK_IMPORT_DEVICE
 			murmur.begin();
 			murmur.add(_state);
 			murmur.add(_stencil);
-			murmur.add(program.m_vsh->m_hash);
-			murmur.add(program.m_vsh->m_attrMask, sizeof(program.m_vsh->m_attrMask) );
+			murmur.add(_program.m_vsh->m_hash);
+			murmur.add(_program.m_vsh->m_attrMask, sizeof(_program.m_vsh->m_attrMask) );
 
-			if (NULL != program.m_fsh)
+			if (NULL != _program.m_fsh)
 			{
-				murmur.add(program.m_fsh->m_hash);
+				murmur.add(_program.m_fsh->m_hash);
 			}
 
 			for (uint8_t ii = 0; ii < _numStreams; ++ii)
@@ -3574,33 +3947,42 @@ VK_IMPORT_DEVICE
 			murmur.add(layout.m_attributes, sizeof(layout.m_attributes) );
 			murmur.add(_numInstanceData);
 			murmur.add(frameBuffer.m_renderPass);
-			const uint32_t hash = murmur.end();
-
-			VkPipeline pipeline = m_pipelineStateCache.find(hash);
+			return murmur.end();
+		}
 
-			if (VK_NULL_HANDLE != pipeline)
-			{
-				return pipeline;
-			}
+		PipelineCompileJobVK* createPipelineJob(uint32_t _hash, uint64_t _state, uint64_t _stencil, uint8_t _numStreams, const VertexLayout** _layouts, const ProgramVK& _program, uint8_t _numInstanceData)
+		{
+			const FrameBufferVK& frameBuffer = isValid(m_fbh)
+				? m_frameBuffers[m_fbh.idx]
+				: m_backBuffer
+				;
 
-			VkPipelineColorBlendAttachmentState blendAttachmentState[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS];
-			VkPipelineColorBlendStateCreateInfo colorBlendState;
-			colorBlendState.pAttachments = blendAttachmentState;
+			// Create info is stored in job, since it's consumed later on compile thread.
+			PipelineCompileJobVK* job = BX_NEW(g_allocator, PipelineCompileJobVK);
+			job->m_hash     = _hash;
+			job->m_pipeline = VK_NULL_HANDLE;
+			job->m_result   = VK_SUCCESS;
+			job->m_time     = 0;
+			job->m_next     = NULL;
+			job->m_state    = PipelineCompileJobVK::State::Queued;
+
+			VkPipelineColorBlendStateCreateInfo& colorBlendState = job->m_colorBlendState;
+			colorBlendState.pAttachments = job->m_blendAttachmentState;
 			setBlendState(colorBlendState, _state);
 
-			VkPipelineInputAssemblyStateCreateInfo inputAssemblyState;
+			VkPipelineInputAssemblyStateCreateInfo& inputAssemblyState = job->m_inputAssemblyState;
 			inputAssemblyState.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
 			inputAssemblyState.pNext = NULL;
 			inputAssemblyState.flags = 0;
 			inputAssemblyState.topology = s_primInfo[(_state&BGFX_STATE_PT_MASK) >> BGFX_STATE_PT_SHIFT].m_topology;
 			inputAssemblyState.primitiveRestartEnable = VK_FALSE;
 
-			VkPipelineRasterizationStateCreateInfo rasterizationState;
+			VkPipelineRasterizationStateCreateInfo& rasterizationState = job->m_rasterizationState;
 			setRasterizerState(rasterizationState, _state, m_wireframe);
 
 			VkBaseInStructure* nextRasterizationState = (VkBaseInStructure*)&rasterizationState;
 
-			VkPipelineRasterizationConservativeStateCreateInfoEXT conservativeRasterizationState;
+			VkPipelineRasterizationConservativeStateCreateInfoEXT& conservativeRasterizationState = job->m_conservativeRasterizationState;
 			if (s_extension[Extension::EXT_conservative_rasterization].m_supported)
 			{
 				nextRasterizationState->pNext = (VkBaseInStructure*)&conservativeRasterizationState;
@@ -3608,7 +3990,7 @@ VK_IMPORT_DEVICE
 				setConservativeRasterizerState(conservativeRasterizationState, _state);
 			}
 
-			VkPipelineRasterizationLineStateCreateInfoEXT lineRasterizationState;
+			VkPipelineRasterizationLineStateCreateInfoEXT& lineRasterizationState = job->m_lineRasterizationState;
 			if (m_lineAASupport)
 			{
 				nextRasterizationState->pNext = (VkBaseInStructure*)&lineRasterizationState;
@@ -3616,18 +3998,15 @@ VK_IMPORT_DEVICE
 				setLineRasterizerState(lineRasterizationState, _state);
 			}
 
-			VkPipelineDepthStencilStateCreateInfo depthStencilState;
+			VkPipelineDepthStencilStateCreateInfo& depthStencilState = job->m_depthStencilState;
 			setDepthStencilState(depthStencilState, _state, _stencil);
 
-			VkVertexInputBindingDescription  inputBinding[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
-			VkVertexInputAttributeDescription inputAttrib[Attrib::Count + BGFX_CONFIG_MAX_INSTANCE_DATA_COUNT];
+			VkPipelineVertexInputStateCreateInfo& vertexInputState = job->m_vertexInputState;
+			vertexInputState.pVertexBindingDescriptions   = job->m_inputBinding;
+			vertexInputState.pVertexAttributeDescriptions = job->m_inputAttrib;
+			setInputLayout(vertexInputState, _numStreams, _layouts, _program, _numInstanceData);
 
-			VkPipelineVertexInputStateCreateInfo vertexInputState;
-			vertexInputState.pVertexBindingDescriptions   = inputBinding;
-			vertexInputState.pVertexAttributeDescriptions = inputAttrib;
-			setInputLayout(vertexInputState, _numStreams, _layouts, program, _numInstanceData);
-
-			const VkDynamicState dynamicStates[] =
+			static const VkDynamicState dynamicStates[] =
 			{
 				VK_DYNAMIC_STATE_VIEWPORT,
 				VK_DYNAMIC_STATE_SCISSOR,
@@ -3635,34 +4014,34 @@ VK_IMPORT_DEVICE
 				VK_DYNAMIC_STATE_STENCIL_REFERENCE,
 			};
 
-			VkPipelineDynamicStateCreateInfo dynamicState;
+			VkPipelineDynamicStateCreateInfo& dynamicState = job->m_dynamicState;
 			dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
 			dynamicState.pNext = NULL;
 			dynamicState.flags = 0;
 			dynamicState.dynamicStateCount = BX_COUNTOF(dynamicStates);
 			dynamicState.pDynamicStates    = dynamicStates;
 
-			VkPipelineShaderStageCreateInfo shaderStages[2];
+			VkPipelineShaderStageCreateInfo* shaderStages = job->m_shaderStages;
 			shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
 			shaderStages[0].pNext = NULL;
 			shaderStages[0].flags = 0;
 			shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
-			shaderStages[0].module = program.m_vsh->m_module;
+			shaderStages[0].module = _program.m_vsh->m_module;
 			shaderStages[0].pName  = "main";
 			shaderStages[0].pSpecializationInfo = NULL;
 
-			if (NULL != program.m_fsh)
+			if (NULL != _program.m_fsh)
 			{
 				shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
 				shaderStages[1].pNext = NULL;
 				shaderStages[1].flags = 0;
 				shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-				shaderStages[1].module = program.m_fsh->m_module;
+				shaderStages[1].module = _program.m_fsh->m_module;
 				shaderStages[1].pName  = "main";
 				shaderStages[1].pSpecializationInfo = NULL;
 			}
 
-			VkPipelineViewportStateCreateInfo viewportState;
+			VkPipelineViewportStateCreateInfo& viewportState = job->m_viewportState;
 			viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
 			viewportState.pNext = NULL;
 			viewportState.flags = 0;
@@ -3671,7 +4050,7 @@ VK_IMPORT_DEVICE
 			viewportState.scissorCount  = 1;
 			viewportState.pScissors     = NULL;
 
-			VkPipelineMultisampleStateCreateInfo multisampleState;
+			VkPipelineMultisampleStateCreateInfo& multisampleState = job->m_multisampleState;
 			multisampleState.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
 			multisampleState.pNext = NULL;
 			multisampleState.flags = 0;
@@ -3682,11 +4061,11 @@ VK_IMPORT_DEVICE
 			multisampleState.alphaToCoverageEnable = !!(BGFX_STATE_BLEND_ALPHA_TO_COVERAGE & _state);
 			multisampleState.alphaToOneEnable      = VK_FALSE;
 
-			VkGraphicsPipelineCreateInfo graphicsPipeline;
+			VkGraphicsPipelineCreateInfo& graphicsPipeline = job->m_createInfo;
 			graphicsPipeline.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
 			graphicsPipeline.pNext = NULL;
 			graphicsPipeline.flags = 0;
-			graphicsPipeline.stageCount = NULL == program.m_fsh ? 1 : 2;
+			graphicsPipeline.stageCount = NULL == _program.m_fsh ? 1 : 2;
 			graphicsPipeline.pStages    = shaderStages;
 			graphicsPipeline.pVertexInputState   = &vertexInputState;
 			graphicsPipeline.pInputAssemblyState = &inputAssemblyState;
@@ -3697,16 +4076,32 @@ VK_IMPORT_DEVICE
 			graphicsPipeline.pDepthStencilState  = &depthStencilState;
 			graphicsPipeline.pColorBlendState    = &colorBlendState;
 			graphicsPipeline.pDynamicState       = &dynamicState;
-			graphicsPipeline.layout     = program.m_pipelineLayout;
+			graphicsPipeline.layout     = _program.m_pipelineLayout;
 			graphicsPipeline.renderPass = frameBuffer.m_renderPass;
 			graphicsPipeline.subpass    = 0;
 			graphicsPipeline.basePipelineHandle = VK_NULL_HANDLE;
 			graphicsPipeline.basePipelineIndex  = 0;
 
-			uint32_t length = g_callback->cacheReadSize(hash);
+			job->m_cacheData     = NULL;
+			job->m_cacheDataSize = 0;
+
+			if (BX_ENABLED(BGFX_CONFIG_PIPELINE_CACHE_BLOB) )
+			{
+				// Creating pipelines with shared cache doesn't require external synchronization,
+				// so compile threads use m_pipelineCache directly, and it's persisted as a whole.
+				job->m_cache = m_pipelineCache;
+				m_pipelineJobs.insert(stl::make_pair(uint64_t(_hash), job) );
+				return job;
+			}
+
+			const int64_t cacheStart = bx::getHPCounter();
+
+			// Cache callback is not required to be thread safe, it's only ever called from
+			// render thread, when job is created and when it's finished.
+			uint32_t length = g_callback->cacheReadSize(_hash);
 			bool cached = length > 0;
 
-			void* cachedData = NULL;
+			job->m_cacheDataSize = length;
 
 			VkPipelineCacheCreateInfo pcci;
 			pcci.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
@@ -3717,73 +4112,185 @@ VK_IMPORT_DEVICE
 
 			if (cached)
 			{
-				cachedData = BX_ALLOC(g_allocator, length);
-				if (g_callback->cacheRead(hash, cachedData, length) )
+				job->m_cacheData = BX_ALLOC(g_allocator, length);
+				if (g_callback->cacheRead(_hash, job->m_cacheData, length) )
 				{
 					BX_TRACE("Loading cached pipeline state (size %d).", length);
-					bx::MemoryReader reader(cachedData, length);
+					bx::MemoryReader reader(job->m_cacheData, length);
 
 					pcci.initialDataSize = (size_t)reader.remaining();
 					pcci.pInitialData    = reader.getDataPtr();
 				}
 			}
 
-			VkPipelineCache cache;
-			VK_CHECK(vkCreatePipelineCache(m_device, &pcci, m_allocatorCb, &cache) );
+			VK_CHECK(vkCreatePipelineCache(m_device, &pcci, m_allocatorCb, &job->m_cache) );
 
-			VK_CHECK(vkCreateGraphicsPipelines(
-				  m_device
-				, cache
-				, 1
-				, &graphicsPipeline
-				, m_allocatorCb
-				, &pipeline
-				) );
-			m_pipelineStateCache.add(hash, pipeline);
+			m_pipelineJobs.insert(stl::make_pair(uint64_t(_hash), job) );
 
-			size_t dataSize;
-			VK_CHECK(vkGetPipelineCacheData(m_device, cache, &dataSize, NULL) );
+			m_pipelineCacheStats.m_ioTime += bx::getHPCounter() - cacheStart;
+
+			return job;
+		}
+
+		void finishPipelineJob(PipelineCompileJobVK* _job)
+		{
+			m_pipelineJobs.erase(_job->m_hash);
+
+			VK_CHECK(_job->m_result);
+
+			if (VK_SUCCESS == _job->m_result)
+			{
+				m_pipelineStateCache.add(_job->m_hash, _job->m_pipeline);
+			}
 
-			if (0 < dataSize)
+			if (_job->m_cache == m_pipelineCache)
+			{
+				m_pipelineCacheStats.m_dirty |= VK_SUCCESS == _job->m_result;
+			}
+			else
 			{
-				if (length < dataSize)
+				const int64_t cacheStart = bx::getHPCounter();
+
+				if (VK_SUCCESS == _job->m_result)
+				{
+					size_t dataSize;
+					VK_CHECK(vkGetPipelineCacheData(m_device, _job->m_cache, &dataSize, NULL) );
+
+					if (0 < dataSize)
+					{
+						if (_job->m_cacheDataSize < dataSize)
+						{
+							_job->m_cacheData = BX_REALLOC(g_allocator, _job->m_cacheData, dataSize);
+						}
+
+						VK_CHECK(vkGetPipelineCacheData(m_device, _job->m_cache, &dataSize, _job->m_cacheData) );
+						g_callback->cacheWrite(_job->m_hash, _job->m_cacheData, (uint32_t)dataSize);
+					}
+
+					VK_CHECK(vkMergePipelineCaches(m_device, m_pipelineCache, 1, &_job->m_cache) );
+				}
+
+				vkDestroy(_job->m_cache);
+
+				if (NULL != _job->m_cacheData)
 				{
-					cachedData = BX_REALLOC(g_allocator, cachedData, dataSize);
+					BX_FREE(g_allocator, _job->m_cacheData);
 				}
 
-				VK_CHECK(vkGetPipelineCacheData(m_device, cache, &dataSize, cachedData) );
-				g_callback->cacheWrite(hash, cachedData, (uint32_t)dataSize);
+				m_pipelineCacheStats.m_ioTime += bx::getHPCounter() - cacheStart;
 			}
 
-			VK_CHECK(vkMergePipelineCaches(m_device, m_pipelineCache, 1, &cache) );
-			vkDestroy(cache);
+			++m_pipelineStats.m_numCompiled;
+			m_pipelineStats.m_compileTime   += _job->m_time;
+			m_pipelineStats.m_compileTimeMax = bx::max(m_pipelineStats.m_compileTimeMax, _job->m_time);
 
-			if (NULL != cachedData)
+			BX_DELETE(g_allocator, _job);
+		}
+
+		void collectPipelines()
+		{
+			for (PipelineCompileJobVK* job = m_pipelineCompiler.popDone(); NULL != job; job = m_pipelineCompiler.popDone() )
 			{
-				BX_FREE(g_allocator, cachedData);
+				finishPipelineJob(job);
 			}
+		}
 
-			return pipeline;
+		void waitPipelines()
+		{
+			while (!m_pipelineJobs.empty() )
+			{
+				m_pipelineCompiler.wait(m_pipelineJobs.begin()->second);
+				collectPipelines();
+			}
 		}
 
-		VkDescriptorSet getDescriptorSet(const ProgramVK& program, const RenderBind& renderBind, const ScratchBufferVK& scratchBuffer, const float _palette[][4])
+		VkPipeline getPipeline(uint64_t _state, uint64_t _stencil, uint8_t _numStreams, const VertexLayout** _layouts, ProgramHandle _program, uint8_t _numInstanceData, bool _skipIfNotReady = false)
 		{
-			VkDescriptorSet descriptorSet;
+			const ProgramVK& program = m_program[_program.idx];
 
-			VkDescriptorSetAllocateInfo dsai;
-			dsai.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-			dsai.pNext              = NULL;
-			dsai.descriptorPool     = m_descriptorPool;
-			dsai.descriptorSetCount = 1;
-			dsai.pSetLayouts        = &program.m_descriptorSetLayout;
+			const uint32_t hash = getPipelineHash(_state, _stencil, _numStreams, _layouts, program, _numInstanceData);
 
-			VK_CHECK(vkAllocateDescriptorSets(m_device, &dsai, &descriptorSet) );
+			VkPipeline pipeline = m_pipelineStateCache.find(hash);
 
-			VkDescriptorImageInfo  imageInfo[BGFX_CONFIG_MAX_TEXTURE_SAMPLERS];
-			VkDescriptorBufferInfo bufferInfo[BGFX_CONFIG_MAX_TEXTURE_SAMPLERS];
+			if (VK_NULL_HANDLE != pipeline)
+			{
+				return pipeline;
+			}
 
-			constexpr uint32_t kMaxDescriptorSets = 2 * BGFX_CONFIG_MAX_TEXTURE_SAMPLERS + 2;
-			VkWriteDescriptorSet wds[kMaxDescriptorSets] = {};
+			PipelineJobMap::iterator it = m_pipelineJobs.find(hash);
+			PipelineCompileJobVK* job = m_pipelineJobs.end() != it ? it->second : NULL;
+
+			if (_skipIfNotReady
+			&&  0 < m_pipelineCompiler.getNumThreads() )
+			{
+				if (NULL == job)
+				{
+					job = createPipelineJob(hash, _state, _stencil, _numStreams, _layouts, program, _numInstanceData);
+					m_pipelineCompiler.queue(job);
+				}
+
+				++m_pipelineStats.m_numSkipped;
+				return VK_NULL_HANDLE;
+			}
+
+			const int64_t start = bx::getHPCounter();
+
+			if (NULL == job)
+			{
+				job = createPipelineJob(hash, _state, _stencil, _numStreams, _layouts, program, _numInstanceData);
+				m_pipelineCompiler.compile(job);
+				finishPipelineJob(job);
+			}
+			else
+			{
+				m_pipelineCompiler.wait(job);
+				collectPipelines();
+			}
+
+			++m_pipelineStats.m_numStalls;
+			m_pipelineStats.m_stallTime += bx::getHPCounter() - start;
+
+			return m_pipelineStateCache.find(hash);
+		}
+
+		void prewarmPipeline(FrameBufferHandle _fbh, ProgramHandle _program, uint64_t _state, uint64_t _stencil, const VertexLayout& _layout, uint8_t _numInstanceData) override
+		{
+			const ProgramVK& program = m_program[_program.idx];
+
+			if (NULL == program.m_vsh)
+			{
+				return;
+			}
+
+			const FrameBufferHandle fbh = m_fbh;
+			m_fbh = _fbh;
+
+			const VertexLayout* layouts[] = { &_layout };
+			const uint8_t numStreams = 0 == _layout.m_stride ? 0 : 1;
+
+			const uint32_t hash = getPipelineHash(_state, _stencil, numStreams, layouts, program, _numInstanceData);
+
+			if (VK_NULL_HANDLE == m_pipelineStateCache.find(hash)
+			&&  m_pipelineJobs.end() == m_pipelineJobs.find(hash) )
+			{
+				PipelineCompileJobVK* job = createPipelineJob(hash, _state, _stencil, numStreams, layouts, program, _numInstanceData);
+				m_pipelineCompiler.queue(job);
+
+				++m_pipelineStats.m_numPrewarmed;
+			}
+
+			m_fbh = fbh;
+		}
+
+		VkDescriptorSet getDescriptorSet(const ProgramVK& program, const RenderBind& renderBind, const ScratchBufferVK& scratchBuffer, const float _palette[][4])
+		{
+			VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+
+			VkDescriptorImageInfo  imageInfo[BGFX_CONFIG_MAX_TEXTURE_SAMPLERS];
+			VkDescriptorBufferInfo bufferInfo[BGFX_CONFIG_MAX_TEXTURE_SAMPLERS];
+
+			constexpr uint32_t kMaxDescriptorSets = 2 * BGFX_CONFIG_MAX_TEXTURE_SAMPLERS + 2;
+			VkWriteDescriptorSet wds[kMaxDescriptorSets] = {};
 
 			uint32_t wdsCount    = 0;
 			uint32_t bufferCount = 0;
@@ -3805,7 +4312,7 @@ VK_IMPORT_DEVICE
 
 							wds[wdsCount].sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 							wds[wdsCount].pNext            = NULL;
-							wds[wdsCount].dstSet           = descriptorSet;
+							wds[wdsCount].dstSet           = VK_NULL_HANDLE;
 							wds[wdsCount].dstBinding       = bindInfo.binding;
 							wds[wdsCount].dstArrayElement  = 0;
 							wds[wdsCount].descriptorCount  = 1;
@@ -3855,7 +4362,7 @@ VK_IMPORT_DEVICE
 						{
 							wds[wdsCount].sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 							wds[wdsCount].pNext            = NULL;
-							wds[wdsCount].dstSet           = descriptorSet;
+							wds[wdsCount].dstSet           = VK_NULL_HANDLE;
 							wds[wdsCount].dstBinding       = bindInfo.binding;
 							wds[wdsCount].dstArrayElement  = 0;
 							wds[wdsCount].descriptorCount  = 1;
@@ -3911,7 +4418,7 @@ VK_IMPORT_DEVICE
 
 							wds[wdsCount].sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 							wds[wdsCount].pNext            = NULL;
-							wds[wdsCount].dstSet           = descriptorSet;
+							wds[wdsCount].dstSet           = VK_NULL_HANDLE;
 							wds[wdsCount].dstBinding       = bindInfo.binding;
 							wds[wdsCount].dstArrayElement  = 0;
 							wds[wdsCount].descriptorCount  = 1;
@@ -3923,7 +4430,7 @@ VK_IMPORT_DEVICE
 
 							wds[wdsCount].sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 							wds[wdsCount].pNext            = NULL;
-							wds[wdsCount].dstSet           = descriptorSet;
+							wds[wdsCount].dstSet           = VK_NULL_HANDLE;
 							wds[wdsCount].dstBinding       = bindInfo.samplerBinding;
 							wds[wdsCount].dstArrayElement  = 0;
 							wds[wdsCount].descriptorCount  = 1;
@@ -3951,7 +4458,7 @@ VK_IMPORT_DEVICE
 
 				wds[wdsCount].sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 				wds[wdsCount].pNext            = NULL;
-				wds[wdsCount].dstSet           = descriptorSet;
+				wds[wdsCount].dstSet           = VK_NULL_HANDLE;
 				wds[wdsCount].dstBinding       = program.m_vsh->m_uniformBinding;
 				wds[wdsCount].dstArrayElement  = 0;
 				wds[wdsCount].descriptorCount  = 1;
@@ -3971,7 +4478,7 @@ VK_IMPORT_DEVICE
 
 				wds[wdsCount].sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 				wds[wdsCount].pNext            = NULL;
-				wds[wdsCount].dstSet           = descriptorSet;
+				wds[wdsCount].dstSet           = VK_NULL_HANDLE;
 				wds[wdsCount].dstBinding       = program.m_fsh->m_uniformBinding;
 				wds[wdsCount].dstArrayElement  = 0;
 				wds[wdsCount].descriptorCount  = 1;
@@ -3983,10 +4490,62 @@ VK_IMPORT_DEVICE
 				++bufferCount;
 			}
 
+			// Key is built from resolved descriptors (image views, samplers,
+			// buffers) so that it doesn't depend on bgfx handles that might be
+			// reused. Uniform data is bound with dynamic offset, and scratch
+			// buffer itself is part of the key.
+			DescriptorSetCacheVK::Key key;
+			key.add(uint64_t(program.m_descriptorSetLayout.vk) );
+
+			for (uint32_t ii = 0; ii < wdsCount; ++ii)
+			{
+				key.add(uint64_t(wds[ii].dstBinding) << 32 | uint64_t(wds[ii].descriptorType) );
+			}
+
+			for (uint32_t ii = 0; ii < imageCount; ++ii)
+			{
+				key.add(uint64_t(imageInfo[ii].sampler) );
+				key.add(uint64_t(imageInfo[ii].imageView) );
+				key.add(uint64_t(imageInfo[ii].imageLayout) );
+			}
+
+			for (uint32_t ii = 0; ii < bufferCount; ++ii)
+			{
+				key.add(uint64_t(bufferInfo[ii].buffer) );
+				key.add(uint64_t(bufferInfo[ii].offset) );
+				key.add(uint64_t(bufferInfo[ii].range) );
+			}
+
+			const uint32_t frame = m_cmd.m_currentFrameInFlight;
+
+			descriptorSet = m_descriptorSetCache[frame].find(key);
+
+			if (VK_NULL_HANDLE != descriptorSet)
+			{
+				m_descriptorSetCacheHits++;
+				return descriptorSet;
+			}
+
+			m_descriptorSetCacheMisses++;
+
+			VkDescriptorSetAllocateInfo dsai;
+			dsai.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+			dsai.pNext              = NULL;
+			dsai.descriptorPool     = m_descriptorPool[frame];
+			dsai.descriptorSetCount = 1;
+			dsai.pSetLayouts        = &program.m_descriptorSetLayout;
+
+			VK_CHECK(vkAllocateDescriptorSets(m_device, &dsai, &descriptorSet) );
+			m_descriptorSetCount[frame]++;
+
+			for (uint32_t ii = 0; ii < wdsCount; ++ii)
+			{
+				wds[ii].dstSet = descriptorSet;
+			}
+
 			vkUpdateDescriptorSets(m_device, wdsCount, wds, 0, NULL);
 
-			VkDescriptorSet temp = descriptorSet;
-			release(temp);
+			m_descriptorSetCache[frame].add(key, descriptorSet);
 
 			return descriptorSet;
 		}
@@ -4273,6 +4832,8 @@ VK_IMPORT_DEVICE
 
 		void kick(bool _finishAll = false)
 		{
+			flushTextureCopies();
+
 			m_cmd.kick(_finishAll);
 			VK_CHECK(m_cmd.alloc(&m_commandBuffer) );
 			m_cmd.finish(_finishAll);
@@ -4320,6 +4881,26 @@ VK_IMPORT_DEVICE
 			return result;
 		}
 
+		VkResult allocateMemory(const VkMemoryRequirements* _requirements, VkMemoryPropertyFlags _propertyFlags, bool _image, DeviceMemoryAllocationVK* _allocation)
+		{
+			VkResult result = VK_ERROR_UNKNOWN;
+			int32_t searchIndex = -1;
+			do
+			{
+				searchIndex++;
+				searchIndex = selectMemoryType(_requirements->memoryTypeBits, _propertyFlags, searchIndex);
+
+				if (searchIndex >= 0)
+				{
+					result = m_memoryAllocator.alloc(*_requirements, searchIndex, _image, _allocation);
+				}
+			}
+			while (result != VK_SUCCESS
+			   &&  searchIndex >= 0);
+
+			return result;
+		}
+
 		VkResult createHostBuffer(uint32_t _size, VkMemoryPropertyFlags _flags, ::VkBuffer* _buffer, ::VkDeviceMemory* _memory, const void* _data = NULL)
 		{
 			VkResult result = VK_SUCCESS;
@@ -4401,6 +4982,65 @@ VK_IMPORT_DEVICE
 			return createHostBuffer(_size, flags, _buffer, _memory, NULL);
 		}
 
+		VkResult allocStagingBuffer(uint32_t _size, uint32_t _align, StagingBufferVK* _staging, const void* _data = NULL)
+		{
+			VkResult result = VK_SUCCESS;
+
+			if (!m_stagingRing.alloc(m_cmd.m_currentFrameInFlight, _size, _align, _staging) )
+			{
+				m_stagingRing.m_numDedicated++;
+
+				result = createStagingBuffer(_size, &_staging->m_buffer, &_staging->m_deviceMem);
+
+				if (VK_SUCCESS != result)
+				{
+					BX_TRACE("Allocate staging buffer error: createStagingBuffer failed %d: %s.", result, getName(result) );
+					return result;
+				}
+
+				_staging->m_offset = 0;
+
+				result = vkMapMemory(m_device, _staging->m_deviceMem, 0, _size, 0, (void**)&_staging->m_data);
+
+				if (VK_SUCCESS != result)
+				{
+					BX_TRACE("Allocate staging buffer error: vkMapMemory failed %d: %s.", result, getName(result) );
+					release(_staging->m_buffer);
+					release(_staging->m_deviceMem);
+					return result;
+				}
+			}
+
+			if (NULL != _data)
+			{
+				bx::memCopy(_staging->m_data, _data, _size);
+			}
+
+			return result;
+		}
+
+		void releaseStagingBuffer(StagingBufferVK& _staging)
+		{
+			if (VK_NULL_HANDLE != _staging.m_deviceMem)
+			{
+				vkUnmapMemory(m_device, _staging.m_deviceMem);
+				release(_staging.m_buffer);
+				release(_staging.m_deviceMem);
+			}
+
+			_staging.m_data = NULL;
+		}
+
+		void flushTextureCopies()
+		{
+			for (uint32_t ii = 0, num = uint32_t(m_textureCopies.size() ); ii < num; ++ii)
+			{
+				m_textureCopies[ii]->flushCopies(m_commandBuffer);
+			}
+
+			m_textureCopies.clear();
+		}
+
 		void setupRaytracing() override
 		{
 #define INSERT_FUNC(func) funcMap.emplace(std::pair<EVkFunctionName, void*>(EVkFunctionName::func, &func));
@@ -4622,6 +5262,9 @@ VK_IMPORT_DEVICE
 		int64_t m_presentElapsed;
 
 		ScratchBufferVK m_scratchBuffer[BGFX_CONFIG_MAX_FRAME_LATENCY];
+		ImageBarrierBatchVK m_imageBarriers;
+		StagingRingVK m_stagingRing;
+		stl::vector<TextureVK*> m_textureCopies;
 
 		uint32_t        m_numFramesInFlight;
 		CommandQueueVK  m_cmd;
@@ -4630,11 +5273,17 @@ VK_IMPORT_DEVICE
 		VkDevice m_device;
 		uint32_t m_globalQueueFamily;
 		VkQueue  m_globalQueue;
-		VkDescriptorPool m_descriptorPool;
 		VkPipelineCache  m_pipelineCache;
 
+		VkDescriptorPool m_descriptorPool[BGFX_CONFIG_MAX_FRAME_LATENCY];
+		DescriptorSetCacheVK m_descriptorSetCache[BGFX_CONFIG_MAX_FRAME_LATENCY];
+		uint32_t m_descriptorSetCount[BGFX_CONFIG_MAX_FRAME_LATENCY];
+		uint32_t m_descriptorSetCacheHits;
+		uint32_t m_descriptorSetCacheMisses;
+
 		TimerQueryVK m_gpuTimer;
 		OcclusionQueryVK m_occlusionQuery;
+		DeviceMemoryAllocatorVK m_memoryAllocator;
 
 		void* m_renderDocDll;
 		void* m_vulkan1Dll;
@@ -4655,6 +5304,14 @@ VK_IMPORT_DEVICE
 		UniformRegistry m_uniformReg;
 
 		StateCacheT<VkPipeline> m_pipelineStateCache;
+
+		typedef stl::unordered_map<uint64_t, PipelineCompileJobVK*> PipelineJobMap;
+		PipelineJobMap m_pipelineJobs;
+		PipelineCompilerVK m_pipelineCompiler;
+		CommandRecorderVK m_commandRecorder;
+		stl::vector<DrawCommandVK> m_drawCommands;
+		PipelineStatsVK m_pipelineStats;
+		PipelineCacheStatsVK m_pipelineCacheStats;
 		StateCacheT<VkDescriptorSetLayout> m_descriptorSetLayoutCache;
 		StateCacheT<VkRenderPass> m_renderPassCache;
 		StateCacheT<VkSampler> m_samplerCache;
@@ -4738,28 +5395,94 @@ VK_DESTROY
 		}
 	}
 
-	void vkDestroy(VkDescriptorSet& _obj)
+	void release(VkDeviceMemory& _obj)
 	{
-		if (VK_NULL_HANDLE != _obj)
+		s_renderVK->release(_obj);
+	}
+
+	void release(VkSurfaceKHR& _obj)
+	{
+		s_renderVK->release(_obj);
+	}
+
+	uint64_t DescriptorSetCacheVK::hash(const Key& _key)
+	{
+		return bx::hash<bx::HashMurmur2A>(_key.m_data, _key.m_num*sizeof(uint64_t) );
+	}
+
+	::VkDescriptorSet DescriptorSetCacheVK::find(const Key& _key)
+	{
+		evict();
+
+		HashMap::iterator it = m_hashMap.find(hash(_key) );
+		if (it != m_hashMap.end() )
 		{
-			vkFreeDescriptorSets(s_renderVK->m_device, s_renderVK->m_descriptorPool, 1, &_obj);
-			_obj = VK_NULL_HANDLE;
+			const Entry& entry = it->second;
+
+			if (entry.m_key.size() == _key.m_num
+			&&  0 == bx::memCmp(entry.m_key.data(), _key.m_data, _key.m_num*sizeof(uint64_t) ) )
+			{
+				return entry.m_descriptorSet;
+			}
 		}
+
+		return VK_NULL_HANDLE;
 	}
 
-	void release(VkDeviceMemory& _obj)
+	void DescriptorSetCacheVK::add(const Key& _key, ::VkDescriptorSet _descriptorSet)
 	{
-		s_renderVK->release(_obj);
+		// Hash collision replaces existing entry, its set stays allocated until
+		// pool is reset.
+		Entry entry;
+		entry.m_key.resize(_key.m_num);
+		bx::memCopy(entry.m_key.data(), _key.m_data, _key.m_num*sizeof(uint64_t) );
+		entry.m_descriptorSet = _descriptorSet;
+
+		const uint64_t key = hash(_key);
+		m_hashMap.erase(key);
+		m_hashMap.insert(stl::make_pair(key, entry) );
 	}
 
-	void release(VkSurfaceKHR& _obj)
+	void DescriptorSetCacheVK::release(uint64_t _object)
 	{
-		s_renderVK->release(_obj);
+		m_released.insert(_object);
 	}
 
-	void release(VkDescriptorSet& _obj)
+	void DescriptorSetCacheVK::invalidate()
 	{
-		s_renderVK->release(_obj);
+		m_hashMap.clear();
+		m_released.clear();
+	}
+
+	void DescriptorSetCacheVK::evict()
+	{
+		if (m_released.empty() )
+		{
+			return;
+		}
+
+		stl::vector<uint64_t> evicted;
+
+		for (HashMap::iterator it = m_hashMap.begin(), itEnd = m_hashMap.end(); it != itEnd; ++it)
+		{
+			const stl::vector<uint64_t>& key = it->second.m_key;
+
+			for (uint32_t ii = 0, num = uint32_t(key.size() ); ii < num; ++ii)
+			{
+				if (m_released.end() != m_released.find(key[ii]) )
+				{
+					evicted.push_back(it->first);
+					break;
+				}
+			}
+		}
+
+		for (uint32_t ii = 0, num = uint32_t(evicted.size() ); ii < num; ++ii)
+		{
+			m_hashMap.erase(evicted[ii]);
+		}
+
+		m_released.clear();
 	}
 
 	void ScratchBufferVK::create(uint32_t _size, uint32_t _count)
@@ -4823,46 +5546,1195 @@ VK_DESTROY
 		s_renderVK->release(m_deviceMem);
 	}
 
-	void ScratchBufferVK::reset()
-	{
-		m_pos = 0;
+	void ScratchBufferVK::reset()
+	{
+		m_pos = 0;
+	}
+
+	uint32_t ScratchBufferVK::write(const void* _data, uint32_t _size)
+	{
+		BX_ASSERT(m_pos < m_size, "Out of scratch buffer memory");
+
+		const uint32_t offset = m_pos;
+
+		if (_size > 0)
+		{
+			bx::memCopy(&m_data[m_pos], _data, _size);
+
+			const VkPhysicalDeviceLimits& deviceLimits = s_renderVK->m_deviceProperties.limits;
+			const uint32_t align = uint32_t(deviceLimits.minUniformBufferOffsetAlignment);
+			const uint32_t alignedSize = bx::strideAlign(_size, align);
+
+			m_pos += alignedSize;
+		}
+
+		return offset;
+	}
+
+	void ScratchBufferVK::flush()
+	{
+		const VkPhysicalDeviceLimits& deviceLimits = s_renderVK->m_deviceProperties.limits;
+		VkDevice device = s_renderVK->m_device;
+
+		const uint32_t align = uint32_t(deviceLimits.nonCoherentAtomSize);
+		const uint32_t size  = bx::min(bx::strideAlign(m_pos, align), m_size);
+
+		VkMappedMemoryRange range;
+		range.sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+		range.pNext  = NULL;
+		range.memory = m_deviceMem;
+		range.offset = 0;
+		range.size   = size;
+		VK_CHECK(vkFlushMappedMemoryRanges(device, 1, &range) );
+	}
+
+	StagingRingVK::StagingRingVK()
+		: m_buffer(VK_NULL_HANDLE)
+		, m_deviceMem(VK_NULL_HANDLE)
+		, m_data(NULL)
+		, m_segmentSize(0)
+		, m_numDedicated(0)
+	{
+		bx::memSet(m_pos, 0, sizeof(m_pos) );
+	}
+
+	VkResult StagingRingVK::create(uint32_t _size, uint32_t _numFramesInFlight)
+	{
+		const VkDevice device = s_renderVK->m_device;
+
+		VkResult result = s_renderVK->createStagingBuffer(_size * _numFramesInFlight, &m_buffer, &m_deviceMem);
+
+		if (VK_SUCCESS != result)
+		{
+			BX_TRACE("Create staging ring error: createStagingBuffer failed %d: %s.", result, getName(result) );
+			destroy();
+			return result;
+		}
+
+		result = vkMapMemory(device, m_deviceMem, 0, VK_WHOLE_SIZE, 0, (void**)&m_data);
+
+		if (VK_SUCCESS != result)
+		{
+			BX_TRACE("Create staging ring error: vkMapMemory failed %d: %s.", result, getName(result) );
+			destroy();
+			return result;
+		}
+
+		m_segmentSize = _size;
+		bx::memSet(m_pos, 0, sizeof(m_pos) );
+
+		return result;
+	}
+
+	void StagingRingVK::destroy()
+	{
+		if (NULL != m_data)
+		{
+			vkUnmapMemory(s_renderVK->m_device, m_deviceMem);
+			m_data = NULL;
+		}
+
+		s_renderVK->release(m_buffer);
+		s_renderVK->release(m_deviceMem);
+
+		m_segmentSize = 0;
+	}
+
+	void StagingRingVK::reset(uint32_t _frameInFlight)
+	{
+		m_pos[_frameInFlight] = 0;
+	}
+
+	bool StagingRingVK::alloc(uint32_t _frameInFlight, uint32_t _size, uint32_t _align, StagingBufferVK* _staging)
+	{
+		if (NULL == m_data)
+		{
+			return false;
+		}
+
+		// Copy offsets must be multiple of texel block size, which is not
+		// always power of two, so offset is aligned within whole buffer.
+		const uint64_t base   = uint64_t(_frameInFlight)*m_segmentSize;
+		const uint64_t offset = (base + m_pos[_frameInFlight] + _align - 1) / _align * _align;
+
+		if (offset + _size > base + m_segmentSize)
+		{
+			return false;
+		}
+
+		_staging->m_buffer    = m_buffer;
+		_staging->m_deviceMem = VK_NULL_HANDLE;
+		_staging->m_offset    = offset;
+		_staging->m_data      = &m_data[offset];
+
+		m_pos[_frameInFlight] = uint32_t(offset + _size - base);
+
+		return true;
+	}
+
+	PipelineCompilerVK::PipelineCompilerVK()
+		: m_device(VK_NULL_HANDLE)
+		, m_allocatorCb(NULL)
+		, m_queueHead(NULL)
+		, m_queueTail(NULL)
+		, m_doneHead(NULL)
+		, m_numThreads(0)
+		, m_exit(false)
+	{
+	}
+
+	void PipelineCompilerVK::init(VkDevice _device, const VkAllocationCallbacks* _allocatorCb, uint32_t _numThreads)
+	{
+		m_device      = _device;
+		m_allocatorCb = _allocatorCb;
+		m_numThreads  = bx::min<uint32_t>(_numThreads, BGFX_CONFIG_MAX_PIPELINE_COMPILE_THREADS);
+		m_exit        = false;
+
+		for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+		{
+			m_thread[ii].init(threadFunc, this, 0, "bgfx - vk pso compile");
+		}
+	}
+
+	void PipelineCompilerVK::shutdown()
+	{
+		{
+			bx::MutexScope lock(m_mutex);
+			m_exit = true;
+		}
+
+		m_work.post(m_numThreads);
+
+		for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+		{
+			m_thread[ii].shutdown();
+		}
+
+		m_numThreads = 0;
+
+		// Anything left in queue is compiled in place, so caller can collect it with popDone.
+		for (PipelineCompileJobVK* job = m_queueHead; NULL != job;)
+		{
+			PipelineCompileJobVK* next = job->m_next;
+			compile(job);
+			job->m_state = PipelineCompileJobVK::State::Done;
+			job->m_next  = m_doneHead;
+			m_doneHead   = job;
+			job = next;
+		}
+
+		m_queueHead = NULL;
+		m_queueTail = NULL;
+	}
+
+	void PipelineCompilerVK::queue(PipelineCompileJobVK* _job)
+	{
+		_job->m_next    = NULL;
+		_job->m_state   = PipelineCompileJobVK::State::Queued;
+		_job->m_waiting = false;
+
+		if (0 == m_numThreads)
+		{
+			compile(_job);
+
+			bx::MutexScope lock(m_mutex);
+			_job->m_state = PipelineCompileJobVK::State::Done;
+			_job->m_next  = m_doneHead;
+			m_doneHead    = _job;
+			return;
+		}
+
+		{
+			bx::MutexScope lock(m_mutex);
+
+			if (NULL == m_queueTail)
+			{
+				m_queueHead = _job;
+			}
+			else
+			{
+				m_queueTail->m_next = _job;
+			}
+
+			m_queueTail = _job;
+		}
+
+		m_work.post();
+	}
+
+	void PipelineCompilerVK::wait(PipelineCompileJobVK* _job)
+	{
+		bool steal = false;
+
+		{
+			bx::MutexScope lock(m_mutex);
+
+			if (PipelineCompileJobVK::State::Queued == _job->m_state)
+			{
+				// Job didn't start yet, unlink it from queue and compile it on calling thread
+				// instead of waiting behind other jobs.
+				PipelineCompileJobVK* prev = NULL;
+				for (PipelineCompileJobVK* job = m_queueHead; job != _job; prev = job, job = job->m_next)
+				{
+				}
+
+				if (NULL == prev)
+				{
+					m_queueHead = _job->m_next;
+				}
+				else
+				{
+					prev->m_next = _job->m_next;
+				}
+
+				if (m_queueTail == _job)
+				{
+					m_queueTail = prev;
+				}
+
+				_job->m_state = PipelineCompileJobVK::State::Compiling;
+				steal = true;
+			}
+		}
+
+		if (steal)
+		{
+			compile(_job);
+
+			bx::MutexScope lock(m_mutex);
+			_job->m_state = PipelineCompileJobVK::State::Done;
+			_job->m_next  = m_doneHead;
+			m_doneHead    = _job;
+			return;
+		}
+
+		{
+			bx::MutexScope lock(m_mutex);
+			if (PipelineCompileJobVK::State::Done == _job->m_state)
+			{
+				return;
+			}
+
+			// Worker posts m_done only for job being waited on, so that there
+			// are no posts left over from other jobs.
+			_job->m_waiting = true;
+		}
+
+		m_done.wait();
+
+		BX_ASSERT(PipelineCompileJobVK::State::Done == _job->m_state, "Pipeline compile job is not done.");
+	}
+
+	PipelineCompileJobVK* PipelineCompilerVK::popDone()
+	{
+		bx::MutexScope lock(m_mutex);
+
+		PipelineCompileJobVK* job = m_doneHead;
+		if (NULL != job)
+		{
+			m_doneHead  = job->m_next;
+			job->m_next = NULL;
+		}
+
+		return job;
+	}
+
+	void PipelineCompilerVK::compile(PipelineCompileJobVK* _job)
+	{
+		const int64_t start = bx::getHPCounter();
+
+		_job->m_result = vkCreateGraphicsPipelines(
+			  m_device
+			, _job->m_cache
+			, 1
+			, &_job->m_createInfo
+			, m_allocatorCb
+			, &_job->m_pipeline
+			);
+
+		_job->m_time = bx::getHPCounter() - start;
+	}
+
+	int32_t PipelineCompilerVK::worker()
+	{
+		for (;;)
+		{
+			m_work.wait();
+
+			PipelineCompileJobVK* job;
+
+			{
+				bx::MutexScope lock(m_mutex);
+
+				if (m_exit)
+				{
+					break;
+				}
+
+				job = m_queueHead;
+				if (NULL == job)
+				{
+					// Job was stolen by wait.
+					continue;
+				}
+
+				m_queueHead = job->m_next;
+				if (NULL == m_queueHead)
+				{
+					m_queueTail = NULL;
+				}
+
+				job->m_state = PipelineCompileJobVK::State::Compiling;
+			}
+
+			compile(job);
+
+			bool waiting;
+
+			{
+				bx::MutexScope lock(m_mutex);
+				job->m_state = PipelineCompileJobVK::State::Done;
+				job->m_next  = m_doneHead;
+				m_doneHead   = job;
+				waiting      = job->m_waiting;
+			}
+
+			if (waiting)
+			{
+				m_done.post();
+			}
+		}
+
+		return 0;
+	}
+
+	int32_t PipelineCompilerVK::threadFunc(bx::Thread* _thread, void* _userData)
+	{
+		BX_UNUSED(_thread);
+		PipelineCompilerVK* compiler = (PipelineCompilerVK*)_userData;
+		return compiler->worker();
+	}
+
+	void DrawCommandStateVK::reset()
+	{
+		m_pipeline         = VK_NULL_HANDLE;
+		m_pipelineLayout   = VK_NULL_HANDLE;
+		m_descriptorSet    = VK_NULL_HANDLE;
+		m_indexBuffer      = VK_NULL_HANDLE;
+		m_indexType        = VK_INDEX_TYPE_MAX_ENUM;
+		m_rgba             = UINT64_MAX;
+		m_stencilRef       = UINT32_MAX;
+		m_numVertexBuffers = 0;
+		m_numOffsets       = UINT8_MAX;
+
+		m_scissor.offset.x      = INT32_MAX;
+		m_scissor.offset.y      = INT32_MAX;
+		m_scissor.extent.width  = 0;
+		m_scissor.extent.height = 0;
+	}
+
+	void recordDrawCommand(VkCommandBuffer _commandBuffer, DrawCommandStateVK& _state, const DrawCommandVK& _cmd)
+	{
+		if (0 < _cmd.m_numVertexBuffers)
+		{
+			const uint8_t num = _cmd.m_numVertexBuffers;
+
+			if (_state.m_numVertexBuffers != num
+			||  0 != bx::memCmp(_state.m_vertexBuffer, _cmd.m_vertexBuffer, num*sizeof(VkBuffer) )
+			||  0 != bx::memCmp(_state.m_vertexOffset, _cmd.m_vertexOffset, num*sizeof(VkDeviceSize) ) )
+			{
+				_state.m_numVertexBuffers = num;
+				bx::memCopy(_state.m_vertexBuffer, _cmd.m_vertexBuffer, num*sizeof(VkBuffer) );
+				bx::memCopy(_state.m_vertexOffset, _cmd.m_vertexOffset, num*sizeof(VkDeviceSize) );
+
+				vkCmdBindVertexBuffers(
+					  _commandBuffer
+					, 0
+					, num
+					, _cmd.m_vertexBuffer
+					, _cmd.m_vertexOffset
+					);
+			}
+		}
+
+		if (_state.m_pipeline != _cmd.m_pipeline)
+		{
+			_state.m_pipeline = _cmd.m_pipeline;
+			vkCmdBindPipeline(_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, _cmd.m_pipeline);
+		}
+
+		if (UINT32_MAX != _cmd.m_stencilRef
+		&&  _state.m_stencilRef != _cmd.m_stencilRef)
+		{
+			_state.m_stencilRef = _cmd.m_stencilRef;
+			vkCmdSetStencilReference(_commandBuffer, VK_STENCIL_FRONT_AND_BACK, _cmd.m_stencilRef);
+		}
+
+		if (UINT64_MAX != _cmd.m_rgba
+		&&  _state.m_rgba != _cmd.m_rgba)
+		{
+			_state.m_rgba = _cmd.m_rgba;
+
+			float bf[4];
+			bf[0] = ( (_cmd.m_rgba>>24)     )/255.0f;
+			bf[1] = ( (_cmd.m_rgba>>16)&0xff)/255.0f;
+			bf[2] = ( (_cmd.m_rgba>> 8)&0xff)/255.0f;
+			bf[3] = ( (_cmd.m_rgba    )&0xff)/255.0f;
+			vkCmdSetBlendConstants(_commandBuffer, bf);
+		}
+
+		if (0 != bx::memCmp(&_state.m_scissor, &_cmd.m_scissor, sizeof(VkRect2D) ) )
+		{
+			_state.m_scissor = _cmd.m_scissor;
+			vkCmdSetScissor(_commandBuffer, 0, 1, &_cmd.m_scissor);
+		}
+
+		if (VK_NULL_HANDLE != _cmd.m_pipelineLayout)
+		{
+			if (_state.m_pipelineLayout != _cmd.m_pipelineLayout
+			||  _state.m_descriptorSet  != _cmd.m_descriptorSet
+			||  _state.m_numOffsets     != _cmd.m_numOffsets
+			||  0 != bx::memCmp(_state.m_offsets, _cmd.m_offsets, _cmd.m_numOffsets*sizeof(uint32_t) ) )
+			{
+				_state.m_pipelineLayout = _cmd.m_pipelineLayout;
+				_state.m_descriptorSet  = _cmd.m_descriptorSet;
+				_state.m_numOffsets     = _cmd.m_numOffsets;
+				bx::memCopy(_state.m_offsets, _cmd.m_offsets, _cmd.m_numOffsets*sizeof(uint32_t) );
+
+				vkCmdBindDescriptorSets(
+					  _commandBuffer
+					, VK_PIPELINE_BIND_POINT_GRAPHICS
+					, _cmd.m_pipelineLayout
+					, 0
+					, 1
+					, &_cmd.m_descriptorSet
+					, _cmd.m_numOffsets
+					, _cmd.m_offsets
+					);
+			}
+		}
+
+		if (VK_NULL_HANDLE == _cmd.m_indexBuffer)
+		{
+			if (VK_NULL_HANDLE != _cmd.m_indirectBuffer)
+			{
+				vkCmdDrawIndirect(
+					  _commandBuffer
+					, _cmd.m_indirectBuffer
+					, _cmd.m_indirectOffset
+					, _cmd.m_numIndirect
+					, BGFX_CONFIG_DRAW_INDIRECT_STRIDE
+					);
+			}
+			else
+			{
+				vkCmdDraw(
+					  _commandBuffer
+					, _cmd.m_num
+					, _cmd.m_numInstances
+					, 0
+					, 0
+					);
+			}
+
+			return;
+		}
+
+		if (_state.m_indexBuffer != _cmd.m_indexBuffer
+		||  _state.m_indexType   != _cmd.m_indexType)
+		{
+			_state.m_indexBuffer = _cmd.m_indexBuffer;
+			_state.m_indexType   = _cmd.m_indexType;
+
+			vkCmdBindIndexBuffer(
+				  _commandBuffer
+				, _cmd.m_indexBuffer
+				, 0
+				, _cmd.m_indexType
+				);
+		}
+
+		if (VK_NULL_HANDLE != _cmd.m_indirectBuffer)
+		{
+			vkCmdDrawIndexedIndirect(
+				  _commandBuffer
+				, _cmd.m_indirectBuffer
+				, _cmd.m_indirectOffset
+				, _cmd.m_numIndirect
+				, BGFX_CONFIG_DRAW_INDIRECT_STRIDE
+				);
+		}
+		else
+		{
+			vkCmdDrawIndexed(
+				  _commandBuffer
+				, _cmd.m_num
+				, _cmd.m_numInstances
+				, _cmd.m_startIndex
+				, 0
+				, 0
+				);
+		}
+	}
+
+	CommandRecorderVK::CommandRecorderVK()
+		: m_device(VK_NULL_HANDLE)
+		, m_allocatorCb(NULL)
+		, m_numJobs(0)
+		, m_nextJob(0)
+		, m_numFramesInFlight(0)
+		, m_frameInFlight(0)
+		, m_numThreads(0)
+		, m_exit(false)
+	{
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_commandPool); ++ii)
+		{
+			for (uint32_t jj = 0; jj < BX_COUNTOF(m_commandPool[0]); ++jj)
+			{
+				m_commandPool[ii][jj].m_commandPool = VK_NULL_HANDLE;
+				m_commandPool[ii][jj].m_numUsed     = 0;
+			}
+		}
+
+		bx::memSet(&m_current, 0, sizeof(m_current) );
+		bx::memSet(&m_stats,   0, sizeof(m_stats)   );
+	}
+
+	VkResult CommandRecorderVK::init(VkDevice _device, const VkAllocationCallbacks* _allocatorCb, uint32_t _queueFamily, uint32_t _numFramesInFlight, uint32_t _numThreads)
+	{
+		m_device            = _device;
+		m_allocatorCb       = _allocatorCb;
+		m_numFramesInFlight = _numFramesInFlight;
+		m_frameInFlight     = 0;
+		m_exit              = false;
+
+		VkCommandPoolCreateInfo cpci;
+		cpci.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		cpci.pNext = NULL;
+		cpci.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+		cpci.queueFamilyIndex = _queueFamily;
+
+		const uint32_t numThreads = bx::min<uint32_t>(_numThreads, BGFX_CONFIG_MAX_COMMAND_RECORD_THREADS);
+
+		// Command pools are externally synchronized, each thread records from its own
+		// pool, and there is pool per frame in flight so it can be reset as a whole.
+		for (uint32_t ii = 0; ii < numThreads+1; ++ii)
+		{
+			for (uint32_t jj = 0; jj < m_numFramesInFlight; ++jj)
+			{
+				const VkResult result = vkCreateCommandPool(
+					  m_device
+					, &cpci
+					, m_allocatorCb
+					, &m_commandPool[ii][jj].m_commandPool
+					);
+
+				if (VK_SUCCESS != result)
+				{
+					BX_TRACE("Create command recorder error: vkCreateCommandPool failed %d: %s.", result, getName(result) );
+					shutdown();
+					return result;
+				}
+			}
+		}
+
+		m_numThreads = numThreads;
+
+		for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+		{
+			m_threadData[ii].m_recorder = this;
+			m_threadData[ii].m_idx      = ii+1;
+			m_thread[ii].init(threadFunc, &m_threadData[ii], 0, "bgfx - vk cmd record");
+		}
+
+		return VK_SUCCESS;
+	}
+
+	void CommandRecorderVK::shutdown()
+	{
+		{
+			bx::MutexScope lock(m_mutex);
+			m_exit = true;
+		}
+
+		m_work.post(m_numThreads);
+
+		for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+		{
+			m_thread[ii].shutdown();
+		}
+
+		m_numThreads = 0;
+
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_commandPool); ++ii)
+		{
+			for (uint32_t jj = 0; jj < BX_COUNTOF(m_commandPool[0]); ++jj)
+			{
+				CommandPool& pool = m_commandPool[ii][jj];
+
+				if (VK_NULL_HANDLE != pool.m_commandPool)
+				{
+					// Destroying pool frees all command buffers allocated from it.
+					vkDestroyCommandPool(m_device, pool.m_commandPool, m_allocatorCb);
+					pool.m_commandPool = VK_NULL_HANDLE;
+				}
+
+				pool.m_commandBuffer.clear();
+				pool.m_numUsed = 0;
+			}
+		}
+	}
+
+	void CommandRecorderVK::reset(uint32_t _frameInFlight)
+	{
+		m_frameInFlight = _frameInFlight;
+
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_commandPool); ++ii)
+		{
+			CommandPool& pool = m_commandPool[ii][_frameInFlight];
+
+			if (VK_NULL_HANDLE != pool.m_commandPool
+			&&  0 != pool.m_numUsed)
+			{
+				VK_CHECK(vkResetCommandPool(m_device, pool.m_commandPool, 0) );
+				pool.m_numUsed = 0;
+			}
+		}
+	}
+
+	void CommandRecorderVK::execute(VkCommandBuffer _commandBuffer, const VkRenderPassBeginInfo& _rpbi, const VkViewport& _viewport, const DrawCommandVK* _draw, uint32_t _num)
+	{
+		if (0 == _num)
+		{
+			return;
+		}
+
+		m_inheritanceInfo.sType                = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+		m_inheritanceInfo.pNext                = NULL;
+		m_inheritanceInfo.renderPass           = _rpbi.renderPass;
+		m_inheritanceInfo.subpass              = 0;
+		m_inheritanceInfo.framebuffer          = _rpbi.framebuffer;
+		m_inheritanceInfo.occlusionQueryEnable = VK_FALSE;
+		m_inheritanceInfo.queryFlags           = 0;
+		m_inheritanceInfo.pipelineStatistics   = 0;
+		m_viewport = _viewport;
+
+		const uint32_t numJobs = bx::clamp<uint32_t>(_num/BGFX_CONFIG_COMMAND_RECORD_MIN_DRAWS, 1, m_numThreads+1);
+		const uint32_t numDrawsPerJob = (_num + numJobs - 1) / numJobs;
+
+		{
+			bx::MutexScope lock(m_mutex);
+
+			for (uint32_t ii = 0, offset = 0; ii < numJobs; ++ii, offset += numDrawsPerJob)
+			{
+				CommandRecordJobVK& job = m_job[ii];
+				job.m_draw          = &_draw[offset];
+				job.m_numDraws      = bx::min<uint32_t>(numDrawsPerJob, _num - offset);
+				job.m_commandBuffer = VK_NULL_HANDLE;
+				job.m_result        = VK_SUCCESS;
+			}
+
+			m_numJobs = numJobs;
+			m_nextJob = 0;
+		}
+
+		m_work.post(numJobs-1);
+
+		// Render thread records jobs too, and waits only for jobs taken by workers.
+		uint32_t numRecorded = 0;
+		while (recordNext(0) )
+		{
+			++numRecorded;
+		}
+
+		for (uint32_t ii = numRecorded; ii < numJobs; ++ii)
+		{
+			m_done.wait();
+		}
+
+		VkCommandBuffer commandBuffers[BX_COUNTOF(m_job)];
+		uint32_t numCommandBuffers = 0;
+
+		for (uint32_t ii = 0; ii < numJobs; ++ii)
+		{
+			const CommandRecordJobVK& job = m_job[ii];
+
+			if (VK_SUCCESS == job.m_result)
+			{
+				commandBuffers[numCommandBuffers++] = job.m_commandBuffer;
+			}
+			else
+			{
+				BX_TRACE("Recording secondary command buffer failed %d: %s.", job.m_result, getName(job.m_result) );
+			}
+		}
+
+		if (0 < numCommandBuffers)
+		{
+			vkCmdExecuteCommands(_commandBuffer, numCommandBuffers, commandBuffers);
+		}
+
+		m_current.m_numViews++;
+		m_current.m_numCommandBuffers += numCommandBuffers;
+	}
+
+	void CommandRecorderVK::frame()
+	{
+		m_stats = m_current;
+		bx::memSet(&m_current, 0, sizeof(m_current) );
+	}
+
+	bool CommandRecorderVK::recordNext(uint32_t _threadIdx)
+	{
+		CommandRecordJobVK* job;
+
+		{
+			bx::MutexScope lock(m_mutex);
+
+			if (m_nextJob >= m_numJobs)
+			{
+				return false;
+			}
+
+			job = &m_job[m_nextJob++];
+		}
+
+		record(_threadIdx, *job);
+
+		return true;
+	}
+
+	void CommandRecorderVK::record(uint32_t _threadIdx, CommandRecordJobVK& _job)
+	{
+		const int64_t start = bx::getHPCounter();
+
+		const VkCommandBuffer commandBuffer = allocCommandBuffer(_threadIdx);
+
+		if (VK_NULL_HANDLE == commandBuffer)
+		{
+			_job.m_result = VK_ERROR_OUT_OF_HOST_MEMORY;
+			return;
+		}
+
+		VkCommandBufferBeginInfo cbbi;
+		cbbi.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		cbbi.pNext = NULL;
+		cbbi.flags = 0
+			| VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+			| VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT
+			;
+		cbbi.pInheritanceInfo = &m_inheritanceInfo;
+
+		_job.m_result = vkBeginCommandBuffer(commandBuffer, &cbbi);
+
+		if (VK_SUCCESS == _job.m_result)
+		{
+			// Secondary command buffer doesn't inherit any state from primary.
+			vkCmdSetViewport(commandBuffer, 0, 1, &m_viewport);
+
+			DrawCommandStateVK state;
+			state.reset();
+
+			for (uint32_t ii = 0; ii < _job.m_numDraws; ++ii)
+			{
+				recordDrawCommand(commandBuffer, state, _job.m_draw[ii]);
+			}
+
+			_job.m_result = vkEndCommandBuffer(commandBuffer);
+		}
+
+		_job.m_commandBuffer = commandBuffer;
+
+		// Each thread writes only its own stats slot.
+		m_current.m_time[_threadIdx]     += bx::getHPCounter() - start;
+		m_current.m_numDraws[_threadIdx] += _job.m_numDraws;
+	}
+
+	VkCommandBuffer CommandRecorderVK::allocCommandBuffer(uint32_t _threadIdx)
+	{
+		CommandPool& pool = m_commandPool[_threadIdx][m_frameInFlight];
+
+		if (pool.m_numUsed == pool.m_commandBuffer.size() )
+		{
+			VkCommandBufferAllocateInfo cbai;
+			cbai.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			cbai.pNext = NULL;
+			cbai.commandPool = pool.m_commandPool;
+			cbai.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+			cbai.commandBufferCount = 1;
+
+			VkCommandBuffer commandBuffer;
+			const VkResult result = vkAllocateCommandBuffers(m_device, &cbai, &commandBuffer);
+
+			if (VK_SUCCESS != result)
+			{
+				BX_TRACE("Allocate secondary command buffer error: vkAllocateCommandBuffers failed %d: %s.", result, getName(result) );
+				return VK_NULL_HANDLE;
+			}
+
+			pool.m_commandBuffer.push_back(commandBuffer);
+		}
+
+		return pool.m_commandBuffer[pool.m_numUsed++];
+	}
+
+	int32_t CommandRecorderVK::worker(uint32_t _threadIdx)
+	{
+		for (;;)
+		{
+			m_work.wait();
+
+			{
+				bx::MutexScope lock(m_mutex);
+
+				if (m_exit)
+				{
+					break;
+				}
+			}
+
+			// Jobs might be already taken by render thread.
+			if (recordNext(_threadIdx) )
+			{
+				m_done.post();
+			}
+		}
+
+		return 0;
+	}
+
+	int32_t CommandRecorderVK::threadFunc(bx::Thread* _thread, void* _userData)
+	{
+		BX_UNUSED(_thread);
+		ThreadData* data = (ThreadData*)_userData;
+		return data->m_recorder->worker(data->m_idx);
+	}
+
+	DeviceMemoryAllocatorVK::DeviceMemoryAllocatorVK()
+		: m_device(VK_NULL_HANDLE)
+		, m_allocatorCb(NULL)
+		, m_numFramesInFlight(0)
+		, m_maxOrder(0)
+		, m_allocated(0)
+		, m_used(0)
+		, m_requested(0)
+		, m_numDedicated(0)
+		, m_numAllocations(0)
+	{
+		bx::memSet(m_numPoolBlocks, 0, sizeof(m_numPoolBlocks) );
+	}
+
+	void DeviceMemoryAllocatorVK::init(VkDevice _device, const VkAllocationCallbacks* _allocatorCb, uint32_t _numFramesInFlight)
+	{
+		BX_STATIC_ASSERT(0 == (BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE & (BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE-1) ), "Block size must be power of two.");
+		BX_STATIC_ASSERT(0 == (BGFX_CONFIG_DEVICE_MEMORY_MIN_ALLOC_SIZE & (BGFX_CONFIG_DEVICE_MEMORY_MIN_ALLOC_SIZE-1) ), "Min allocation size must be power of two.");
+		BX_STATIC_ASSERT(BGFX_CONFIG_DEVICE_MEMORY_MIN_ALLOC_SIZE < BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE);
+
+		m_device            = _device;
+		m_allocatorCb       = _allocatorCb;
+		m_numFramesInFlight = _numFramesInFlight;
+		m_maxOrder          = uint8_t(bx::uint32_cnttz(BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE / BGFX_CONFIG_DEVICE_MEMORY_MIN_ALLOC_SIZE) );
+	}
+
+	void DeviceMemoryAllocatorVK::shutdown()
+	{
+		for (uint32_t ii = 0; ii < m_numFramesInFlight; ++ii)
+		{
+			consume(ii);
+		}
+
+		BX_WARN(0 == m_numAllocations, "Device memory allocations leaked: %d.", m_numAllocations);
+
+		for (uint32_t ii = 0, num = uint32_t(m_block.size() ); ii < num; ++ii)
+		{
+			if (NULL != m_block[ii])
+			{
+				destroyBlock(ii);
+			}
+		}
+
+		m_block.clear();
+		m_freeBlockSlots.clear();
+	}
+
+	VkResult DeviceMemoryAllocatorVK::alloc(const VkMemoryRequirements& _requirements, uint32_t _memoryType, bool _image, DeviceMemoryAllocationVK* _allocation)
+	{
+		const uint64_t size = bx::max<uint64_t>(_requirements.size, _requirements.alignment);
+
+		if (size > BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE/2
+		|| (_image && size >= BGFX_CONFIG_DEVICE_MEMORY_DEDICATED_IMAGE_SIZE) )
+		{
+			return allocDedicated(_requirements, _memoryType, _allocation);
+		}
+
+		// Linear and optimal resources are kept in separate blocks, so that
+		// bufferImageGranularity never has to be considered.
+		const uint32_t pool     = _memoryType*2 + (_image ? 1 : 0);
+		const uint32_t numUnits = uint32_t( (size + BGFX_CONFIG_DEVICE_MEMORY_MIN_ALLOC_SIZE - 1) / BGFX_CONFIG_DEVICE_MEMORY_MIN_ALLOC_SIZE);
+		const uint8_t  order    = uint8_t(bx::uint32_cnttz(bx::uint32_nextpow2(numUnits) ) );
+
+		uint32_t block  = UINT32_MAX;
+		uint32_t offset = 0;
+
+		for (uint32_t ii = 0, num = uint32_t(m_block.size() ); ii < num; ++ii)
+		{
+			if (NULL != m_block[ii]
+			&&  pool == m_block[ii]->m_pool
+			&&  allocBlock(ii, order, &offset) )
+			{
+				block = ii;
+				break;
+			}
+		}
+
+		if (UINT32_MAX == block)
+		{
+			if (VK_SUCCESS != createBlock(pool, &block) )
+			{
+				// Whole block doesn't fit into heap anymore, smaller dedicated
+				// allocation still might.
+				return allocDedicated(_requirements, _memoryType, _allocation);
+			}
+
+			allocBlock(block, order, &offset);
+		}
+
+		_allocation->m_memory    = m_block[block]->m_memory;
+		_allocation->m_offset    = VkDeviceSize(offset) * BGFX_CONFIG_DEVICE_MEMORY_MIN_ALLOC_SIZE;
+		_allocation->m_size      = VkDeviceSize(BGFX_CONFIG_DEVICE_MEMORY_MIN_ALLOC_SIZE) << order;
+		_allocation->m_requested = _requirements.size;
+		_allocation->m_block     = block;
+		_allocation->m_order     = order;
+
+		m_used      += _allocation->m_size;
+		m_requested += _allocation->m_requested;
+		m_numAllocations++;
+
+		return VK_SUCCESS;
+	}
+
+	void DeviceMemoryAllocatorVK::release(DeviceMemoryAllocationVK& _allocation, uint32_t _frameInFlight)
+	{
+		if (VK_NULL_HANDLE != _allocation.m_memory)
+		{
+			m_release[_frameInFlight].push_back(_allocation);
+			_allocation = DeviceMemoryAllocationVK();
+		}
+	}
+
+	void DeviceMemoryAllocatorVK::consume(uint32_t _frameInFlight)
+	{
+		AllocationArray& release = m_release[_frameInFlight];
+
+		for (uint32_t ii = 0, num = uint32_t(release.size() ); ii < num; ++ii)
+		{
+			free(release[ii]);
+		}
+
+		release.clear();
+	}
+
+	void DeviceMemoryAllocatorVK::getStats(Stats& _stats) const
+	{
+		_stats.m_allocated      = m_allocated;
+		_stats.m_used           = m_used;
+		_stats.m_requested      = m_requested;
+		_stats.m_free           = 0;
+		_stats.m_largestFree    = 0;
+		_stats.m_numBlocks      = 0;
+		_stats.m_numDedicated   = m_numDedicated;
+		_stats.m_numAllocations = m_numAllocations;
+
+		for (uint32_t ii = 0, num = uint32_t(m_block.size() ); ii < num; ++ii)
+		{
+			const Block* block = m_block[ii];
+
+			if (NULL != block)
+			{
+				_stats.m_numBlocks++;
+				_stats.m_free += BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE - uint64_t(block->m_used) * BGFX_CONFIG_DEVICE_MEMORY_MIN_ALLOC_SIZE;
+
+				for (int32_t order = m_maxOrder; order >= 0; --order)
+				{
+					if (!block->m_free[order].empty() )
+					{
+						_stats.m_largestFree = bx::max<uint64_t>(_stats.m_largestFree, uint64_t(BGFX_CONFIG_DEVICE_MEMORY_MIN_ALLOC_SIZE) << order);
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	VkResult DeviceMemoryAllocatorVK::allocDedicated(const VkMemoryRequirements& _requirements, uint32_t _memoryType, DeviceMemoryAllocationVK* _allocation)
+	{
+		VkMemoryAllocateInfo ma;
+		ma.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		ma.pNext = NULL;
+		ma.allocationSize  = _requirements.size;
+		ma.memoryTypeIndex = _memoryType;
+
+		VkResult result = vkAllocateMemory(m_device, &ma, m_allocatorCb, &_allocation->m_memory);
+
+		if (VK_SUCCESS == result)
+		{
+			_allocation->m_offset    = 0;
+			_allocation->m_size      = _requirements.size;
+			_allocation->m_requested = _requirements.size;
+			_allocation->m_block     = UINT32_MAX;
+			_allocation->m_order     = 0;
+
+			m_allocated += _allocation->m_size;
+			m_used      += _allocation->m_size;
+			m_requested += _allocation->m_requested;
+			m_numDedicated++;
+			m_numAllocations++;
+		}
+
+		return result;
+	}
+
+	VkResult DeviceMemoryAllocatorVK::createBlock(uint32_t _pool, uint32_t* _block)
+	{
+		VkMemoryAllocateInfo ma;
+		ma.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		ma.pNext = NULL;
+		ma.allocationSize  = BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE;
+		ma.memoryTypeIndex = _pool/2;
+
+		VkDeviceMemory memory;
+		VkResult result = vkAllocateMemory(m_device, &ma, m_allocatorCb, &memory);
+
+		if (VK_SUCCESS != result)
+		{
+			BX_TRACE("Create device memory block error: vkAllocateMemory failed %d: %s.", result, getName(result) );
+			return result;
+		}
+
+		Block* block = BX_NEW(g_allocator, Block);
+		block->m_memory = memory;
+		block->m_pool   = _pool;
+		block->m_used   = 0;
+		block->m_free[m_maxOrder].push_back(0);
+
+		if (m_freeBlockSlots.empty() )
+		{
+			*_block = uint32_t(m_block.size() );
+			m_block.push_back(block);
+		}
+		else
+		{
+			*_block = m_freeBlockSlots.back();
+			m_freeBlockSlots.pop_back();
+			m_block[*_block] = block;
+		}
+
+		m_allocated += BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE;
+		m_numPoolBlocks[_pool]++;
+
+		return result;
+	}
+
+	void DeviceMemoryAllocatorVK::destroyBlock(uint32_t _block)
+	{
+		Block* block = m_block[_block];
+
+		vkFreeMemory(m_device, block->m_memory, m_allocatorCb);
+
+		m_allocated -= BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE;
+		m_numPoolBlocks[block->m_pool]--;
+
+		BX_DELETE(g_allocator, block);
+		m_block[_block] = NULL;
+		m_freeBlockSlots.push_back(_block);
+	}
+
+	bool DeviceMemoryAllocatorVK::allocBlock(uint32_t _block, uint8_t _order, uint32_t* _offset)
+	{
+		Block& block = *m_block[_block];
+
+		uint8_t order = _order;
+		while (order <= m_maxOrder
+		&&     block.m_free[order].empty() )
+		{
+			++order;
+		}
+
+		if (order > m_maxOrder)
+		{
+			return false;
+		}
+
+		const uint32_t offset = block.m_free[order].back();
+		block.m_free[order].pop_back();
+
+		// Split larger node, upper halves go to free lists of lower orders.
+		while (order > _order)
+		{
+			--order;
+			block.m_free[order].push_back(offset + (1<<order) );
+		}
+
+		block.m_used += 1<<_order;
+		*_offset = offset;
+
+		return true;
 	}
 
-	uint32_t ScratchBufferVK::write(const void* _data, uint32_t _size)
+	void DeviceMemoryAllocatorVK::free(const DeviceMemoryAllocationVK& _allocation)
 	{
-		BX_ASSERT(m_pos < m_size, "Out of scratch buffer memory");
+		m_used      -= _allocation.m_size;
+		m_requested -= _allocation.m_requested;
+		m_numAllocations--;
 
-		const uint32_t offset = m_pos;
+		if (_allocation.isDedicated() )
+		{
+			vkFreeMemory(m_device, _allocation.m_memory, m_allocatorCb);
 
-		if (_size > 0)
+			m_allocated -= _allocation.m_size;
+			m_numDedicated--;
+			return;
+		}
+
+		Block& block = *m_block[_allocation.m_block];
+
+		uint32_t offset = uint32_t(_allocation.m_offset / BGFX_CONFIG_DEVICE_MEMORY_MIN_ALLOC_SIZE);
+		uint8_t  order  = _allocation.m_order;
+
+		block.m_used -= 1<<order;
+
+		// Merge with free buddy as long as there is one.
+		for (; order < m_maxOrder; ++order)
 		{
-			bx::memCopy(&m_data[m_pos], _data, _size);
+			stl::vector<uint32_t>& freeList = block.m_free[order];
+			const uint32_t buddy = offset ^ (1<<order);
 
-			const VkPhysicalDeviceLimits& deviceLimits = s_renderVK->m_deviceProperties.limits;
-			const uint32_t align = uint32_t(deviceLimits.minUniformBufferOffsetAlignment);
-			const uint32_t alignedSize = bx::strideAlign(_size, align);
+			uint32_t idx = 0;
+			const uint32_t num = uint32_t(freeList.size() );
+			for (; idx < num && buddy != freeList[idx]; ++idx)
+			{
+			}
 
-			m_pos += alignedSize;
-		}
+			if (idx == num)
+			{
+				break;
+			}
 
-		return offset;
-	}
+			freeList[idx] = freeList.back();
+			freeList.pop_back();
 
-	void ScratchBufferVK::flush()
-	{
-		const VkPhysicalDeviceLimits& deviceLimits = s_renderVK->m_deviceProperties.limits;
-		VkDevice device = s_renderVK->m_device;
+			offset = bx::min(offset, buddy);
+		}
 
-		const uint32_t align = uint32_t(deviceLimits.nonCoherentAtomSize);
-		const uint32_t size  = bx::min(bx::strideAlign(m_pos, align), m_size);
+		block.m_free[order].push_back(offset);
 
-		VkMappedMemoryRange range;
-		range.sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-		range.pNext  = NULL;
-		range.memory = m_deviceMem;
-		range.offset = 0;
-		range.size   = size;
-		VK_CHECK(vkFlushMappedMemoryRanges(device, 1, &range) );
+		// Keep at least one block per pool around to avoid reallocating it
+		// every time last resource in pool is released.
+		if (0 == block.m_used
+		&&  1 < m_numPoolBlocks[block.m_pool])
+		{
+			destroyBlock(_allocation.m_block);
+		}
 	}
 
 	void BufferVK::create(VkCommandBuffer _commandBuffer, uint32_t _size, void* _data, uint16_t _flags, bool _vertex, uint32_t _stride)
@@ -4898,9 +6770,9 @@ VK_DESTROY
 		VkMemoryRequirements mr;
 		vkGetBufferMemoryRequirements(device, m_buffer, &mr);
 
-		VK_CHECK(s_renderVK->allocateMemory(&mr, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &m_deviceMem) );
+		VK_CHECK(s_renderVK->allocateMemory(&mr, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, false, &m_deviceMem) );
 
-		VK_CHECK(vkBindBufferMemory(device, m_buffer, m_deviceMem, 0) );
+		VK_CHECK(vkBindBufferMemory(device, m_buffer, m_deviceMem.m_memory, m_deviceMem.m_offset) );
 
 		if (!m_dynamic)
 		{
@@ -4912,15 +6784,14 @@ VK_DESTROY
 	{
 		BX_UNUSED(_discard);
 
-		VkBuffer stagingBuffer;
-		VkDeviceMemory stagingMem;
-		VK_CHECK(s_renderVK->createStagingBuffer(_size, &stagingBuffer, &stagingMem, _data) );
+		StagingBufferVK staging;
+		VK_CHECK(s_renderVK->allocStagingBuffer(_size, 4, &staging, _data) );
 
 		VkBufferCopy region;
-		region.srcOffset = 0;
+		region.srcOffset = staging.m_offset;
 		region.dstOffset = _offset;
 		region.size      = _size;
-		vkCmdCopyBuffer(_commandBuffer, stagingBuffer, m_buffer, 1, &region);
+		vkCmdCopyBuffer(_commandBuffer, staging.m_buffer, m_buffer, 1, &region);
 
 		setMemoryBarrier(
 			  _commandBuffer
@@ -4928,8 +6799,7 @@ VK_DESTROY
 			, VK_PIPELINE_STAGE_TRANSFER_BIT
 			);
 
-		s_renderVK->release(stagingBuffer);
-		s_renderVK->release(stagingMem);
+		s_renderVK->releaseStagingBuffer(staging);
 	}
 
 	void BufferVK::destroy()
@@ -5994,14 +7864,14 @@ VK_DESTROY
 		VkMemoryRequirements imageMemReq;
 		vkGetImageMemoryRequirements(device, m_textureImage, &imageMemReq);
 
-		result = s_renderVK->allocateMemory(&imageMemReq, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &m_textureDeviceMem);
+		result = s_renderVK->allocateMemory(&imageMemReq, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, true, &m_textureDeviceMem);
 		if (VK_SUCCESS != result)
 		{
 			BX_TRACE("Create texture image error: allocateMemory failed %d: %s.", result, getName(result) );
 			return result;
 		}
 
-		result = vkBindImageMemory(device, m_textureImage, m_textureDeviceMem, 0);
+		result = vkBindImageMemory(device, m_textureImage, m_textureDeviceMem.m_memory, m_textureDeviceMem.m_offset);
 		if (VK_SUCCESS != result)
 		{
 			BX_TRACE("Create texture image error: vkBindImageMemory failed %d: %s.", result, getName(result) );
@@ -6037,14 +7907,14 @@ VK_DESTROY
 			VkMemoryRequirements imageMemReq_resolve;
 			vkGetImageMemoryRequirements(device, m_singleMsaaImage, &imageMemReq_resolve);
 
-			result = s_renderVK->allocateMemory(&imageMemReq_resolve, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &m_singleMsaaDeviceMem);
+			result = s_renderVK->allocateMemory(&imageMemReq_resolve, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, true, &m_singleMsaaDeviceMem);
 			if (VK_SUCCESS != result)
 			{
 				BX_TRACE("Create texture image error: allocateMemory failed %d: %s.", result, getName(result) );
 				return result;
 			}
 
-			result = vkBindImageMemory(device, m_singleMsaaImage, m_singleMsaaDeviceMem, 0);
+			result = vkBindImageMemory(device, m_singleMsaaImage, m_singleMsaaDeviceMem.m_memory, m_singleMsaaDeviceMem.m_offset);
 			if (VK_SUCCESS != result)
 			{
 				BX_TRACE("Create texture image error: vkBindImageMemory failed %d: %s.", result, getName(result) );
@@ -6263,6 +8133,8 @@ VK_DESTROY
 				}
 			}
 
+			const uint32_t align = getCopyAlignment();
+
 			uint32_t totalMemSize = 0;
 			VkBufferImageCopy* bufferCopyInfo = (VkBufferImageCopy*)BX_ALLOC(g_allocator, sizeof(VkBufferImageCopy) * numSrd);
 
@@ -6270,6 +8142,7 @@ VK_DESTROY
 			{
 				const uint32_t idealWidth  = bx::max<uint32_t>(1, m_width  >> imageInfos[ii].mipLevel);
 				const uint32_t idealHeight = bx::max<uint32_t>(1, m_height >> imageInfos[ii].mipLevel);
+				totalMemSize = bx::strideAlign(totalMemSize, align);
 				bufferCopyInfo[ii].bufferOffset      = totalMemSize;
 				bufferCopyInfo[ii].bufferRowLength   = 0; // assume that image data are tightly aligned
 				bufferCopyInfo[ii].bufferImageHeight = 0; // assume that image data are tightly aligned
@@ -6284,35 +8157,19 @@ VK_DESTROY
 
 			if (totalMemSize > 0)
 			{
-				const VkDevice device = s_renderVK->m_device;
-
-				VkBuffer stagingBuffer;
-				VkDeviceMemory stagingDeviceMem;
-				VK_CHECK(s_renderVK->createStagingBuffer(totalMemSize, &stagingBuffer, &stagingDeviceMem) );
-
-				uint8_t* mappedMemory;
-				VK_CHECK(vkMapMemory(
-					  device
-					, stagingDeviceMem
-					, 0
-					, totalMemSize
-					, 0
-					, (void**)&mappedMemory
-					) );
+				StagingBufferVK staging;
+				VK_CHECK(s_renderVK->allocStagingBuffer(totalMemSize, align, &staging) );
 
 				// copy image to staging buffer
 				for (uint32_t ii = 0; ii < numSrd; ++ii)
 				{
-					bx::memCopy(mappedMemory, imageInfos[ii].data, imageInfos[ii].size);
-					mappedMemory += imageInfos[ii].size;
+					bx::memCopy(&staging.m_data[bufferCopyInfo[ii].bufferOffset], imageInfos[ii].data, imageInfos[ii].size);
+					bufferCopyInfo[ii].bufferOffset += staging.m_offset;
 				}
 
-				vkUnmapMemory(device, stagingDeviceMem);
-
-				copyBufferToTexture(_commandBuffer, stagingBuffer, numSrd, bufferCopyInfo);
+				copyBufferToTexture(_commandBuffer, staging.m_buffer, numSrd, bufferCopyInfo);
 
-				s_renderVK->release(stagingBuffer);
-				s_renderVK->release(stagingDeviceMem);
+				s_renderVK->releaseStagingBuffer(staging);
 			}
 			else
 			{
@@ -6338,6 +8195,10 @@ VK_DESTROY
 	{
 		m_readback.destroy();
 
+		// Texture is gone, there is no point to copy into it.
+		m_copyRegions.clear();
+		m_copyBuffer = VK_NULL_HANDLE;
+
 		if (VK_NULL_HANDLE != m_textureImage)
 		{
 			s_renderVK->release(m_textureImage);
@@ -6354,7 +8215,7 @@ VK_DESTROY
 		m_currentSingleMsaaImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 	}
 
-	void TextureVK::update(VkCommandBuffer _commandBuffer, uint8_t _side, uint8_t _mip, const Rect& _rect, uint16_t _z, uint16_t _depth, uint16_t _pitch, const Memory* _mem)
+	bool TextureVK::update(VkCommandBuffer _commandBuffer, uint8_t _side, uint8_t _mip, const Rect& _rect, uint16_t _z, uint16_t _depth, uint16_t _pitch, const Memory* _mem)
 	{
 		const uint32_t bpp = bimg::getBitsPerPixel(bimg::TextureFormat::Enum(m_textureFormat) );
 		uint32_t rectpitch = _rect.m_width * bpp / 8;
@@ -6397,9 +8258,10 @@ VK_DESTROY
 			};
 		}
 
-		VkBuffer stagingBuffer = VK_NULL_HANDLE;
-		VkDeviceMemory stagingDeviceMem = VK_NULL_HANDLE;
-		VK_CHECK(s_renderVK->createStagingBuffer(size, &stagingBuffer, &stagingDeviceMem, data) );
+		StagingBufferVK staging;
+		VK_CHECK(s_renderVK->allocStagingBuffer(size, getCopyAlignment(), &staging, data) );
+
+		region.bufferOffset = staging.m_offset;
 
 		if (VK_IMAGE_VIEW_TYPE_3D == m_type)
 		{
@@ -6415,15 +8277,16 @@ VK_DESTROY
 			region.imageSubresource.baseArrayLayer = _z;
 		}
 
-		copyBufferToTexture(_commandBuffer, stagingBuffer, 1, &region);
+		const bool queued = queueCopy(_commandBuffer, staging.m_buffer, region);
 
-		s_renderVK->release(stagingBuffer);
-		s_renderVK->release(stagingDeviceMem);
+		s_renderVK->releaseStagingBuffer(staging);
 
 		if (NULL != temp)
 		{
 			BX_FREE(g_allocator, temp);
 		}
+
+		return queued;
 	}
 
 	void TextureVK::resolve(VkCommandBuffer _commandBuffer, uint8_t _resolve, uint32_t _layer, uint32_t _numLayers, uint32_t _mip)
@@ -6574,6 +8437,71 @@ VK_DESTROY
 		setImageMemoryBarrier(_commandBuffer, oldLayout);
 	}
 
+	static bool overlaps(const VkBufferImageCopy& _a, const VkBufferImageCopy& _b)
+	{
+		const VkImageSubresourceLayers& as = _a.imageSubresource;
+		const VkImageSubresourceLayers& bs = _b.imageSubresource;
+
+		return as.mipLevel == bs.mipLevel
+			&& as.baseArrayLayer < bs.baseArrayLayer + bs.layerCount
+			&& bs.baseArrayLayer < as.baseArrayLayer + as.layerCount
+			&& _a.imageOffset.x < _b.imageOffset.x + int32_t(_b.imageExtent.width)
+			&& _b.imageOffset.x < _a.imageOffset.x + int32_t(_a.imageExtent.width)
+			&& _a.imageOffset.y < _b.imageOffset.y + int32_t(_b.imageExtent.height)
+			&& _b.imageOffset.y < _a.imageOffset.y + int32_t(_a.imageExtent.height)
+			&& _a.imageOffset.z < _b.imageOffset.z + int32_t(_b.imageExtent.depth)
+			&& _b.imageOffset.z < _a.imageOffset.z + int32_t(_a.imageExtent.depth)
+			;
+	}
+
+	bool TextureVK::queueCopy(VkCommandBuffer _commandBuffer, VkBuffer _stagingBuffer, const VkBufferImageCopy& _region)
+	{
+		// Texture is already in list of textures with queued copies when it has
+		// queued regions, even if they are flushed below.
+		const bool first = m_copyRegions.empty();
+
+		// Single copy command can source only one buffer, and its destination
+		// regions must not overlap. Flushing keeps last write wins order of
+		// overlapping updates.
+		bool flush = _stagingBuffer != m_copyBuffer;
+
+		for (uint32_t ii = 0, num = uint32_t(m_copyRegions.size() ); ii < num && !flush; ++ii)
+		{
+			flush = overlaps(m_copyRegions[ii], _region);
+		}
+
+		if (flush)
+		{
+			flushCopies(_commandBuffer);
+		}
+
+		m_copyBuffer = _stagingBuffer;
+		m_copyRegions.push_back(_region);
+
+		return first;
+	}
+
+	void TextureVK::flushCopies(VkCommandBuffer _commandBuffer)
+	{
+		if (!m_copyRegions.empty() )
+		{
+			copyBufferToTexture(_commandBuffer, m_copyBuffer, uint32_t(m_copyRegions.size() ), m_copyRegions.data() );
+			m_copyRegions.clear();
+		}
+	}
+
+	uint32_t TextureVK::getCopyAlignment() const
+	{
+		// Buffer offset must be multiple of texel block size and 4.
+		const bimg::ImageBlockInfo& blockInfo = bimg::getBlockInfo(bimg::TextureFormat::Enum(m_textureFormat) );
+		const uint32_t blockSize = bx::max<uint32_t>(1, blockInfo.blockSize);
+
+		return 0 == (blockSize & 3)
+			? blockSize
+			: blockSize * 4
+			;
+	}
+
 	VkImageLayout TextureVK::setImageMemoryBarrier(VkCommandBuffer _commandBuffer, VkImageLayout _newImageLayout, bool _singleMsaaImage)
 	{
 		if (_singleMsaaImage && VK_NULL_HANDLE == m_singleMsaaImage)
@@ -6610,6 +8538,36 @@ VK_DESTROY
 		return oldLayout;
 	}
 
+	VkImageLayout TextureVK::setImageMemoryBarrier(ImageBarrierBatchVK& _batch, VkImageLayout _newImageLayout, bool _singleMsaaImage)
+	{
+		if (_singleMsaaImage && VK_NULL_HANDLE == m_singleMsaaImage)
+		{
+			return VK_IMAGE_LAYOUT_UNDEFINED;
+		}
+
+		VkImageLayout& currentLayout = _singleMsaaImage
+			? m_currentSingleMsaaImageLayout
+			: m_currentImageLayout
+			;
+
+		const VkImageLayout oldLayout = currentLayout;
+
+		if (currentLayout == _newImageLayout)
+		{
+			return oldLayout;
+		}
+
+		_batch.add(
+			  _singleMsaaImage ? m_singleMsaaImage : m_textureImage
+			, m_aspectMask
+			, currentLayout
+			, _newImageLayout
+			);
+
+		currentLayout = _newImageLayout;
+		return oldLayout;
+	}
+
 	VkResult TextureVK::createView(uint32_t _layer, uint32_t _numLayers, uint32_t _mip, uint32_t _numMips, VkImageViewType _type, VkImageAspectFlags _aspectMask, bool _renderTarget, ::VkImageView* _view) const
 	{
 		VkResult result = VK_SUCCESS;
@@ -8020,6 +9978,9 @@ VK_DESTROY
 				return result;
 			}
 
+			s_renderVK->m_commandRecorder.reset(m_currentFrameInFlight);
+			s_renderVK->m_stagingRing.reset(m_currentFrameInFlight);
+
 			VkCommandBufferBeginInfo cbi;
 			cbi.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
 			cbi.pNext = NULL;
@@ -8152,7 +10113,6 @@ VK_DESTROY
 			case VK_OBJECT_TYPE_FRAMEBUFFER:           destroy<VkFramebuffer        >(resource.m_handle); break;
 			case VK_OBJECT_TYPE_PIPELINE_LAYOUT:       destroy<VkPipelineLayout     >(resource.m_handle); break;
 			case VK_OBJECT_TYPE_PIPELINE:              destroy<VkPipeline           >(resource.m_handle); break;
-			case VK_OBJECT_TYPE_DESCRIPTOR_SET:        destroy<VkDescriptorSet      >(resource.m_handle); break;
 			case VK_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT: destroy<VkDescriptorSetLayout>(resource.m_handle); break;
 			case VK_OBJECT_TYPE_RENDER_PASS:           destroy<VkRenderPass         >(resource.m_handle); break;
 			case VK_OBJECT_TYPE_SAMPLER:               destroy<VkSampler            >(resource.m_handle); break;
@@ -8167,6 +10127,8 @@ VK_DESTROY
 		}
 
 		m_release[m_consumeIndex].clear();
+
+		s_renderVK->m_memoryAllocator.consume(m_consumeIndex);
 	}
 
 	void RendererContextVK::submitBlit(BlitState& _bs, uint16_t _view)
@@ -8283,9 +10245,11 @@ VK_DESTROY
 			TextureVK& src = m_textures[blit.m_src.idx];
 			TextureVK& dst = m_textures[blit.m_dst.idx];
 
-			src.setImageMemoryBarrier(m_commandBuffer, srcLayouts[item], VK_NULL_HANDLE != src.m_singleMsaaImage);
-			dst.setImageMemoryBarrier(m_commandBuffer, dstLayouts[item]);
+			src.setImageMemoryBarrier(m_imageBarriers, srcLayouts[item], VK_NULL_HANDLE != src.m_singleMsaaImage);
+			dst.setImageMemoryBarrier(m_imageBarriers, dstLayouts[item]);
 		}
+
+		m_imageBarriers.flush(m_commandBuffer);
 	}
 
 	void RendererContextVK::submit(Frame* _render, ClearQuad& _clearQuad, TextVideoMemBlitter& _textVideoMemBlitter)
@@ -8347,21 +10311,30 @@ VK_DESTROY
 		VkDescriptorSet currentDescriptorSet = VK_NULL_HANDLE;
 		uint32_t currentBindHash = 0;
 		uint32_t descriptorSetCount = 0;
-		VkIndexType currentIndexFormat = VK_INDEX_TYPE_MAX_ENUM;
+		uint32_t currentNumOffsets = 0;
+		uint32_t currentOffsets[2] = { 0, 0 };
 		SortKey key;
 		uint16_t view = UINT16_MAX;
 		FrameBufferHandle fbh = { BGFX_CONFIG_MAX_FRAME_BUFFERS };
 
 		BlitState bs(_render);
 
-		uint64_t blendFactor = UINT64_MAX;
-
 		bool wasCompute     = false;
 		bool viewHasScissor = false;
-		bool restoreScissor = false;
 		Rect viewScissorRect;
 		viewScissorRect.clear();
 
+		VkViewport viewport;
+		bx::memSet(&viewport, 0, sizeof(viewport) );
+
+		DrawCommandStateVK drawState;
+		drawState.reset();
+
+		// When set, draw calls of current view are collected and recorded into
+		// secondary command buffers by m_commandRecorder at the end of view.
+		bool recordDeferred = false;
+		m_drawCommands.clear();
+
 		bool isFrameBufferValid = false;
 
 		uint32_t statsNumPrimsSubmitted[BX_COUNTOF(s_primInfo)] = {};
@@ -8378,6 +10351,25 @@ VK_DESTROY
 		ScratchBufferVK& scratchBuffer = m_scratchBuffer[m_cmd.m_currentFrameInFlight];
 		scratchBuffer.reset();
 
+		flushTextureCopies();
+
+		resetDescriptorSets();
+		collectPipelines();
+
+		++m_pipelineCacheStats.m_frame;
+
+		// Pipeline cache is saved only when no pipelines are being compiled, so
+		// vkGetPipelineCacheData sees consistent cache size between calls.
+		if (BX_ENABLED(BGFX_CONFIG_PIPELINE_CACHE_BLOB)
+		&&  0 != BGFX_CONFIG_PIPELINE_CACHE_SAVE_INTERVAL
+		&&  m_pipelineCacheStats.m_dirty
+		&&  m_pipelineJobs.empty()
+		&&  m_pipelineCacheStats.m_frame - m_pipelineCacheStats.m_lastSaveFrame >= BGFX_CONFIG_PIPELINE_CACHE_SAVE_INTERVAL)
+		{
+			m_pipelineCacheStats.m_lastSaveFrame = m_pipelineCacheStats.m_frame;
+			savePipelineCache();
+		}
+
 		setMemoryBarrier(
 			  m_commandBuffer
 			, VK_PIPELINE_STAGE_TRANSFER_BIT
@@ -8426,6 +10418,12 @@ VK_DESTROY
 				{
 					if (beginRenderPass)
 					{
+						if (recordDeferred)
+						{
+							m_commandRecorder.execute(m_commandBuffer, rpbi, viewport, m_drawCommands.data(), uint32_t(m_drawCommands.size() ) );
+							m_drawCommands.clear();
+						}
+
 						vkCmdEndRenderPass(m_commandBuffer);
 						beginRenderPass = false;
 					}
@@ -8434,6 +10432,39 @@ VK_DESTROY
 					currentProgram = BGFX_INVALID_HANDLE;
 					hasPredefined  = false;
 
+					recordDeferred = false;
+
+					if (0 < m_commandRecorder.getNumThreads() )
+					{
+						// Views with occlusion queries are recorded inline, queries can't
+						// be begun inside secondary command buffer without inheriting them.
+						const ViewId viewId = SortKey::decodeView(encodedKey);
+						uint32_t numDraws = 0;
+						bool hasQuery = false;
+
+						for (int32_t jj = item-1; jj < numItems; ++jj)
+						{
+							const uint64_t jjKey = _render->m_sortKeys[jj];
+
+							if (SortKey::decodeView(jjKey) != viewId)
+							{
+								break;
+							}
+
+							if (0 != (jjKey & kSortKeyDrawBit) )
+							{
+								const RenderDraw& jjDraw = _render->m_renderItem[_render->m_sortValues[jj] ].draw;
+								hasQuery |= 0 != (jjDraw.m_stateFlags & BGFX_STATE_INTERNAL_OCCLUSION_QUERY);
+								++numDraws;
+							}
+						}
+
+						recordDeferred = true
+							&& !hasQuery
+							&& BGFX_CONFIG_COMMAND_RECORD_MIN_DRAWS <= numDraws
+							;
+					}
+
 					if (item > 1)
 					{
 						profiler.end();
@@ -8465,7 +10496,6 @@ VK_DESTROY
 						const Rect& scissorRect = _render->m_view[view].m_scissor;
 						viewHasScissor  = !scissorRect.isZero();
 						viewScissorRect = viewHasScissor ? scissorRect : rect;
-						restoreScissor = false;
 
 						rpbi.framebuffer = fb.m_currentFramebuffer;
 						rpbi.renderPass  = fb.m_renderPass;
@@ -8474,14 +10504,13 @@ VK_DESTROY
 						rpbi.renderArea.extent.width  = rect.m_width;
 						rpbi.renderArea.extent.height = rect.m_height;
 
-						VkViewport vp;
-						vp.x        =  float(rect.m_x);
-						vp.y        =  float(rect.m_y + rect.m_height);
-						vp.width    =  float(rect.m_width);
-						vp.height   = -float(rect.m_height);
-						vp.minDepth = 0.0f;
-						vp.maxDepth = 1.0f;
-						vkCmdSetViewport(m_commandBuffer, 0, 1, &vp);
+						viewport.x        =  float(rect.m_x);
+						viewport.y        =  float(rect.m_y + rect.m_height);
+						viewport.width    =  float(rect.m_width);
+						viewport.height   = -float(rect.m_height);
+						viewport.minDepth = 0.0f;
+						viewport.maxDepth = 1.0f;
+						vkCmdSetViewport(m_commandBuffer, 0, 1, &viewport);
 
 						VkRect2D rc;
 						rc.offset.x      = viewScissorRect.m_x;
@@ -8675,25 +10704,24 @@ VK_DESTROY
 					setViewType(view, " ");
 					BGFX_VK_PROFILER_BEGIN(view, kColorDraw);
 
-					vkCmdBeginRenderPass(m_commandBuffer, &rpbi, VK_SUBPASS_CONTENTS_INLINE);
+					vkCmdBeginRenderPass(
+						  m_commandBuffer
+						, &rpbi
+						, recordDeferred
+							? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+							: VK_SUBPASS_CONTENTS_INLINE
+						);
 					beginRenderPass = true;
 
 					currentProgram = BGFX_INVALID_HANDLE;
-					currentState.m_scissor = !draw.m_scissor;
+					drawState.reset();
 				}
 
 				if (0 != draw.m_streamMask)
 				{
-					const bool bindAttribs = hasVertexStreamChanged(currentState, draw);
-
-					currentState.m_streamMask         = draw.m_streamMask;
-					currentState.m_instanceDataBuffer = draw.m_instanceDataBuffer;
-					currentState.m_instanceDataOffset = draw.m_instanceDataOffset;
-					currentState.m_instanceDataStride = draw.m_instanceDataStride;
+					DrawCommandVK cmd;
 
 					const VertexLayout* layouts[BGFX_CONFIG_MAX_VERTEX_STREAMS];
-					VkBuffer streamBuffers[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
-					VkDeviceSize streamOffsets[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
 					uint8_t numStreams = 0;
 					uint32_t numVertices = draw.m_numVertices;
 					if (UINT8_MAX != draw.m_streamMask)
@@ -8707,8 +10735,6 @@ VK_DESTROY
 							streamMask >>= ntz;
 							idx         += ntz;
 
-							currentState.m_stream[idx] = draw.m_stream[idx];
-
 							const VertexBufferHandle handle = draw.m_stream[idx].m_handle;
 							const VertexBufferVK& vb = m_vertexBuffers[handle.idx];
 							const uint16_t decl = isValid(draw.m_stream[idx].m_layoutHandle)
@@ -8718,9 +10744,9 @@ VK_DESTROY
 							const VertexLayout& layout = m_vertexLayouts[decl];
 							const uint32_t stride = layout.m_stride;
 
-							streamBuffers[numStreams] = m_vertexBuffers[handle.idx].m_buffer;
-							streamOffsets[numStreams] = draw.m_stream[idx].m_startVertex * stride;
-							layouts[numStreams]       = &layout;
+							cmd.m_vertexBuffer[numStreams] = m_vertexBuffers[handle.idx].m_buffer;
+							cmd.m_vertexOffset[numStreams] = draw.m_stream[idx].m_startVertex * stride;
+							layouts[numStreams]            = &layout;
 
 							numVertices = bx::uint32_min(UINT32_MAX == draw.m_numVertices
 								? vb.m_size/stride
@@ -8730,27 +10756,13 @@ VK_DESTROY
 						}
 					}
 
-					if (bindAttribs)
-					{
-						uint32_t numVertexBuffers = numStreams;
-
-						if (isValid(draw.m_instanceDataBuffer) )
-						{
-							streamOffsets[numVertexBuffers] = draw.m_instanceDataOffset;
-							streamBuffers[numVertexBuffers] = m_vertexBuffers[draw.m_instanceDataBuffer.idx].m_buffer;
-							numVertexBuffers++;
-						}
+					cmd.m_numVertexBuffers = numStreams;
 
-						if (0 < numVertexBuffers)
-						{
-							vkCmdBindVertexBuffers(
-								  m_commandBuffer
-								, 0
-								, numVertexBuffers
-								, &streamBuffers[0]
-								, streamOffsets
-								);
-						}
+					if (isValid(draw.m_instanceDataBuffer) )
+					{
+						cmd.m_vertexOffset[cmd.m_numVertexBuffers] = draw.m_instanceDataOffset;
+						cmd.m_vertexBuffer[cmd.m_numVertexBuffers] = m_vertexBuffers[draw.m_instanceDataBuffer.idx].m_buffer;
+						cmd.m_numVertexBuffers++;
 					}
 
 					const VkPipeline pipeline =
@@ -8760,24 +10772,25 @@ VK_DESTROY
 							, layouts
 							, key.m_program
 							, uint8_t(draw.m_instanceDataStride/16)
+							, 0 != BGFX_CONFIG_PIPELINE_SKIP_DRAW_UNTIL_READY
 							);
 
-					if (currentPipeline != pipeline)
+					if (VK_NULL_HANDLE == pipeline)
 					{
-						currentPipeline = pipeline;
-						vkCmdBindPipeline(m_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+						// Skipped draw already updated uniforms, force next draw to commit
+						// them, and compare its state against last recorded draw.
+						currentProgram = BGFX_INVALID_HANDLE;
+						currentState.m_stateFlags ^= changedFlags;
+						continue;
 					}
 
-					const bool hasStencil = 0 != draw.m_stencil;
+					cmd.m_pipeline = pipeline;
 
-					if (hasStencil
-					&&  currentState.m_stencil != draw.m_stencil)
+					cmd.m_stencilRef = UINT32_MAX;
+					if (0 != draw.m_stencil)
 					{
-						currentState.m_stencil = draw.m_stencil;
-
 						const uint32_t fstencil = unpackStencil(0, draw.m_stencil);
-						const uint32_t ref = (fstencil&BGFX_STENCIL_FUNC_REF_MASK)>>BGFX_STENCIL_FUNC_REF_SHIFT;
-						vkCmdSetStencilReference(m_commandBuffer, VK_STENCIL_FRONT_AND_BACK, ref);
+						cmd.m_stencilRef = (fstencil&BGFX_STENCIL_FUNC_REF_MASK)>>BGFX_STENCIL_FUNC_REF_SHIFT;
 					}
 
 					const bool hasFactor = 0
@@ -8787,54 +10800,19 @@ VK_DESTROY
 						|| f3 == (draw.m_stateFlags & f3)
 						;
 
-					if (hasFactor
-					&&  blendFactor != draw.m_rgba)
-					{
-						blendFactor = draw.m_rgba;
-
-						float bf[4];
-						bf[0] = ( (draw.m_rgba>>24)     )/255.0f;
-						bf[1] = ( (draw.m_rgba>>16)&0xff)/255.0f;
-						bf[2] = ( (draw.m_rgba>> 8)&0xff)/255.0f;
-						bf[3] = ( (draw.m_rgba    )&0xff)/255.0f;
-						vkCmdSetBlendConstants(m_commandBuffer, bf);
-					}
+					cmd.m_rgba = hasFactor ? draw.m_rgba : UINT64_MAX;
 
-					const uint16_t scissor = draw.m_scissor;
-
-					if (currentState.m_scissor != scissor)
+					Rect scissorRect = viewScissorRect;
+					if (UINT16_MAX != draw.m_scissor)
 					{
-						currentState.m_scissor = scissor;
-
-						if (UINT16_MAX == scissor)
-						{
-							if (restoreScissor
-							||  viewHasScissor)
-							{
-								restoreScissor = false;
-								VkRect2D rc;
-								rc.offset.x      = viewScissorRect.m_x;
-								rc.offset.y      = viewScissorRect.m_y;
-								rc.extent.width  = viewScissorRect.m_width;
-								rc.extent.height = viewScissorRect.m_height;
-								vkCmdSetScissor(m_commandBuffer, 0, 1, &rc);
-							}
-						}
-						else
-						{
-							restoreScissor = true;
-							Rect scissorRect;
-							scissorRect.setIntersect(viewScissorRect, _render->m_frameCache.m_rectCache.m_cache[scissor]);
-
-							VkRect2D rc;
-							rc.offset.x      = scissorRect.m_x;
-							rc.offset.y      = scissorRect.m_y;
-							rc.extent.width  = scissorRect.m_width;
-							rc.extent.height = scissorRect.m_height;
-							vkCmdSetScissor(m_commandBuffer, 0, 1, &rc);
-						}
+						scissorRect.setIntersect(viewScissorRect, _render->m_frameCache.m_rectCache.m_cache[draw.m_scissor]);
 					}
 
+					cmd.m_scissor.offset.x      = scissorRect.m_x;
+					cmd.m_scissor.offset.y      = scissorRect.m_y;
+					cmd.m_scissor.extent.width  = scissorRect.m_width;
+					cmd.m_scissor.extent.height = scissorRect.m_height;
+
 					bool constantsChanged = false;
 					if (draw.m_uniformBegin < draw.m_uniformEnd
 					||  currentProgram.idx != key.m_program.idx
@@ -8875,20 +10853,22 @@ VK_DESTROY
 					{
 						const uint32_t vsize = program.m_vsh->m_size;
 						const uint32_t fsize = NULL != program.m_fsh ? program.m_fsh->m_size : 0;
-						uint32_t numOffset = 0;
-						uint32_t offsets[2] = { 0, 0 };
 
+						// Offsets of constants written for this program last are kept, so
+						// draw can be recorded without depending on draws before it.
 						if (constantsChanged
 						||  hasPredefined)
 						{
+							currentNumOffsets = 0;
+
 							if (vsize > 0)
 							{
-								offsets[numOffset++] = scratchBuffer.write(m_vsScratch, vsize);
+								currentOffsets[currentNumOffsets++] = scratchBuffer.write(m_vsScratch, vsize);
 							}
 
 							if (fsize > 0)
 							{
-								offsets[numOffset++] = scratchBuffer.write(m_fsScratch, fsize);
+								currentOffsets[currentNumOffsets++] = scratchBuffer.write(m_fsScratch, fsize);
 							}
 						}
 
@@ -8914,35 +10894,31 @@ VK_DESTROY
 							descriptorSetCount++;
 						}
 
-						vkCmdBindDescriptorSets(
-							  m_commandBuffer
-							, VK_PIPELINE_BIND_POINT_GRAPHICS
-							, program.m_pipelineLayout
-							, 0
-							, 1
-							, &currentDescriptorSet
-							, numOffset
-							, offsets
-							);
+						cmd.m_pipelineLayout = program.m_pipelineLayout;
+						cmd.m_descriptorSet  = currentDescriptorSet;
+						cmd.m_numOffsets     = uint8_t(currentNumOffsets);
+						cmd.m_offsets[0]     = currentOffsets[0];
+						cmd.m_offsets[1]     = currentOffsets[1];
+					}
+					else
+					{
+						cmd.m_pipelineLayout = VK_NULL_HANDLE;
+						cmd.m_descriptorSet  = VK_NULL_HANDLE;
+						cmd.m_numOffsets     = 0;
 					}
 
-					VkBuffer bufferIndirect = VK_NULL_HANDLE;
-					uint32_t numDrawIndirect = 0;
-					uint32_t bufferOffsetIndirect = 0;
+					cmd.m_indirectBuffer = VK_NULL_HANDLE;
+					cmd.m_indirectOffset = 0;
+					cmd.m_numIndirect    = 0;
 					if (isValid(draw.m_indirectBuffer) )
 					{
 						const VertexBufferVK& vb = m_vertexBuffers[draw.m_indirectBuffer.idx];
-						bufferIndirect = vb.m_buffer;
-						numDrawIndirect = UINT16_MAX == draw.m_numIndirect
+						cmd.m_indirectBuffer = vb.m_buffer;
+						cmd.m_numIndirect = UINT16_MAX == draw.m_numIndirect
 							? vb.m_size / BGFX_CONFIG_DRAW_INDIRECT_STRIDE
 							: draw.m_numIndirect
 							;
-						bufferOffsetIndirect = draw.m_startIndirect * BGFX_CONFIG_DRAW_INDIRECT_STRIDE;
-					}
-
-					if (hasOcclusionQuery)
-					{
-						m_occlusionQuery.begin(draw.m_occlusionQuery);
+						cmd.m_indirectOffset = draw.m_startIndirect * BGFX_CONFIG_DRAW_INDIRECT_STRIDE;
 					}
 
 					const uint8_t primIndex = uint8_t((draw.m_stateFlags & BGFX_STATE_PT_MASK) >> BGFX_STATE_PT_SHIFT);
@@ -8951,30 +10927,16 @@ VK_DESTROY
 					uint32_t numPrimsSubmitted = 0;
 					uint32_t numIndices = 0;
 
+					cmd.m_numInstances = draw.m_numInstances;
+
 					if (!isValid(draw.m_indexBuffer) )
 					{
 						numPrimsSubmitted = numVertices / prim.m_div - prim.m_sub;
 
-						if (isValid(draw.m_indirectBuffer) )
-						{
-							vkCmdDrawIndirect(
-								  m_commandBuffer
-								, bufferIndirect
-								, bufferOffsetIndirect
-								, numDrawIndirect
-								, BGFX_CONFIG_DRAW_INDIRECT_STRIDE
-								);
-						}
-						else
-						{
-							vkCmdDraw(
-								  m_commandBuffer
-								, numVertices
-								, draw.m_numInstances
-								, 0
-								, 0
-								);
-						}
+						cmd.m_indexBuffer = VK_NULL_HANDLE;
+						cmd.m_indexType   = VK_INDEX_TYPE_MAX_ENUM;
+						cmd.m_num         = numVertices;
+						cmd.m_startIndex  = 0;
 					}
 					else
 					{
@@ -8990,40 +10952,28 @@ VK_DESTROY
 
 						numPrimsSubmitted = numIndices / prim.m_div - prim.m_sub;
 
-						if (currentState.m_indexBuffer.idx != draw.m_indexBuffer.idx
-						||  currentIndexFormat != indexFormat)
-						{
-							currentState.m_indexBuffer = draw.m_indexBuffer;
-							currentIndexFormat = indexFormat;
-
-							vkCmdBindIndexBuffer(
-								  m_commandBuffer
-								, m_indexBuffers[draw.m_indexBuffer.idx].m_buffer
-								, 0
-								, indexFormat
-								);
-						}
+						cmd.m_indexBuffer = ib.m_buffer;
+						cmd.m_indexType   = indexFormat;
+						cmd.m_num         = numIndices;
+						cmd.m_startIndex  = draw.m_startIndex;
+					}
 
-						if (isValid(draw.m_indirectBuffer) )
+					if (recordDeferred)
+					{
+						m_drawCommands.push_back(cmd);
+					}
+					else
+					{
+						if (hasOcclusionQuery)
 						{
-							vkCmdDrawIndexedIndirect(
-								  m_commandBuffer
-								, bufferIndirect
-								, bufferOffsetIndirect
-								, numDrawIndirect
-								, BGFX_CONFIG_DRAW_INDIRECT_STRIDE
-								);
+							m_occlusionQuery.begin(draw.m_occlusionQuery);
 						}
-						else
+
+						recordDrawCommand(m_commandBuffer, drawState, cmd);
+
+						if (hasOcclusionQuery)
 						{
-							vkCmdDrawIndexed(
-								  m_commandBuffer
-								, numIndices
-								, draw.m_numInstances
-								, draw.m_startIndex
-								, 0
-								, 0
-								);
+							m_occlusionQuery.end();
 						}
 					}
 
@@ -9033,16 +10983,17 @@ VK_DESTROY
 					statsNumPrimsRendered[primIndex]  += numPrimsRendered;
 					statsNumInstances[primIndex]      += draw.m_numInstances;
 					statsNumIndices                   += numIndices;
-
-					if (hasOcclusionQuery)
-					{
-						m_occlusionQuery.end();
-					}
 				}
 			}
 
 			if (beginRenderPass)
 			{
+				if (recordDeferred)
+				{
+					m_commandRecorder.execute(m_commandBuffer, rpbi, viewport, m_drawCommands.data(), uint32_t(m_drawCommands.size() ) );
+					m_drawCommands.clear();
+				}
+
 				vkCmdEndRenderPass(m_commandBuffer);
 				beginRenderPass = false;
 			}
@@ -9068,6 +11019,8 @@ VK_DESTROY
 
 		BGFX_VK_PROFILER_END();
 
+		m_commandRecorder.frame();
+
 		int64_t timeEnd = bx::getHPCounter();
 		int64_t frameTime = timeEnd - timeBegin;
 
@@ -9129,6 +11082,16 @@ VK_DESTROY
 			}
 		}
 
+		DeviceMemoryAllocatorVK::Stats memoryStats;
+		m_memoryAllocator.getStats(memoryStats);
+
+		if (0 > gpuMemoryUsed)
+		{
+			// Without memory budget extension report memory allocated for
+			// buffers and textures.
+			gpuMemoryUsed = int64_t(memoryStats.m_allocated);
+		}
+
 		Stats& perfStats = _render->m_perfStats;
 		perfStats.cpuTimeBegin  = timeBegin;
 		perfStats.cpuTimeEnd    = timeEnd;
@@ -9200,6 +11163,34 @@ VK_DESTROY
 					}
 				}
 
+				{
+					char allocated[16];
+					bx::prettify(allocated, BX_COUNTOF(allocated), memoryStats.m_allocated);
+
+					char used[16];
+					bx::prettify(used, BX_COUNTOF(used), memoryStats.m_used);
+
+					char requested[16];
+					bx::prettify(requested, BX_COUNTOF(requested), memoryStats.m_requested);
+
+					tvm.printf(0, pos++, 0x8f, " Allocator - Allocated: %12s, Used: %12s, Requested: %12s"
+						, allocated
+						, used
+						, requested
+						);
+
+					char largestFree[16];
+					bx::prettify(largestFree, BX_COUNTOF(largestFree), memoryStats.m_largestFree);
+
+					tvm.printf(0, pos++, 0x8f, "             %5d allocations, %3d blocks, %4d dedicated, largest free: %12s, fragmentation: %5.1f%%"
+						, memoryStats.m_numAllocations
+						, memoryStats.m_numBlocks
+						, memoryStats.m_numDedicated
+						, largestFree
+						, 0 == memoryStats.m_free ? 0.0f : 100.0f - float(memoryStats.m_largestFree)*100.0f/float(memoryStats.m_free)
+						);
+				}
+
 				pos = 10;
 				tvm.printf(10, pos++, 0x8b, "       Frame: % 7.3f, % 7.3f \x1f, % 7.3f \x1e [ms] / % 6.2f FPS "
 					, double(frameTime)*toMs
@@ -9248,20 +11239,77 @@ VK_DESTROY
 //				tvm.printf(10, pos++, 0x8b, " Uniform size: %7d, Max: %7d ", _render->m_uniformEnd, _render->m_uniformMax);
 				tvm.printf(10, pos++, 0x8b, "     DVB size: %7d ", _render->m_vboffset);
 				tvm.printf(10, pos++, 0x8b, "     DIB size: %7d ", _render->m_iboffset);
+				tvm.printf(10, pos++, 0x8b, "     Staging: %6d / %6d KiB, dedicated: %4d "
+					, m_stagingRing.m_pos[m_cmd.m_currentFrameInFlight]/1024
+					, m_stagingRing.m_segmentSize/1024
+					, m_stagingRing.m_numDedicated
+					);
+				tvm.printf(10, pos++, 0x8b, "    Barriers: %5d (image %5d) "
+					, s_barrierStats.m_numPipelineBarriers
+					, s_barrierStats.m_numImageBarriers
+					);
 
 				pos++;
 				tvm.printf(10, pos++, 0x8b, " Occlusion queries: %3d ", m_occlusionQuery.m_control.available() );
 
 				pos++;
-				tvm.printf(10, pos++, 0x8b, " State cache:             ");
-				tvm.printf(10, pos++, 0x8b, " PSO    | DSL    |  DS    ");
-				tvm.printf(10, pos++, 0x8b, " %6d | %6d | %6d "
+				const uint32_t dsLookups = m_descriptorSetCacheHits + m_descriptorSetCacheMisses;
+
+				tvm.printf(10, pos++, 0x8b, " State cache:                               ");
+				tvm.printf(10, pos++, 0x8b, " PSO    | DSL    |  DS    | DS cache | DS hit ");
+				tvm.printf(10, pos++, 0x8b, " %6d | %6d | %6d | %8d | %5.1f%% "
 					, m_pipelineStateCache.getCount()
 					, m_descriptorSetLayoutCache.getCount()
 					, descriptorSetCount
+					, m_descriptorSetCache[m_cmd.m_currentFrameInFlight].getCount()
+					, 0 == dsLookups ? 0.0f : float(m_descriptorSetCacheHits)*100.0f/float(dsLookups)
 					);
 				pos++;
 
+				tvm.printf(10, pos++, 0x8b, " PSO compile: %5d (pending %3d, prewarmed %5d), avg %7.4f, max %7.4f [ms] "
+					, m_pipelineStats.m_numCompiled
+					, uint32_t(m_pipelineJobs.size() )
+					, m_pipelineStats.m_numPrewarmed
+					, 0 == m_pipelineStats.m_numCompiled ? 0.0 : double(m_pipelineStats.m_compileTime)*toMs/double(m_pipelineStats.m_numCompiled)
+					, double(m_pipelineStats.m_compileTimeMax)*toMs
+					);
+				tvm.printf(10, pos++, 0x8b, "   PSO stall: %5d, %7.4f [ms], skipped draws: %7d "
+					, m_pipelineStats.m_numStalls
+					, double(m_pipelineStats.m_stallTime)*toMs
+					, m_pipelineStats.m_numSkipped
+					);
+				tvm.printf(10, pos++, 0x8b, "   PSO cache: load %6d KiB %7.4f [ms], save %6d KiB %7.4f [ms] (#%d), I/O %7.4f [ms] "
+					, m_pipelineCacheStats.m_loadSize/1024
+					, double(m_pipelineCacheStats.m_loadTime)*toMs
+					, m_pipelineCacheStats.m_saveSize/1024
+					, double(m_pipelineCacheStats.m_saveTime)*toMs
+					, m_pipelineCacheStats.m_numSaves
+					, double(m_pipelineCacheStats.m_ioTime)*toMs
+					);
+				pos++;
+
+				if (0 < m_commandRecorder.getNumThreads() )
+				{
+					const CommandRecorderVK::Stats& recorderStats = m_commandRecorder.getStats();
+
+					tvm.printf(10, pos++, 0x8b, " Cmd record: %3d views, %4d secondary cmd buffers "
+						, recorderStats.m_numViews
+						, recorderStats.m_numCommandBuffers
+						);
+
+					for (uint32_t ii = 0, num = m_commandRecorder.getNumThreads()+1; ii < num; ++ii)
+					{
+						tvm.printf(10, pos++, 0x8b, "   %s %d: %6d draws, %7.4f [ms] "
+							, 0 == ii ? "Render" : "Worker"
+							, ii
+							, recorderStats.m_numDraws[ii]
+							, double(recorderStats.m_time[ii])*toMs
+							);
+					}
+
+					pos++;
+				}
+
 				double captureMs = double(captureElapsed)*toMs;
 				tvm.printf(10, pos++, 0x8b, "     Capture: %7.4f [ms] ", captureMs);
 
@@ -9291,6 +11339,8 @@ VK_DESTROY
 		}
 
 		m_presentElapsed = 0;
+		m_stagingRing.m_numDedicated = 0;
+		bx::memSet(&s_barrierStats, 0, sizeof(s_barrierStats) );
 
 		scratchBuffer.flush();
 
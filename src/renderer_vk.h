@@ -156,6 +156,7 @@
 			VK_IMPORT_DEVICE_FUNC(false, vkCmdPipelineBarrier);            \
 			VK_IMPORT_DEVICE_FUNC(false, vkCmdBeginRenderPass);            \
 			VK_IMPORT_DEVICE_FUNC(false, vkCmdEndRenderPass);              \
+			VK_IMPORT_DEVICE_FUNC(false, vkCmdExecuteCommands);            \
 			VK_IMPORT_DEVICE_FUNC(false, vkCmdSetViewport);                \
 			VK_IMPORT_DEVICE_FUNC(false, vkCmdDraw);                       \
 			VK_IMPORT_DEVICE_FUNC(false, vkCmdDrawIndexed);                \
@@ -327,7 +328,6 @@ namespace bgfx { namespace vk
 VK_DESTROY
 VK_DESTROY_FUNC(DeviceMemory);
 VK_DESTROY_FUNC(SurfaceKHR);
-VK_DESTROY_FUNC(DescriptorSet);
 #undef VK_DESTROY_FUNC
 
 	template<typename Ty>
@@ -386,6 +386,59 @@ VK_DESTROY_FUNC(DescriptorSet);
 		HashMap m_hashMap;
 	};
 
+	/// Descriptor sets of one frame in flight, found by hash of their descriptors. Full
+	/// descriptors are compared on hit. Entries referencing released objects are evicted
+	/// before the next lookup, and their sets are reclaimed when descriptor pool is reset.
+	class DescriptorSetCacheVK
+	{
+	public:
+		// Key is descriptor set layout, binding and type of each write, and sampler, image
+		// view, and layout of image, or buffer, offset, and range of buffer descriptor.
+		static constexpr uint32_t kMaxDescriptors = 2*BGFX_CONFIG_MAX_TEXTURE_SAMPLERS + 2;
+		static constexpr uint32_t kMaxKeySize     = 1 + 4*kMaxDescriptors;
+
+		struct Key
+		{
+			Key()
+				: m_num(0)
+			{
+			}
+
+			void add(uint64_t _value)
+			{
+				BX_ASSERT(m_num < kMaxKeySize, "Descriptor set key is too large.");
+				m_data[m_num++] = _value;
+			}
+
+			uint64_t m_data[kMaxKeySize];
+			uint32_t m_num;
+		};
+
+		::VkDescriptorSet find(const Key& _key);
+		void add(const Key& _key, ::VkDescriptorSet _descriptorSet);
+		void release(uint64_t _object);
+		void invalidate();
+
+		uint32_t getCount() const
+		{
+			return uint32_t(m_hashMap.size() );
+		}
+
+	private:
+		static uint64_t hash(const Key& _key);
+		void evict();
+
+		struct Entry
+		{
+			stl::vector<uint64_t> m_key;
+			::VkDescriptorSet     m_descriptorSet;
+		};
+
+		typedef stl::unordered_map<uint64_t, Entry> HashMap;
+		HashMap m_hashMap;
+		stl::unordered_set<uint64_t> m_released;
+	};
+
 	class ScratchBufferVK
 	{
 	public:
@@ -410,11 +463,415 @@ VK_DESTROY_FUNC(DescriptorSet);
 		uint32_t m_pos;
 	};
 
+	struct BarrierStatsVK
+	{
+		uint32_t m_numPipelineBarriers;
+		uint32_t m_numImageBarriers;
+	};
+
+	/// Collects whole image layout transitions and records them with single
+	/// vkCmdPipelineBarrier. Consecutive transitions of same image are merged.
+	class ImageBarrierBatchVK
+	{
+	public:
+		ImageBarrierBatchVK();
+
+		void add(VkImage _image, VkImageAspectFlags _aspectMask, VkImageLayout _oldLayout, VkImageLayout _newLayout);
+		void flush(VkCommandBuffer _commandBuffer);
+
+	private:
+		stl::vector<VkImageMemoryBarrier> m_barriers;
+		VkPipelineStageFlags m_srcStageMask;
+		VkPipelineStageFlags m_dstStageMask;
+	};
+
+	/// Host visible memory upload is staged in. Memory is either sub-allocated
+	/// from staging ring, or dedicated when m_deviceMem is set.
+	struct StagingBufferVK
+	{
+		StagingBufferVK()
+			: m_buffer(VK_NULL_HANDLE)
+			, m_deviceMem(VK_NULL_HANDLE)
+			, m_offset(0)
+			, m_data(NULL)
+		{
+		}
+
+		VkBuffer m_buffer;
+		VkDeviceMemory m_deviceMem;
+		VkDeviceSize m_offset;
+		uint8_t* m_data;
+	};
+
+	/// Persistently mapped staging buffer split into one segment per frame in
+	/// flight. Segment is reused once frame that wrote into it is done.
+	class StagingRingVK
+	{
+	public:
+		StagingRingVK();
+
+		VkResult create(uint32_t _size, uint32_t _numFramesInFlight);
+		void destroy();
+
+		/// Resets segment of frame in flight, called once its fence is signaled.
+		void reset(uint32_t _frameInFlight);
+
+		/// Returns false when there is not enough space left in segment.
+		bool alloc(uint32_t _frameInFlight, uint32_t _size, uint32_t _align, StagingBufferVK* _staging);
+
+		VkBuffer m_buffer;
+		VkDeviceMemory m_deviceMem;
+		uint8_t* m_data;
+		uint32_t m_segmentSize;
+		uint32_t m_pos[BGFX_CONFIG_MAX_FRAME_LATENCY];
+		uint32_t m_numDedicated;
+	};
+
+	struct PipelineCompileJobVK
+	{
+		struct State
+		{
+			enum Enum
+			{
+				Queued,
+				Compiling,
+				Done,
+			};
+		};
+
+		VkPipelineColorBlendAttachmentState m_blendAttachmentState[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS];
+		VkPipelineColorBlendStateCreateInfo m_colorBlendState;
+		VkPipelineInputAssemblyStateCreateInfo m_inputAssemblyState;
+		VkPipelineRasterizationStateCreateInfo m_rasterizationState;
+		VkPipelineRasterizationConservativeStateCreateInfoEXT m_conservativeRasterizationState;
+		VkPipelineRasterizationLineStateCreateInfoEXT m_lineRasterizationState;
+		VkPipelineDepthStencilStateCreateInfo m_depthStencilState;
+		VkVertexInputBindingDescription m_inputBinding[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
+		VkVertexInputAttributeDescription m_inputAttrib[Attrib::Count + BGFX_CONFIG_MAX_INSTANCE_DATA_COUNT];
+		VkPipelineVertexInputStateCreateInfo m_vertexInputState;
+		VkPipelineDynamicStateCreateInfo m_dynamicState;
+		VkPipelineShaderStageCreateInfo m_shaderStages[2];
+		VkPipelineViewportStateCreateInfo m_viewportState;
+		VkPipelineMultisampleStateCreateInfo m_multisampleState;
+		VkGraphicsPipelineCreateInfo m_createInfo;
+
+		VkPipelineCache m_cache;
+		VkPipeline m_pipeline;
+		VkResult m_result;
+		void* m_cacheData;
+		uint32_t m_cacheDataSize;
+		uint32_t m_hash;
+		int64_t m_time;
+		PipelineCompileJobVK* m_next;
+		State::Enum m_state;
+		bool m_waiting;
+	};
+
+	struct PipelineStatsVK
+	{
+		uint32_t m_numCompiled;
+		uint32_t m_numPrewarmed;
+		uint32_t m_numStalls;
+		uint32_t m_numSkipped;
+		int64_t m_compileTime;
+		int64_t m_compileTimeMax;
+		int64_t m_stallTime;
+	};
+
+	struct PipelineCacheStatsVK
+	{
+		uint32_t m_loadSize;
+		uint32_t m_saveSize;
+		uint32_t m_numSaves;
+		uint32_t m_frame;
+		uint32_t m_lastSaveFrame;
+		int64_t m_loadTime;
+		int64_t m_saveTime;
+		int64_t m_ioTime;
+		bool m_dirty;
+	};
+
+	class PipelineCompilerVK
+	{
+	public:
+		PipelineCompilerVK();
+
+		void init(VkDevice _device, const VkAllocationCallbacks* _allocatorCb, uint32_t _numThreads);
+		void shutdown();
+
+		void queue(PipelineCompileJobVK* _job);
+		void wait(PipelineCompileJobVK* _job);
+		PipelineCompileJobVK* popDone();
+		void compile(PipelineCompileJobVK* _job);
+
+		uint32_t getNumThreads() const
+		{
+			return m_numThreads;
+		}
+
+	private:
+		int32_t worker();
+
+		static int32_t threadFunc(bx::Thread* _thread, void* _userData);
+
+		VkDevice m_device;
+		const VkAllocationCallbacks* m_allocatorCb;
+
+		bx::Thread m_thread[0 < BGFX_CONFIG_MAX_PIPELINE_COMPILE_THREADS ? BGFX_CONFIG_MAX_PIPELINE_COMPILE_THREADS : 1];
+		bx::Mutex m_mutex;
+		bx::Semaphore m_work;
+		bx::Semaphore m_done;
+
+		PipelineCompileJobVK* m_queueHead;
+		PipelineCompileJobVK* m_queueTail;
+		PipelineCompileJobVK* m_doneHead;
+
+		uint32_t m_numThreads;
+		bool m_exit;
+	};
+
+	/// Draw call with all state resolved on render thread, so that it can be
+	/// recorded into command buffer on any thread.
+	struct DrawCommandVK
+	{
+		VkPipeline m_pipeline;
+		VkPipelineLayout m_pipelineLayout; // VK_NULL_HANDLE when program has no descriptor set.
+		VkDescriptorSet m_descriptorSet;
+		VkBuffer m_vertexBuffer[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
+		VkDeviceSize m_vertexOffset[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
+		VkBuffer m_indexBuffer;            // VK_NULL_HANDLE for non-indexed draw.
+		VkBuffer m_indirectBuffer;         // VK_NULL_HANDLE for direct draw.
+		VkRect2D m_scissor;
+		uint64_t m_rgba;                   // Blend factor, UINT64_MAX when not used.
+		uint32_t m_offsets[2];
+		uint32_t m_stencilRef;             // UINT32_MAX when stencil is not used.
+		uint32_t m_num;                    // Number of vertices, or indices for indexed draw.
+		uint32_t m_numInstances;
+		uint32_t m_startIndex;
+		uint32_t m_indirectOffset;
+		uint32_t m_numIndirect;
+		VkIndexType m_indexType;
+		uint8_t m_numVertexBuffers;
+		uint8_t m_numOffsets;
+	};
+
+	/// State last recorded into command buffer, used to skip redundant commands.
+	struct DrawCommandStateVK
+	{
+		void reset();
+
+		VkPipeline m_pipeline;
+		VkPipelineLayout m_pipelineLayout;
+		VkDescriptorSet m_descriptorSet;
+		VkBuffer m_vertexBuffer[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
+		VkDeviceSize m_vertexOffset[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
+		VkBuffer m_indexBuffer;
+		VkRect2D m_scissor;
+		uint64_t m_rgba;
+		uint32_t m_offsets[2];
+		uint32_t m_stencilRef;
+		VkIndexType m_indexType;
+		uint8_t m_numVertexBuffers;
+		uint8_t m_numOffsets;
+	};
+
+	void recordDrawCommand(VkCommandBuffer _commandBuffer, DrawCommandStateVK& _state, const DrawCommandVK& _cmd);
+
+	struct CommandRecordJobVK
+	{
+		const DrawCommandVK* m_draw;
+		uint32_t m_numDraws;
+		VkCommandBuffer m_commandBuffer;
+		VkResult m_result;
+	};
+
+	/// Records draw calls of view into secondary command buffers on worker
+	/// threads, render thread records one part of the view too.
+	class CommandRecorderVK
+	{
+	public:
+		struct Stats
+		{
+			int64_t m_time[BGFX_CONFIG_MAX_COMMAND_RECORD_THREADS + 1];
+			uint32_t m_numDraws[BGFX_CONFIG_MAX_COMMAND_RECORD_THREADS + 1];
+			uint32_t m_numViews;
+			uint32_t m_numCommandBuffers;
+		};
+
+		CommandRecorderVK();
+
+		VkResult init(VkDevice _device, const VkAllocationCallbacks* _allocatorCb, uint32_t _queueFamily, uint32_t _numFramesInFlight, uint32_t _numThreads);
+		void shutdown();
+
+		/// Resets command pools of frame in flight, called once its fence is signaled.
+		void reset(uint32_t _frameInFlight);
+
+		/// Records draw calls in parallel and executes them in order inside render
+		/// pass begun on _commandBuffer with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS.
+		void execute(VkCommandBuffer _commandBuffer, const VkRenderPassBeginInfo& _rpbi, const VkViewport& _viewport, const DrawCommandVK* _draw, uint32_t _num);
+
+		/// Publishes stats of current frame and clears them.
+		void frame();
+
+		uint32_t getNumThreads() const
+		{
+			return m_numThreads;
+		}
+
+		const Stats& getStats() const
+		{
+			return m_stats;
+		}
+
+	private:
+		struct ThreadData
+		{
+			CommandRecorderVK* m_recorder;
+			uint32_t m_idx;
+		};
+
+		struct CommandPool
+		{
+			VkCommandPool m_commandPool;
+			stl::vector<VkCommandBuffer> m_commandBuffer;
+			uint32_t m_numUsed;
+		};
+
+		int32_t worker(uint32_t _threadIdx);
+		bool recordNext(uint32_t _threadIdx);
+		void record(uint32_t _threadIdx, CommandRecordJobVK& _job);
+		VkCommandBuffer allocCommandBuffer(uint32_t _threadIdx);
+
+		static int32_t threadFunc(bx::Thread* _thread, void* _userData);
+
+		VkDevice m_device;
+		const VkAllocationCallbacks* m_allocatorCb;
+
+		bx::Thread m_thread[0 < BGFX_CONFIG_MAX_COMMAND_RECORD_THREADS ? BGFX_CONFIG_MAX_COMMAND_RECORD_THREADS : 1];
+		ThreadData m_threadData[BX_COUNTOF(m_thread)];
+		bx::Mutex m_mutex;
+		bx::Semaphore m_work;
+		bx::Semaphore m_done;
+
+		CommandPool m_commandPool[BGFX_CONFIG_MAX_COMMAND_RECORD_THREADS + 1][BGFX_CONFIG_MAX_FRAME_LATENCY];
+
+		CommandRecordJobVK m_job[BGFX_CONFIG_MAX_COMMAND_RECORD_THREADS + 1];
+		VkCommandBufferInheritanceInfo m_inheritanceInfo;
+		VkViewport m_viewport;
+		uint32_t m_numJobs;
+		uint32_t m_nextJob;
+
+		Stats m_current;
+		Stats m_stats;
+
+		uint32_t m_numFramesInFlight;
+		uint32_t m_frameInFlight;
+		uint32_t m_numThreads;
+		bool m_exit;
+	};
+
+	/// Range of device memory, sub-allocated from block or dedicated.
+	struct DeviceMemoryAllocationVK
+	{
+		DeviceMemoryAllocationVK()
+			: m_memory(VK_NULL_HANDLE)
+			, m_offset(0)
+			, m_size(0)
+			, m_requested(0)
+			, m_block(UINT32_MAX)
+			, m_order(0)
+		{
+		}
+
+		bool isDedicated() const
+		{
+			return UINT32_MAX == m_block;
+		}
+
+		VkDeviceMemory m_memory;
+		VkDeviceSize m_offset;
+		VkDeviceSize m_size;
+		VkDeviceSize m_requested;
+		uint32_t m_block;
+		uint8_t  m_order;
+	};
+
+	/// Sub-allocates device local memory from large blocks per memory type, every
+	/// block is managed as buddy allocator. Large images and requests that don't
+	/// fit into half of block get dedicated allocation.
+	class DeviceMemoryAllocatorVK
+	{
+	public:
+		struct Stats
+		{
+			uint64_t m_allocated;
+			uint64_t m_used;
+			uint64_t m_requested;
+			uint64_t m_free;
+			uint64_t m_largestFree;
+			uint32_t m_numBlocks;
+			uint32_t m_numDedicated;
+			uint32_t m_numAllocations;
+		};
+
+		DeviceMemoryAllocatorVK();
+
+		void init(VkDevice _device, const VkAllocationCallbacks* _allocatorCb, uint32_t _numFramesInFlight);
+		void shutdown();
+
+		VkResult alloc(const VkMemoryRequirements& _requirements, uint32_t _memoryType, bool _image, DeviceMemoryAllocationVK* _allocation);
+
+		/// Returns allocation once frame in flight is done with it.
+		void release(DeviceMemoryAllocationVK& _allocation, uint32_t _frameInFlight);
+		void consume(uint32_t _frameInFlight);
+
+		void getStats(Stats& _stats) const;
+
+	private:
+		enum
+		{
+			MaxOrders = 32,
+			NumPools  = VK_MAX_MEMORY_TYPES*2,
+		};
+
+		struct Block
+		{
+			VkDeviceMemory m_memory;
+			uint32_t m_pool;
+			uint32_t m_used;
+			stl::vector<uint32_t> m_free[MaxOrders];
+		};
+
+		VkResult allocDedicated(const VkMemoryRequirements& _requirements, uint32_t _memoryType, DeviceMemoryAllocationVK* _allocation);
+		VkResult createBlock(uint32_t _pool, uint32_t* _block);
+		void destroyBlock(uint32_t _block);
+		bool allocBlock(uint32_t _block, uint8_t _order, uint32_t* _offset);
+		void free(const DeviceMemoryAllocationVK& _allocation);
+
+		VkDevice m_device;
+		const VkAllocationCallbacks* m_allocatorCb;
+
+		stl::vector<Block*> m_block;
+		stl::vector<uint32_t> m_freeBlockSlots;
+		uint32_t m_numPoolBlocks[NumPools];
+
+		typedef stl::vector<DeviceMemoryAllocationVK> AllocationArray;
+		AllocationArray m_release[BGFX_CONFIG_MAX_FRAME_LATENCY];
+
+		uint32_t m_numFramesInFlight;
+		uint8_t  m_maxOrder;
+
+		uint64_t m_allocated;
+		uint64_t m_used;
+		uint64_t m_requested;
+		uint32_t m_numDedicated;
+		uint32_t m_numAllocations;
+	};
+
 	struct BufferVK
 	{
 		BufferVK()
 			: m_buffer(VK_NULL_HANDLE)
-			, m_deviceMem(VK_NULL_HANDLE)
 			, m_size(0)
 			, m_flags(BGFX_BUFFER_NONE)
 			, m_dynamic(false)
@@ -426,7 +883,7 @@ VK_DESTROY_FUNC(DescriptorSet);
 		void destroy();
 
 		VkBuffer m_buffer;
-		VkDeviceMemory m_deviceMem;
+		DeviceMemoryAllocationVK m_deviceMem;
 		uint32_t m_size;
 		uint16_t m_flags;
 		bool m_dynamic;
@@ -646,11 +1103,10 @@ VK_DESTROY_FUNC(DescriptorSet);
 			, m_sampler({ 1, VK_SAMPLE_COUNT_1_BIT })
 			, m_format(VK_FORMAT_UNDEFINED)
 			, m_textureImage(VK_NULL_HANDLE)
-			, m_textureDeviceMem(VK_NULL_HANDLE)
 			, m_currentImageLayout(VK_IMAGE_LAYOUT_UNDEFINED)
 			, m_singleMsaaImage(VK_NULL_HANDLE)
-			, m_singleMsaaDeviceMem(VK_NULL_HANDLE)
 			, m_currentSingleMsaaImageLayout(VK_IMAGE_LAYOUT_UNDEFINED)
+			, m_copyBuffer(VK_NULL_HANDLE)
 		{
 		}
 
@@ -660,12 +1116,22 @@ VK_DESTROY_FUNC(DescriptorSet);
 
 		void destroy();
 
-		void update(VkCommandBuffer _commandBuffer, uint8_t _side, uint8_t _mip, const Rect& _rect, uint16_t _z, uint16_t _depth, uint16_t _pitch, const Memory* _mem);
+		/// Returns true when copy was queued on texture without queued copies.
+		bool update(VkCommandBuffer _commandBuffer, uint8_t _side, uint8_t _mip, const Rect& _rect, uint16_t _z, uint16_t _depth, uint16_t _pitch, const Memory* _mem);
 		void resolve(VkCommandBuffer _commandBuffer, uint8_t _resolve, uint32_t _layer, uint32_t _numLayers, uint32_t _mip);
 
 		void copyBufferToTexture(VkCommandBuffer _commandBuffer, VkBuffer _stagingBuffer, uint32_t _bufferImageCopyCount, VkBufferImageCopy* _bufferImageCopy);
+
+		/// Queues copy region, queued regions are copied with single command in
+		/// flushCopies. Returns true when it's first region queued.
+		bool queueCopy(VkCommandBuffer _commandBuffer, VkBuffer _stagingBuffer, const VkBufferImageCopy& _region);
+		void flushCopies(VkCommandBuffer _commandBuffer);
+
 		VkImageLayout setImageMemoryBarrier(VkCommandBuffer _commandBuffer, VkImageLayout _newImageLayout, bool _singleMsaaImage = false);
 
+		/// Same as above, but transition is recorded when batch is flushed.
+		VkImageLayout setImageMemoryBarrier(ImageBarrierBatchVK& _batch, VkImageLayout _newImageLayout, bool _singleMsaaImage = false);
+
 		VkResult createView(uint32_t _layer, uint32_t _numLayers, uint32_t _mip, uint32_t _numMips, VkImageViewType _type, VkImageAspectFlags _aspectMask, bool _renderTarget, ::VkImageView* _view) const;
 
 		void*    m_directAccessPtr;
@@ -686,20 +1152,24 @@ VK_DESTROY_FUNC(DescriptorSet);
 		VkComponentMapping m_components;
 		VkImageAspectFlags m_aspectMask;
 
-		VkImage        m_textureImage;
-		VkDeviceMemory m_textureDeviceMem;
-		VkImageLayout  m_currentImageLayout;
+		VkImage                  m_textureImage;
+		DeviceMemoryAllocationVK m_textureDeviceMem;
+		VkImageLayout            m_currentImageLayout;
 
-		VkImage        m_singleMsaaImage;
-		VkDeviceMemory m_singleMsaaDeviceMem;
-		VkImageLayout  m_currentSingleMsaaImageLayout;
+		VkImage                  m_singleMsaaImage;
+		DeviceMemoryAllocationVK m_singleMsaaDeviceMem;
+		VkImageLayout            m_currentSingleMsaaImageLayout;
 
 		VkImageLayout m_sampledLayout;
 
 		ReadbackVK m_readback;
 
+		VkBuffer m_copyBuffer;
+		stl::vector<VkBufferImageCopy> m_copyRegions;
+
 	private:
 		VkResult createImages(VkCommandBuffer _commandBuffer);
+		uint32_t getCopyAlignment() const;
 		static VkImageAspectFlags getAspectMask(VkFormat _format);
 	};
 
@@ -0,0 +1,1399 @@
+/*
+ * Copyright 2011-2022 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include <bx/allocator.h>
+#include <bx/commandline.h>
+#include <bx/file.h>
+#include <bx/math.h>
+#include <bx/rng.h>
+#include <bx/semaphore.h>
+#include <bx/sort.h>
+#include <bx/string.h>
+#include <bx/thread.h>
+#include <bx/timer.h>
+#include <bgfx/bgfx.h>
+
+#include "../../examples/common/culling.h"
+#include "../../examples/common/occlusion.h"
+
+#include <stdlib.h> // abort
+
+#define BGFX_BENCH_VERSION_MAJOR 1
+#define BGFX_BENCH_VERSION_MINOR 0
+
+#define BGFX_BENCH_MAX_ENCODERS 8
+
+struct Phase
+{
+	enum Enum
+	{
+		Submit,
+		Cull,
+		Occlusion,
+		Frame,
+		Sort,
+		Swap,
+		ExecCommands,
+		RenderSubmit,
+
+		Count
+	};
+};
+
+static const char* s_phaseName[] =
+{
+	"submit",
+	"cull",
+	"occlusion",
+	"frame",
+	"sort",
+	"swap",
+	"rendererExecCommands",
+	"rendererSubmit",
+};
+BX_STATIC_ASSERT(BX_COUNTOF(s_phaseName) == Phase::Count);
+
+struct ProfilerScopeRemap
+{
+	bx::StringView name;
+	Phase::Enum phase;
+};
+
+// Profiler scopes emitted by bgfx when built with BGFX_CONFIG_PROFILER=1.
+static const ProfilerScopeRemap s_profilerScopeRemap[] =
+{
+	{ "bgfx/Sort",              Phase::Sort         },
+	{ "bgfx/Swap",              Phase::Swap         },
+	{ "bgfx/Exec commands pre", Phase::ExecCommands },
+	{ "bgfx/Exec commands post",Phase::ExecCommands },
+	{ "bgfx/Render submit",     Phase::RenderSubmit },
+};
+
+struct BenchCallback : public bgfx::CallbackI
+{
+	BenchCallback()
+		: m_depth(0)
+		, m_numEvents(0)
+	{
+		reset();
+	}
+
+	virtual ~BenchCallback()
+	{
+	}
+
+	void reset()
+	{
+		bx::memSet(m_time, 0, sizeof(m_time) );
+	}
+
+	virtual void fatal(const char* _filePath, uint16_t _line, bgfx::Fatal::Enum _code, const char* _str) override
+	{
+		BX_UNUSED(_filePath, _line);
+
+		bx::printf("Fatal error: 0x%08x: %s\n", _code, _str);
+		abort();
+	}
+
+	virtual void traceVargs(const char* _filePath, uint16_t _line, const char* _format, va_list _argList) override
+	{
+		BX_UNUSED(_filePath, _line, _format, _argList);
+	}
+
+	virtual void profilerBegin(const char* _name, uint32_t _abgr, const char* _filePath, uint16_t _line) override
+	{
+		profilerBeginLiteral(_name, _abgr, _filePath, _line);
+	}
+
+	virtual void profilerBeginLiteral(const char* _name, uint32_t _abgr, const char* _filePath, uint16_t _line) override
+	{
+		BX_UNUSED(_abgr, _filePath, _line);
+
+		// Benchmark runs bgfx in single threaded mode, all profiler scopes are on API thread.
+		if (m_depth < BX_COUNTOF(m_stack) )
+		{
+			Scope& scope = m_stack[m_depth];
+			scope.phase = Phase::Count;
+			scope.begin = bx::getHPCounter();
+
+			for (uint32_t ii = 0; ii < BX_COUNTOF(s_profilerScopeRemap); ++ii)
+			{
+				if (0 == bx::strCmp(_name, s_profilerScopeRemap[ii].name) )
+				{
+					scope.phase = s_profilerScopeRemap[ii].phase;
+					break;
+				}
+			}
+		}
+
+		++m_depth;
+		++m_numEvents;
+	}
+
+	virtual void profilerEnd() override
+	{
+		BX_ASSERT(0 < m_depth, "Profiler scope begin/end mismatch.");
+		--m_depth;
+
+		if (m_depth < BX_COUNTOF(m_stack) )
+		{
+			const Scope& scope = m_stack[m_depth];
+			if (Phase::Count != scope.phase)
+			{
+				m_time[scope.phase] += bx::getHPCounter() - scope.begin;
+			}
+		}
+	}
+
+	virtual uint32_t cacheReadSize(uint64_t _id) override
+	{
+		BX_UNUSED(_id);
+		return 0;
+	}
+
+	virtual bool cacheRead(uint64_t _id, void* _data, uint32_t _size) override
+	{
+		BX_UNUSED(_id, _data, _size);
+		return false;
+	}
+
+	virtual void cacheWrite(uint64_t _id, const void* _data, uint32_t _size) override
+	{
+		BX_UNUSED(_id, _data, _size);
+	}
+
+	virtual void screenShot(const char* _filePath, uint32_t _width, uint32_t _height, uint32_t _pitch, const void* _data, uint32_t _size, bool _yflip) override
+	{
+		BX_UNUSED(_filePath, _width, _height, _pitch, _data, _size, _yflip);
+	}
+
+	virtual void captureBegin(uint32_t _width, uint32_t _height, uint32_t _pitch, bgfx::TextureFormat::Enum _format, bool _yflip) override
+	{
+		BX_UNUSED(_width, _height, _pitch, _format, _yflip);
+	}
+
+	virtual void captureEnd() override
+	{
+	}
+
+	virtual void captureFrame(const void* _data, uint32_t _size) override
+	{
+		BX_UNUSED(_data, _size);
+	}
+
+	struct Scope
+	{
+		int64_t begin;
+		Phase::Enum phase;
+	};
+
+	Scope    m_stack[64];
+	uint32_t m_depth;
+	uint32_t m_numEvents;
+	int64_t  m_time[Phase::Count];
+};
+
+struct Options
+{
+	Options()
+		: numFrames(300)
+		, numWarmup(30)
+		, numDraws(10000)
+		, numViews(4)
+		, numEncoders(1)
+		, numUniforms(8)
+		, numDynamic(256)
+		, numTransient(1000)
+		, numTextures(64)
+		, numInstances(100000)
+		, numRasterThreads(4)
+		, workload(NULL)
+	{
+	}
+
+	uint32_t numFrames;
+	uint32_t numWarmup;
+	uint32_t numDraws;
+	uint32_t numViews;
+	uint32_t numEncoders;
+	uint32_t numUniforms;
+	uint32_t numDynamic;
+	uint32_t numTransient;
+	uint32_t numTextures;
+	uint32_t numInstances;
+	uint32_t numRasterThreads;
+	const char* workload;
+};
+
+struct PosColorVertex
+{
+	float m_x;
+	float m_y;
+	float m_z;
+	uint32_t m_abgr;
+};
+
+static const PosColorVertex s_quadVertices[] =
+{
+	{ -1.0f, -1.0f, 0.0f, 0xff0000ff },
+	{  1.0f, -1.0f, 0.0f, 0xff00ff00 },
+	{  1.0f,  1.0f, 0.0f, 0xffff0000 },
+	{ -1.0f,  1.0f, 0.0f, 0xffffffff },
+};
+
+static const uint16_t s_quadIndices[] =
+{
+	0, 1, 2,
+	0, 2, 3,
+};
+
+static bgfx::ShaderHandle createNullShader(char _type)
+{
+	// Noop renderer doesn't compile shaders, only shader binary header is required to get
+	// valid handle. Vertex shader output hash must match fragment shader input hash.
+	bgfx::ShaderHandle handle = BGFX_INVALID_HANDLE;
+
+	const bgfx::Memory* mem = bgfx::alloc(4*sizeof(uint32_t)+sizeof(uint16_t) );
+	bx::StaticMemoryBlockWriter writer(mem->data, mem->size);
+	bx::Error err;
+	bx::write(&writer, uint32_t(BX_MAKEFOURCC(_type, 'S', 'H', 11) ), &err);
+	bx::write(&writer, uint32_t(0xbe4c4), &err); // hash in
+	bx::write(&writer, uint32_t(0xbe4c4), &err); // hash out
+	bx::write(&writer, uint16_t(0), &err);       // number of uniforms
+	bx::write(&writer, uint32_t(0), &err);       // shader size
+
+	if (err.isOk() )
+	{
+		handle = bgfx::createShader(mem);
+	}
+
+	return handle;
+}
+
+class Workload
+{
+public:
+	Workload(const char* _name, const Options& _options)
+		: m_name(_name)
+		, m_options(_options)
+		, m_cullTime(0)
+		, m_occlusionTime(0)
+	{
+	}
+
+	virtual ~Workload()
+	{
+	}
+
+	/// Create resources used by workload.
+	virtual void init(bgfx::ProgramHandle _program, const bgfx::VertexLayout& _layout) = 0;
+
+	/// Destroy resources used by workload.
+	virtual void shutdown() = 0;
+
+	/// Called on API thread before encoders start submitting frame.
+	virtual void beginFrame()
+	{
+	}
+
+	/// Called from each encoder thread, work must be split by encoder index.
+	virtual void submit(bgfx::Encoder* _encoder, uint32_t _encoderIdx, uint32_t _numEncoders) = 0;
+
+	/// Number of encoders used by workload.
+	virtual uint32_t getNumEncoders() const
+	{
+		return 1;
+	}
+
+	/// Number of draw calls submitted per frame.
+	virtual uint32_t getNumDraws() const = 0;
+
+	const char* m_name;
+	const Options& m_options;
+
+	/// Time spent culling in last beginFrame.
+	int64_t m_cullTime;
+
+	/// Time spent rasterizing occluders and testing occludees in last beginFrame.
+	int64_t m_occlusionTime;
+};
+
+static void range(uint32_t _num, uint32_t _idx, uint32_t _count, uint32_t& _begin, uint32_t& _end)
+{
+	_begin = _num *  _idx     / _count;
+	_end   = _num * (_idx+1) / _count;
+}
+
+class DrawWorkload : public Workload
+{
+public:
+	DrawWorkload(const Options& _options)
+		: Workload("draws", _options)
+	{
+	}
+
+	virtual void init(bgfx::ProgramHandle _program, const bgfx::VertexLayout& _layout) override
+	{
+		m_program = _program;
+		m_vbh = bgfx::createVertexBuffer(bgfx::makeRef(s_quadVertices, sizeof(s_quadVertices) ), _layout);
+		m_ibh = bgfx::createIndexBuffer(bgfx::makeRef(s_quadIndices, sizeof(s_quadIndices) ) );
+	}
+
+	virtual void shutdown() override
+	{
+		bgfx::destroy(m_vbh);
+		bgfx::destroy(m_ibh);
+	}
+
+	virtual void submit(bgfx::Encoder* _encoder, uint32_t _encoderIdx, uint32_t _numEncoders) override
+	{
+		uint32_t begin, end;
+		range(m_options.numDraws, _encoderIdx, _numEncoders, begin, end);
+
+		for (uint32_t view = 0; view < m_options.numViews; ++view)
+		{
+			for (uint32_t ii = begin; ii < end; ++ii)
+			{
+				float mtx[16];
+				bx::mtxTranslate(mtx, float(ii%100), float(ii/100), float(view) );
+
+				_encoder->setTransform(mtx);
+				_encoder->setVertexBuffer(0, m_vbh);
+				_encoder->setIndexBuffer(m_ibh);
+				_encoder->setState(BGFX_STATE_DEFAULT);
+				_encoder->submit(bgfx::ViewId(view), m_program, ii);
+			}
+		}
+	}
+
+	virtual uint32_t getNumEncoders() const override
+	{
+		return m_options.numEncoders;
+	}
+
+	virtual uint32_t getNumDraws() const override
+	{
+		return m_options.numDraws*m_options.numViews;
+	}
+
+protected:
+	bgfx::ProgramHandle m_program;
+	bgfx::VertexBufferHandle m_vbh;
+	bgfx::IndexBufferHandle m_ibh;
+};
+
+class UniformWorkload : public DrawWorkload
+{
+public:
+	UniformWorkload(const Options& _options)
+		: DrawWorkload(_options)
+	{
+		m_name = "uniforms";
+	}
+
+	virtual void init(bgfx::ProgramHandle _program, const bgfx::VertexLayout& _layout) override
+	{
+		DrawWorkload::init(_program, _layout);
+
+		m_uniform = bgfx::createUniform("u_bench", bgfx::UniformType::Vec4, uint16_t(m_options.numUniforms) );
+		m_params  = new float[m_options.numUniforms*4];
+
+		for (uint32_t ii = 0, num = m_options.numUniforms*4; ii < num; ++ii)
+		{
+			m_params[ii] = float(ii);
+		}
+	}
+
+	virtual void shutdown() override
+	{
+		delete [] m_params;
+		bgfx::destroy(m_uniform);
+
+		DrawWorkload::shutdown();
+	}
+
+	virtual void submit(bgfx::Encoder* _encoder, uint32_t _encoderIdx, uint32_t _numEncoders) override
+	{
+		uint32_t begin, end;
+		range(m_options.numDraws, _encoderIdx, _numEncoders, begin, end);
+
+		for (uint32_t view = 0; view < m_options.numViews; ++view)
+		{
+			for (uint32_t ii = begin; ii < end; ++ii)
+			{
+				float mtx[16];
+				bx::mtxTranslate(mtx, float(ii%100), float(ii/100), float(view) );
+
+				_encoder->setUniform(m_uniform, m_params, uint16_t(m_options.numUniforms) );
+				_encoder->setTransform(mtx);
+				_encoder->setVertexBuffer(0, m_vbh);
+				_encoder->setIndexBuffer(m_ibh);
+				_encoder->setState(BGFX_STATE_DEFAULT);
+				_encoder->submit(bgfx::ViewId(view), m_program, ii);
+			}
+		}
+	}
+
+private:
+	bgfx::UniformHandle m_uniform;
+	float* m_params;
+};
+
+class DynamicWorkload : public Workload
+{
+public:
+	DynamicWorkload(const Options& _options)
+		: Workload("dynamic", _options)
+		, m_frame(0)
+	{
+	}
+
+	virtual void init(bgfx::ProgramHandle _program, const bgfx::VertexLayout& _layout) override
+	{
+		m_program = _program;
+		m_layout  = _layout;
+		m_vbh = new bgfx::DynamicVertexBufferHandle[m_options.numDynamic];
+		m_ibh = new bgfx::DynamicIndexBufferHandle[m_options.numDynamic];
+
+		for (uint32_t ii = 0; ii < m_options.numDynamic; ++ii)
+		{
+			m_vbh[ii] = bgfx::createDynamicVertexBuffer(BX_COUNTOF(s_quadVertices), m_layout);
+			m_ibh[ii] = bgfx::createDynamicIndexBuffer(BX_COUNTOF(s_quadIndices) );
+		}
+	}
+
+	virtual void shutdown() override
+	{
+		for (uint32_t ii = 0; ii < m_options.numDynamic; ++ii)
+		{
+			bgfx::destroy(m_vbh[ii]);
+			bgfx::destroy(m_ibh[ii]);
+		}
+
+		delete [] m_vbh;
+		delete [] m_ibh;
+	}
+
+	virtual void beginFrame() override
+	{
+		// Every frame 1/8 of buffers are recreated, and every buffer is updated.
+		for (uint32_t ii = m_frame%8; ii < m_options.numDynamic; ii += 8)
+		{
+			bgfx::destroy(m_vbh[ii]);
+			bgfx::destroy(m_ibh[ii]);
+			m_vbh[ii] = bgfx::createDynamicVertexBuffer(BX_COUNTOF(s_quadVertices), m_layout);
+			m_ibh[ii] = bgfx::createDynamicIndexBuffer(BX_COUNTOF(s_quadIndices) );
+		}
+
+		for (uint32_t ii = 0; ii < m_options.numDynamic; ++ii)
+		{
+			bgfx::update(m_vbh[ii], 0, bgfx::copy(s_quadVertices, sizeof(s_quadVertices) ) );
+			bgfx::update(m_ibh[ii], 0, bgfx::copy(s_quadIndices,  sizeof(s_quadIndices) ) );
+		}
+
+		++m_frame;
+	}
+
+	virtual void submit(bgfx::Encoder* _encoder, uint32_t _encoderIdx, uint32_t _numEncoders) override
+	{
+		uint32_t begin, end;
+		range(m_options.numDynamic, _encoderIdx, _numEncoders, begin, end);
+
+		for (uint32_t ii = begin; ii < end; ++ii)
+		{
+			_encoder->setVertexBuffer(0, m_vbh[ii]);
+			_encoder->setIndexBuffer(m_ibh[ii]);
+			_encoder->setState(BGFX_STATE_DEFAULT);
+			_encoder->submit(0, m_program);
+		}
+	}
+
+	virtual uint32_t getNumDraws() const override
+	{
+		return m_options.numDynamic;
+	}
+
+private:
+	bgfx::ProgramHandle m_program;
+	bgfx::VertexLayout m_layout;
+	bgfx::DynamicVertexBufferHandle* m_vbh;
+	bgfx::DynamicIndexBufferHandle* m_ibh;
+	uint32_t m_frame;
+};
+
+class TransientWorkload : public Workload
+{
+public:
+	TransientWorkload(const Options& _options)
+		: Workload("transient", _options)
+	{
+	}
+
+	virtual void init(bgfx::ProgramHandle _program, const bgfx::VertexLayout& _layout) override
+	{
+		m_program = _program;
+		m_layout  = _layout;
+	}
+
+	virtual void shutdown() override
+	{
+	}
+
+	virtual void submit(bgfx::Encoder* _encoder, uint32_t _encoderIdx, uint32_t _numEncoders) override
+	{
+		uint32_t begin, end;
+		range(m_options.numTransient, _encoderIdx, _numEncoders, begin, end);
+
+		for (uint32_t ii = begin; ii < end; ++ii)
+		{
+			bgfx::TransientVertexBuffer tvb;
+			bgfx::TransientIndexBuffer tib;
+
+			if (!bgfx::allocTransientBuffers(&tvb, m_layout, BX_COUNTOF(s_quadVertices), &tib, BX_COUNTOF(s_quadIndices) ) )
+			{
+				break;
+			}
+
+			bx::memCopy(tvb.data, s_quadVertices, sizeof(s_quadVertices) );
+			bx::memCopy(tib.data, s_quadIndices,  sizeof(s_quadIndices) );
+
+			_encoder->setVertexBuffer(0, &tvb);
+			_encoder->setIndexBuffer(&tib);
+			_encoder->setState(BGFX_STATE_DEFAULT);
+			_encoder->submit(0, m_program);
+		}
+	}
+
+	virtual uint32_t getNumEncoders() const override
+	{
+		return m_options.numEncoders;
+	}
+
+	virtual uint32_t getNumDraws() const override
+	{
+		return m_options.numTransient;
+	}
+
+private:
+	bgfx::ProgramHandle m_program;
+	bgfx::VertexLayout m_layout;
+};
+
+class TextureWorkload : public Workload
+{
+public:
+	TextureWorkload(const Options& _options)
+		: Workload("textures", _options)
+	{
+	}
+
+	virtual void init(bgfx::ProgramHandle _program, const bgfx::VertexLayout& _layout) override
+	{
+		BX_UNUSED(_program, _layout);
+
+		m_texture = new bgfx::TextureHandle[m_options.numTextures];
+
+		for (uint32_t ii = 0; ii < m_options.numTextures; ++ii)
+		{
+			m_texture[ii].idx = bgfx::kInvalidHandle;
+		}
+	}
+
+	virtual void shutdown() override
+	{
+		destroyTextures();
+		delete [] m_texture;
+	}
+
+	virtual void beginFrame() override
+	{
+		destroyTextures();
+
+		const uint32_t size = 64*64*4;
+
+		for (uint32_t ii = 0; ii < m_options.numTextures; ++ii)
+		{
+			const bgfx::Memory* mem = bgfx::alloc(size);
+			bx::memSet(mem->data, uint8_t(ii), size);
+
+			m_texture[ii] = bgfx::createTexture2D(64, 64, false, 1, bgfx::TextureFormat::RGBA8, BGFX_TEXTURE_NONE, mem);
+		}
+	}
+
+	virtual void submit(bgfx::Encoder* _encoder, uint32_t _encoderIdx, uint32_t _numEncoders) override
+	{
+		BX_UNUSED(_encoder, _encoderIdx, _numEncoders);
+	}
+
+	virtual uint32_t getNumDraws() const override
+	{
+		return 0;
+	}
+
+private:
+	void destroyTextures()
+	{
+		for (uint32_t ii = 0; ii < m_options.numTextures; ++ii)
+		{
+			if (bgfx::isValid(m_texture[ii]) )
+			{
+				bgfx::destroy(m_texture[ii]);
+				m_texture[ii].idx = bgfx::kInvalidHandle;
+			}
+		}
+	}
+
+	bgfx::TextureHandle* m_texture;
+};
+
+class CullWorkload : public Workload
+{
+public:
+	CullWorkload(const char* _name, const Options& _options, bool _bvh)
+		: Workload(_name, _options)
+		, m_bvh(_bvh)
+	{
+	}
+
+	virtual void init(bgfx::ProgramHandle _program, const bgfx::VertexLayout& _layout) override
+	{
+		m_program = _program;
+		m_vbh = bgfx::createVertexBuffer(bgfx::makeRef(s_quadVertices, sizeof(s_quadVertices) ), _layout);
+		m_ibh = bgfx::createIndexBuffer(bgfx::makeRef(s_quadIndices, sizeof(s_quadIndices) ) );
+
+		m_numInstances = bx::max<uint32_t>(m_options.numInstances, 1);
+		m_aabbs   = new bx::Aabb[m_numInstances];
+		m_visible = new uint32_t[m_numInstances];
+		m_numVisible = 0;
+		m_frame = 0;
+
+		// Instances are placed on grid around camera.
+		const uint32_t side = uint32_t(bx::ceil(bx::sqrt(float(m_numInstances) ) ) );
+		const float offset = float(side)*2.0f;
+
+		for (uint32_t ii = 0; ii < m_numInstances; ++ii)
+		{
+			const bx::Vec3 pos =
+			{
+				float(ii%side)*4.0f - offset,
+				float(ii%7),
+				float(ii/side)*4.0f - offset,
+			};
+
+			m_aabbs[ii].min = bx::sub(pos, 1.0f);
+			m_aabbs[ii].max = bx::add(pos, 1.0f);
+		}
+
+		if (m_bvh)
+		{
+			m_hierarchy.build(m_aabbs, m_numInstances);
+		}
+	}
+
+	virtual void shutdown() override
+	{
+		bgfx::destroy(m_vbh);
+		bgfx::destroy(m_ibh);
+
+		delete [] m_aabbs;
+		delete [] m_visible;
+	}
+
+	virtual void beginFrame() override
+	{
+		const int64_t cullBegin = bx::getHPCounter();
+
+		// Camera is rotating in the middle of the grid.
+		const float angle = float(m_frame)*0.01f;
+		const bx::Vec3 eye = { 0.0f, 10.0f, 0.0f };
+		const bx::Vec3 at  = { bx::sin(angle), 9.8f, bx::cos(angle) };
+
+		float view[16];
+		float proj[16];
+		bx::mtxLookAt(view, eye, at);
+		bx::mtxProj(proj, 60.0f, 1280.0f/720.0f, 0.1f, 1000.0f, bgfx::getCaps()->homogeneousDepth);
+
+		Frustum frustum;
+		frustumInit(frustum, view, proj);
+
+		m_numVisible = m_bvh
+			? m_hierarchy.cull(m_visible, frustum)
+			: cullAabbs(m_visible, frustum, m_aabbs, m_numInstances)
+			;
+
+		m_cullTime = bx::getHPCounter() - cullBegin;
+		++m_frame;
+	}
+
+	virtual void submit(bgfx::Encoder* _encoder, uint32_t _encoderIdx, uint32_t _numEncoders) override
+	{
+		uint32_t begin, end;
+		range(m_numVisible, _encoderIdx, _numEncoders, begin, end);
+
+		for (uint32_t ii = begin; ii < end; ++ii)
+		{
+			const bx::Aabb& aabb = m_aabbs[m_visible[ii] ];
+
+			float mtx[16];
+			bx::mtxTranslate(mtx, aabb.min.x + 1.0f, aabb.min.y + 1.0f, aabb.min.z + 1.0f);
+
+			_encoder->setTransform(mtx);
+			_encoder->setVertexBuffer(0, m_vbh);
+			_encoder->setIndexBuffer(m_ibh);
+			_encoder->setState(BGFX_STATE_DEFAULT);
+			_encoder->submit(0, m_program, ii);
+		}
+	}
+
+	virtual uint32_t getNumEncoders() const override
+	{
+		return m_options.numEncoders;
+	}
+
+	virtual uint32_t getNumDraws() const override
+	{
+		return m_numVisible;
+	}
+
+private:
+	CullingBvh m_hierarchy;
+	bx::Aabb*  m_aabbs;
+	uint32_t*  m_visible;
+	uint32_t   m_numInstances;
+	uint32_t   m_numVisible;
+	uint32_t   m_frame;
+	bool       m_bvh;
+
+	bgfx::ProgramHandle m_program;
+	bgfx::VertexBufferHandle m_vbh;
+	bgfx::IndexBufferHandle m_ibh;
+};
+
+// Box corner ii is at max along axis when bit of axis is set. Faces are
+// counter-clockwise when seen from outside.
+static const uint16_t s_boxIndices[] =
+{
+	0, 1, 2,  1, 3, 2,
+	4, 6, 5,  5, 6, 7,
+	0, 2, 4,  4, 2, 6,
+	1, 5, 3,  5, 7, 3,
+	0, 4, 1,  4, 5, 1,
+	2, 3, 6,  6, 3, 7,
+};
+
+class OcclusionWorkload : public Workload
+{
+public:
+	OcclusionWorkload(const Options& _options)
+		: Workload("occlusion", _options)
+		, m_rasterizer(NULL)
+	{
+	}
+
+	virtual void init(bgfx::ProgramHandle _program, const bgfx::VertexLayout& _layout) override
+	{
+		m_program = _program;
+		m_vbh = bgfx::createVertexBuffer(bgfx::makeRef(s_quadVertices, sizeof(s_quadVertices) ), _layout);
+		m_ibh = bgfx::createIndexBuffer(bgfx::makeRef(s_quadIndices, sizeof(s_quadIndices) ) );
+
+		m_numInstances = bx::max<uint32_t>(m_options.numInstances, 1);
+		m_aabbs   = new bx::Aabb[m_numInstances];
+		m_visible = new uint32_t[m_numInstances];
+		m_numVisible = 0;
+		m_frame = 0;
+
+		bx::RngMwc rng;
+
+		// Synthetic city, grid of buildings separated by streets. Buildings are
+		// occluders, and props placed along streets are occludees.
+		for (uint32_t ii = 0; ii < kNumBuildings; ++ii)
+		{
+			const float x = float(ii%kCitySize)*kBlockSize - kCityHalfSize;
+			const float z = float(ii/kCitySize)*kBlockSize - kCityHalfSize;
+			const float height = 10.0f + bx::frnd(&rng)*50.0f;
+
+			bx::Aabb& aabb = m_buildings[ii];
+			aabb.min = { x, 0.0f, z };
+			aabb.max = { x + kBuildingSize, height, z + kBuildingSize };
+
+			float* vertices = &m_buildingVertices[ii*8*3];
+			for (uint32_t jj = 0; jj < 8; ++jj)
+			{
+				vertices[jj*3+0] = jj & 1 ? aabb.max.x : aabb.min.x;
+				vertices[jj*3+1] = jj & 2 ? aabb.max.y : aabb.min.y;
+				vertices[jj*3+2] = jj & 4 ? aabb.max.z : aabb.min.z;
+			}
+		}
+
+		const float streetSize = kBlockSize - kBuildingSize;
+
+		for (uint32_t ii = 0; ii < m_numInstances; ++ii)
+		{
+			const float blockX = float(rng.gen() % kCitySize)*kBlockSize - kCityHalfSize;
+			const float blockZ = float(rng.gen() % kCitySize)*kBlockSize - kCityHalfSize;
+			const float along  = bx::frnd(&rng)*kBlockSize;
+			const float across = kBuildingSize + 0.5f + bx::frnd(&rng)*(streetSize - 1.0f);
+
+			const bx::Vec3 pos = 0 == (ii & 1)
+				? bx::Vec3{ blockX + across, bx::frnd(&rng)*3.0f, blockZ + along  }
+				: bx::Vec3{ blockX + along,  bx::frnd(&rng)*3.0f, blockZ + across }
+				;
+
+			m_aabbs[ii].min = bx::sub(pos, 0.5f);
+			m_aabbs[ii].max = bx::add(pos, 0.5f);
+		}
+
+		m_hierarchy.build(m_aabbs, m_numInstances);
+
+		m_rasterizer = new OcclusionRasterizer(&m_allocator, 256, 144, m_options.numRasterThreads);
+	}
+
+	virtual void shutdown() override
+	{
+		bgfx::destroy(m_vbh);
+		bgfx::destroy(m_ibh);
+
+		delete m_rasterizer;
+		delete [] m_aabbs;
+		delete [] m_visible;
+	}
+
+	virtual void beginFrame() override
+	{
+		const int64_t cullBegin = bx::getHPCounter();
+
+		// Camera is walking along street in the middle of the city at street
+		// level, and looking around.
+		const float streetZ = kBuildingSize + (kBlockSize - kBuildingSize)*0.5f;
+		const float walk    = bx::mod(float(m_frame)*0.5f, kCitySize*kBlockSize);
+		const float angle   = bx::sin(float(m_frame)*0.01f)*0.8f;
+
+		const bx::Vec3 eye = { walk - kCityHalfSize, 2.0f, streetZ };
+		const bx::Vec3 at  = { eye.x + bx::cos(angle), 2.0f, eye.z + bx::sin(angle) };
+
+		const bool homogeneousDepth = bgfx::getCaps()->homogeneousDepth;
+
+		float view[16];
+		float proj[16];
+		float viewProj[16];
+		bx::mtxLookAt(view, eye, at);
+		bx::mtxProj(proj, 60.0f, 1280.0f/720.0f, 0.1f, 1000.0f, homogeneousDepth);
+		bx::mtxMul(viewProj, view, proj);
+
+		Frustum frustum;
+		frustumInit(frustum, viewProj);
+
+		m_numVisible = m_hierarchy.cull(m_visible, frustum);
+		const uint32_t numOccluders = cullAabbs(m_occluders, frustum, m_buildings, kNumBuildings);
+
+		const int64_t occlusionBegin = bx::getHPCounter();
+
+		m_rasterizer->begin(viewProj, homogeneousDepth);
+
+		for (uint32_t ii = 0; ii < numOccluders; ++ii)
+		{
+			m_rasterizer->addOccluder(
+				  &m_buildingVertices[m_occluders[ii]*8*3]
+				, 3*sizeof(float)
+				, 8
+				, s_boxIndices
+				, BX_COUNTOF(s_boxIndices)
+				, NULL
+				, OcclusionRasterizer::CullMode::Cw
+				);
+		}
+
+		m_rasterizer->rasterize();
+		m_numVisible = m_rasterizer->cull(m_visible, m_aabbs, m_visible, m_numVisible);
+
+		const int64_t occlusionEnd = bx::getHPCounter();
+
+		m_cullTime      = occlusionBegin - cullBegin;
+		m_occlusionTime = occlusionEnd   - occlusionBegin;
+		++m_frame;
+	}
+
+	virtual void submit(bgfx::Encoder* _encoder, uint32_t _encoderIdx, uint32_t _numEncoders) override
+	{
+		uint32_t begin, end;
+		range(m_numVisible, _encoderIdx, _numEncoders, begin, end);
+
+		for (uint32_t ii = begin; ii < end; ++ii)
+		{
+			const bx::Aabb& aabb = m_aabbs[m_visible[ii] ];
+
+			float mtx[16];
+			bx::mtxSRT(mtx
+				, 0.5f, 0.5f, 0.5f
+				, 0.0f, 0.0f, 0.0f
+				, aabb.min.x + 0.5f, aabb.min.y + 0.5f, aabb.min.z + 0.5f
+				);
+
+			_encoder->setTransform(mtx);
+			_encoder->setVertexBuffer(0, m_vbh);
+			_encoder->setIndexBuffer(m_ibh);
+			_encoder->setState(BGFX_STATE_DEFAULT);
+			_encoder->submit(0, m_program, ii);
+		}
+	}
+
+	virtual uint32_t getNumEncoders() const override
+	{
+		return m_options.numEncoders;
+	}
+
+	virtual uint32_t getNumDraws() const override
+	{
+		return m_numVisible;
+	}
+
+private:
+	static constexpr uint32_t kCitySize      = 32;
+	static constexpr uint32_t kNumBuildings  = kCitySize*kCitySize;
+	static constexpr float    kBlockSize     = 24.0f;
+	static constexpr float    kBuildingSize  = 16.0f;
+	static constexpr float    kCityHalfSize  = kCitySize*kBlockSize*0.5f;
+
+	bx::DefaultAllocator m_allocator;
+	OcclusionRasterizer* m_rasterizer;
+
+	bx::Aabb m_buildings[kNumBuildings];
+	float    m_buildingVertices[kNumBuildings*8*3];
+	uint32_t m_occluders[kNumBuildings];
+
+	CullingBvh m_hierarchy;
+	bx::Aabb*  m_aabbs;
+	uint32_t*  m_visible;
+	uint32_t   m_numInstances;
+	uint32_t   m_numVisible;
+	uint32_t   m_frame;
+
+	bgfx::ProgramHandle m_program;
+	bgfx::VertexBufferHandle m_vbh;
+	bgfx::IndexBufferHandle m_ibh;
+};
+
+struct EncoderThread
+{
+	static int32_t threadFunc(bx::Thread* _thread, void* _userData)
+	{
+		BX_UNUSED(_thread);
+
+		EncoderThread& et = *(EncoderThread*)_userData;
+
+		for (;;)
+		{
+			et.m_start.wait();
+
+			if (NULL == et.m_workload)
+			{
+				break;
+			}
+
+			bgfx::Encoder* encoder = bgfx::begin(true);
+			if (NULL != encoder)
+			{
+				et.m_workload->submit(encoder, et.m_encoderIdx, et.m_numEncoders);
+				bgfx::end(encoder);
+			}
+
+			et.m_done.post();
+		}
+
+		return bx::kExitSuccess;
+	}
+
+	Workload*     m_workload;
+	uint32_t      m_encoderIdx;
+	uint32_t      m_numEncoders;
+	bx::Semaphore m_start;
+	bx::Semaphore m_done;
+	bx::Thread    m_thread;
+};
+
+struct PhaseStats
+{
+	double avg;
+	double min;
+	double max;
+	double median;
+};
+
+static int32_t compareTime(const void* _lhs, const void* _rhs)
+{
+	const int64_t lhs = *(const int64_t*)_lhs;
+	const int64_t rhs = *(const int64_t*)_rhs;
+	return lhs < rhs ? -1 : (lhs > rhs ? 1 : 0);
+}
+
+static PhaseStats computeStats(int64_t* _samples, uint32_t _num)
+{
+	const double toMs = 1000.0/double(bx::getHPFrequency() );
+
+	bx::quickSort(_samples, _num, sizeof(int64_t), compareTime);
+
+	int64_t total = 0;
+	for (uint32_t ii = 0; ii < _num; ++ii)
+	{
+		total += _samples[ii];
+	}
+
+	PhaseStats stats;
+	stats.avg    = double(total)*toMs/double(_num);
+	stats.min    = double(_samples[0])*toMs;
+	stats.max    = double(_samples[_num-1])*toMs;
+	stats.median = double(_samples[_num/2])*toMs;
+	return stats;
+}
+
+static void runWorkload(
+	  bx::WriterI* _writer
+	, bx::Error* _err
+	, BenchCallback& _callback
+	, Workload& _workload
+	, EncoderThread* _threads
+	, bgfx::ProgramHandle _program
+	, const bgfx::VertexLayout& _layout
+	, const Options& _options
+	, bool _first
+	)
+{
+	_workload.init(_program, _layout);
+
+	const uint32_t numEncoders = bx::uint32_clamp(_workload.getNumEncoders(), 1, BGFX_BENCH_MAX_ENCODERS);
+	const uint32_t numFrames   = _options.numWarmup + _options.numFrames;
+
+	int64_t* samples = new int64_t[Phase::Count*_options.numFrames];
+
+	for (uint32_t frame = 0; frame < numFrames; ++frame)
+	{
+		const int64_t submitBegin = bx::getHPCounter();
+
+		_workload.beginFrame();
+
+		for (uint32_t ii = 1; ii < numEncoders; ++ii)
+		{
+			EncoderThread& et = _threads[ii-1];
+			et.m_workload    = &_workload;
+			et.m_encoderIdx  = ii;
+			et.m_numEncoders = numEncoders;
+			et.m_start.post();
+		}
+
+		// API thread is first encoder.
+		_workload.submit(bgfx::begin(), 0, numEncoders);
+
+		for (uint32_t ii = 1; ii < numEncoders; ++ii)
+		{
+			_threads[ii-1].m_done.wait();
+		}
+
+		const int64_t frameBegin = bx::getHPCounter();
+
+		_callback.reset();
+		bgfx::frame();
+
+		const int64_t frameEnd = bx::getHPCounter();
+
+		if (frame >= _options.numWarmup)
+		{
+			const uint32_t sample = frame - _options.numWarmup;
+
+			int64_t time[Phase::Count];
+			bx::memCopy(time, _callback.m_time, sizeof(time) );
+			time[Phase::Submit   ] = frameBegin - submitBegin;
+			time[Phase::Cull     ] = _workload.m_cullTime;
+			time[Phase::Occlusion] = _workload.m_occlusionTime;
+			time[Phase::Frame    ] = frameEnd   - frameBegin;
+
+			for (uint32_t phase = 0; phase < Phase::Count; ++phase)
+			{
+				samples[phase*_options.numFrames + sample] = time[phase];
+			}
+		}
+	}
+
+	_workload.shutdown();
+	bgfx::frame();
+
+	bx::write(_writer, _err
+		, "%s\t\t{\n"
+		  "\t\t\t\"name\": \"%s\",\n"
+		  "\t\t\t\"encoders\": %d,\n"
+		  "\t\t\t\"drawsPerFrame\": %d,\n"
+		  "\t\t\t\"phases\": {\n"
+		, _first ? "" : ",\n"
+		, _workload.m_name
+		, numEncoders
+		, _workload.getNumDraws()
+		);
+
+	for (uint32_t phase = 0; phase < Phase::Count; ++phase)
+	{
+		const PhaseStats stats = computeStats(&samples[phase*_options.numFrames], _options.numFrames);
+
+		bx::write(_writer, _err
+			, "\t\t\t\t\"%s\": { \"avg\": %.6f, \"min\": %.6f, \"max\": %.6f, \"median\": %.6f }%s\n"
+			, s_phaseName[phase]
+			, stats.avg
+			, stats.min
+			, stats.max
+			, stats.median
+			, phase == Phase::Count-1 ? "" : ","
+			);
+	}
+
+	bx::write(_writer, _err, "\t\t\t}\n\t\t}");
+
+	delete [] samples;
+}
+
+void help(const char* _error = NULL)
+{
+	if (NULL != _error)
+	{
+		bx::printf("Error:\n%s\n\n", _error);
+	}
+
+	bx::printf(
+		  "bench, bgfx CPU overhead benchmark, version %d.%d.%d.\n"
+		  "Copyright 2011-2022 Branimir Karadzic. All rights reserved.\n"
+		  "License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE\n\n"
+		, BGFX_BENCH_VERSION_MAJOR
+		, BGFX_BENCH_VERSION_MINOR
+		, BGFX_API_VERSION
+		);
+
+	bx::printf(
+		  "Usage: bench [-o <out>] [--workload <name>]\n"
+
+		  "\n"
+		  "Runs synthetic workloads through noop renderer without window, and reports\n"
+		  "per-phase CPU timings in milliseconds as JSON. Per-phase renderer timings\n"
+		  "(sort, swap, rendererExecCommands, rendererSubmit) require bgfx built with\n"
+		  "BGFX_CONFIG_PROFILER=1 (genie --with-profiler).\n"
+
+		  "\n"
+		  "Options:\n"
+		  "  -h, --help               Help.\n"
+		  "  -v, --version            Version information only.\n"
+		  "  -o <file path>           Output JSON file path (default stdout).\n"
+		  "      --workload <name>    Run only one workload: draws, uniforms, dynamic, transient,\n"
+		  "                           textures, cull-simd, cull-bvh, occlusion.\n"
+		  "      --frames <num>       Number of measured frames (default 300).\n"
+		  "      --warmup <num>       Number of warmup frames (default 30).\n"
+		  "      --draws <num>        Number of draws per view (default 10000).\n"
+		  "      --views <num>        Number of views (default 4).\n"
+		  "      --encoders <num>     Number of encoders, 1-%d (default 1).\n"
+		  "      --uniforms <num>     Number of vec4 uniforms per draw (default 8).\n"
+		  "      --dynamic <num>      Number of dynamic buffers updated per frame (default 256).\n"
+		  "      --transient <num>    Number of transient buffer allocations per frame (default 1000).\n"
+		  "      --textures <num>     Number of textures created per frame (default 64).\n"
+		  "      --instances <num>    Number of instances culled per frame (default 100000).\n"
+		  "      --raster-threads <num>\n"
+		  "                           Number of occlusion rasterizer threads (default 4).\n"
+
+		  "\n"
+		  "For additional information, see https://github.com/bkaradzic/bgfx\n"
+		, BGFX_BENCH_MAX_ENCODERS
+		);
+}
+
+int main(int _argc, const char* _argv[])
+{
+	bx::CommandLine cmdLine(_argc, _argv);
+
+	if (cmdLine.hasArg('v', "version") )
+	{
+		bx::printf(
+			"bench, bgfx CPU overhead benchmark, version %d.%d.%d.\n"
+			, BGFX_BENCH_VERSION_MAJOR
+			, BGFX_BENCH_VERSION_MINOR
+			, BGFX_API_VERSION
+			);
+		return bx::kExitSuccess;
+	}
+
+	if (cmdLine.hasArg('h', "help") )
+	{
+		help();
+		return bx::kExitFailure;
+	}
+
+	Options options;
+	cmdLine.hasArg(options.numFrames,    '\0', "frames");
+	cmdLine.hasArg(options.numWarmup,    '\0', "warmup");
+	cmdLine.hasArg(options.numDraws,     '\0', "draws");
+	cmdLine.hasArg(options.numViews,     '\0', "views");
+	cmdLine.hasArg(options.numEncoders,  '\0', "encoders");
+	cmdLine.hasArg(options.numUniforms,  '\0', "uniforms");
+	cmdLine.hasArg(options.numDynamic,   '\0', "dynamic");
+	cmdLine.hasArg(options.numTransient, '\0', "transient");
+	cmdLine.hasArg(options.numTextures,  '\0', "textures");
+	cmdLine.hasArg(options.numInstances, '\0', "instances");
+	cmdLine.hasArg(options.numRasterThreads, '\0', "raster-threads");
+	options.workload = cmdLine.findOption("workload");
+
+	options.numFrames   = bx::max<uint32_t>(options.numFrames, 1);
+	options.numViews    = bx::uint32_clamp(options.numViews, 1, 256);
+	options.numEncoders = bx::uint32_clamp(options.numEncoders, 1, BGFX_BENCH_MAX_ENCODERS);
+	options.numUniforms = bx::uint32_clamp(options.numUniforms, 1, UINT16_MAX);
+	options.numRasterThreads = bx::uint32_clamp(options.numRasterThreads, 1, 64);
+
+	DrawWorkload      draws(options);
+	UniformWorkload   uniforms(options);
+	DynamicWorkload   dynamic(options);
+	TransientWorkload transient(options);
+	TextureWorkload   textures(options);
+	CullWorkload      cullSimd("cull-simd", options, false);
+	CullWorkload      cullBvh("cull-bvh", options, true);
+	OcclusionWorkload occlusion(options);
+
+	Workload* workloads[] =
+	{
+		&draws,
+		&uniforms,
+		&dynamic,
+		&transient,
+		&textures,
+		&cullSimd,
+		&cullBvh,
+		&occlusion,
+	};
+
+	bool found = NULL == options.workload;
+	for (uint32_t ii = 0; ii < BX_COUNTOF(workloads) && !found; ++ii)
+	{
+		found = 0 == bx::strCmpI(options.workload, workloads[ii]->m_name);
+	}
+
+	if (!found)
+	{
+		help("Invalid workload name.");
+		return bx::kExitFailure;
+	}
+
+	BenchCallback callback;
+
+	// Calling renderFrame before init makes bgfx single threaded, so that renderer side of
+	// the frame is measured on API thread without render thread scheduling noise.
+	bgfx::renderFrame();
+
+	bgfx::Init init;
+	init.type               = bgfx::RendererType::Noop;
+	init.resolution.width   = 1280;
+	init.resolution.height  = 720;
+	init.resolution.reset   = BGFX_RESET_NONE;
+	init.limits.maxEncoders = uint16_t(options.numEncoders);
+	init.callback           = &callback;
+
+	if (!bgfx::init(init) )
+	{
+		bx::printf("Failed to initialize renderer.\n");
+		return bx::kExitFailure;
+	}
+
+	for (uint32_t ii = 0; ii < options.numViews; ++ii)
+	{
+		bgfx::setViewRect(bgfx::ViewId(ii), 0, 0, bgfx::BackbufferRatio::Equal);
+		bgfx::setViewClear(bgfx::ViewId(ii), BGFX_CLEAR_COLOR|BGFX_CLEAR_DEPTH, 0x303030ff);
+	}
+
+	bgfx::VertexLayout layout;
+	layout
+		.begin()
+		.add(bgfx::Attrib::Position, 3, bgfx::AttribType::Float)
+		.add(bgfx::Attrib::Color0,   4, bgfx::AttribType::Uint8, true)
+		.end();
+
+	bgfx::ProgramHandle program = bgfx::createProgram(
+		  createNullShader('V')
+		, createNullShader('F')
+		, true
+		);
+
+	// Flush view setup, and detect whether bgfx was built with profiler.
+	bgfx::frame();
+
+	EncoderThread* threads = new EncoderThread[BGFX_BENCH_MAX_ENCODERS-1];
+	for (uint32_t ii = 0; ii < options.numEncoders-1; ++ii)
+	{
+		threads[ii].m_workload = NULL;
+		threads[ii].m_thread.init(EncoderThread::threadFunc, &threads[ii], 0, "bench encoder");
+	}
+
+	bx::DefaultAllocator allocator;
+	bx::MemoryBlock mb(&allocator);
+	bx::MemoryWriter writer(&mb);
+	bx::Error err;
+
+	bx::write(&writer, &err
+		, "{\n"
+		  "\t\"version\": %d,\n"
+		  "\t\"renderer\": \"%s\",\n"
+		  "\t\"profiler\": %s,\n"
+		  "\t\"frames\": %d,\n"
+		  "\t\"warmup\": %d,\n"
+		  "\t\"views\": %d,\n"
+		  "\t\"workloads\": [\n"
+		, BGFX_API_VERSION
+		, bgfx::getRendererName(bgfx::getRendererType() )
+		, 0 != callback.m_numEvents ? "true" : "false"
+		, options.numFrames
+		, options.numWarmup
+		, options.numViews
+		);
+
+	bool first = true;
+	for (uint32_t ii = 0; ii < BX_COUNTOF(workloads); ++ii)
+	{
+		if (NULL == options.workload
+		||  0 == bx::strCmpI(options.workload, workloads[ii]->m_name) )
+		{
+			runWorkload(&writer, &err, callback, *workloads[ii], threads, program, layout, options, first);
+			first = false;
+		}
+	}
+
+	bx::write(&writer, &err, "\n\t]\n}\n");
+
+	for (uint32_t ii = 0; ii < options.numEncoders-1; ++ii)
+	{
+		threads[ii].m_workload = NULL;
+		threads[ii].m_start.post();
+		threads[ii].m_thread.shutdown();
+	}
+
+	delete [] threads;
+
+	bgfx::destroy(program);
+	bgfx::shutdown();
+
+	const char* json = (const char*)mb.more();
+	const int32_t size = int32_t(writer.seek(0, bx::Whence::Current) );
+
+	const char* outFilePath = cmdLine.findOption('o');
+	if (NULL != outFilePath)
+	{
+		bx::FileWriter fw;
+		if (!bx::open(&fw, outFilePath, false, &err) )
+		{
+			bx::printf("Unable to open output file \"%s\".\n", outFilePath);
+			return bx::kExitFailure;
+		}
+
+		bx::write(&fw, json, size, &err);
+		bx::close(&fw);
+	}
+	else
+	{
+		bx::printf("%.*s", size, json);
+	}
+
+	return err.isOk()
+		? bx::kExitSuccess
+		: bx::kExitFailure
+		;
+}
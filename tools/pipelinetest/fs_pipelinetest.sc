@@ -0,0 +1,13 @@
+/*
+ * Copyright 2011-2022 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include <bgfx_shader.sh>
+
+uniform vec4 u_color;
+
+void main()
+{
+	gl_FragColor = u_color;
+}
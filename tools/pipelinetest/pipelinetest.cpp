@@ -0,0 +1,283 @@
+/*
+ * Copyright 2011-2022 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include <bx/commandline.h>
+#include <bx/os.h>
+#include <bx/string.h>
+#include <bgfx/bgfx.h>
+#include <bgfx/platform.h>
+
+#include "vs_pipelinetest.bin.h"
+#include "fs_pipelinetest.bin.h"
+
+#define BGFX_PIPELINETEST_VERSION_MAJOR 1
+#define BGFX_PIPELINETEST_VERSION_MINOR 0
+
+// Draws are scissored to single pixel each, pixel x is draw index.
+static const uint16_t kWidth  = 4;
+static const uint16_t kHeight = 1;
+
+static const uint32_t kMaxWarmupFrames = 1000;
+
+static const bgfx::ViewId kViewDraw = 0;
+static const bgfx::ViewId kViewBlit = 1;
+
+static const float s_red[4]   = { 1.0f, 0.0f, 0.0f, 1.0f };
+static const float s_green[4] = { 0.0f, 1.0f, 0.0f, 1.0f };
+static const float s_clear[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+struct PosVertex
+{
+	float m_x;
+	float m_y;
+	float m_z;
+
+	static void init()
+	{
+		ms_layout
+			.begin()
+			.add(bgfx::Attrib::Position, 3, bgfx::AttribType::Float)
+			.end();
+	}
+
+	static bgfx::VertexLayout ms_layout;
+};
+
+bgfx::VertexLayout PosVertex::ms_layout;
+
+struct Context
+{
+	bgfx::ProgramHandle program;
+	bgfx::UniformHandle u_color;
+	bgfx::FrameBufferHandle fb;
+	bgfx::TextureHandle readBack;
+	uint8_t pixels[kWidth*kHeight*4];
+};
+
+void help(const char* _error = NULL)
+{
+	if (NULL != _error)
+	{
+		bx::printf("Error:\n%s\n\n", _error);
+	}
+
+	bx::printf(
+		  "pipelinetest, bgfx Vulkan pipeline compile test, version %d.%d.%d.\n"
+		  "Copyright 2011-2022 Branimir Karadzic. All rights reserved.\n"
+		  "License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE\n\n"
+		, BGFX_PIPELINETEST_VERSION_MAJOR
+		, BGFX_PIPELINETEST_VERSION_MINOR
+		, BGFX_API_VERSION
+		);
+
+	bx::printf(
+		  "Usage: pipelinetest\n"
+
+		  "\n"
+		  "Checks that uniforms set on draw call skipped while its pipeline is compiled are used\n"
+		  "by following draw calls. Requires bgfx built with\n"
+		  "BGFX_CONFIG_PIPELINE_SKIP_DRAW_UNTIL_READY=1 and Vulkan device, runs without window.\n"
+
+		  "\n"
+		  "Options:\n"
+		  "  -h, --help               Help.\n"
+		  "  -v, --version            Version information only.\n"
+
+		  "\n"
+		  "For additional information, see https://github.com/bkaradzic/bgfx\n"
+		);
+}
+
+static void submitPixel(const Context& _ctx, uint16_t _x, uint64_t _state, const float* _color)
+{
+	bgfx::TransientVertexBuffer tvb;
+	bgfx::allocTransientVertexBuffer(&tvb, 3, PosVertex::ms_layout);
+
+	// Full screen triangle.
+	PosVertex* vertex = (PosVertex*)tvb.data;
+	vertex[0] = { -1.0f, -1.0f, 0.0f };
+	vertex[1] = {  3.0f, -1.0f, 0.0f };
+	vertex[2] = { -1.0f,  3.0f, 0.0f };
+
+	if (NULL != _color)
+	{
+		bgfx::setUniform(_ctx.u_color, _color);
+	}
+
+	bgfx::setScissor(_x, 0, 1, 1);
+	bgfx::setVertexBuffer(0, &tvb);
+	bgfx::setState(_state);
+	bgfx::submit(kViewDraw, _ctx.program);
+}
+
+static void readPixels(Context& _ctx)
+{
+	bgfx::blit(kViewBlit, _ctx.readBack, 0, 0, bgfx::getTexture(_ctx.fb) );
+
+	const uint32_t frame = bgfx::readTexture(_ctx.readBack, _ctx.pixels);
+	while (bgfx::frame() < frame)
+	{
+	}
+}
+
+static bool isPixel(const Context& _ctx, uint16_t _x, const float* _color)
+{
+	const uint8_t* pixel = &_ctx.pixels[_x*4];
+
+	for (uint32_t ii = 0; ii < 4; ++ii)
+	{
+		if (pixel[ii] != uint8_t(_color[ii]*255.0f) )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void printPixel(const Context& _ctx, uint16_t _x)
+{
+	const uint8_t* pixel = &_ctx.pixels[_x*4];
+	bx::printf("Pixel %d: %3d %3d %3d %3d\n", _x, pixel[0], pixel[1], pixel[2], pixel[3]);
+}
+
+static bool test(Context& _ctx)
+{
+	const uint64_t state = 0
+		| BGFX_STATE_WRITE_RGB
+		| BGFX_STATE_WRITE_A
+		;
+
+	// Same output as state, but it's different pipeline that was never used before.
+	const uint64_t stateNew = state
+		| BGFX_STATE_BLEND_FUNC(BGFX_STATE_BLEND_ONE, BGFX_STATE_BLEND_ZERO)
+		;
+
+	// Wait for pipeline of first draw call to be compiled.
+	uint32_t numFrames = 0;
+	for (; numFrames < kMaxWarmupFrames; ++numFrames)
+	{
+		submitPixel(_ctx, 0, state, s_red);
+		readPixels(_ctx);
+
+		if (isPixel(_ctx, 0, s_red) )
+		{
+			break;
+		}
+
+		bx::sleep(1);
+	}
+
+	if (kMaxWarmupFrames == numFrames)
+	{
+		bx::printf("Pipeline wasn't compiled after %d frames.\n", kMaxWarmupFrames);
+		return false;
+	}
+
+	// Second draw call uses new pipeline and it's skipped. Third draw call doesn't set uniform,
+	// and it must use value set by second draw call.
+	submitPixel(_ctx, 0, state,    s_red);
+	submitPixel(_ctx, 1, stateNew, s_green);
+	submitPixel(_ctx, 2, state,    NULL);
+	readPixels(_ctx);
+
+	if (!isPixel(_ctx, 1, s_clear) )
+	{
+		printPixel(_ctx, 1);
+		bx::printf("Draw call wasn't skipped, bgfx must be built with BGFX_CONFIG_PIPELINE_SKIP_DRAW_UNTIL_READY=1.\n");
+		return false;
+	}
+
+	if (!isPixel(_ctx, 2, s_green) )
+	{
+		printPixel(_ctx, 2);
+		bx::printf("Uniform set on skipped draw call wasn't used by next draw call.\n");
+		return false;
+	}
+
+	return true;
+}
+
+int main(int _argc, const char* _argv[])
+{
+	bx::CommandLine cmdLine(_argc, _argv);
+
+	if (cmdLine.hasArg('v', "version") )
+	{
+		bx::printf(
+			"pipelinetest, bgfx Vulkan pipeline compile test, version %d.%d.%d.\n"
+			, BGFX_PIPELINETEST_VERSION_MAJOR
+			, BGFX_PIPELINETEST_VERSION_MINOR
+			, BGFX_API_VERSION
+			);
+		return bx::kExitSuccess;
+	}
+
+	if (cmdLine.hasArg('h', "help") )
+	{
+		help();
+		return bx::kExitFailure;
+	}
+
+	// Calling renderFrame before init makes bgfx single threaded, draw calls are submitted and
+	// rendered in order by bgfx::frame.
+	bgfx::renderFrame();
+
+	bgfx::Init init;
+	init.type              = bgfx::RendererType::Vulkan;
+	init.resolution.width  = kWidth;
+	init.resolution.height = kHeight;
+	init.resolution.reset  = BGFX_RESET_NONE;
+
+	if (!bgfx::init(init) )
+	{
+		bx::printf("Failed to initialize Vulkan renderer.\n");
+		return bx::kExitFailure;
+	}
+
+	if (0 == (bgfx::getCaps()->supported & BGFX_CAPS_TEXTURE_READ_BACK) )
+	{
+		bgfx::shutdown();
+		bx::printf("Texture read back is not supported.\n");
+		return bx::kExitFailure;
+	}
+
+	PosVertex::init();
+
+	Context ctx;
+	ctx.program = bgfx::createProgram(
+		  bgfx::createShader(bgfx::makeRef(vs_pipelinetest_spv, sizeof(vs_pipelinetest_spv) ) )
+		, bgfx::createShader(bgfx::makeRef(fs_pipelinetest_spv, sizeof(fs_pipelinetest_spv) ) )
+		, true
+		);
+	ctx.u_color  = bgfx::createUniform("u_color", bgfx::UniformType::Vec4);
+	ctx.fb       = bgfx::createFrameBuffer(kWidth, kHeight, bgfx::TextureFormat::RGBA8);
+	ctx.readBack = bgfx::createTexture2D(
+		  kWidth
+		, kHeight
+		, false
+		, 1
+		, bgfx::TextureFormat::RGBA8
+		, BGFX_TEXTURE_BLIT_DST|BGFX_TEXTURE_READ_BACK
+		);
+
+	bgfx::setViewFrameBuffer(kViewDraw, ctx.fb);
+	bgfx::setViewRect(kViewDraw, 0, 0, kWidth, kHeight);
+	bgfx::setViewClear(kViewDraw, BGFX_CLEAR_COLOR, 0x000000ff);
+	bgfx::setViewMode(kViewDraw, bgfx::ViewMode::Sequential);
+
+	const bool ok = test(ctx);
+
+	bgfx::destroy(ctx.readBack);
+	bgfx::destroy(ctx.fb);
+	bgfx::destroy(ctx.u_color);
+	bgfx::destroy(ctx.program);
+	bgfx::frame();
+	bgfx::shutdown();
+
+	bx::printf("%s\n", ok ? "Passed." : "Failed.");
+
+	return ok ? bx::kExitSuccess : bx::kExitFailure;
+}
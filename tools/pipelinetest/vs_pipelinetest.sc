@@ -0,0 +1,13 @@
+$input a_position
+
+/*
+ * Copyright 2011-2022 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include <bgfx_shader.sh>
+
+void main()
+{
+	gl_Position = vec4(a_position, 1.0);
+}
@@ -5,7 +5,12 @@
 
 #include "shaderc.h"
 #include <bx/commandline.h>
+#include <bx/cpu.h>
 #include <bx/filepath.h>
+#include <bx/thread.h>
+#include <bx/timer.h>
+#include <inttypes.h>
+#include <thread>
 
 #define MAX_TAGS 256
 extern "C"
@@ -18,6 +23,13 @@ extern "C"
 #define BGFX_CHUNK_MAGIC_FSH BX_MAKEFOURCC('F', 'S', 'H', BGFX_SHADER_BIN_VERSION)
 #define BGFX_CHUNK_MAGIC_VSH BX_MAKEFOURCC('V', 'S', 'H', BGFX_SHADER_BIN_VERSION)
 
+#define SHADERC_CACHE_VERSION 1
+#define SHADERC_CACHE_MAGIC BX_MAKEFOURCC('S', 'C', 'C', SHADERC_CACHE_VERSION)
+
+#define BGFX_SHADER_VARIANTS_VERSION 2
+#define BGFX_CHUNK_MAGIC_SVA BX_MAKEFOURCC('S', 'V', 'A', BGFX_SHADER_VARIANTS_VERSION)
+#define SHADERC_MAX_VARIANTS (64<<10)
+
 #define BGFX_SHADERC_VERSION_MAJOR 1
 #define BGFX_SHADERC_VERSION_MINOR 18
 
@@ -348,6 +360,7 @@ namespace bgfx
 		, backwardsCompatibility(false)
 		, warningsAreErrors(false)
 		, keepIntermediate(false)
+		, uniformBuffer(false)
 		, optimize(false)
 		, optimizationLevel(3)
 	{
@@ -361,6 +374,7 @@ namespace bgfx
 			"\t  profile: %s\n"
 			"\t  inputFile: %s\n"
 			"\t  outputFile: %s\n"
+			"\t  cacheDir: %s\n"
 			"\t  disasm: %s\n"
 			"\t  raw: %s\n"
 			"\t  preprocessOnly: %s\n"
@@ -373,6 +387,7 @@ namespace bgfx
 			"\t  backwardsCompatibility: %s\n"
 			"\t  warningsAreErrors: %s\n"
 			"\t  keepIntermediate: %s\n"
+			"\t  uniformBuffer: %s\n"
 			"\t  optimize: %s\n"
 			"\t  optimizationLevel: %d\n"
 
@@ -381,6 +396,7 @@ namespace bgfx
 			, profile.c_str()
 			, inputFilePath.c_str()
 			, outputFilePath.c_str()
+			, cacheDir.c_str()
 			, disasm ? "true" : "false"
 			, raw ? "true" : "false"
 			, preprocessOnly ? "true" : "false"
@@ -393,6 +409,7 @@ namespace bgfx
 			, backwardsCompatibility ? "true" : "false"
 			, warningsAreErrors ? "true" : "false"
 			, keepIntermediate ? "true" : "false"
+			, uniformBuffer ? "true" : "false"
 			, optimize ? "true" : "false"
 			, optimizationLevel
 			);
@@ -1007,6 +1024,9 @@ namespace bgfx
 			  "  -f <file path>                Input file path.\n"
 			  "  -i <include path>             Include path (for multiple paths use -i multiple times).\n"
 			  "  -o <file path>                Output file path.\n"
+			  "      --batch <targets>         Compile for multiple targets concurrently, and write all outputs. Targets are\n"
+			  "                                semicolon separated list of [<platform>:]<profile>=<file path> (-o is ignored).\n"
+			  "      --cache <dir path>        Reuse compiled shaders from content addressed cache directory.\n"
 			  "      --bin2c [array name]      Generate C header file. If array name is not specified base file name will be used as name.\n"
 			  "      --depends                 Generate makefile style depends file.\n"
 			  "      --platform <platform>     Target platform.\n"
@@ -1040,11 +1060,15 @@ namespace bgfx
 		}
 
 		bx::printf(
+			  "  -j, --jobs <num>              Number of threads used with --batch and --variants (default number of CPU cores).\n"
 			  "      --preprocess              Preprocess only.\n"
 			  "      --define <defines>        Add defines to preprocessor (semicolon separated).\n"
 			  "      --raw                     Do not process shader. No preprocessor, and no glsl-optimizer (GLSL only).\n"
 			  "      --type <type>             Shader type (vertex, fragment, compute)\n"
+			  "      --uniform-buffer          Pack uniforms into std140 uniform block (GLSL 410 and above only).\n"
 			  "      --varyingdef <file path>  Path to varying.def.sc file.\n"
+			  "      --variants <file path>    Compile all define permutations from variant manifest file into single\n"
+			  "                                archive. Variants with identical preprocessed source share shader binary.\n"
 			  "      --verbose                 Verbose.\n"
 
 			  "\n"
@@ -1068,7 +1092,283 @@ namespace bgfx
 		return word;
 	}
 
-	bool compileShader(const char* _varying, const char* _comment, char* _shader, uint32_t _shaderLen, Options& _options, bx::FileWriter* _writer)
+	// Moves top level vec4/mat3/mat4 uniform declarations into instanced std140
+	// uniform block, GL renderer sources it from uniform buffer range per draw.
+	std::string packUniformBlock(const std::string& _code, char _shaderType)
+	{
+		const bool fragment = 'f' == _shaderType;
+		const char* blockName = fragment ? "bgfx_FsUniforms" : "bgfx_VsUniforms";
+		const char* instance  = fragment ? "bgfx_fs"         : "bgfx_vs";
+
+		std::string out;
+		std::string members;
+		std::string defines;
+		size_t blockPos = std::string::npos;
+
+		bx::LineReader reader(_code.c_str() );
+		while (!reader.isDone() )
+		{
+			const bx::StringView line = reader.next();
+
+			bx::StringView parse = line;
+			bool member = 0 == bx::strCmp(nextWord(parse), "uniform");
+
+			bx::StringView type = nextWord(parse);
+			if (0 == bx::strCmp(type, "lowp")
+			||  0 == bx::strCmp(type, "mediump")
+			||  0 == bx::strCmp(type, "highp") )
+			{
+				type = nextWord(parse);
+			}
+
+			const bx::StringView name = nextWord(parse);
+			const bx::StringView rest = bx::strRTrimSpace(parse);
+
+			member = member
+				&& (  0 == bx::strCmp(type, "vec4")
+				   || 0 == bx::strCmp(type, "mat3")
+				   || 0 == bx::strCmp(type, "mat4")
+				   )
+				&& !name.isEmpty()
+				&& !rest.isEmpty()
+				&& ';' == rest.getTerm()[-1]
+				&& (1 == rest.getLength() || '[' == rest.getPtr()[0])
+				&& bx::strFind(rest, ',').isEmpty()
+				&& bx::strFind(rest, '=').isEmpty()
+				;
+
+			if (member)
+			{
+				if (std::string::npos == blockPos)
+				{
+					blockPos = out.size();
+				}
+
+				members.append("\t");
+				members.append(type.getPtr(), type.getLength() );
+				members.append(" ");
+				members.append(name.getPtr(), name.getLength() );
+				members.append(rest.getPtr(), rest.getLength() );
+				members.append("\n");
+
+				bx::stringPrintf(defines, "#define %.*s %s.%.*s\n"
+					, name.getLength(), name.getPtr()
+					, instance
+					, name.getLength(), name.getPtr()
+					);
+			}
+			else
+			{
+				out.append(line.getPtr(), line.getLength() );
+				out.append("\n");
+			}
+		}
+
+		if (!members.empty() )
+		{
+			std::string block;
+			bx::stringPrintf(block, "layout(std140) uniform %s\n{\n", blockName);
+			block += members;
+			bx::stringPrintf(block, "} %s;\n", instance);
+			block += defines;
+
+			out.insert(blockPos, block);
+		}
+
+		return out;
+	}
+
+	class TeeWriter : public bx::WriterI
+	{
+	public:
+		TeeWriter(bx::WriterI* _writer)
+			: m_writer(_writer)
+		{
+		}
+
+		virtual ~TeeWriter()
+		{
+		}
+
+		virtual int32_t write(const void* _data, int32_t _size, bx::Error* _err) override
+		{
+			const uint8_t* data = (const uint8_t*)_data;
+			m_buffer.insert(m_buffer.end(), data, data+_size);
+
+			if (NULL == m_writer)
+			{
+				return _size;
+			}
+
+			return bx::write(m_writer, _data, _size, _err);
+		}
+
+		bx::WriterI* m_writer;
+		std::vector<uint8_t> m_buffer;
+	};
+
+	struct ShaderCacheHash
+	{
+		void begin()
+		{
+			m_murmur.begin();
+			m_crc32.begin();
+		}
+
+		void add(const void* _data, int32_t _len)
+		{
+			m_murmur.add(_data, _len);
+			m_crc32.add(_data, _len);
+		}
+
+		void add(const std::string& _str)
+		{
+			add(_str.c_str(), int32_t(_str.size()+1) );
+		}
+
+		template<typename Ty>
+		void add(Ty _value)
+		{
+			add(&_value, sizeof(Ty) );
+		}
+
+		uint64_t end()
+		{
+			return (uint64_t(m_murmur.end() ) << 32) | m_crc32.end();
+		}
+
+		bx::HashMurmur2A m_murmur;
+		bx::HashCrc32    m_crc32;
+	};
+
+	uint64_t shaderCacheKey(const Options& _options, const char* _varying, const char* _data)
+	{
+		// Preprocessed source already contains contents of all included
+		// files, any change in dependencies results in different key.
+		ShaderCacheHash hash;
+		hash.begin();
+		hash.add(uint32_t(SHADERC_CACHE_MAGIC) );
+		hash.add(uint32_t(BGFX_SHADERC_VERSION_MAJOR) );
+		hash.add(uint32_t(BGFX_SHADERC_VERSION_MINOR) );
+		hash.add(uint32_t(BGFX_API_VERSION) );
+		hash.add(uint32_t(BGFX_SHADER_BIN_VERSION) );
+		hash.add(_options.shaderType);
+		hash.add(_options.platform);
+		hash.add(_options.profile);
+
+		for (size_t ii = 0; ii < _options.defines.size(); ++ii)
+		{
+			hash.add(_options.defines[ii]);
+		}
+
+		hash.add(_options.disasm);
+		hash.add(_options.raw);
+		hash.add(_options.debugInformation);
+		hash.add(_options.avoidFlowControl);
+		hash.add(_options.noPreshader);
+		hash.add(_options.partialPrecision);
+		hash.add(_options.preferFlowControl);
+		hash.add(_options.backwardsCompatibility);
+		hash.add(_options.warningsAreErrors);
+		hash.add(_options.uniformBuffer);
+		hash.add(_options.optimize);
+		hash.add(_options.optimizationLevel);
+
+		if (NULL != _varying)
+		{
+			hash.add(_varying, bx::strLen(_varying) );
+		}
+
+		hash.add(_data, bx::strLen(_data) );
+
+		return hash.end();
+	}
+
+	std::string shaderCacheFilePath(const Options& _options, uint64_t _key)
+	{
+		char temp[32];
+		bx::snprintf(temp, BX_COUNTOF(temp), "%016" PRIx64 ".bin", _key);
+
+		bx::FilePath filePath(_options.cacheDir.c_str() );
+		filePath.join(temp);
+
+		return filePath.getCPtr();
+	}
+
+	bool shaderCacheRead(const Options& _options, uint64_t _key, bx::WriterI* _writer)
+	{
+		const std::string filePath = shaderCacheFilePath(_options, _key);
+
+		bx::FileReader reader;
+		if (!bx::open(&reader, filePath.c_str() ) )
+		{
+			return false;
+		}
+
+		bx::Error err;
+
+		uint32_t magic = 0;
+		uint64_t key   = 0;
+		uint32_t size  = 0;
+		bx::read(&reader, magic, &err);
+		bx::read(&reader, key,   &err);
+		bx::read(&reader, size,  &err);
+
+		bool result = false;
+
+		if (err.isOk()
+		&&  SHADERC_CACHE_MAGIC == magic
+		&&  _key == key
+		&&  int64_t(size) == bx::getRemain(&reader) )
+		{
+			uint8_t* data = new uint8_t[size];
+			bx::read(&reader, data, size, &err);
+
+			if (err.isOk() )
+			{
+				bx::write(_writer, data, size, bx::ErrorAssert{});
+				result = true;
+			}
+
+			delete [] data;
+		}
+
+		bx::close(&reader);
+
+		return result;
+	}
+
+	void shaderCacheWrite(const Options& _options, uint64_t _key, const std::vector<uint8_t>& _data)
+	{
+		bx::Error err;
+		bx::makeAll(_options.cacheDir.c_str(), &err);
+
+		const std::string filePath = shaderCacheFilePath(_options, _key);
+
+		// Write to temporary file and rename it, so that concurrent shaderc
+		// processes never observe partially written entry.
+		char temp[32];
+		bx::snprintf(temp, BX_COUNTOF(temp), ".%016" PRIx64 ".tmp", bx::getHPCounter() );
+		const std::string tempFilePath = filePath + temp;
+
+		bx::FileWriter writer;
+		if (bx::open(&writer, tempFilePath.c_str(), false, &err) )
+		{
+			bx::write(&writer, uint32_t(SHADERC_CACHE_MAGIC), &err);
+			bx::write(&writer, _key, &err);
+			bx::write(&writer, uint32_t(_data.size() ), &err);
+			bx::write(&writer, _data.data(), int32_t(_data.size() ), &err);
+			bx::close(&writer);
+
+			if (!err.isOk()
+			||  0 != ::rename(tempFilePath.c_str(), filePath.c_str() ) )
+			{
+				bx::remove(tempFilePath.c_str() );
+			}
+		}
+	}
+
+	bool compileShader(const char* _varying, const char* _comment, char* _shader, uint32_t _shaderLen, Options& _options, bx::WriterI* _writer)
 	{
 		uint32_t profile_id = 0;
 
@@ -1449,6 +1749,43 @@ namespace bgfx
 			}
 		}
 
+		const bool useCache = true
+			&& !_options.cacheDir.empty()
+			&& !_options.preprocessOnly
+			;
+
+		uint64_t cacheKey = 0;
+		TeeWriter cacheWriter(_writer);
+
+		if (useCache)
+		{
+			cacheKey = shaderCacheKey(_options, _varying, data);
+
+			if (shaderCacheRead(_options, cacheKey, _writer) )
+			{
+				if (g_verbose)
+				{
+					bx::printf("Cache hit %016" PRIx64 " '%s'.\n", cacheKey, _options.outputFilePath.c_str() );
+				}
+
+				if (_options.depends)
+				{
+					std::string ofp = _options.outputFilePath + ".d";
+					bx::FileWriter writer;
+					if (bx::open(&writer, ofp.c_str() ) )
+					{
+						writef(&writer, "%s : %s\n", _options.outputFilePath.c_str(), preprocessor.m_depends.c_str() );
+						bx::close(&writer);
+					}
+				}
+
+				delete [] data;
+				return true;
+			}
+
+			_writer = &cacheWriter;
+		}
+
 		bool invalidShaderAttribute = false;
 		if ('v' == _options.shaderType)
 		{
@@ -2527,7 +2864,15 @@ namespace bgfx
 							if ( (profile->lang == ShadingLang::GLSL && glsl_profile > 400)
 							||   (profile->lang == ShadingLang::ESSL && glsl_profile > 300) )
 							{
-								code += preprocessor.m_preprocessed;
+								if (_options.uniformBuffer
+								&&  profile->lang == ShadingLang::GLSL)
+								{
+									code += packUniformBlock(preprocessor.m_preprocessed, _options.shaderType);
+								}
+								else
+								{
+									code += preprocessor.m_preprocessed;
+								}
 
 								bx::write(_writer, uint16_t(0), &err);
 
@@ -2592,11 +2937,528 @@ namespace bgfx
 			}
 		}
 
+		if (useCache
+		&&  compiled)
+		{
+			shaderCacheWrite(_options, cacheKey, cacheWriter.m_buffer);
+		}
+
 		delete [] data;
 
 		return compiled;
 	}
 
+	std::string bin2cName(const bx::StringView& _filePath)
+	{
+		std::string name;
+
+		bx::StringView base = baseName(_filePath);
+		for (uint32_t ii = 0, num = base.getLength(); ii < num; ++ii)
+		{
+			const char ch = base.getPtr()[ii];
+			name += bx::isAlphaNum(ch) ? ch : '_';
+		}
+
+		return name;
+	}
+
+	char* copyShader(const char* _data, uint32_t _size)
+	{
+		// compileShader takes ownership of input data, and it requires
+		// padding after the end of source.
+		const size_t padding = 16384;
+		char* data = new char[_size+padding+1];
+		bx::memCopy(data, _data, _size+1);
+		bx::memSet(&data[_size+1], 0, padding);
+
+		return data;
+	}
+
+	typedef void (*ParallelForFn)(uint32_t _idx, void* _userData);
+
+	struct ParallelFor
+	{
+		ParallelForFn fn;
+		void* userData;
+		int32_t num;
+		int32_t next;
+	};
+
+	static int32_t parallelForThreadFunc(bx::Thread* _thread, void* _userData)
+	{
+		BX_UNUSED(_thread);
+
+		ParallelFor& pf = *(ParallelFor*)_userData;
+
+		for (int32_t idx = bx::atomicFetchAndAdd(&pf.next, 1); idx < pf.num; idx = bx::atomicFetchAndAdd(&pf.next, 1) )
+		{
+			pf.fn(uint32_t(idx), pf.userData);
+		}
+
+		return bx::kExitSuccess;
+	}
+
+	void parallelFor(uint32_t _num, uint32_t _numThreads, ParallelForFn _fn, void* _userData)
+	{
+		ParallelFor pf;
+		pf.fn       = _fn;
+		pf.userData = _userData;
+		pf.num      = int32_t(_num);
+		pf.next     = 0;
+
+		const uint32_t numThreads = bx::uint32_clamp(_numThreads, 1, bx::uint32_max(_num, 1) );
+
+		// Calling thread is a worker too.
+		bx::Thread* threads = new bx::Thread[numThreads-1];
+		for (uint32_t ii = 0; ii < numThreads-1; ++ii)
+		{
+			threads[ii].init(parallelForThreadFunc, &pf, 0, "shaderc");
+		}
+
+		parallelForThreadFunc(NULL, &pf);
+
+		for (uint32_t ii = 0; ii < numThreads-1; ++ii)
+		{
+			threads[ii].shutdown();
+		}
+
+		delete [] threads;
+	}
+
+	bool compileShader(const char* _varying, const char* _comment, const char* _data, uint32_t _size, Options& _options, const char* _bin2c)
+	{
+		const char* outFilePath = _options.outputFilePath.c_str();
+
+		bx::FileWriter* writer = NULL;
+
+		std::string bin2c;
+		if (NULL != _bin2c)
+		{
+			bin2c = '\0' != _bin2c[0] ? _bin2c : bin2cName(outFilePath);
+			writer = new Bin2cWriter(bin2c.c_str() );
+		}
+		else
+		{
+			writer = new bx::FileWriter;
+		}
+
+		if (!bx::open(writer, outFilePath) )
+		{
+			bx::printf("Unable to open output file '%s'.\n", outFilePath);
+			delete writer;
+			return false;
+		}
+
+		const bool compiled = compileShader(_varying, _comment, copyShader(_data, _size), _size, _options, writer);
+
+		bx::close(writer);
+		delete writer;
+
+		if (!compiled)
+		{
+			bx::remove(outFilePath);
+		}
+
+		return compiled;
+	}
+
+	struct BatchTarget
+	{
+		Options options;
+		bool compiled;
+	};
+
+	typedef std::vector<BatchTarget> BatchTargetArray;
+
+	struct BatchContext
+	{
+		const char* varying;
+		const char* comment;
+		const char* data;
+		uint32_t size;
+		const char* bin2c;
+		BatchTargetArray* targets;
+	};
+
+	static void compileBatchTarget(uint32_t _idx, void* _userData)
+	{
+		BatchContext& ctx = *(BatchContext*)_userData;
+		BatchTarget& target = (*ctx.targets)[_idx];
+		target.compiled = compileShader(ctx.varying, ctx.comment, ctx.data, ctx.size, target.options, ctx.bin2c);
+	}
+
+	bool parseBatch(BatchTargetArray& _targets, const Options& _options, const char* _batch)
+	{
+		bx::StringView parse(_batch);
+
+		while (!parse.isEmpty() )
+		{
+			bx::StringView eot = bx::strFind(parse, ';');
+			if (eot.isEmpty() )
+			{
+				eot.set(parse.getTerm(), parse.getTerm() );
+			}
+
+			const bx::StringView target = bx::strTrimSpace(bx::StringView(parse.getPtr(), eot.getPtr() ) );
+			parse.set(eot.getPtr() == parse.getTerm() ? eot.getPtr() : eot.getPtr()+1, parse.getTerm() );
+
+			if (target.isEmpty() )
+			{
+				continue;
+			}
+
+			const bx::StringView assign = bx::strFind(target, '=');
+			if (assign.isEmpty() )
+			{
+				bx::printf("Invalid batch target '%.*s', expected [<platform>:]<profile>=<file path>.\n"
+					, target.getLength()
+					, target.getPtr()
+					);
+				return false;
+			}
+
+			BatchTarget bt;
+			bt.options  = _options;
+			bt.compiled = false;
+
+			bx::StringView profile = bx::strTrimSpace(bx::StringView(target.getPtr(), assign.getPtr() ) );
+			const bx::StringView colon = bx::strFind(profile, ':');
+			if (!colon.isEmpty() )
+			{
+				const bx::StringView platform = bx::strTrimSpace(bx::StringView(profile.getPtr(), colon.getPtr() ) );
+				bt.options.platform.assign(platform.getPtr(), platform.getTerm() );
+				profile = bx::strTrimSpace(bx::StringView(colon.getPtr()+1, profile.getTerm() ) );
+			}
+
+			const bx::StringView outFilePath = bx::strTrimSpace(bx::StringView(assign.getPtr()+1, target.getTerm() ) );
+
+			bt.options.profile.assign(profile.getPtr(), profile.getTerm() );
+			bt.options.outputFilePath.assign(outFilePath.getPtr(), outFilePath.getTerm() );
+
+			if (bt.options.outputFilePath.empty() )
+			{
+				bx::printf("Batch target '%.*s' is missing output file path.\n"
+					, target.getLength()
+					, target.getPtr()
+					);
+				return false;
+			}
+
+			_targets.push_back(bt);
+		}
+
+		return !_targets.empty();
+	}
+
+	bool compileBatch(const char* _varying, const char* _comment, const char* _data, uint32_t _size, BatchTargetArray& _targets, const char* _bin2c, uint32_t _numThreads)
+	{
+		BatchContext ctx;
+		ctx.varying = _varying;
+		ctx.comment = _comment;
+		ctx.data    = _data;
+		ctx.size    = _size;
+		ctx.bin2c   = _bin2c;
+		ctx.targets = &_targets;
+
+		parallelFor(uint32_t(_targets.size() ), _numThreads, compileBatchTarget, &ctx);
+
+		bool compiled = true;
+		for (BatchTargetArray::const_iterator it = _targets.begin(), itEnd = _targets.end(); it != itEnd; ++it)
+		{
+			if (!it->compiled)
+			{
+				bx::printf("Failed to build shader '%s' (platform: '%s', profile: '%s').\n"
+					, it->options.outputFilePath.c_str()
+					, it->options.platform.c_str()
+					, it->options.profile.c_str()
+					);
+				compiled = false;
+			}
+		}
+
+		return compiled;
+	}
+
+	typedef std::vector<std::string> DefineArray;
+	typedef std::vector<DefineArray> DefineArrayArray;
+
+	void parseDefines(DefineArray& _defines, const bx::StringView& _str)
+	{
+		bx::StringView parse(_str);
+
+		while (!parse.isEmpty() )
+		{
+			bx::StringView eod = bx::strFind(parse, ';');
+			if (eod.isEmpty() )
+			{
+				eod.set(parse.getTerm(), parse.getTerm() );
+			}
+
+			const bx::StringView define = bx::strTrimSpace(bx::StringView(parse.getPtr(), eod.getPtr() ) );
+			if (!define.isEmpty() )
+			{
+				_defines.push_back(std::string(define.getPtr(), define.getTerm() ) );
+			}
+
+			parse.set(eod.getPtr() == parse.getTerm() ? eod.getPtr() : eod.getPtr()+1, parse.getTerm() );
+		}
+	}
+
+	// Variant manifest contains one define axis per line. Axis alternatives
+	// are separated by '|', and each alternative is a semicolon separated
+	// define list (same as --define). Empty alternative defines nothing.
+	// Text after '#' is comment. For example:
+	//
+	//   # skinning off / on
+	//   | SKINNING
+	//   SHADOW_HARD | SHADOW_PCF | SHADOW_PCF;SHADOW_CASCADES=4
+	//
+	// Variants are cartesian product of all axes, variant index is mixed
+	// radix number where the first axis is the least significant digit.
+	bool parseVariants(DefineArrayArray& _variants, const char* _manifest)
+	{
+		std::vector<DefineArrayArray> axes;
+		uint32_t numVariants = 1;
+
+		bx::LineReader reader(_manifest);
+		while (!reader.isDone() )
+		{
+			bx::StringView line = reader.next();
+
+			const bx::StringView comment = bx::strFind(line, '#');
+			if (!comment.isEmpty() )
+			{
+				line.set(line.getPtr(), comment.getPtr() );
+			}
+
+			line = bx::strTrimSpace(line);
+			if (line.isEmpty() )
+			{
+				continue;
+			}
+
+			DefineArrayArray axis;
+
+			for (;;)
+			{
+				const bx::StringView pipe = bx::strFind(line, '|');
+
+				DefineArray alternative;
+				parseDefines(alternative, pipe.isEmpty() ? line : bx::StringView(line.getPtr(), pipe.getPtr() ) );
+				axis.push_back(alternative);
+
+				if (pipe.isEmpty() )
+				{
+					break;
+				}
+
+				line.set(pipe.getPtr()+1, line.getTerm() );
+			}
+
+			numVariants *= uint32_t(axis.size() );
+			if (numVariants > SHADERC_MAX_VARIANTS)
+			{
+				bx::printf("Too many shader variants, maximum is %d.\n", SHADERC_MAX_VARIANTS);
+				return false;
+			}
+
+			axes.push_back(axis);
+		}
+
+		_variants.resize(numVariants);
+
+		for (uint32_t ii = 0; ii < numVariants; ++ii)
+		{
+			DefineArray& defines = _variants[ii];
+
+			uint32_t digits = ii;
+			for (size_t axis = 0; axis < axes.size(); ++axis)
+			{
+				const uint32_t num = uint32_t(axes[axis].size() );
+				const DefineArray& alternative = axes[axis][digits % num];
+				defines.insert(defines.end(), alternative.begin(), alternative.end() );
+				digits /= num;
+			}
+		}
+
+		return true;
+	}
+
+	struct Variant
+	{
+		Options options;
+		uint64_t hash;
+		uint32_t blob;
+		bool compiled;
+		std::vector<uint8_t> code;
+	};
+
+	typedef std::vector<Variant> VariantArray;
+
+	struct VariantContext
+	{
+		const char* varying;
+		const char* comment;
+		const char* data;
+		uint32_t size;
+		VariantArray* variants;
+		std::vector<uint32_t> unique;
+	};
+
+	static void preprocessVariant(uint32_t _idx, void* _userData)
+	{
+		VariantContext& ctx = *(VariantContext*)_userData;
+		Variant& variant = (*ctx.variants)[_idx];
+
+		Options options = variant.options;
+		options.preprocessOnly = true;
+		options.depends        = false;
+
+		TeeWriter writer(NULL);
+		variant.compiled = compileShader(ctx.varying, ctx.comment, copyShader(ctx.data, ctx.size), ctx.size, options, &writer);
+
+		ShaderCacheHash hash;
+		hash.begin();
+		hash.add(writer.m_buffer.data(), int32_t(writer.m_buffer.size() ) );
+		variant.hash = hash.end();
+	}
+
+	static void compileVariant(uint32_t _idx, void* _userData)
+	{
+		VariantContext& ctx = *(VariantContext*)_userData;
+		Variant& variant = (*ctx.variants)[ctx.unique[_idx] ];
+
+		TeeWriter writer(NULL);
+		variant.compiled = compileShader(ctx.varying, ctx.comment, copyShader(ctx.data, ctx.size), ctx.size, variant.options, &writer);
+		variant.code.swap(writer.m_buffer);
+	}
+
+	// Shader variant archive layout:
+	//
+	//   uint32_t magic;                                 // BGFX_CHUNK_MAGIC_SVA
+	//   uint32_t numVariants;
+	//   uint32_t numBlobs;
+	//   uint32_t variant[numVariants];                  // Blob index of variant.
+	//   struct { uint32_t offset, size; } blob[numBlobs];
+	//   uint8_t  data[];                                // Shader binaries, offset is from start of archive.
+	//
+	bool compileVariants(const char* _varying, const char* _comment, const char* _data, uint32_t _size, const Options& _options, const char* _manifest, uint32_t _numThreads)
+	{
+		DefineArrayArray defines;
+		if (!parseVariants(defines, _manifest) )
+		{
+			return false;
+		}
+
+		VariantArray variants(defines.size() );
+		for (size_t ii = 0; ii < defines.size(); ++ii)
+		{
+			Variant& variant = variants[ii];
+			variant.options = _options;
+			variant.options.defines.insert(variant.options.defines.end(), defines[ii].begin(), defines[ii].end() );
+			variant.hash     = 0;
+			variant.blob     = UINT32_MAX;
+			variant.compiled = false;
+		}
+
+		VariantContext ctx;
+		ctx.varying  = _varying;
+		ctx.comment  = _comment;
+		ctx.data     = _data;
+		ctx.size     = _size;
+		ctx.variants = &variants;
+
+		parallelFor(uint32_t(variants.size() ), _numThreads, preprocessVariant, &ctx);
+
+		// Variants with identical preprocessed source produce identical
+		// shader binary, compile only first one and share the blob.
+		typedef std::unordered_map<uint64_t, uint32_t> HashToBlobMap;
+		HashToBlobMap hashToBlob;
+
+		for (uint32_t ii = 0, num = uint32_t(variants.size() ); ii < num; ++ii)
+		{
+			Variant& variant = variants[ii];
+			if (!variant.compiled)
+			{
+				bx::printf("Failed to preprocess shader variant %d.\n", ii);
+				return false;
+			}
+
+			HashToBlobMap::const_iterator it = hashToBlob.find(variant.hash);
+			if (it == hashToBlob.end() )
+			{
+				variant.blob = uint32_t(ctx.unique.size() );
+				hashToBlob.insert(std::make_pair(variant.hash, variant.blob) );
+				ctx.unique.push_back(ii);
+			}
+			else
+			{
+				variant.blob = it->second;
+			}
+		}
+
+		parallelFor(uint32_t(ctx.unique.size() ), _numThreads, compileVariant, &ctx);
+
+		for (size_t ii = 0; ii < ctx.unique.size(); ++ii)
+		{
+			if (!variants[ctx.unique[ii] ].compiled)
+			{
+				bx::printf("Failed to build shader variant %d.\n", ctx.unique[ii]);
+				return false;
+			}
+		}
+
+		const uint32_t numVariants = uint32_t(variants.size() );
+		const uint32_t numBlobs    = uint32_t(ctx.unique.size() );
+
+		if (g_verbose)
+		{
+			bx::printf("Shader variants: %d, unique: %d.\n", numVariants, numBlobs);
+		}
+
+		bx::FileWriter writer;
+		if (!bx::open(&writer, _options.outputFilePath.c_str() ) )
+		{
+			bx::printf("Unable to open output file '%s'.\n", _options.outputFilePath.c_str() );
+			return false;
+		}
+
+		bx::ErrorAssert err;
+
+		bx::write(&writer, BGFX_CHUNK_MAGIC_SVA, &err);
+		bx::write(&writer, numVariants, &err);
+		bx::write(&writer, numBlobs, &err);
+
+		for (uint32_t ii = 0; ii < numVariants; ++ii)
+		{
+			bx::write(&writer, variants[ii].blob, &err);
+		}
+
+		uint32_t offset = 0
+			+ 3*sizeof(uint32_t)
+			+ numVariants*sizeof(uint32_t)
+			+ numBlobs*2*sizeof(uint32_t)
+			;
+
+		for (uint32_t ii = 0; ii < numBlobs; ++ii)
+		{
+			const uint32_t size = uint32_t(variants[ctx.unique[ii] ].code.size() );
+			bx::write(&writer, offset, &err);
+			bx::write(&writer, size, &err);
+			offset += size;
+		}
+
+		for (uint32_t ii = 0; ii < numBlobs; ++ii)
+		{
+			const std::vector<uint8_t>& code = variants[ctx.unique[ii] ].code;
+			bx::write(&writer, code.data(), int32_t(code.size() ), &err);
+		}
+
+		bx::close(&writer);
+
+		return true;
+	}
+
 	int compileShader(int _argc, const char* _argv[])
 	{
 		bx::CommandLine cmdLine(_argc, _argv);
@@ -2627,13 +3489,24 @@ namespace bgfx
 			return bx::kExitFailure;
 		}
 
+		const char* batch = cmdLine.findOption("batch");
+		const char* variants = cmdLine.findOption("variants");
+
 		const char* outFilePath = cmdLine.findOption('o');
-		if (NULL == outFilePath)
+		if (NULL == outFilePath
+		&&  NULL == batch)
 		{
 			help("Output file name must be specified.");
 			return bx::kExitFailure;
 		}
 
+		if (NULL != variants
+		&&  NULL != batch)
+		{
+			help("--variants and --batch can't be used together.");
+			return bx::kExitFailure;
+		}
+
 		const char* type = cmdLine.findOption('\0', "type");
 		if (NULL == type)
 		{
@@ -2643,7 +3516,7 @@ namespace bgfx
 
 		Options options;
 		options.inputFilePath = filePath;
-		options.outputFilePath = outFilePath;
+		options.outputFilePath = NULL != outFilePath ? outFilePath : "";
 		options.shaderType = bx::toLower(type[0]);
 
 		options.disasm = cmdLine.hasArg('\0', "disasm");
@@ -2674,6 +3547,7 @@ namespace bgfx
 			options.backwardsCompatibility = cmdLine.hasArg('\0', "backwards-compatibility");
 			options.warningsAreErrors      = cmdLine.hasArg('\0', "Werror");
 			options.keepIntermediate       = cmdLine.hasArg('\0', "keep-intermediate");
+			options.uniformBuffer          = cmdLine.hasArg('\0', "uniform-buffer");
 
 			uint32_t optimization = 3;
 			if (cmdLine.hasArg(optimization, 'O') )
@@ -2683,38 +3557,21 @@ namespace bgfx
 			}
 		}
 
-		bx::StringView bin2c;
+		const char* bin2c = NULL;
 		if (cmdLine.hasArg("bin2c") )
 		{
-			const char* bin2cArg = cmdLine.findOption("bin2c");
-			if (NULL != bin2cArg)
+			bin2c = cmdLine.findOption("bin2c");
+			if (NULL == bin2c)
 			{
-				bin2c.set(bin2cArg);
+				// Array name is derived from output file name.
+				bin2c = "";
 			}
-			else
-			{
-				bin2c = baseName(outFilePath);
-				if (!bin2c.isEmpty() )
-				{
-					char* temp = (char*)alloca(bin2c.getLength()+1);
-					for (uint32_t ii = 0, num = bin2c.getLength(); ii < num; ++ii)
-					{
-						char ch = bin2c.getPtr()[ii];
-						if (bx::isAlphaNum(ch) )
-						{
-							temp[ii] = ch;
-						}
-						else
-						{
-							temp[ii] = '_';
-						}
-					}
-
-					temp[bin2c.getLength()] = '\0';
+		}
 
-					bin2c = temp;
-				}
-			}
+		const char* cacheDir = cmdLine.findOption("cache");
+		if (NULL != cacheDir)
+		{
+			options.cacheDir = cacheDir;
 		}
 
 		options.depends = cmdLine.hasArg("depends");
@@ -2807,27 +3664,55 @@ namespace bgfx
 			bx::memSet(&data[size+1], 0, padding);
 			bx::close(&reader);
 
-			bx::FileWriter* writer = NULL;
+			uint32_t numThreads = std::thread::hardware_concurrency();
+			cmdLine.hasArg(numThreads, 'j', "jobs");
 
-			if (!bin2c.isEmpty() )
+			if (NULL != variants)
 			{
-				writer = new Bin2cWriter(bin2c);
-			}
-			else
-			{
-				writer = new bx::FileWriter;
+				File manifest;
+				manifest.load(variants);
+
+				if (NULL == manifest.getData() )
+				{
+					delete [] data;
+					bx::printf("Unable to open variant manifest file '%s'.\n", variants);
+					return bx::kExitFailure;
+				}
+
+				compiled = compileVariants(varying, commandLineComment.c_str(), data, size, options, manifest.getData(), numThreads);
+
+				delete [] data;
+
+				if (!compiled)
+				{
+					bx::remove(outFilePath);
+					bx::printf("Failed to build shader variants.\n");
+					return bx::kExitFailure;
+				}
+
+				return bx::kExitSuccess;
 			}
 
-			if (!bx::open(writer, outFilePath) )
+			if (NULL != batch)
 			{
-				bx::printf("Unable to open output file '%s'.\n", outFilePath);
-				return bx::kExitFailure;
+				BatchTargetArray targets;
+				if (!parseBatch(targets, options, batch) )
+				{
+					delete [] data;
+					help("Invalid batch target list.");
+					return bx::kExitFailure;
+				}
+
+				compiled = compileBatch(varying, commandLineComment.c_str(), data, size, targets, bin2c, numThreads);
+
+				delete [] data;
+
+				return compiled ? bx::kExitSuccess : bx::kExitFailure;
 			}
 
-			compiled = compileShader(varying, commandLineComment.c_str(), data, size, options, writer);
+			compiled = compileShader(varying, commandLineComment.c_str(), data, size, options, bin2c);
 
-			bx::close(writer);
-			delete writer;
+			delete [] data;
 		}
 
 		if (compiled)
@@ -2835,8 +3720,6 @@ namespace bgfx
 			return bx::kExitSuccess;
 		}
 
-		bx::remove(outFilePath);
-
 		bx::printf("Failed to build shader.\n");
 		return bx::kExitFailure;
 	}
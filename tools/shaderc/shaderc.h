@@ -88,6 +88,7 @@ namespace bgfx
 
 		std::string	inputFilePath;
 		std::string	outputFilePath;
+		std::string	cacheDir;
 
 		std::vector<std::string> includeDirs;
 		std::vector<std::string> defines;
@@ -107,6 +108,7 @@ namespace bgfx
 		bool backwardsCompatibility;
 		bool warningsAreErrors;
 		bool keepIntermediate;
+		bool uniformBuffer;
 
 		bool optimize;
 		uint32_t optimizationLevel;
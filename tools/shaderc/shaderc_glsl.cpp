@@ -5,9 +5,14 @@
 
 #include "shaderc.h"
 #include "glsl_optimizer.h"
+#include <bx/mutex.h>
 
 namespace bgfx { namespace glsl
 {
+	// glsl-optimizer type tables are process global and released by
+	// glslopt_cleanup, compile one shader at the time when in batch mode.
+	static bx::Mutex s_mutex;
+
 	static bool compile(const Options& _options, uint32_t _version, const std::string& _code, bx::WriterI* _writer)
 	{
 		char ch = _options.shaderType;
@@ -384,6 +389,7 @@ namespace bgfx { namespace glsl
 
 	bool compileGLSLShader(const Options& _options, uint32_t _version, const std::string& _code, bx::WriterI* _writer)
 	{
+		bx::MutexScope scope(glsl::s_mutex);
 		return glsl::compile(_options, _version, _code, _writer);
 	}
 
@@ -17,6 +17,7 @@
 #include <d3dcompiler.h>
 #include <d3d11shader.h>
 #include <bx/os.h>
+#include <bx/mutex.h>
 
 #ifndef D3D_SVF_USED
 #	define D3D_SVF_USED 2
@@ -79,6 +80,7 @@ namespace bgfx { namespace hlsl
 
 	static const D3DCompiler* s_compiler;
 	static void* s_d3dcompilerdll;
+	static bx::Mutex s_mutex;
 
 	const D3DCompiler* load()
 	{
@@ -830,6 +832,8 @@ namespace bgfx { namespace hlsl
 
 	bool compileHLSLShader(const Options& _options, uint32_t _version, const std::string& _code, bx::WriterI* _writer)
 	{
+		// D3DCompiler DLL is loaded and unloaded per shader through globals.
+		bx::MutexScope scope(hlsl::s_mutex);
 		return hlsl::compile(_options, _version, _code, _writer, true);
 	}
 
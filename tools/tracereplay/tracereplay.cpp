@@ -0,0 +1,184 @@
+/*
+ * Copyright 2011-2022 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include <bx/commandline.h>
+#include <bx/string.h>
+#include <bgfx/bgfx.h>
+#include <bgfx/platform.h>
+
+#define BGFX_TRACEREPLAY_VERSION_MAJOR 1
+#define BGFX_TRACEREPLAY_VERSION_MINOR 0
+
+struct RendererTypeRemap
+{
+	bx::StringView name;
+	bgfx::RendererType::Enum type;
+};
+
+static const RendererTypeRemap s_rendererTypeRemap[] =
+{
+	{ "d3d11", bgfx::RendererType::Direct3D11 },
+	{ "d3d12", bgfx::RendererType::Direct3D12 },
+	{ "d3d9",  bgfx::RendererType::Direct3D9  },
+	{ "gl",    bgfx::RendererType::OpenGL     },
+	{ "mtl",   bgfx::RendererType::Metal      },
+	{ "noop",  bgfx::RendererType::Noop       },
+	{ "vk",    bgfx::RendererType::Vulkan     },
+};
+
+void help(const char* _error = NULL)
+{
+	if (NULL != _error)
+	{
+		bx::printf("Error:\n%s\n\n", _error);
+	}
+
+	bx::printf(
+		  "tracereplay, bgfx trace replay tool, version %d.%d.%d.\n"
+		  "Copyright 2011-2022 Branimir Karadzic. All rights reserved.\n"
+		  "License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE\n\n"
+		, BGFX_TRACEREPLAY_VERSION_MAJOR
+		, BGFX_TRACEREPLAY_VERSION_MINOR
+		, BGFX_API_VERSION
+		);
+
+	bx::printf(
+		  "Usage: tracereplay -f <in> [--type <renderer>]\n"
+
+		  "\n"
+		  "Replays trace captured with BGFX_CONFIG_RENDERER_CAPTURE=1 without window.\n"
+
+		  "\n"
+		  "Options:\n"
+		  "  -h, --help               Help.\n"
+		  "  -v, --version            Version information only.\n"
+		  "  -f <file path>           Input trace file path.\n"
+		  "  -n, --loops <num>        Number of times trace is replayed (default 1).\n"
+		  "  -t, --type <renderer>    Renderer type: d3d9, d3d11, d3d12, gl, mtl, noop, vk.\n"
+		  "      --width <num>        Back buffer width (default 1280).\n"
+		  "      --height <num>       Back buffer height (default 720).\n"
+
+		  "\n"
+		  "For additional information, see https://github.com/bkaradzic/bgfx\n"
+		);
+}
+
+static double toMs(int64_t _time, int64_t _freq)
+{
+	return 0 != _freq ? double(_time)*1000.0/double(_freq) : 0.0;
+}
+
+int main(int _argc, const char* _argv[])
+{
+	bx::CommandLine cmdLine(_argc, _argv);
+
+	if (cmdLine.hasArg('v', "version") )
+	{
+		bx::printf(
+			"tracereplay, bgfx trace replay tool, version %d.%d.%d.\n"
+			, BGFX_TRACEREPLAY_VERSION_MAJOR
+			, BGFX_TRACEREPLAY_VERSION_MINOR
+			, BGFX_API_VERSION
+			);
+		return bx::kExitSuccess;
+	}
+
+	if (cmdLine.hasArg('h', "help") )
+	{
+		help();
+		return bx::kExitFailure;
+	}
+
+	const char* filePath = cmdLine.findOption('f');
+	if (NULL == filePath)
+	{
+		help("Input file name must be specified.");
+		return bx::kExitFailure;
+	}
+
+	bgfx::RendererType::Enum type = bgfx::RendererType::Count;
+
+	const char* typeArg = cmdLine.findOption('t', "type");
+	if (NULL != typeArg)
+	{
+		for (uint32_t ii = 0; ii < BX_COUNTOF(s_rendererTypeRemap); ++ii)
+		{
+			if (0 == bx::strCmpI(typeArg, s_rendererTypeRemap[ii].name) )
+			{
+				type = s_rendererTypeRemap[ii].type;
+				break;
+			}
+		}
+
+		if (bgfx::RendererType::Count == type)
+		{
+			help("Invalid renderer type.");
+			return bx::kExitFailure;
+		}
+	}
+
+	uint32_t numLoops = 1;
+	cmdLine.hasArg(numLoops, 'n', "loops");
+	numLoops = bx::max<uint32_t>(numLoops, 1);
+
+	uint32_t width  = 1280;
+	uint32_t height = 720;
+	cmdLine.hasArg(width,  '\0', "width");
+	cmdLine.hasArg(height, '\0', "height");
+
+	// Calling renderFrame before init makes bgfx single threaded, which is required by replay.
+	bgfx::renderFrame();
+
+	bgfx::Init init;
+	init.type              = type;
+	init.resolution.width  = width;
+	init.resolution.height = height;
+	init.resolution.reset  = BGFX_RESET_NONE;
+
+	if (!bgfx::init(init) )
+	{
+		bx::printf("Failed to initialize renderer.\n");
+		return bx::kExitFailure;
+	}
+
+	const bgfx::RendererType::Enum rendererType = bgfx::getRendererType();
+
+	// There is no window, back buffer is replaced with offscreen frame buffer.
+	bgfx::FrameBufferHandle backBuffer = bgfx::createFrameBuffer(
+		  uint16_t(width)
+		, uint16_t(height)
+		, bgfx::TextureFormat::BGRA8
+		);
+	bgfx::frame();
+
+	bgfx::ReplayStats stats;
+	const bool ok = bgfx::replayTrace(filePath, numLoops, backBuffer, &stats);
+
+	bgfx::destroy(backBuffer);
+	bgfx::frame();
+	bgfx::shutdown();
+
+	if (!ok)
+	{
+		bx::printf("Failed to replay trace \"%s\".\n", filePath);
+		return bx::kExitFailure;
+	}
+
+	const uint32_t numFrames = bx::max<uint32_t>(stats.numFrames, 1);
+
+	bx::printf("Renderer: %s\n", bgfx::getRendererName(rendererType) );
+	bx::printf("Loops:    %d\n", stats.numLoops);
+	bx::printf("Frames:   %d\n", stats.numFrames);
+	bx::printf("Commands: %d\n", stats.numCommands);
+	bx::printf("Submit:   %.3f ms avg, %.3f ms min, %.3f ms max\n"
+		, toMs(stats.submitTime, stats.timerFreq)/numFrames
+		, toMs(stats.submitTimeMin, stats.timerFreq)
+		, toMs(stats.submitTimeMax, stats.timerFreq)
+		);
+	bx::printf("Flip:     %.3f ms avg\n", toMs(stats.flipTime, stats.timerFreq)/numFrames);
+	bx::printf("Total:    %.3f ms\n", toMs(stats.totalTime, stats.timerFreq) );
+
+	return bx::kExitSuccess;
+}